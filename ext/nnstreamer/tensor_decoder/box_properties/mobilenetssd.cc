@@ -122,22 +122,24 @@ class MobilenetSSD : public BoxProperties
     detinput, config, results, i_width, i_height, max_detection)                                             \
   case typename:                                                                                             \
     {                                                                                                        \
-      int d;                                                                                                 \
       _type *boxinput_ = (_type *) boxinput;                                                                 \
       size_t boxbpi = config->info.info[0].dimension[0];                                                     \
       _type *detinput_ = (_type *) detinput;                                                                 \
       size_t detbpi = config->info.info[1].dimension[0];                                                     \
       int num = (DETECTION_MAX > max_detection) ? max_detection : DETECTION_MAX;                             \
-      detectedObject object = {                                                                              \
-        .valid = FALSE, .class_id = 0, .x = 0, .y = 0, .width = 0, .height = 0, .prob = .0, .tracking_id = 0 \
-      };                                                                                                     \
-      for (d = 0; d < num; d++) {                                                                            \
-        _get_object_i_mobilenet_ssd (d, detbpi, boxprior, (boxinput_ + (d * boxbpi)),                        \
-            (detinput_ + (d * detbpi)), (&object), i_width, i_height);                                       \
-        if (object.valid == TRUE) {                                                                          \
-          g_array_append_val (results, object);                                                              \
+      find_objects_parallel (results, num, [&] (guint start, guint end, GArray *out) {                       \
+        guint d;                                                                                             \
+        detectedObject object = {                                                                            \
+          .valid = FALSE, .class_id = 0, .x = 0, .y = 0, .width = 0, .height = 0, .prob = .0, .tracking_id = 0 \
+        };                                                                                                   \
+        for (d = start; d < end; d++) {                                                                      \
+          _get_object_i_mobilenet_ssd (d, detbpi, boxprior, (boxinput_ + (d * boxbpi)),                      \
+              (detinput_ + (d * detbpi)), (&object), i_width, i_height);                                     \
+          if (object.valid == TRUE) {                                                                        \
+            g_array_append_val (out, object);                                                                \
+          }                                                                                                  \
         }                                                                                                    \
-      }                                                                                                      \
+      });                                                                                                    \
     }                                                                                                        \
     break
 
@@ -400,7 +402,7 @@ MobilenetSSD::decode (const GstTensorsConfig *config, const GstTensorMemory *inp
     default:
       g_assert (0);
   }
-  nms (results, params[IOU_THRESHOLD_IDX]);
+  nms (results, params[IOU_THRESHOLD_IDX], FALSE);
   return results;
 }
 
@@ -357,7 +357,7 @@ MpPalmDetection::decode (const GstTensorsConfig *config, const GstTensorMemory *
     default:
       g_assert (0);
   }
-  nms (results, 0.05f);
+  nms (results, 0.05f, FALSE);
   return results;
 }
 
@@ -39,6 +39,8 @@ class YoloV5 : public BoxProperties
   int scaled_output;
   gfloat conf_threshold;
   gfloat iou_threshold;
+  /* From option3, whether NMS is applied for each class or not */
+  gboolean per_class_nms;
 };
 
 /**
@@ -58,6 +60,8 @@ class YoloV8 : public BoxProperties
   int scaled_output;
   gfloat conf_threshold;
   gfloat iou_threshold;
+  /* From option3, whether NMS is applied for each class or not */
+  gboolean per_class_nms;
 };
 
 static BoxProperties *yolo5 = nullptr;
@@ -81,6 +85,7 @@ YoloV5::YoloV5 ()
   scaled_output = 0;
   conf_threshold = YOLO_DETECTION_CONF_THRESHOLD;
   iou_threshold = YOLO_DETECTION_IOU_THRESHOLD;
+  per_class_nms = FALSE;
   name = g_strdup_printf ("yolov5");
 }
 
@@ -107,9 +112,11 @@ YoloV5::setOptionInternal (const char *param)
     conf_threshold = (gfloat) g_ascii_strtod (options[1], NULL);
   if (noptions > 2)
     iou_threshold = (gfloat) g_ascii_strtod (options[2], NULL);
+  if (noptions > 3)
+    per_class_nms = (g_ascii_strtoll (options[3], NULL, 10) != 0);
 
-  nns_logi ("Setting YOLOV5/YOLOV8 decoder as scaled_output: %d, conf_threshold: %.2f, iou_threshold: %.2f",
-      scaled_output, conf_threshold, iou_threshold);
+  nns_logi ("Setting YOLOV5/YOLOV8 decoder as scaled_output: %d, conf_threshold: %.2f, iou_threshold: %.2f, per_class_nms: %d",
+      scaled_output, conf_threshold, iou_threshold, per_class_nms);
 
   g_strfreev (options);
   return TRUE;
@@ -148,8 +155,8 @@ YoloV5::decode (const GstTensorsConfig *config, const GstTensorMemory *input)
 {
   GArray *results = NULL;
 
-  int bIdx, numTotalBox;
-  int cIdx, numTotalClass, cStartIdx, cIdxMax;
+  int numTotalBox;
+  int numTotalClass, cStartIdx, cIdxMax;
   float *boxinput;
   int is_output_scaled = scaled_output;
 
@@ -165,45 +172,52 @@ YoloV5::decode (const GstTensorsConfig *config, const GstTensorMemory *input)
   g_assert (config->info.info[0].type == _NNS_FLOAT32);
 
   results = g_array_sized_new (FALSE, TRUE, sizeof (detectedObject), numTotalBox);
-  for (bIdx = 0; bIdx < numTotalBox; ++bIdx) {
-    float maxClassConfVal = -INFINITY;
-    int maxClassIdx = -1;
-    for (cIdx = cStartIdx; cIdx < cIdxMax; ++cIdx) {
-      if (boxinput[bIdx * cIdxMax + cIdx] > maxClassConfVal) {
-        maxClassConfVal = boxinput[bIdx * cIdxMax + cIdx];
-        maxClassIdx = cIdx;
-      }
-    }
 
-    if (maxClassConfVal * boxinput[bIdx * cIdxMax + 4] > conf_threshold) {
-      detectedObject object;
-      float cx, cy, w, h;
-      cx = boxinput[bIdx * cIdxMax + 0];
-      cy = boxinput[bIdx * cIdxMax + 1];
-      w = boxinput[bIdx * cIdxMax + 2];
-      h = boxinput[bIdx * cIdxMax + 3];
-
-      if (!is_output_scaled) {
-        cx *= (float) i_width;
-        cy *= (float) i_height;
-        w *= (float) i_width;
-        h *= (float) i_height;
+  /* Find the candidates in parallel if there are many boxes (e.g., 8400 boxes of 640x640 input) */
+  find_objects_parallel (results, numTotalBox, [&] (guint start, guint end, GArray *out) {
+    guint bIdx;
+    int cIdx;
+
+    for (bIdx = start; bIdx < end; ++bIdx) {
+      float maxClassConfVal = -INFINITY;
+      int maxClassIdx = -1;
+      for (cIdx = cStartIdx; cIdx < cIdxMax; ++cIdx) {
+        if (boxinput[bIdx * cIdxMax + cIdx] > maxClassConfVal) {
+          maxClassConfVal = boxinput[bIdx * cIdxMax + cIdx];
+          maxClassIdx = cIdx;
+        }
       }
 
-      object.x = (int) (MAX (0.f, (cx - w / 2.f)));
-      object.y = (int) (MAX (0.f, (cy - h / 2.f)));
-      object.width = (int) (MIN ((float) i_width, w));
-      object.height = (int) (MIN ((float) i_height, h));
-
-      object.prob = maxClassConfVal * boxinput[bIdx * cIdxMax + 4];
-      object.class_id = maxClassIdx - DEFAULT_DETECTION_NUM_INFO_YOLO5;
-      object.tracking_id = 0;
-      object.valid = TRUE;
-      g_array_append_val (results, object);
+      if (maxClassConfVal * boxinput[bIdx * cIdxMax + 4] > conf_threshold) {
+        detectedObject object;
+        float cx, cy, w, h;
+        cx = boxinput[bIdx * cIdxMax + 0];
+        cy = boxinput[bIdx * cIdxMax + 1];
+        w = boxinput[bIdx * cIdxMax + 2];
+        h = boxinput[bIdx * cIdxMax + 3];
+
+        if (!is_output_scaled) {
+          cx *= (float) i_width;
+          cy *= (float) i_height;
+          w *= (float) i_width;
+          h *= (float) i_height;
+        }
+
+        object.x = (int) (MAX (0.f, (cx - w / 2.f)));
+        object.y = (int) (MAX (0.f, (cy - h / 2.f)));
+        object.width = (int) (MIN ((float) i_width, w));
+        object.height = (int) (MIN ((float) i_height, h));
+
+        object.prob = maxClassConfVal * boxinput[bIdx * cIdxMax + 4];
+        object.class_id = maxClassIdx - DEFAULT_DETECTION_NUM_INFO_YOLO5;
+        object.tracking_id = 0;
+        object.valid = TRUE;
+        g_array_append_val (out, object);
+      }
     }
-  }
+  });
 
-  nms (results, iou_threshold);
+  nms (results, iou_threshold, per_class_nms);
   return results;
 }
 
@@ -213,6 +227,7 @@ YoloV8::YoloV8 ()
   scaled_output = 0;
   conf_threshold = YOLO_DETECTION_CONF_THRESHOLD;
   iou_threshold = YOLO_DETECTION_IOU_THRESHOLD;
+  per_class_nms = FALSE;
   name = g_strdup_printf ("yolov8");
 }
 
@@ -237,9 +252,11 @@ YoloV8::setOptionInternal (const char *param)
     conf_threshold = (gfloat) g_ascii_strtod (options[1], NULL);
   if (noptions > 2)
     iou_threshold = (gfloat) g_ascii_strtod (options[2], NULL);
+  if (noptions > 3)
+    per_class_nms = (g_ascii_strtoll (options[3], NULL, 10) != 0);
 
-  nns_logi ("Setting YOLOV5/YOLOV8 decoder as scaled_output: %d, conf_threshold: %.2f, iou_threshold: %.2f",
-      scaled_output, conf_threshold, iou_threshold);
+  nns_logi ("Setting YOLOV5/YOLOV8 decoder as scaled_output: %d, conf_threshold: %.2f, iou_threshold: %.2f, per_class_nms: %d",
+      scaled_output, conf_threshold, iou_threshold, per_class_nms);
 
   g_strfreev (options);
   return TRUE;
@@ -296,8 +313,8 @@ GArray *
 YoloV8::decode (const GstTensorsConfig *config, const GstTensorMemory *input)
 {
   GArray *results = NULL;
-  int bIdx, numTotalBox;
-  int cIdx, numTotalClass, cStartIdx, cIdxMax;
+  int numTotalBox;
+  int numTotalClass, cStartIdx, cIdxMax;
   float *boxinput;
   int is_output_scaled = scaled_output;
   UNUSED (config);
@@ -311,45 +328,52 @@ YoloV8::decode (const GstTensorsConfig *config, const GstTensorMemory *input)
   boxinput = (float *) input[0].data;
 
   results = g_array_sized_new (FALSE, TRUE, sizeof (detectedObject), numTotalBox);
-  for (bIdx = 0; bIdx < numTotalBox; ++bIdx) {
-    float maxClassConfVal = -INFINITY;
-    int maxClassIdx = -1;
-    for (cIdx = cStartIdx; cIdx < cIdxMax; ++cIdx) {
-      if (boxinput[bIdx * cIdxMax + cIdx] > maxClassConfVal) {
-        maxClassConfVal = boxinput[bIdx * cIdxMax + cIdx];
-        maxClassIdx = cIdx;
-      }
-    }
 
-    if (maxClassConfVal > conf_threshold) {
-      detectedObject object;
-      float cx, cy, w, h;
-      cx = boxinput[bIdx * cIdxMax + 0];
-      cy = boxinput[bIdx * cIdxMax + 1];
-      w = boxinput[bIdx * cIdxMax + 2];
-      h = boxinput[bIdx * cIdxMax + 3];
-
-      if (!is_output_scaled) {
-        cx *= (float) i_width;
-        cy *= (float) i_height;
-        w *= (float) i_width;
-        h *= (float) i_height;
+  /* Find the candidates in parallel if there are many boxes (e.g., 8400 boxes of 640x640 input) */
+  find_objects_parallel (results, numTotalBox, [&] (guint start, guint end, GArray *out) {
+    guint bIdx;
+    int cIdx;
+
+    for (bIdx = start; bIdx < end; ++bIdx) {
+      float maxClassConfVal = -INFINITY;
+      int maxClassIdx = -1;
+      for (cIdx = cStartIdx; cIdx < cIdxMax; ++cIdx) {
+        if (boxinput[bIdx * cIdxMax + cIdx] > maxClassConfVal) {
+          maxClassConfVal = boxinput[bIdx * cIdxMax + cIdx];
+          maxClassIdx = cIdx;
+        }
       }
 
-      object.x = (int) (MAX (0.f, (cx - w / 2.f)));
-      object.y = (int) (MAX (0.f, (cy - h / 2.f)));
-      object.width = (int) (MIN ((float) i_width, w));
-      object.height = (int) (MIN ((float) i_height, h));
-
-      object.prob = maxClassConfVal;
-      object.class_id = maxClassIdx - DEFAULT_DETECTION_NUM_INFO_YOLO8;
-      object.tracking_id = 0;
-      object.valid = TRUE;
-      g_array_append_val (results, object);
+      if (maxClassConfVal > conf_threshold) {
+        detectedObject object;
+        float cx, cy, w, h;
+        cx = boxinput[bIdx * cIdxMax + 0];
+        cy = boxinput[bIdx * cIdxMax + 1];
+        w = boxinput[bIdx * cIdxMax + 2];
+        h = boxinput[bIdx * cIdxMax + 3];
+
+        if (!is_output_scaled) {
+          cx *= (float) i_width;
+          cy *= (float) i_height;
+          w *= (float) i_width;
+          h *= (float) i_height;
+        }
+
+        object.x = (int) (MAX (0.f, (cx - w / 2.f)));
+        object.y = (int) (MAX (0.f, (cy - h / 2.f)));
+        object.width = (int) (MIN ((float) i_width, w));
+        object.height = (int) (MIN ((float) i_height, h));
+
+        object.prob = maxClassConfVal;
+        object.class_id = maxClassIdx - DEFAULT_DETECTION_NUM_INFO_YOLO8;
+        object.tracking_id = 0;
+        object.valid = TRUE;
+        g_array_append_val (out, object);
+      }
     }
-  }
+  });
 
-  nms (results, iou_threshold);
+  nms (results, iou_threshold, per_class_nms);
   return results;
 }
 
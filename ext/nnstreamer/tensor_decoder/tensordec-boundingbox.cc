@@ -40,6 +40,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <vector>
 #include "tensordec-boundingbox.h"
 
 #ifdef __cplusplus
@@ -56,6 +58,14 @@ void fini_bb (void) __attribute__ ((destructor));
  */
 G_LOCK_DEFINE_STATIC (box_properties_table);
 
+/**
+ * @brief Thread pool to decode the candidate boxes, shared by the decoder instances.
+ * @details The pool is created with the first decoder instance and freed with the last one, so that the threads are not created for each frame.
+ */
+static GThreadPool *decode_pool = NULL;
+static guint decode_pool_refcount = 0;
+G_LOCK_DEFINE_STATIC (decode_pool);
+
 /* font.c */
 extern uint8_t rasters[][13];
 
@@ -99,6 +109,84 @@ updateDecodingMode (const char *param)
   return param;
 }
 
+/**
+ * @brief Data structure to wait for the chunks of the candidate boxes decoded by the thread pool.
+ */
+typedef struct {
+  const std::function<void (guint start, guint end, GArray *out)> *func;
+  GMutex lock;
+  GCond cond;
+  guint remaining; /**< The number of chunks not decoded yet */
+} decodeJob;
+
+/**
+ * @brief A chunk of the candidate boxes [start, end) to be decoded by the thread pool.
+ */
+typedef struct {
+  decodeJob *job;
+  guint start;
+  guint end;
+  GArray *out; /**< The objects found in this chunk */
+} decodeTask;
+
+/**
+ * @brief Thread pool function to decode a chunk of the candidate boxes.
+ */
+static void
+decode_pool_func (gpointer data, gpointer user_data)
+{
+  decodeTask *task = (decodeTask *) data;
+  decodeJob *job = task->job;
+  UNUSED (user_data);
+
+  (*job->func) (task->start, task->end, task->out);
+
+  g_mutex_lock (&job->lock);
+  job->remaining--;
+  g_cond_signal (&job->cond);
+  g_mutex_unlock (&job->lock);
+}
+
+/**
+ * @brief Create the thread pool to decode the boxes with the first decoder instance.
+ */
+static void
+decode_pool_ref (void)
+{
+  GError *error = NULL;
+  guint num_threads;
+
+  G_LOCK (decode_pool);
+  if (decode_pool_refcount++ == 0) {
+    /* the caller decodes a chunk, the pool has the other threads. */
+    num_threads = MIN ((guint) g_get_num_processors (), DECODE_MAX_THREADS);
+    if (num_threads > 1) {
+      decode_pool = g_thread_pool_new (decode_pool_func, NULL,
+          (gint) num_threads - 1, TRUE, &error);
+      if (decode_pool == NULL) {
+        nns_logw ("Failed to create the threads to decode boxes (%s).",
+            error ? error->message : "unknown reason");
+        g_clear_error (&error);
+      }
+    }
+  }
+  G_UNLOCK (decode_pool);
+}
+
+/**
+ * @brief Free the thread pool to decode the boxes with the last decoder instance.
+ */
+static void
+decode_pool_unref (void)
+{
+  G_LOCK (decode_pool);
+  if (--decode_pool_refcount == 0 && decode_pool) {
+    g_thread_pool_free (decode_pool, TRUE, TRUE);
+    decode_pool = NULL;
+  }
+  G_UNLOCK (decode_pool);
+}
+
 /** @brief tensordec-plugin's GstTensorDecoderDef callback */
 static int
 bb_init (void **pdata)
@@ -113,6 +201,7 @@ bb_init (void **pdata)
   }
 
   initSingleLineSprite (singleLineSprite, rasters, PIXEL_VALUE);
+  decode_pool_ref ();
 
   return TRUE;
 }
@@ -124,6 +213,8 @@ bb_exit (void **pdata)
   BoundingBox *bdata = static_cast<BoundingBox *> (*pdata);
   delete bdata;
   *pdata = NULL;
+
+  decode_pool_unref ();
 }
 
 /** @brief tensordec-plugin's GstTensorDecoderDef callback */
@@ -298,74 +389,163 @@ distance_compare (const void *a, const void *b)
 }
 
 /**
- * @brief Compare Function for g_array_sort with detectedObject.
+ * @brief Apply NMS to the given results (objects[DETECTION_MAX])
+ * @details The candidates are sorted with the probability (top-k of NMS_MAX_CANDIDATES),
+ *          the boxes are stored in SoA arrays to calculate IoU of a box with the others in a vectorizable loop,
+ *          then the remained objects are compacted in a single pass.
  */
-static gint
-compare_detection (gconstpointer _a, gconstpointer _b)
+void
+nms (GArray *results, gfloat threshold, gboolean per_class)
 {
-  const detectedObject *a = static_cast<const detectedObject *> (_a);
-  const detectedObject *b = static_cast<const detectedObject *> (_b);
+  guint boxes_size, num, i, j, kept;
+  std::vector<guint> order;
+  std::vector<gfloat> x1, y1, x2, y2, area;
+  std::vector<gint> cls;
+  std::vector<guint8> keep;
+  std::vector<detectedObject> objects;
+  detectedObject *base;
 
-  /* Larger comes first */
-  return (a->prob > b->prob) ? -1 : ((a->prob == b->prob) ? 0 : 1);
-}
+  boxes_size = results->len;
+  if (boxes_size == 0U)
+    return;
 
-/**
- * @brief Calculate the intersected surface
- */
-static gfloat
-iou (detectedObject *a, detectedObject *b)
-{
-  int x1 = MAX (a->x, b->x);
-  int y1 = MAX (a->y, b->y);
-  int x2 = MIN (a->x + a->width, b->x + b->width);
-  int y2 = MIN (a->y + a->height, b->y + b->height);
-  int w = MAX (0, (x2 - x1 + 1));
-  int h = MAX (0, (y2 - y1 + 1));
-  float inter = w * h;
-  float areaA = a->width * a->height;
-  float areaB = b->width * b->height;
-  float o = inter / (areaA + areaB - inter);
-  return (o >= 0) ? o : 0;
+  base = (detectedObject *) results->data;
+
+  /* Larger comes first, the index is compared to keep the order of same probability (stable sort). */
+  auto compare = [base] (guint a, guint b) {
+    if (base[a].prob != base[b].prob)
+      return base[a].prob > base[b].prob;
+    return a < b;
+  };
+
+  order.resize (boxes_size);
+  for (i = 0; i < boxes_size; i++)
+    order[i] = i;
+
+  num = MIN (boxes_size, NMS_MAX_CANDIDATES);
+  if (num < boxes_size) {
+    nns_logw ("Too many candidates for NMS (%u), only %u candidates with higher probability are used.",
+        boxes_size, num);
+    std::partial_sort (order.begin (), order.begin () + num, order.end (), compare);
+  } else
+    std::sort (order.begin (), order.end (), compare);
+
+  x1.resize (num);
+  y1.resize (num);
+  x2.resize (num);
+  y2.resize (num);
+  area.resize (num);
+  cls.resize (num);
+  keep.resize (num);
+
+  for (i = 0; i < num; i++) {
+    const detectedObject *o = &base[order[i]];
+
+    x1[i] = (gfloat) o->x;
+    y1[i] = (gfloat) o->y;
+    x2[i] = (gfloat) (o->x + o->width);
+    y2[i] = (gfloat) (o->y + o->height);
+    area[i] = (gfloat) (o->width * o->height);
+    cls[i] = per_class ? o->class_id : 0;
+    keep[i] = (o->valid == TRUE);
+  }
+
+  for (i = 0; i < num; i++) {
+    const gfloat ax1 = x1[i], ay1 = y1[i], ax2 = x2[i], ay2 = y2[i];
+    const gfloat aarea = area[i];
+    const gint acls = cls[i];
+
+    if (!keep[i])
+      continue;
+
+    /* No branch in the loop, so that the compiler can vectorize it. */
+    for (j = i + 1; j < num; j++) {
+      gfloat w = MAX (0.f, MIN (ax2, x2[j]) - MAX (ax1, x1[j]) + 1.f);
+      gfloat h = MAX (0.f, MIN (ay2, y2[j]) - MAX (ay1, y1[j]) + 1.f);
+      gfloat inter = w * h;
+      gfloat o = inter / (aarea + area[j] - inter);
+
+      o = (o >= 0.f) ? o : 0.f;
+      keep[j] &= (guint8) !((o > threshold) & (cls[j] == acls));
+    }
+  }
+
+  objects.reserve (num);
+  for (i = 0; i < num; i++) {
+    if (keep[i])
+      objects.push_back (base[order[i]]);
+  }
+
+  kept = objects.size ();
+  if (kept > 0)
+    memcpy (results->data, objects.data (), kept * sizeof (detectedObject));
+  g_array_set_size (results, kept);
 }
 
 /**
- * @brief Apply NMS to the given results (objects[DETECTION_MAX])
+ * @brief Find the objects from the candidate boxes, using the thread pool of the decoder if there are many boxes.
  */
 void
-nms (GArray *results, gfloat threshold)
+find_objects_parallel (GArray *results, guint num_boxes,
+    const std::function<void (guint start, guint end, GArray *out)> &func)
 {
-  guint boxes_size;
-  guint i, j;
+  guint num_threads, chunk, t;
+  std::vector<decodeTask> tasks;
+  decodeJob job;
 
-  boxes_size = results->len;
-  if (boxes_size == 0U)
+  num_threads = num_boxes / DECODE_MIN_BOXES_PER_THREAD;
+  if (decode_pool)
+    num_threads = MIN (num_threads, (guint) g_thread_pool_get_max_threads (decode_pool) + 1);
+
+  if (decode_pool == NULL || num_threads <= 1) {
+    func (0, num_boxes, results);
     return;
+  }
 
-  g_array_sort (results, compare_detection);
+  chunk = (num_boxes + num_threads - 1) / num_threads;
+  tasks.resize (num_threads);
 
-  for (i = 0; i < boxes_size; i++) {
-    detectedObject *a = &g_array_index (results, detectedObject, i);
-    if (a->valid == TRUE) {
-      for (j = i + 1; j < boxes_size; j++) {
-        detectedObject *b = &g_array_index (results, detectedObject, j);
-        if (b->valid == TRUE) {
-          if (iou (a, b) > threshold) {
-            b->valid = FALSE;
-          }
-        }
-      }
+  job.func = &func;
+  job.remaining = 0;
+  g_mutex_init (&job.lock);
+  g_cond_init (&job.cond);
+
+  for (t = 1; t < num_threads; t++) {
+    tasks[t].job = &job;
+    tasks[t].start = t * chunk;
+    tasks[t].end = MIN (tasks[t].start + chunk, num_boxes);
+    tasks[t].out = NULL;
+
+    if (tasks[t].start >= tasks[t].end)
+      break;
+
+    tasks[t].out = g_array_sized_new (FALSE, TRUE, sizeof (detectedObject), 64);
+
+    g_mutex_lock (&job.lock);
+    job.remaining++;
+    g_mutex_unlock (&job.lock);
+
+    g_thread_pool_push (decode_pool, &tasks[t], NULL);
+  }
+
+  /* The first chunk in this thread, appended to the results directly. */
+  func (0, MIN (chunk, num_boxes), results);
+
+  g_mutex_lock (&job.lock);
+  while (job.remaining > 0)
+    g_cond_wait (&job.cond, &job.lock);
+  g_mutex_unlock (&job.lock);
+
+  /* Append in the order of the boxes, the results are same as the sequential decoding. */
+  for (t = 1; t < num_threads; t++) {
+    if (tasks[t].out) {
+      g_array_append_vals (results, tasks[t].out->data, tasks[t].out->len);
+      g_array_free (tasks[t].out, TRUE);
     }
   }
 
-  i = 0;
-  do {
-    detectedObject *a = &g_array_index (results, detectedObject, i);
-    if (a->valid == FALSE)
-      g_array_remove_index (results, i);
-    else
-      i++;
-  } while (i < results->len);
+  g_mutex_clear (&job.lock);
+  g_cond_clear (&job.cond);
 }
 
 /**
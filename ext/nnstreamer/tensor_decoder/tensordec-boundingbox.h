@@ -39,12 +39,14 @@
  * option3: Any option1-dependent values
  *          !!This depends on option1 values!!
  *          for yolov5 and yolov8 mode:
- *            The option3 requires up to 3 numbers, which tell
+ *            The option3 requires up to 4 numbers, which tell
  *              - whether the output values are scaled or not
  *                0: not scaled (default), 1: scaled (e.g., 0.0 ~ 1.0)
  *              - the threshold of confidence (optional, default set to 0.25)
  *              - the threshold of IOU (optional, default set to 0.45)
- *            An example of option3 is "option3=0:0.65:0.6"
+ *              - whether NMS is applied for each class or not
+ *                0: all classes together (default), 1: each class
+ *            An example of option3 is "option3=0:0.65:0.6" or "option3=0:0.65:0.6:1"
  *          for mobilenet-ssd mode:
  *            The option3 definition scheme is, in order, the following:
  *                - box priors location file (mandatory)
@@ -107,6 +109,7 @@
 #define _TENSORDECBB_H__
 #include <gst/gst.h>
 #include <math.h> /* expf */
+#include <functional>
 #include <nnstreamer_log.h>
 #include <nnstreamer_util.h>
 #include "tensordecutil.h"
@@ -193,11 +196,35 @@ typedef struct {
 } detectedObject;
 
 
+/**
+ * @brief The max number of candidates for NMS, the candidates with higher probability are used.
+ */
+#define NMS_MAX_CANDIDATES (30000U)
+
+/**
+ * @brief The min number of boxes to be decoded in a thread, and the max number of threads.
+ * @details The boxes are decoded in parallel if there are many anchors (e.g., 8400 boxes of yolov8 with 640x640 input, or 1917 boxes of mobilenet-ssd).
+ */
+#define DECODE_MIN_BOXES_PER_THREAD (512U)
+#define DECODE_MAX_THREADS (8U)
+
 /**
  * @brief Apply NMS to the given results (objects[DETECTION_MAX])
  * @param[in/out] results The results to be filtered with nms
+ * @param[in] threshold The threshold of IoU to suppress the box
+ * @param[in] per_class TRUE to suppress the boxes of the same class only
+ */
+void nms (GArray *results, gfloat threshold, gboolean per_class);
+
+/**
+ * @brief Find the objects from the candidate boxes, using the thread pool of the decoder if there are many boxes.
+ * @param[in/out] results The array of detectedObject to append the objects found
+ * @param[in] num_boxes The number of candidate boxes
+ * @param[in] func The function to find the objects from the boxes [start, end) and append to out
+ * @note The objects are appended in the order of the boxes regardless of the number of threads.
  */
-void nms (GArray *results, gfloat threshold);
+void find_objects_parallel (GArray *results, guint num_boxes,
+    const std::function<void (guint start, guint end, GArray *out)> &func);
 
 /**
  * @brief check the num_tensors is valid
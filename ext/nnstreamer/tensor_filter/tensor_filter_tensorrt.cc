@@ -105,7 +105,8 @@ class tensorrt_subplugin final : public tensor_filter_subplugin
   static tensorrt_subplugin *registeredRepresentation;
 
   gchar *_uff_path; /**< UFF file path to infer */
-  void *_inputBuffer; /**< Input Cuda buffer */
+  void *_inputBuffer; /**< Input Cuda buffer, upstream may write the input into it */
+  void *_stageBuffer; /**< Input Cuda buffer to copy the input which is not written into _inputBuffer */
 
   GstTensorsInfo _inputTensorMeta;
   GstTensorsInfo _outputTensorMeta;
@@ -135,7 +136,7 @@ const accl_hw tensorrt_subplugin::hw_list[] = {};
  * @brief constructor of tensorrt_subplugin
  */
 tensorrt_subplugin::tensorrt_subplugin ()
-    : tensor_filter_subplugin (), _uff_path (nullptr), _inputBuffer (nullptr)
+    : tensor_filter_subplugin (), _uff_path (nullptr), _inputBuffer (nullptr), _stageBuffer (nullptr)
 {
   gst_tensors_info_init (&_inputTensorMeta);
   gst_tensors_info_init (&_outputTensorMeta);
@@ -152,6 +153,9 @@ tensorrt_subplugin::~tensorrt_subplugin ()
   if (_inputBuffer != nullptr)
     cudaFree (_inputBuffer);
 
+  if (_stageBuffer != nullptr)
+    cudaFree (_stageBuffer);
+
   if (_uff_path != nullptr)
     g_free (_uff_path);
 }
@@ -214,16 +218,21 @@ tensorrt_subplugin::configure_instance (const GstTensorFilterProperties *prop)
 void
 tensorrt_subplugin::invoke (const GstTensorMemory *input, GstTensorMemory *output)
 {
-  /* If internal _inputBuffer is nullptr, tne allocate GPU memory */
-  if (!_inputBuffer) {
-    if (allocBuffer (&_inputBuffer, input->size) != 0) {
+  void *inputBuffer = _inputBuffer;
+
+  /**
+   * Upstream may write the input into _inputBuffer directly, then skip copying the input.
+   * Otherwise, upstream may be writing the next frame into _inputBuffer, copy the input into another Cuda buffer.
+   */
+  if (input->data != _inputBuffer) {
+    if (!_stageBuffer && allocBuffer (&_stageBuffer, input->size) != 0) {
       ml_loge ("Failed to allocate GPU memory for input");
       throw std::runtime_error ("Failed to allocate GPU memory for input");
     }
-  }
 
-  /* Copy input data to Cuda memory space */
-  memcpy (_inputBuffer, input->data, input->size);
+    memcpy (_stageBuffer, input->data, input->size);
+    inputBuffer = _stageBuffer;
+  }
 
   /* Allocate output buffer */
   if (allocBuffer (&output->data, output->size) != 0) {
@@ -232,7 +241,7 @@ tensorrt_subplugin::invoke (const GstTensorMemory *input, GstTensorMemory *outpu
   }
 
   /* Bind the input and execute the network */
-  std::vector<void *> bindings = { _inputBuffer, output->data };
+  std::vector<void *> bindings = { inputBuffer, output->data };
   if (!_Context->execute (1, bindings.data ())) {
     ml_loge ("Failed to execute the network");
     throw std::runtime_error ("Failed to execute the network");
@@ -255,6 +264,7 @@ tensorrt_subplugin::getFrameworkInfo (GstTensorFilterFrameworkInfo &info)
   info.verify_model_path = FALSE;
   info.hw_list = hw_list;
   info.num_hw = num_hw;
+  info.zero_copy_input = TRUE;
 }
 
 /**
@@ -275,7 +285,7 @@ tensorrt_subplugin::getModelInfo (
 }
 
 /**
- * @brief Override eventHandler to free Cuda data buffer.
+ * @brief Override eventHandler to free Cuda data buffer and provide the input Cuda buffer.
  */
 int
 tensorrt_subplugin::eventHandler (event_ops ops, GstTensorFilterFrameworkEventData &data)
@@ -284,6 +294,16 @@ tensorrt_subplugin::eventHandler (event_ops ops, GstTensorFilterFrameworkEventDa
     if (data.data != nullptr) {
       cudaFree (data.data);
     }
+  } else if (ops == GET_INPUT_MEMORY) {
+    gsize size = gst_tensor_info_get_size (
+        gst_tensors_info_get_nth_info (&_inputTensorMeta, 0U));
+
+    /* Unified memory is accessible from host, upstream writes the input into it. */
+    if (!_inputBuffer && allocBuffer (&_inputBuffer, size) != 0)
+      return -1;
+
+    data.input_memory[0].data = _inputBuffer;
+    data.input_memory[0].size = size;
   }
   return 0;
 }
@@ -18,7 +18,12 @@
  * gst-launch-1.0 datareposrc location=file.dat json=file.json tensors-sequence=2,3 start-sample-index=0 stop-sample-index=199 epochs=1 !  \
  * other/tensors, format=static, num_tensors=2, framerate=0/1, dimensions=1:1:784:1.1:1:10:1, types=float32.float32 ! \
  * datareposink location=hyunil.dat json=file.json
+ * gst-launch-1.0 videotestsrc ! datareposink location=filename json=video.json async-write=true buffer-size=4194304
  * ]|
+ *
+ * With 'async-write=true', the data are copied into large aligned chunks and a background thread writes the chunks,
+ * so that a slow storage does not block the render thread until the pending data exceed 'max-buffered-size'.
+ * 'direct-io=true' additionally opens the file with O_DIRECT to bypass the page cache for very large datasets.
  */
 
 #ifdef HAVE_CONFIG_H
@@ -31,6 +36,8 @@
 #include <sys/types.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <errno.h>
+#include <string.h>
 #include <nnstreamer_plugin_api.h>
 #include <tensor_common.h>
 #include <nnstreamer_util.h>
@@ -84,7 +91,33 @@ enum
 {
   PROP_0,
   PROP_LOCATION,
-  PROP_JSON
+  PROP_JSON,
+  PROP_ASYNC_WRITE,
+  PROP_BUFFER_SIZE,
+  PROP_MAX_BUFFERED_SIZE,
+  PROP_DIRECT_IO
+};
+
+#define DEFAULT_ASYNC_WRITE FALSE
+#define DEFAULT_BUFFER_SIZE (1U << 20)
+#define DEFAULT_MAX_BUFFERED_SIZE (64U << 20)
+#define DEFAULT_DIRECT_IO FALSE
+
+/**
+ * @brief Alignment of the chunk address and size (for O_DIRECT).
+ */
+#define WRITE_ALIGNMENT 4096U
+#define WRITE_ALIGN_UP(n) \
+  ((((gsize) (n)) + WRITE_ALIGNMENT - 1) & ~((gsize) WRITE_ALIGNMENT - 1))
+
+/**
+ * @brief Chunk of data to be written in the writer thread.
+ */
+struct _GstDataRepoSinkChunk
+{
+  guint8 *mem;  /**< allocated memory */
+  guint8 *data; /**< aligned address in the allocated memory */
+  gsize size;   /**< size of the filled data */
 };
 
 GST_DEBUG_CATEGORY_STATIC (gst_data_repo_sink_debug);
@@ -112,6 +145,7 @@ static gboolean gst_data_repo_sink_set_caps (GstBaseSink * bsink,
 static gboolean gst_data_repo_sink_event (GstBaseSink * bsink,
     GstEvent * event);
 static gboolean gst_data_repo_sink_query (GstBaseSink * sink, GstQuery * query);
+static void gst_data_repo_sink_stop_writer (GstDataRepoSink * sink);
 
 /**
  * @brief Initialize datareposink class.
@@ -146,6 +180,37 @@ gst_data_repo_sink_class_init (GstDataRepoSinkClass * klass)
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
           GST_PARAM_MUTABLE_READY));
 
+  g_object_class_install_property (gobject_class, PROP_ASYNC_WRITE,
+      g_param_spec_boolean ("async-write", "Async write",
+          "Copy the data into large chunks and write the chunks in a background thread",
+          DEFAULT_ASYNC_WRITE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  g_object_class_install_property (gobject_class, PROP_BUFFER_SIZE,
+      g_param_spec_uint ("buffer-size", "Buffer size",
+          "Size of a write batch in bytes with async-write, "
+          "it is rounded up to a multiple of 4096",
+          WRITE_ALIGNMENT, G_MAXINT, DEFAULT_BUFFER_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  g_object_class_install_property (gobject_class, PROP_MAX_BUFFERED_SIZE,
+      g_param_spec_uint ("max-buffered-size", "Max buffered size",
+          "Memory budget in bytes for the data not written yet with async-write, "
+          "the render thread waits for the writer when the budget is exceeded",
+          0, G_MAXUINT, DEFAULT_MAX_BUFFERED_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  g_object_class_install_property (gobject_class, PROP_DIRECT_IO,
+      g_param_spec_boolean ("direct-io", "Direct I/O",
+          "Open the file with O_DIRECT to bypass the page cache (only with async-write). "
+          "It falls back to buffered I/O if the file system does not support it",
+          DEFAULT_DIRECT_IO,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
   gst_element_class_set_static_metadata (gstelement_class,
       "NNStreamer MLOps Data Repository Sink",
       "Sink/File",
@@ -187,6 +252,21 @@ gst_data_repo_sink_init (GstDataRepoSink * sink)
   sink->sample_offset_array = json_array_new ();
   sink->tensor_size_array = json_array_new ();
   sink->tensor_count_array = json_array_new ();
+  sink->async_write = DEFAULT_ASYNC_WRITE;
+  sink->buffer_size = DEFAULT_BUFFER_SIZE;
+  sink->max_buffered_size = DEFAULT_MAX_BUFFERED_SIZE;
+  sink->direct_io = DEFAULT_DIRECT_IO;
+  sink->writer_thread = NULL;
+  g_mutex_init (&sink->writer_lock);
+  g_cond_init (&sink->writer_cond);
+  g_queue_init (&sink->write_queue);
+  g_queue_init (&sink->free_chunks);
+  sink->chunk = NULL;
+  sink->chunk_size = 0;
+  sink->buffered_size = 0;
+  sink->writer_running = FALSE;
+  sink->writer_error = FALSE;
+  sink->is_direct = FALSE;
 }
 
 /**
@@ -200,6 +280,10 @@ gst_data_repo_sink_finalize (GObject * object)
   g_free (sink->filename);
   g_free (sink->json_filename);
 
+  gst_data_repo_sink_stop_writer (sink);
+  g_mutex_clear (&sink->writer_lock);
+  g_cond_clear (&sink->writer_cond);
+
   if (sink->fd) {
     g_close (sink->fd, NULL);
     sink->fd = 0;
@@ -240,6 +324,18 @@ gst_data_repo_sink_set_property (GObject * object, guint prop_id,
       sink->json_filename = g_value_dup_string (value);
       GST_INFO_OBJECT (sink, "JSON filename: %s", sink->json_filename);
       break;
+    case PROP_ASYNC_WRITE:
+      sink->async_write = g_value_get_boolean (value);
+      break;
+    case PROP_BUFFER_SIZE:
+      sink->buffer_size = g_value_get_uint (value);
+      break;
+    case PROP_MAX_BUFFERED_SIZE:
+      sink->max_buffered_size = g_value_get_uint (value);
+      break;
+    case PROP_DIRECT_IO:
+      sink->direct_io = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -264,19 +360,283 @@ gst_data_repo_sink_get_property (GObject * object, guint prop_id,
     case PROP_JSON:
       g_value_set_string (value, sink->json_filename);
       break;
+    case PROP_ASYNC_WRITE:
+      g_value_set_boolean (value, sink->async_write);
+      break;
+    case PROP_BUFFER_SIZE:
+      g_value_set_uint (value, sink->buffer_size);
+      break;
+    case PROP_MAX_BUFFERED_SIZE:
+      g_value_set_uint (value, sink->max_buffered_size);
+      break;
+    case PROP_DIRECT_IO:
+      g_value_set_boolean (value, sink->direct_io);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
   }
 }
 
+/**
+ * @brief Write the data to the file, repeating on partial write.
+ */
+static gboolean
+gst_data_repo_sink_write_fd (gint fd, const guint8 * data, gsize size)
+{
+  gssize written;
+
+  while (size > 0) {
+    errno = 0;
+    written = write (fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR || errno == EAGAIN)
+        continue;
+      return FALSE;
+    }
+    data += written;
+    size -= written;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Write a chunk in the writer thread.
+ */
+static gboolean
+gst_data_repo_sink_write_chunk (GstDataRepoSink * sink,
+    GstDataRepoSinkChunk * chunk)
+{
+#ifdef O_DIRECT
+  /* O_DIRECT requires aligned size, the last chunk is written without it. */
+  if (sink->is_direct && (chunk->size % WRITE_ALIGNMENT) != 0) {
+    gint flags = fcntl (sink->fd, F_GETFL);
+
+    if (flags < 0 || fcntl (sink->fd, F_SETFL, flags & ~O_DIRECT) < 0)
+      return FALSE;
+    sink->is_direct = FALSE;
+  }
+#endif
+
+  return gst_data_repo_sink_write_fd (sink->fd, chunk->data, chunk->size);
+}
+
+/**
+ * @brief Writer thread, writes the queued chunks to the file.
+ */
+static gpointer
+gst_data_repo_sink_writer_thread (gpointer data)
+{
+  GstDataRepoSink *sink = GST_DATA_REPO_SINK (data);
+  GstDataRepoSinkChunk *chunk;
+  gboolean failed;
+
+  g_mutex_lock (&sink->writer_lock);
+  while (TRUE) {
+    chunk = (GstDataRepoSinkChunk *) g_queue_pop_head (&sink->write_queue);
+    if (chunk == NULL) {
+      if (!sink->writer_running)
+        break;
+
+      g_cond_wait (&sink->writer_cond, &sink->writer_lock);
+      continue;
+    }
+
+    /* drop the data after an error, render thread will post an error */
+    failed = sink->writer_error;
+    g_mutex_unlock (&sink->writer_lock);
+
+    GST_LOG_OBJECT (sink, "Writing chunk of %zd bytes", chunk->size);
+    if (!failed && !gst_data_repo_sink_write_chunk (sink, chunk)) {
+      GST_ERROR_OBJECT (sink, "Could not write data to file: %s",
+          g_strerror (errno));
+      failed = TRUE;
+    }
+
+    g_mutex_lock (&sink->writer_lock);
+    if (failed)
+      sink->writer_error = TRUE;
+
+    chunk->size = 0;
+    g_queue_push_head (&sink->free_chunks, chunk);
+    sink->buffered_size -= sink->chunk_size;
+    g_cond_broadcast (&sink->writer_cond);
+  }
+  g_mutex_unlock (&sink->writer_lock);
+
+  return NULL;
+}
+
+/**
+ * @brief Get an empty chunk to be filled, waits for the writer if the memory budget is exceeded.
+ * @return NULL if the writer failed to write the data.
+ */
+static GstDataRepoSinkChunk *
+gst_data_repo_sink_get_chunk (GstDataRepoSink * sink)
+{
+  GstDataRepoSinkChunk *chunk = NULL;
+
+  g_mutex_lock (&sink->writer_lock);
+
+  /* at least one chunk is always available */
+  while (!sink->writer_error && sink->buffered_size > 0 &&
+      sink->buffered_size + sink->chunk_size > sink->max_buffered_size) {
+    GST_DEBUG_OBJECT (sink, "Exceeded max-buffered-size, wait for the writer");
+    g_cond_wait (&sink->writer_cond, &sink->writer_lock);
+  }
+
+  if (!sink->writer_error) {
+    chunk = (GstDataRepoSinkChunk *) g_queue_pop_head (&sink->free_chunks);
+    if (chunk == NULL) {
+      chunk = g_new0 (GstDataRepoSinkChunk, 1);
+      chunk->mem = (guint8 *) g_malloc (sink->chunk_size + WRITE_ALIGNMENT);
+      chunk->data = (guint8 *)
+          GSIZE_TO_POINTER (WRITE_ALIGN_UP (GPOINTER_TO_SIZE (chunk->mem)));
+    }
+
+    sink->buffered_size += sink->chunk_size;
+  }
+
+  g_mutex_unlock (&sink->writer_lock);
+  return chunk;
+}
+
+/**
+ * @brief Pass the filled chunk to the writer thread.
+ */
+static void
+gst_data_repo_sink_queue_chunk (GstDataRepoSink * sink)
+{
+  g_mutex_lock (&sink->writer_lock);
+  if (sink->chunk->size > 0) {
+    g_queue_push_tail (&sink->write_queue, sink->chunk);
+  } else {
+    g_queue_push_head (&sink->free_chunks, sink->chunk);
+    sink->buffered_size -= sink->chunk_size;
+  }
+  g_cond_broadcast (&sink->writer_cond);
+  g_mutex_unlock (&sink->writer_lock);
+
+  sink->chunk = NULL;
+}
+
+/**
+ * @brief Write the data to the file, or copy the data into the chunks if async-write is enabled.
+ */
+static gboolean
+gst_data_repo_sink_write_data (GstDataRepoSink * sink, const guint8 * data,
+    gsize size)
+{
+  gsize len;
+
+  if (!sink->writer_thread)
+    return gst_data_repo_sink_write_fd (sink->fd, data, size);
+
+  while (size > 0) {
+    if (sink->chunk == NULL) {
+      sink->chunk = gst_data_repo_sink_get_chunk (sink);
+      if (sink->chunk == NULL)
+        return FALSE;
+    }
+
+    len = MIN (size, sink->chunk_size - sink->chunk->size);
+    memcpy (sink->chunk->data + sink->chunk->size, data, len);
+    sink->chunk->size += len;
+    data += len;
+    size -= len;
+
+    if (sink->chunk->size == sink->chunk_size)
+      gst_data_repo_sink_queue_chunk (sink);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Wait until all the data are written to the file.
+ * @return FALSE if the writer failed to write the data.
+ */
+static gboolean
+gst_data_repo_sink_flush (GstDataRepoSink * sink)
+{
+  gboolean ret;
+
+  if (!sink->writer_thread)
+    return TRUE;
+
+  if (sink->chunk)
+    gst_data_repo_sink_queue_chunk (sink);
+
+  g_mutex_lock (&sink->writer_lock);
+  while (!sink->writer_error && sink->buffered_size > 0)
+    g_cond_wait (&sink->writer_cond, &sink->writer_lock);
+  ret = !sink->writer_error;
+  g_mutex_unlock (&sink->writer_lock);
+
+  return ret;
+}
+
+/**
+ * @brief Start the writer thread.
+ */
+static gboolean
+gst_data_repo_sink_start_writer (GstDataRepoSink * sink)
+{
+  GError *error = NULL;
+
+  sink->chunk_size = WRITE_ALIGN_UP (sink->buffer_size);
+  sink->buffered_size = 0;
+  sink->writer_error = FALSE;
+  sink->writer_running = TRUE;
+
+  sink->writer_thread = g_thread_try_new ("datareposink-writer",
+      gst_data_repo_sink_writer_thread, sink, &error);
+  if (!sink->writer_thread) {
+    GST_ERROR_OBJECT (sink, "Failed to start writer thread: %s",
+        error ? error->message : "Unknown error");
+    g_clear_error (&error);
+    sink->writer_running = FALSE;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Flush the pending data and stop the writer thread.
+ */
+static void
+gst_data_repo_sink_stop_writer (GstDataRepoSink * sink)
+{
+  GstDataRepoSinkChunk *chunk;
+
+  if (!sink->writer_thread)
+    return;
+
+  if (!gst_data_repo_sink_flush (sink))
+    GST_ERROR_OBJECT (sink, "Failed to write the pending data to file");
+
+  g_mutex_lock (&sink->writer_lock);
+  sink->writer_running = FALSE;
+  g_cond_broadcast (&sink->writer_cond);
+  g_mutex_unlock (&sink->writer_lock);
+
+  g_thread_join (sink->writer_thread);
+  sink->writer_thread = NULL;
+
+  while ((chunk = (GstDataRepoSinkChunk *) g_queue_pop_head (&sink->free_chunks))) {
+    g_free (chunk->mem);
+    g_free (chunk);
+  }
+}
+
 /**
  * @brief Function to write others media type (tensors(fixed), video, audio, octet and text)
  */
 static GstFlowReturn
 gst_data_repo_sink_write_others (GstDataRepoSink * sink, GstBuffer * buffer)
 {
-  gsize write_size = 0;
   GstMapInfo info;
   GstFlowReturn ret = GST_FLOW_OK;
 
@@ -296,13 +656,11 @@ gst_data_repo_sink_write_others (GstDataRepoSink * sink, GstBuffer * buffer)
       "Writing %lld bytes at offset 0x%" G_GINT64_MODIFIER "x (%lld size)",
       (long long) info.size, sink->fd_offset, (long long) sink->fd_offset);
 
-  write_size = write (sink->fd, info.data, info.size);
-
-  if (write_size != info.size) {
+  if (!gst_data_repo_sink_write_data (sink, info.data, info.size)) {
     GST_ERROR_OBJECT (sink, "Could not write data to file");
     ret = GST_FLOW_ERROR;
   } else {
-    sink->fd_offset += write_size;
+    sink->fd_offset += info.size;
     sink->total_samples++;
   }
 
@@ -320,7 +678,7 @@ gst_data_repo_sink_write_flexible_or_sparse_tensors (GstDataRepoSink * sink,
     GstBuffer * buffer)
 {
   guint num_tensors, i;
-  gsize write_size = 0, total_write = 0, tensor_size;
+  gsize total_write = 0, tensor_size;
   GstMapInfo info;
   GstMemory *mem = NULL;
   GstTensorMetaInfo meta;
@@ -358,14 +716,13 @@ gst_data_repo_sink_write_flexible_or_sparse_tensors (GstDataRepoSink * sink,
         (long long) tensor_size, sink->fd_offset + total_write,
         (long long) sink->fd_offset + total_write);
 
-    write_size = write (sink->fd, info.data, tensor_size);
-    if (write_size != tensor_size) {
+    if (!gst_data_repo_sink_write_data (sink, info.data, tensor_size)) {
       GST_ERROR_OBJECT (sink, "Could not write data to file");
       goto error;
     }
 
     json_array_add_int_element (sink->tensor_size_array, tensor_size);
-    total_write += write_size;
+    total_write += tensor_size;
 
     gst_memory_unmap (mem, &info);
     gst_memory_unref (mem);
@@ -554,6 +911,11 @@ gst_data_repo_sink_event (GstBaseSink * bsink, GstEvent * event)
     case GST_EVENT_EOS:
       GST_INFO_OBJECT (sink, "get GST_EVENT_EOS event..state is %d",
           GST_STATE (sink));
+      /* all data should be in the file when EOS is posted */
+      if (!gst_data_repo_sink_flush (sink)) {
+        GST_ELEMENT_ERROR (sink, RESOURCE, WRITE,
+            ("Failed to write the pending data to file."), (NULL));
+      }
       break;
     case GST_EVENT_FLUSH_START:
       GST_INFO_OBJECT (sink, "get GST_EVENT_FLUSH_START event");
@@ -624,12 +986,37 @@ gst_data_repo_sink_open_file (GstDataRepoSink * sink)
 
   flags |= O_TRUNC;             /* "wb" */
 
+  if (sink->direct_io && !sink->async_write)
+    GST_WARNING_OBJECT (sink, "direct-io is available only with async-write.");
+
+#ifdef O_DIRECT
+  if (sink->direct_io && sink->async_write)
+    flags |= O_DIRECT;
+#endif
+
   /* open the file */
   sink->fd = g_open (filename, flags, 0644);
 
+#ifdef O_DIRECT
+  if (sink->fd < 0 && (flags & O_DIRECT) && errno == EINVAL) {
+    GST_WARNING_OBJECT (sink,
+        "The file system does not support O_DIRECT, use buffered I/O.");
+    flags &= ~O_DIRECT;
+    sink->fd = g_open (filename, flags, 0644);
+  }
+
+  sink->is_direct = (sink->fd >= 0 && (flags & O_DIRECT));
+#endif
+
   if (sink->fd < 0)
     goto open_failed;
 
+  if (sink->async_write && !gst_data_repo_sink_start_writer (sink)) {
+    g_close (sink->fd, NULL);
+    sink->fd = 0;
+    goto error_exit;
+  }
+
   g_free (filename);
 
   return TRUE;
@@ -673,6 +1060,9 @@ gst_data_repo_sink_stop (GstBaseSink * basesink)
 
   sink = GST_DATA_REPO_SINK_CAST (basesink);
 
+  /* write the pending data */
+  gst_data_repo_sink_stop_writer (sink);
+
   /* close the file */
   g_close (sink->fd, NULL);
   sink->fd = 0;
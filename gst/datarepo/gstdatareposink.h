@@ -33,6 +33,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstDataRepoSink GstDataRepoSink;
 typedef struct _GstDataRepoSinkClass GstDataRepoSinkClass;
+typedef struct _GstDataRepoSinkChunk GstDataRepoSinkChunk;
 
 /**
  * @brief GstDataRepoSink data structure
@@ -58,6 +59,23 @@ struct _GstDataRepoSink
   /* property */
   gchar *filename;      /**< filename */
   gchar *json_filename; /**< "JSON file path to store the meta information */
+  gboolean async_write; /**< write the data in a background thread */
+  guint buffer_size;    /**< size of a write batch, in bytes */
+  guint max_buffered_size; /**< memory budget for the data not written yet, in bytes */
+  gboolean direct_io;   /**< open the file with O_DIRECT (async-write only) */
+
+  /* background writer */
+  GThread *writer_thread;       /**< thread to write the chunks to the file */
+  GMutex writer_lock;           /**< lock for the writer */
+  GCond writer_cond;            /**< condition for the writer */
+  GQueue write_queue;           /**< chunks to be written */
+  GQueue free_chunks;           /**< written chunks to be reused */
+  GstDataRepoSinkChunk *chunk;  /**< chunk being filled in render thread */
+  gsize chunk_size;             /**< size of a chunk, aligned buffer-size */
+  gsize buffered_size;          /**< size of the chunks in use (filling, queued or being written) */
+  gboolean writer_running;      /**< FALSE to stop the writer thread */
+  gboolean writer_error;        /**< TRUE if failed to write a chunk */
+  gboolean is_direct;           /**< the file is opened with O_DIRECT */
 };
 
 /**
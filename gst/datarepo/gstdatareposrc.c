@@ -28,6 +28,13 @@
  * caps ="other/tensors, format=(string)static, framerate=(fraction)0/1, num_tensors=(int)2, dimensions=(string)1:1:784:1.1:1:10:1, types=(string)float32.float32" \
  * ! fakesink
  * ]|
+ *
+ * By default, datareposrc reads the samples with read() into newly allocated memories.
+ * With 'use-mmap=true', it memory-maps the file and pushes the tensors wrapping the mapped region without copy.
+ * These memories are read-only and not aligned (a sample starts at any offset of the file),
+ * so an element writing in place or requiring aligned input copies them.
+ * A background thread reads 'prefetch-depth' samples ahead along the (shuffled) sample order,
+ * so that the pages of the next samples are already loaded when the samples are pushed.
  */
 
 #ifdef HAVE_CONFIG_H
@@ -85,11 +92,30 @@ enum
   PROP_IS_SHUFFLE,
   PROP_TENSORS_SEQUENCE,
   PROP_CAPS,                    /* for setting caps of sample data directly */
+  PROP_USE_MMAP,
+  PROP_PREFETCH_DEPTH,
 };
 
 #define DEFAULT_INDEX 0
 #define DEFAULT_EPOCHS 1
 #define DEFAULT_IS_SHUFFLE TRUE
+#define DEFAULT_USE_MMAP FALSE
+#define DEFAULT_PREFETCH_DEPTH 4
+#define MAX_PREFETCH_DEPTH 1024
+
+/**
+ * @brief Range of the file to be prefetched.
+ */
+typedef struct
+{
+  guint64 offset;
+  gsize size;
+} GstDataRepoSrcRange;
+
+/**
+ * @brief Dummy range to stop the prefetch thread.
+ */
+static GstDataRepoSrcRange prefetch_stop;
 
 static void gst_data_repo_src_finalize (GObject * object);
 static GstStateChangeReturn gst_data_repo_src_change_state (GstElement *
@@ -99,6 +125,7 @@ static void gst_data_repo_src_set_property (GObject * object, guint prop_id,
 static void gst_data_repo_src_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static gboolean gst_data_repo_src_stop (GstBaseSrc * basesrc);
+static void gst_data_repo_src_close_io (GstDataRepoSrc * src);
 static GstCaps *gst_data_repo_src_get_caps (GstBaseSrc * basesrc,
     GstCaps * filter);
 static gboolean gst_data_repo_src_set_caps (GstBaseSrc * basesrc,
@@ -195,6 +222,23 @@ gst_data_repo_src_class_init (GstDataRepoSrcClass * klass)
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
           GST_PARAM_MUTABLE_READY));
 
+  g_object_class_install_property (gobject_class, PROP_USE_MMAP,
+      g_param_spec_boolean ("use-mmap", "Use mmap",
+          "If the value is true, the file is memory-mapped and "
+          "the samples are pushed without copy in read-only and unaligned memories, "
+          "otherwise read with read()",
+          DEFAULT_USE_MMAP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
+  g_object_class_install_property (gobject_class, PROP_PREFETCH_DEPTH,
+      g_param_spec_uint ("prefetch-depth", "Prefetch depth",
+          "The number of samples to be read ahead in a background thread "
+          "along the (shuffled) sample order, 0 to disable prefetch",
+          0, MAX_PREFETCH_DEPTH, DEFAULT_PREFETCH_DEPTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_READY));
+
   gobject_class->finalize = gst_data_repo_src_finalize;
   gstelement_class->change_state = gst_data_repo_src_change_state;
 
@@ -256,6 +300,12 @@ gst_data_repo_src_init (GstDataRepoSrc * src)
   src->n_frame = 0;
   src->running_time = 0;
   src->parser = NULL;
+  src->use_mmap = DEFAULT_USE_MMAP;
+  src->prefetch_depth = DEFAULT_PREFETCH_DEPTH;
+  src->mapped_file = NULL;
+  src->prefetch_thread = NULL;
+  src->prefetch_queue = NULL;
+  src->prefetch_index = 0;
   gst_tensors_config_init (&src->config);
 
   /* Filling the buffer should be pending until set_caps() */
@@ -275,11 +325,8 @@ gst_data_repo_src_finalize (GObject * object)
   g_free (src->json_filename);
   g_free (src->tensors_seq_str);
 
-  /* close the file */
-  if (src->fd) {
-    g_close (src->fd, NULL);
-    src->fd = 0;
-  }
+  /* stop prefetch, unmap and close the file */
+  gst_data_repo_src_close_io (src);
 
   if (src->parser)
     g_object_unref (src->parser);
@@ -558,11 +605,300 @@ gst_data_repo_src_epoch_is_done (GstDataRepoSrc * src)
 
   src->first_epoch_is_done = TRUE;
   src->array_index = 0;
+  src->prefetch_index = 0;
   src->epochs--;
 
   return TRUE;
 }
 
+/**
+ * @brief Function to get num_tensors from tensor_count_array
+ */
+static guint
+gst_data_repo_src_get_num_tensors (GstDataRepoSrc * src, guint shuffled_index)
+{
+  guint num_tensors = 0;
+  guint cur_idx_tensor_cnt = 0;
+  guint next_idx_tensor_cnt = 0;
+
+  g_return_val_if_fail (src != NULL, 0);
+
+  cur_idx_tensor_cnt =
+      json_array_get_int_element (src->tensor_count_array, shuffled_index);
+  GST_DEBUG_OBJECT (src, "cur_idx_tensor_cnt:%u", cur_idx_tensor_cnt);
+
+  if (shuffled_index + 1 == src->tensor_count_array_len) {
+    next_idx_tensor_cnt = src->tensor_size_array_len;
+  } else {
+    next_idx_tensor_cnt =
+        json_array_get_int_element (src->tensor_count_array,
+        shuffled_index + 1);
+  }
+  GST_DEBUG_OBJECT (src, "next_idx_tensor_cnt:%u", next_idx_tensor_cnt);
+
+  num_tensors = next_idx_tensor_cnt - cur_idx_tensor_cnt;
+  GST_DEBUG_OBJECT (src, "num_tensors:%u", num_tensors);
+
+  return num_tensors;
+}
+
+/**
+ * @brief Function to get the range of a sample in the file
+ */
+static void
+gst_data_repo_src_get_sample_range (GstDataRepoSrc * src, guint sample_index,
+    GstDataRepoSrcRange * range)
+{
+  guint i, num_tensors, tensor_count;
+
+  if (src->data_type == GST_DATA_REPO_DATA_TENSOR &&
+      !gst_tensors_config_is_static (&src->config)) {
+    range->offset =
+        json_array_get_int_element (src->sample_offset_array, sample_index);
+    range->size = 0;
+
+    tensor_count =
+        json_array_get_int_element (src->tensor_count_array, sample_index);
+    num_tensors = gst_data_repo_src_get_num_tensors (src, sample_index);
+
+    for (i = 0; i < num_tensors; i++) {
+      range->size +=
+          json_array_get_int_element (src->tensor_size_array, tensor_count + i);
+    }
+  } else {
+    range->offset = gst_data_repo_src_get_file_offset (src, sample_index);
+    range->size = src->sample_size;
+  }
+}
+
+/**
+ * @brief Prefetch thread, loads the pages of given ranges into memory.
+ * @note With mmap, touching a byte of each page faults the page in, so that the consumer of zero-copy memory does not wait for I/O.
+ * Otherwise, let the kernel read the range ahead into the page cache.
+ */
+static gpointer
+gst_data_repo_src_prefetch_thread (gpointer data)
+{
+  GstDataRepoSrc *src = GST_DATA_REPO_SRC (data);
+  GstDataRepoSrcRange *range;
+  const volatile guint8 *contents = NULL;
+  gsize length = 0;
+  glong page_size;
+  guint64 pos, end;
+  guint8 sum = 0;
+
+  page_size = sysconf (_SC_PAGESIZE);
+  if (page_size <= 0)
+    page_size = 4096;
+
+  if (src->mapped_file) {
+    contents = (const guint8 *) g_mapped_file_get_contents (src->mapped_file);
+    length = g_mapped_file_get_length (src->mapped_file);
+  }
+
+  while ((range = g_async_queue_pop (src->prefetch_queue)) != &prefetch_stop) {
+    GST_LOG_OBJECT (src, "Prefetch %zd bytes at offset 0x%" G_GINT64_MODIFIER
+        "x", range->size, range->offset);
+
+    if (contents) {
+      end = MIN (range->offset + range->size, length);
+
+      for (pos = range->offset; pos < end; pos += page_size)
+        sum ^= contents[pos];
+      if (end > range->offset)
+        sum ^= contents[end - 1];
+    } else {
+#ifdef POSIX_FADV_WILLNEED
+      posix_fadvise (src->fd, range->offset, range->size, POSIX_FADV_WILLNEED);
+#endif
+    }
+
+    g_free (range);
+  }
+
+  GST_DEBUG_OBJECT (src, "Prefetch thread is stopped (%u)", sum);
+  return NULL;
+}
+
+/**
+ * @brief Start the prefetch thread
+ */
+static void
+gst_data_repo_src_start_prefetch (GstDataRepoSrc * src)
+{
+  GError *error = NULL;
+
+  if (src->prefetch_depth == 0 || src->prefetch_thread)
+    return;
+
+  src->prefetch_queue = g_async_queue_new_full (g_free);
+  src->prefetch_index = 0;
+  src->prefetch_thread = g_thread_try_new ("datareposrc-prefetch",
+      gst_data_repo_src_prefetch_thread, src, &error);
+
+  if (!src->prefetch_thread) {
+    GST_WARNING_OBJECT (src, "Failed to start prefetch thread: %s",
+        error ? error->message : "Unknown error");
+    g_clear_error (&error);
+    g_async_queue_unref (src->prefetch_queue);
+    src->prefetch_queue = NULL;
+  }
+}
+
+/**
+ * @brief Stop the prefetch thread, unmap and close the file
+ */
+static void
+gst_data_repo_src_close_io (GstDataRepoSrc * src)
+{
+  if (src->prefetch_thread) {
+    g_async_queue_push_front (src->prefetch_queue, &prefetch_stop);
+    g_thread_join (src->prefetch_thread);
+    src->prefetch_thread = NULL;
+  }
+
+  if (src->prefetch_queue) {
+    g_async_queue_unref (src->prefetch_queue);
+    src->prefetch_queue = NULL;
+  }
+
+  /* the buffers still holding the mapped region keep the reference */
+  if (src->mapped_file) {
+    g_mapped_file_unref (src->mapped_file);
+    src->mapped_file = NULL;
+  }
+
+  if (src->fd) {
+    g_close (src->fd, NULL);
+    src->fd = 0;
+  }
+}
+
+/**
+ * @brief Request to prefetch the samples after current sample in this epoch.
+ * @note Next epoch is not prefetched because the samples index will be shuffled again.
+ */
+static void
+gst_data_repo_src_prefetch (GstDataRepoSrc * src)
+{
+  GstDataRepoSrcRange *range;
+  guint sample_index, last;
+
+  if (!src->prefetch_thread)
+    return;
+
+  last = MIN (src->array_index + src->prefetch_depth, src->num_samples);
+  src->prefetch_index = MAX (src->prefetch_index, src->array_index);
+
+  for (; src->prefetch_index < last; src->prefetch_index++) {
+    /* in the first epoch, the samples index is appended when reading a sample */
+    if (src->first_epoch_is_done)
+      sample_index = g_array_index (src->shuffled_index_array, guint,
+          src->prefetch_index);
+    else
+      sample_index = src->start_sample_index + src->prefetch_index;
+
+    range = g_new (GstDataRepoSrcRange, 1);
+    gst_data_repo_src_get_sample_range (src, sample_index, range);
+    g_async_queue_push (src->prefetch_queue, range);
+  }
+}
+
+/**
+ * @brief Function to get the memory of given range in the file.
+ * @note If the file is memory-mapped, the memory wraps the mapped region without copy.
+ */
+static GstFlowReturn
+gst_data_repo_src_read_memory (GstDataRepoSrc * src, guint64 offset,
+    gsize size, GstMemory ** memory)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMemory *mem;
+  GstMapInfo info;
+  gsize to_read, byte_read;
+  gssize read_size;
+  guint8 *data;
+  gsize length;
+
+  *memory = NULL;
+
+  if (src->mapped_file) {
+    length = g_mapped_file_get_length (src->mapped_file);
+
+    /* out of the mapped region, read() handles EOS */
+    if (offset + size <= length) {
+      GST_LOG_OBJECT (src,
+          "Wrapping %zd bytes at offset 0x%" G_GINT64_MODIFIER "x", size,
+          offset);
+
+      *memory = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          g_mapped_file_get_contents (src->mapped_file), length, offset, size,
+          g_mapped_file_ref (src->mapped_file),
+          (GDestroyNotify) g_mapped_file_unref);
+
+      src->read_position += size;
+      src->fd_offset = offset + size;
+      return GST_FLOW_OK;
+    }
+  }
+
+  mem = gst_allocator_alloc (NULL, size, NULL);
+
+  if (!gst_memory_map (mem, &info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (src, "Could not map GstMemory");
+    gst_memory_unref (mem);
+    return GST_FLOW_ERROR;
+  }
+
+  data = info.data;
+
+  byte_read = 0;
+  to_read = size;
+  src->fd_offset = lseek (src->fd, offset, SEEK_SET);
+
+  while (to_read > 0) {
+    GST_LOG_OBJECT (src,
+        "Reading %zd bytes at offset 0x%" G_GINT64_MODIFIER "x (%zd size)",
+        to_read, src->fd_offset + byte_read,
+        (guint) src->fd_offset + byte_read);
+    errno = 0;
+    read_size = read (src->fd, data + byte_read, to_read);
+    GST_LOG_OBJECT (src, "Read: %zd", read_size);
+    if (read_size < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
+      ret = GST_FLOW_ERROR;
+      goto error;
+    }
+    /* files should eos if they read 0 and more was requested */
+    if (read_size == 0) {
+      /* .. but first we should return any remaining data */
+      if (byte_read > 0)
+        break;
+      GST_DEBUG_OBJECT (src, "EOS");
+      ret = GST_FLOW_EOS;
+      goto error;
+    }
+    to_read -= read_size;
+    byte_read += read_size;
+
+    src->read_position += read_size;
+    src->fd_offset += read_size;
+  }
+
+  gst_memory_unmap (mem, &info);
+
+  *memory = mem;
+  return GST_FLOW_OK;
+
+error:
+  gst_memory_unmap (mem, &info);
+  gst_memory_unref (mem);
+
+  return ret;
+}
+
 /**
  * @brief Function to read tensors
  */
@@ -572,11 +908,7 @@ gst_data_repo_src_read_tensors (GstDataRepoSrc * src, GstBuffer ** buffer)
   GstFlowReturn ret = GST_FLOW_OK;
   guint i = 0, seq_idx = 0;
   GstBuffer *buf;
-  gsize to_read, byte_read;
-  gssize read_size;
-  guint8 *data;
   GstMemory *mem = NULL;
-  GstMapInfo info;
   guint shuffled_index = 0;
   guint64 sample_offset = 0;
   guint64 offset = 0;           /* offset from 0 */
@@ -604,6 +936,8 @@ gst_data_repo_src_read_tensors (GstDataRepoSrc * src, GstBuffer ** buffer)
   GST_LOG_OBJECT (src, "shuffled_index [%d] -> %d", src->array_index - 1,
       shuffled_index);
 
+  gst_data_repo_src_prefetch (src);
+
   /* sample offset from 0 */
   sample_offset = gst_data_repo_src_get_file_offset (src, shuffled_index);
   GST_LOG_OBJECT (src, "sample offset 0x%" G_GINT64_MODIFIER "x (%d size)",
@@ -613,13 +947,6 @@ gst_data_repo_src_read_tensors (GstDataRepoSrc * src, GstBuffer ** buffer)
 
   for (i = 0; i < src->tensors_seq_cnt; i++) {
     seq_idx = src->tensors_seq[i];
-    mem = gst_allocator_alloc (NULL, src->tensors_size[seq_idx], NULL);
-
-    if (!gst_memory_map (mem, &info, GST_MAP_WRITE)) {
-      GST_ERROR_OBJECT (src, "Could not map GstMemory[%d]", i);
-      ret = GST_FLOW_ERROR;
-      goto error;
-    }
 
     GST_INFO_OBJECT (src, "sequence index: %d", seq_idx);
     GST_INFO_OBJECT (src, "tensor_size[%d]: %zd", seq_idx,
@@ -641,45 +968,11 @@ gst_data_repo_src_read_tensors (GstDataRepoSrc * src, GstBuffer ** buffer)
       if user sets "tensor-sequence=2,1", datareposrc read offset 9528 then 9488.
     */
 
-    data = info.data;
-
-    byte_read = 0;
-    to_read = src->tensors_size[seq_idx];
     offset = sample_offset + src->tensors_offset[seq_idx];
-    src->fd_offset = lseek (src->fd, offset, SEEK_SET);
-
-    while (to_read > 0) {
-      GST_LOG_OBJECT (src,
-          "Reading %zd bytes at offset 0x%" G_GINT64_MODIFIER "x (%zd size)",
-          to_read, src->fd_offset + byte_read,
-          (guint) src->fd_offset + byte_read);
-      errno = 0;
-      read_size = read (src->fd, data + byte_read, to_read);
-      GST_LOG_OBJECT (src, "Read: %zd", read_size);
-      if (read_size < 0) {
-        if (errno == EAGAIN || errno == EINTR)
-          continue;
-        GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
-        ret = GST_FLOW_ERROR;
-        goto error;
-      }
-      /* files should eos if they read 0 and more was requested */
-      if (read_size == 0) {
-        /* .. but first we should return any remaining data */
-        if (byte_read > 0)
-          break;
-        GST_DEBUG_OBJECT (src, "EOS");
-        ret = GST_FLOW_EOS;
-        goto error;
-      }
-      to_read -= read_size;
-      byte_read += read_size;
-
-      src->read_position += read_size;
-      src->fd_offset += read_size;
-    }
-
-    gst_memory_unmap (mem, &info);
+    ret = gst_data_repo_src_read_memory (src, offset,
+        src->tensors_size[seq_idx], &mem);
+    if (ret != GST_FLOW_OK)
+      goto error;
 
     gst_tensor_buffer_append_memory (buf, mem,
         gst_tensors_info_get_nth_info (&src->config.info, i));
@@ -690,47 +983,11 @@ gst_data_repo_src_read_tensors (GstDataRepoSrc * src, GstBuffer ** buffer)
   return GST_FLOW_OK;
 
 error:
-  if (mem) {
-    gst_memory_unmap (mem, &info);
-    gst_memory_unref (mem);
-  }
-
   gst_buffer_unref (buf);
 
   return ret;
 }
 
-/**
- * @brief Function to get num_tensors from tensor_count_array
- */
-static guint
-gst_data_repo_src_get_num_tensors (GstDataRepoSrc * src, guint shuffled_index)
-{
-  guint num_tensors = 0;
-  guint cur_idx_tensor_cnt = 0;
-  guint next_idx_tensor_cnt = 0;
-
-  g_return_val_if_fail (src != NULL, 0);
-
-  cur_idx_tensor_cnt =
-      json_array_get_int_element (src->tensor_count_array, shuffled_index);
-  GST_DEBUG_OBJECT (src, "cur_idx_tensor_cnt:%u", cur_idx_tensor_cnt);
-
-  if (shuffled_index + 1 == src->tensor_count_array_len) {
-    next_idx_tensor_cnt = src->tensor_size_array_len;
-  } else {
-    next_idx_tensor_cnt =
-        json_array_get_int_element (src->tensor_count_array,
-        shuffled_index + 1);
-  }
-  GST_DEBUG_OBJECT (src, "next_idx_tensor_cnt:%u", next_idx_tensor_cnt);
-
-  num_tensors = next_idx_tensor_cnt - cur_idx_tensor_cnt;
-  GST_DEBUG_OBJECT (src, "num_tensors:%u", num_tensors);
-
-  return num_tensors;
-}
-
 /**
  * @brief Function to read flexible or sparse tensors
  */
@@ -748,9 +1005,7 @@ gst_data_repo_src_read_flexible_or_sparse_tensors (GstDataRepoSrc * src,
   GstMapInfo info;
   GstTensorMetaInfo meta;
   GstTensorInfo tinfo;
-  gsize to_read, byte_read;
-  gssize read_size;
-  guint8 *data;
+  gboolean valid;
   guint tensor_count;
   guint tensor_size;
 
@@ -778,14 +1033,14 @@ gst_data_repo_src_read_flexible_or_sparse_tensors (GstDataRepoSrc * src,
   GST_LOG_OBJECT (src, "shuffled_index [%d] -> %d", src->array_index - 1,
       shuffled_index);
 
+  gst_data_repo_src_prefetch (src);
+
   /* sample offset from 0 */
   sample_offset =
       json_array_get_int_element (src->sample_offset_array, shuffled_index);
   GST_LOG_OBJECT (src, "sample offset 0x%" G_GINT64_MODIFIER "x (%d size)",
       sample_offset, (guint) sample_offset);
 
-  src->fd_offset = lseek (src->fd, sample_offset, SEEK_SET);
-
   buf = gst_buffer_new ();
 
   tensor_count =
@@ -795,56 +1050,32 @@ gst_data_repo_src_read_flexible_or_sparse_tensors (GstDataRepoSrc * src,
   for (i = 0; i < num_tensors; i++) {
     tensor_size =
         json_array_get_int_element (src->tensor_size_array, tensor_count + i);
-    mem = gst_allocator_alloc (NULL, tensor_size, NULL);
 
-    if (!gst_memory_map (mem, &info, GST_MAP_WRITE)) {
-      GST_ERROR_OBJECT (src, "Could not map GstMemory[%d]", i);
-      ret = GST_FLOW_ERROR;
+    ret = gst_data_repo_src_read_memory (src, sample_offset, tensor_size,
+        &mem);
+    if (ret != GST_FLOW_OK)
       goto error;
-    }
 
-    data = info.data;
-    byte_read = 0;
-    to_read = tensor_size;
-    while (to_read > 0) {
-      GST_LOG_OBJECT (src,
-          "Reading %zd bytes at offset 0x%" G_GINT64_MODIFIER "x (%lld size)",
-          to_read, src->fd_offset + byte_read, (long long) src->fd_offset);
-      errno = 0;
-      read_size = read (src->fd, data + byte_read, to_read);
-      GST_LOG_OBJECT (src, "Read: %zd", read_size);
-      if (read_size < 0) {
-        if (errno == EAGAIN || errno == EINTR)
-          continue;
-        GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
-        ret = GST_FLOW_ERROR;
-        goto error;
-      }
-      /* files should eos if they read 0 and more was requested */
-      if (read_size == 0) {
-        /* .. but first we should return any remaining data */
-        if (byte_read > 0)
-          break;
-        GST_DEBUG_OBJECT (src, "EOS");
-        ret = GST_FLOW_EOS;
-        goto error;
-      }
-      to_read -= read_size;
-      byte_read += read_size;
+    sample_offset += tensor_size;
 
-      src->read_position += read_size;
-      src->fd_offset += read_size;
+    if (!gst_memory_map (mem, &info, GST_MAP_READ)) {
+      GST_ERROR_OBJECT (src, "Could not map GstMemory[%d]", i);
+      gst_memory_unref (mem);
+      ret = GST_FLOW_ERROR;
+      goto error;
     }
 
     /* check invalid flexible tensor */
-    if (!gst_tensor_meta_info_parse_header (&meta, info.data)) {
+    valid = gst_tensor_meta_info_parse_header (&meta, info.data);
+    gst_memory_unmap (mem, &info);
+
+    if (!valid) {
       GST_ERROR_OBJECT (src, "Invalid flexible tensors");
+      gst_memory_unref (mem);
       ret = GST_FLOW_ERROR;
       goto error;
     }
 
-    gst_memory_unmap (mem, &info);
-
     gst_tensor_meta_info_convert (&meta, &tinfo);
     gst_tensor_buffer_append_memory (buf, mem, &tinfo);
     gst_tensor_info_free (&tinfo);
@@ -855,10 +1086,6 @@ gst_data_repo_src_read_flexible_or_sparse_tensors (GstDataRepoSrc * src,
   return GST_FLOW_OK;
 
 error:
-  if (mem) {
-    gst_memory_unmap (mem, &info);
-    gst_memory_unref (mem);
-  }
   gst_buffer_unref (buf);
 
   return ret;
@@ -980,11 +1207,7 @@ gst_data_repo_src_read_others (GstDataRepoSrc * src, GstBuffer ** buffer)
 {
   GstFlowReturn ret = GST_FLOW_OK;
   GstBuffer *buf;
-  gsize to_read, byte_read;
-  gssize read_size;
-  guint8 *data;
   GstMemory *mem;
-  GstMapInfo info;
   guint shuffled_index = 0;
   guint64 offset = 0;
 
@@ -1011,64 +1234,20 @@ gst_data_repo_src_read_others (GstDataRepoSrc * src, GstBuffer ** buffer)
       g_array_index (src->shuffled_index_array, guint, src->array_index++);
   GST_LOG_OBJECT (src, "shuffled_index [%d] -> %d", src->array_index - 1,
       shuffled_index);
-  offset = gst_data_repo_src_get_file_offset (src, shuffled_index);
-  src->fd_offset = lseek (src->fd, offset, SEEK_SET);
-
-  mem = gst_allocator_alloc (NULL, src->sample_size, NULL);
-
-  if (!gst_memory_map (mem, &info, GST_MAP_WRITE)) {
-    GST_ERROR_OBJECT (src, "Could not map GstMemory");
-    return GST_FLOW_ERROR;
-  }
-
-  data = info.data;
 
-  byte_read = 0;
-  to_read = src->sample_size;
-  while (to_read > 0) {
-    GST_LOG_OBJECT (src, "Reading %zd bytes at offset 0x%" G_GINT64_MODIFIER "x",
-        to_read, src->fd_offset + byte_read);
-    errno = 0;
-    read_size = read (src->fd, data + byte_read, to_read);
-    GST_LOG_OBJECT (src, "Read: %zd", read_size);
-    if (read_size < 0) {
-      if (errno == EAGAIN || errno == EINTR)
-        continue;
-      GST_ELEMENT_ERROR (src, RESOURCE, READ, (NULL), GST_ERROR_SYSTEM);
-      ret = GST_FLOW_ERROR;
-      goto error;
-    }
-    /* files should eos if they read 0 and more was requested */
-    if (read_size == 0) {
-      /* .. but first we should return any remaining data */
-      if (byte_read > 0)
-        break;
-      GST_DEBUG_OBJECT (src, "EOS");
-      ret = GST_FLOW_EOS;
-      goto error;
-    }
-    to_read -= read_size;
-    byte_read += read_size;
+  gst_data_repo_src_prefetch (src);
 
-    src->read_position += read_size;
-    src->fd_offset += read_size;
-  }
+  offset = gst_data_repo_src_get_file_offset (src, shuffled_index);
 
-  gst_memory_unmap (mem, &info);
+  ret = gst_data_repo_src_read_memory (src, offset, src->sample_size, &mem);
+  if (ret != GST_FLOW_OK)
+    return ret;
 
   buf = gst_buffer_new ();
   gst_buffer_append_memory (buf, mem);
 
   *buffer = buf;
   return GST_FLOW_OK;
-
-error:
-  if (mem) {
-    gst_memory_unmap (mem, &info);
-    gst_memory_unref (mem);
-  }
-
-  return ret;
 }
 
 /**
@@ -1142,6 +1321,19 @@ gst_data_repo_src_start (GstDataRepoSrc * src)
     src->fd_offset = lseek (src->fd, src->start_offset, SEEK_SET);
     GST_LOG_OBJECT (src, "Start file offset 0x%" G_GINT64_MODIFIER "x",
         src->fd_offset);
+
+    if (src->use_mmap) {
+      GError *error = NULL;
+
+      src->mapped_file = g_mapped_file_new_from_fd (src->fd, FALSE, &error);
+      if (!src->mapped_file) {
+        GST_WARNING_OBJECT (src, "Failed to map the file, use read(): %s",
+            error ? error->message : "Unknown error");
+        g_clear_error (&error);
+      }
+    }
+
+    gst_data_repo_src_start_prefetch (src);
   }
 
   return TRUE;
@@ -1288,9 +1480,8 @@ gst_data_repo_src_stop (GstBaseSrc * basesrc)
 {
   GstDataRepoSrc *src = GST_DATA_REPO_SRC (basesrc);
 
-  /* close the file */
-  g_close (src->fd, NULL);
-  src->fd = 0;
+  /* stop prefetch, unmap and close the file */
+  gst_data_repo_src_close_io (src);
 
   return TRUE;
 }
@@ -1582,6 +1773,12 @@ gst_data_repo_src_set_property (GObject * object, guint prop_id,
           src->need_changed_caps = TRUE;
       }
       break;
+    case PROP_USE_MMAP:
+      src->use_mmap = g_value_get_boolean (value);
+      break;
+    case PROP_PREFETCH_DEPTH:
+      src->prefetch_depth = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1626,6 +1823,12 @@ gst_data_repo_src_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_CAPS:
       gst_value_set_caps (value, src->caps);
       break;
+    case PROP_USE_MMAP:
+      g_value_set_boolean (value, src->use_mmap);
+      break;
+    case PROP_PREFETCH_DEPTH:
+      g_value_set_uint (value, src->prefetch_depth);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
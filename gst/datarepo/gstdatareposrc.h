@@ -90,6 +90,14 @@ struct _GstDataRepoSrc {
   GstClockTime running_time;    /**< one frame running time */
   gint rate_n, rate_d;
   guint64 n_frame;
+
+  /* I/O engine */
+  gboolean use_mmap;            /**< memory-map the file and push the samples without copy */
+  guint prefetch_depth;         /**< the number of samples to be read ahead, 0 to disable prefetch */
+  GMappedFile *mapped_file;     /**< mapped file, NULL if the samples are read with read() */
+  GThread *prefetch_thread;     /**< thread to read the samples ahead along the sample order */
+  GAsyncQueue *prefetch_queue;  /**< ranges of the file to be prefetched */
+  guint prefetch_index;         /**< element index of shuffled_index_array to be prefetched next */
 };
 
 /**
@@ -15,6 +15,7 @@
 #endif
 
 #include "edge_src.h"
+#include "tensor_query/tensor_query_common.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_edgesrc_debug);
 #define GST_CAT_DEFAULT gst_edgesrc_debug
@@ -379,13 +380,11 @@ gst_edgesrc_create (GstBaseSrc * basesrc, guint64 offset, guint size,
   GstEdgeSrc *self = GST_EDGESRC (basesrc);
   nns_edge_data_h data_h = NULL;
   GstBuffer *buffer = NULL;
-  GstMemory *mem;
   GstCaps *caps = NULL;
   GstStructure *structure;
   GstTensorsConfig config;
-  GstTensorInfo *_info;
   gboolean is_tensor = FALSE;
-  guint i, num_data, max_mems;
+  guint num_data, max_mems;
   int ret;
 
   UNUSED (offset);
@@ -427,24 +426,14 @@ gst_edgesrc_create (GstBaseSrc * basesrc, guint64 offset, guint size,
     goto done;
   }
 
+  /* wrap received data without copy, edge data is released with the buffer */
   buffer = gst_buffer_new ();
-  for (i = 0; i < num_data; i++) {
-    void *data = NULL;
-    nns_size_t data_len = 0;
-    gpointer new_data;
-
-    nns_edge_data_get (data_h, i, &data, &data_len);
-    new_data = _g_memdup (data, data_len);
-    mem = gst_memory_new_wrapped (0, new_data, data_len, 0, data_len,
-        new_data, g_free);
-
-    if (is_tensor) {
-      _info = gst_tensors_info_get_nth_info (&config.info, i);
-      gst_tensor_buffer_append_memory (buffer, mem, _info);
-    } else {
-      gst_buffer_append_memory (buffer, mem);
-    }
+  if (!gst_tensor_query_data_append_to_buffer (data_h, buffer,
+          is_tensor ? &config.info : NULL)) {
+    gst_buffer_unref (buffer);
+    buffer = NULL;
   }
+  data_h = NULL;
 
 done:
   if (data_h)
@@ -57,11 +57,27 @@ typedef struct _GstMQTTMessageHdr {
       GstClockTime dts;
       GstClockTime pts;
       gchar gst_caps_str[GST_MQTT_MAX_LEN_GST_CAPS_STR];
+      guint num_buffers; /**< the number of coalesced buffers, 0 if the message has a single buffer */
     };
     guint8 _reserved_hdr[GST_MQTT_LEN_MSG_HDR];
   };
 } GstMQTTMessageHdr;
 
+/**
+ * @brief Defined a custom data type, GstMQTTBufferHdr
+ *
+ * If num_buffers of GstMQTTMessageHdr is not 0, the message coalesces multiple
+ * buffers. GstMQTTMessageHdr is followed by num_buffers pairs of GstMQTTBufferHdr
+ * and the data of the buffer. GstMQTTBufferHdr is not aligned in the message.
+ */
+typedef struct _GstMQTTBufferHdr {
+  guint num_mems;
+  gsize size_mems[GST_MQTT_MAX_NUM_MEMS];
+  GstClockTime duration;
+  GstClockTime dts;
+  GstClockTime pts;
+} GstMQTTBufferHdr;
+
 typedef int64_t (*mqtt_get_unix_epoch)(uint32_t, char **, uint16_t *);
 
 /**
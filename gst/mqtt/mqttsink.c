@@ -58,6 +58,7 @@ enum
   PROP_MQTT_QOS,
   PROP_MQTT_NTP_SYNC,
   PROP_MQTT_NTP_SRVS,
+  PROP_COALESCE,
 
   PROP_LAST
 };
@@ -75,6 +76,7 @@ enum
   DEFAULT_MAX_MSG_BUF_SIZE = 0, /* Buffer size is not fixed */
   DEFAULT_MQTT_QOS = 0,         /* fire and forget */
   DEFAULT_MQTT_NTP_SYNC = FALSE,
+  DEFAULT_COALESCE = FALSE,
   MAX_LEN_PROP_NTP_SRVS = 4096,
 };
 
@@ -146,6 +148,9 @@ static void gst_mqtt_sink_set_mqtt_ntp_sync (GstMqttSink * self,
 static gchar *gst_mqtt_sink_get_mqtt_ntp_srvs (GstMqttSink * self);
 static void gst_mqtt_sink_set_mqtt_ntp_srvs (GstMqttSink * self,
     const gchar * pairs);
+static gboolean gst_mqtt_sink_get_coalesce (GstMqttSink * self);
+static void gst_mqtt_sink_set_coalesce (GstMqttSink * self,
+    const gboolean flag);
 
 static void cb_mqtt_on_connect (void *context,
     MQTTAsync_successData * response);
@@ -216,6 +221,7 @@ gst_mqtt_sink_init (GstMqttSink * self)
   self->mqtt_ntp_num_srvs = 0;
   self->get_epoch_func = default_mqtt_get_unix_epoch;
   self->is_connected = FALSE;
+  self->coalesce = DEFAULT_COALESCE;
 
   /** init basesink properties */
   gst_base_sink_set_qos_enabled (basesink, DEFAULT_QOS);
@@ -318,6 +324,12 @@ gst_mqtt_sink_class_init (GstMqttSinkClass * klass)
           "\t\t\tsee also: https://www.eclipse.org/paho/files/mqttdoc/MQTTAsync/html/qos.html",
           0, 2, DEFAULT_MQTT_QOS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_COALESCE,
+      g_param_spec_boolean ("coalesce", "Coalesce buffers",
+          "Publish the buffers in a buffer list as a single message "
+          "(mqttsrc should support coalesced messages)",
+          DEFAULT_COALESCE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_mqtt_sink_change_state;
 
   gstbasesink_class->start = GST_DEBUG_FUNCPTR (gst_mqtt_sink_start);
@@ -386,6 +398,9 @@ gst_mqtt_sink_set_property (GObject * object, guint prop_id,
     case PROP_MQTT_NTP_SRVS:
       gst_mqtt_sink_set_mqtt_ntp_srvs (self, g_value_get_string (value));
       break;
+    case PROP_COALESCE:
+      gst_mqtt_sink_set_coalesce (self, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -441,6 +456,9 @@ gst_mqtt_sink_get_property (GObject * object, guint prop_id,
     case PROP_MQTT_NTP_SRVS:
       g_value_set_string (value, gst_mqtt_sink_get_mqtt_ntp_srvs (self));
       break;
+    case PROP_COALESCE:
+      g_value_set_boolean (value, gst_mqtt_sink_get_coalesce (self));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -745,20 +763,12 @@ _mqtt_set_msg_buf_hdr (GstBuffer * gst_buf, GstMQTTMessageHdr * hdr)
 }
 
 /**
- * @brief The callback to process each buffer receiving on the sink pad
+ * @brief A utility function to wait until the MQTT connection is established
  */
 static GstFlowReturn
-gst_mqtt_sink_render (GstBaseSink * basesink, GstBuffer * in_buf)
+_mqtt_sink_wait_connected (GstMqttSink * self)
 {
-  const gsize in_buf_size = gst_buffer_get_size (in_buf);
-  static gboolean is_static_sized_buf = FALSE;
-  GstMqttSink *self = GST_MQTT_SINK (basesink);
-  GstFlowReturn ret = GST_FLOW_ERROR;
   mqtt_sink_state_t cur_state;
-  GstMemory *in_buf_mem;
-  GstMapInfo in_buf_map;
-  gint mqtt_rc;
-  guint8 *msg_pub;
 
   while ((cur_state =
           g_atomic_int_get (&self->mqtt_sink_state)) != MQTT_CONNECTED) {
@@ -777,96 +787,184 @@ gst_mqtt_sink_render (GstBaseSink * basesink, GstBuffer * in_buf)
       case MQTT_DISCONNECTED:
       case MQTT_CONNECTION_LOST:
       case SINK_RENDER_ERROR:
-        ret = GST_FLOW_ERROR;
-        break;
+        return GST_FLOW_ERROR;
       case SINK_RENDER_EOS:
-        ret = GST_FLOW_EOS;
-        break;
+        return GST_FLOW_EOS;
       default:
         continue;
     }
-    goto ret_with;
   }
 
-  if (self->num_buffers == 0) {
-    ret = GST_FLOW_EOS;
-    goto ret_with;
-  }
+  return GST_FLOW_OK;
+}
 
-  if (self->num_buffers != -1) {
-    self->num_buffers -= 1;
+/**
+ * @brief A utility function to prepare the message buffer for the payload
+ */
+static guint8 *
+_mqtt_sink_prepare_msg_buf (GstMqttSink * self, const gsize payload_size)
+{
+  gsize required = payload_size + GST_MQTT_LEN_MSG_HDR;
+
+  if (self->max_msg_buf_size != 0) {
+    /** The message buffer is allocated once with the given size */
+    if (self->max_msg_buf_size < payload_size) {
+      g_printerr ("%s: The given size for a message buffer is too small: "
+          "given (%" G_GSIZE_FORMAT " bytes) vs. incoming (%" G_GSIZE_FORMAT
+          " bytes)\n", TAG_ERR_MQTTSINK, self->max_msg_buf_size, payload_size);
+      return NULL;
+    }
+    required = self->max_msg_buf_size + GST_MQTT_LEN_MSG_HDR;
   }
 
-  if ((!is_static_sized_buf) && (self->mqtt_msg_buf) &&
-      (self->mqtt_msg_buf_size != 0) &&
-      (self->mqtt_msg_buf_size < in_buf_size + GST_MQTT_LEN_MSG_HDR)) {
+  if (self->mqtt_msg_buf && self->mqtt_msg_buf_size < required) {
     g_free (self->mqtt_msg_buf);
     self->mqtt_msg_buf = NULL;
     self->mqtt_msg_buf_size = 0;
   }
 
-  /** Allocate a message buffer */
-  if ((!self->mqtt_msg_buf) && (self->mqtt_msg_buf_size == 0)) {
-    if (self->max_msg_buf_size == 0) {
-      self->mqtt_msg_buf_size = in_buf_size + GST_MQTT_LEN_MSG_HDR;
-    } else {
-      if (self->max_msg_buf_size < in_buf_size) {
-        g_printerr ("%s: The given size for a message buffer is too small: "
-            "given (%" G_GSIZE_FORMAT " bytes) vs. incoming (%" G_GSIZE_FORMAT
-            " bytes)\n", TAG_ERR_MQTTSINK, self->max_msg_buf_size, in_buf_size);
-        ret = GST_FLOW_ERROR;
-        goto ret_with;
-      }
-      self->mqtt_msg_buf_size = self->max_msg_buf_size + GST_MQTT_LEN_MSG_HDR;
-      is_static_sized_buf = TRUE;
-    }
-
-    self->mqtt_msg_buf = g_try_malloc0 (self->mqtt_msg_buf_size);
+  if (!self->mqtt_msg_buf) {
+    self->mqtt_msg_buf = g_try_malloc0 (required);
+    self->mqtt_msg_buf_size = self->mqtt_msg_buf ? required : 0;
   }
 
-  if (!_mqtt_set_msg_buf_hdr (in_buf, &self->mqtt_msg_hdr)) {
-    ret = GST_FLOW_ERROR;
-    goto ret_with;
-  }
+  return self->mqtt_msg_buf;
+}
 
-  msg_pub = self->mqtt_msg_buf;
-  if (!msg_pub) {
-    self->mqtt_msg_buf_size = 0;
-    ret = GST_FLOW_ERROR;
-    goto ret_with;
-  }
-  memcpy (msg_pub, &self->mqtt_msg_hdr, sizeof (self->mqtt_msg_hdr));
-  _put_timestamp_to_msg_buf_hdr (self, in_buf, (GstMQTTMessageHdr *) msg_pub);
+/**
+ * @brief A utility function to copy the memories of the buffer into the message without merging them
+ */
+static gboolean
+_mqtt_sink_copy_buffer_to_msg (GstBuffer * gst_buf, guint8 * dest)
+{
+  guint i, num_mems = gst_buffer_n_memory (gst_buf);
+  GstMapInfo map;
+  gsize offset = 0;
 
-  in_buf_mem = gst_buffer_get_all_memory (in_buf);
-  if (!in_buf_mem) {
-    ret = GST_FLOW_ERROR;
-    goto ret_with;
-  }
+  for (i = 0; i < num_mems; ++i) {
+    GstMemory *each_mem = gst_buffer_peek_memory (gst_buf, i);
+
+    if (!each_mem || !gst_memory_map (each_mem, &map, GST_MAP_READ))
+      return FALSE;
 
-  if (!gst_memory_map (in_buf_mem, &in_buf_map, GST_MAP_READ)) {
-    ret = GST_FLOW_ERROR;
-    goto ret_unref_in_buf_mem;
+    memcpy (dest + offset, map.data, map.size);
+    offset += map.size;
+    gst_memory_unmap (each_mem, &map);
   }
 
-  ret = GST_FLOW_OK;
+  return TRUE;
+}
+
+/**
+ * @brief A utility function to publish the message in the message buffer
+ */
+static GstFlowReturn
+_mqtt_sink_send_msg_buf (GstMqttSink * self, const gsize payload_size)
+{
+  gint mqtt_rc;
 
-  memcpy (&msg_pub[sizeof (self->mqtt_msg_hdr)], in_buf_map.data,
-      in_buf_map.size);
   mqtt_rc = MQTTAsync_send (self->mqtt_client_handle, self->mqtt_topic,
-      GST_MQTT_LEN_MSG_HDR + in_buf_map.size, self->mqtt_msg_buf,
+      GST_MQTT_LEN_MSG_HDR + payload_size, self->mqtt_msg_buf,
       self->mqtt_qos, 1, &self->mqtt_respn_opts);
-  if (mqtt_rc != MQTTASYNC_SUCCESS) {
-    ret = GST_FLOW_ERROR;
+
+  return (mqtt_rc == MQTTASYNC_SUCCESS) ? GST_FLOW_OK : GST_FLOW_ERROR;
+}
+
+/**
+ * @brief The callback to process each buffer receiving on the sink pad
+ */
+static GstFlowReturn
+gst_mqtt_sink_render (GstBaseSink * basesink, GstBuffer * in_buf)
+{
+  const gsize in_buf_size = gst_buffer_get_size (in_buf);
+  GstMqttSink *self = GST_MQTT_SINK (basesink);
+  GstFlowReturn ret;
+  guint8 *msg_pub;
+
+  ret = _mqtt_sink_wait_connected (self);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
+  if (self->num_buffers == 0)
+    return GST_FLOW_EOS;
+
+  if (self->num_buffers != -1) {
+    self->num_buffers -= 1;
   }
 
-  gst_memory_unmap (in_buf_mem, &in_buf_map);
+  /** Allocate a message buffer */
+  msg_pub = _mqtt_sink_prepare_msg_buf (self, in_buf_size);
+  if (!msg_pub)
+    return GST_FLOW_ERROR;
 
-ret_unref_in_buf_mem:
-  gst_memory_unref (in_buf_mem);
+  if (!_mqtt_set_msg_buf_hdr (in_buf, &self->mqtt_msg_hdr))
+    return GST_FLOW_ERROR;
 
-ret_with:
-  return ret;
+  self->mqtt_msg_hdr.num_buffers = 0;
+  memcpy (msg_pub, &self->mqtt_msg_hdr, sizeof (self->mqtt_msg_hdr));
+  _put_timestamp_to_msg_buf_hdr (self, in_buf, (GstMQTTMessageHdr *) msg_pub);
+
+  /** Copy each memory to the message, not to merge the memories of the buffer */
+  if (!_mqtt_sink_copy_buffer_to_msg (in_buf, &msg_pub[GST_MQTT_LEN_MSG_HDR]))
+    return GST_FLOW_ERROR;
+
+  return _mqtt_sink_send_msg_buf (self, in_buf_size);
+}
+
+/**
+ * @brief A utility function to publish the buffers in the list as a single message
+ */
+static GstFlowReturn
+_mqtt_sink_render_coalesced (GstMqttSink * self, GstBufferList * list,
+    const guint start, const guint num, const gsize payload_size)
+{
+  GstMQTTMessageHdr *hdr;
+  GstMQTTBufferHdr buf_hdr;
+  GstBuffer *buffer;
+  guint8 *msg_pub;
+  gsize offset;
+  guint i, j;
+
+  msg_pub = _mqtt_sink_prepare_msg_buf (self, payload_size);
+  if (!msg_pub)
+    return GST_FLOW_ERROR;
+
+  self->mqtt_msg_hdr.num_mems = 0;
+  self->mqtt_msg_hdr.num_buffers = num;
+  memcpy (msg_pub, &self->mqtt_msg_hdr, sizeof (self->mqtt_msg_hdr));
+
+  hdr = (GstMQTTMessageHdr *) msg_pub;
+  _put_timestamp_to_msg_buf_hdr (self, gst_buffer_list_get (list, start), hdr);
+
+  offset = GST_MQTT_LEN_MSG_HDR;
+  for (i = start; i < start + num; ++i) {
+    buffer = gst_buffer_list_get (list, i);
+
+    memset (&buf_hdr, 0, sizeof (buf_hdr));
+    buf_hdr.num_mems = gst_buffer_n_memory (buffer);
+    if (buf_hdr.num_mems > GST_MQTT_MAX_NUM_MEMS) {
+      GST_ERROR_OBJECT (self,
+          "The number of memories (%u) of the buffer exceeds the limit (%d).",
+          buf_hdr.num_mems, GST_MQTT_MAX_NUM_MEMS);
+      return GST_FLOW_ERROR;
+    }
+
+    for (j = 0; j < buf_hdr.num_mems; ++j)
+      buf_hdr.size_mems[j] = gst_buffer_peek_memory (buffer, j)->size;
+
+    buf_hdr.duration = GST_BUFFER_DURATION (buffer);
+    buf_hdr.dts = GST_BUFFER_DTS (buffer);
+    buf_hdr.pts = GST_BUFFER_PTS (buffer);
+
+    memcpy (&msg_pub[offset], &buf_hdr, sizeof (buf_hdr));
+    offset += sizeof (buf_hdr);
+
+    if (!_mqtt_sink_copy_buffer_to_msg (buffer, &msg_pub[offset]))
+      return GST_FLOW_ERROR;
+    offset += gst_buffer_get_size (buffer);
+  }
+
+  return _mqtt_sink_send_msg_buf (self, payload_size);
 }
 
 /**
@@ -876,16 +974,59 @@ ret_with:
 static GstFlowReturn
 gst_mqtt_sink_render_list (GstBaseSink * basesink, GstBufferList * list)
 {
+  GstMqttSink *self = GST_MQTT_SINK (basesink);
   guint num_buffers = gst_buffer_list_length (list);
-  GstFlowReturn ret;
+  GstFlowReturn ret = GST_FLOW_OK;
   GstBuffer *buffer;
-  guint i;
+  guint i, start, num;
+  gsize payload_size, each_size;
+
+  if (!self->coalesce || num_buffers <= 1) {
+    for (i = 0; i < num_buffers; ++i) {
+      buffer = gst_buffer_list_get (list, i);
+      ret = gst_mqtt_sink_render (basesink, buffer);
+      if (ret != GST_FLOW_OK)
+        break;
+    }
 
-  for (i = 0; i < num_buffers; ++i) {
-    buffer = gst_buffer_list_get (list, i);
-    ret = gst_mqtt_sink_render (basesink, buffer);
+    return ret;
+  }
+
+  ret = _mqtt_sink_wait_connected (self);
+  if (ret != GST_FLOW_OK)
+    return ret;
+
+  /** Pack the buffers as many as the message buffer allows */
+  start = 0;
+  while (start < num_buffers) {
+    payload_size = 0;
+    num = 0;
+
+    for (i = start; i < num_buffers; ++i) {
+      if (self->num_buffers != -1 && (gint) num >= self->num_buffers)
+        break;
+
+      each_size = sizeof (GstMQTTBufferHdr) +
+          gst_buffer_get_size (gst_buffer_list_get (list, i));
+      if (num > 0 && self->max_msg_buf_size != 0 &&
+          payload_size + each_size > self->max_msg_buf_size)
+        break;
+
+      payload_size += each_size;
+      num++;
+    }
+
+    if (num == 0)
+      return GST_FLOW_EOS;
+
+    if (self->num_buffers != -1)
+      self->num_buffers -= num;
+
+    ret = _mqtt_sink_render_coalesced (self, list, start, num, payload_size);
     if (ret != GST_FLOW_OK)
       break;
+
+    start += num;
   }
 
   return ret;
@@ -1178,6 +1319,24 @@ gst_mqtt_sink_set_mqtt_ntp_sync (GstMqttSink * self, const gboolean flag)
   self->mqtt_ntp_sync = flag;
 }
 
+/**
+ * @brief Getter for the 'coalesce' property.
+ */
+static gboolean
+gst_mqtt_sink_get_coalesce (GstMqttSink * self)
+{
+  return self->coalesce;
+}
+
+/**
+ * @brief Setter for the 'coalesce' property.
+ */
+static void
+gst_mqtt_sink_set_coalesce (GstMqttSink * self, const gboolean flag)
+{
+  self->coalesce = flag;
+}
+
 /**
  * @brief Getter for the 'ntp-srvs' property.
  */
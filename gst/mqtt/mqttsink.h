@@ -81,6 +81,7 @@ struct _GstMqttSink {
   gchar **mqtt_ntp_hnames;
   guint16 *mqtt_ntp_ports;
   gboolean is_connected;
+  gboolean coalesce;
 
   mqtt_get_unix_epoch get_epoch_func;
 
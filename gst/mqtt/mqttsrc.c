@@ -146,6 +146,11 @@ static GstMQTTMessageHdr *_extract_mqtt_msg_hdr_from (GstMemory * mem,
     GstMemory ** hdr_mem, GstMapInfo * hdr_map_info);
 static void _put_timestamp_on_gst_buf (GstMqttSrc * self,
     GstMQTTMessageHdr * hdr, GstBuffer * buf);
+static void _put_buffer_timestamp_on_gst_buf (GstMqttSrc * self,
+    GstMQTTMessageHdr * hdr, GstClockTime pts, GstClockTime dts,
+    GstClockTime duration, GstBuffer * buf);
+static gboolean _push_coalesced_buffers (GstMqttSrc * self,
+    GstMQTTMessageHdr * hdr, GstMemory * received_mem, gsize size);
 static gboolean _subscribe (GstMqttSrc * self);
 static gboolean _unsubscribe (GstMqttSrc * self);
 
@@ -1149,6 +1154,20 @@ cb_mqtt_on_message_arrived (void *context, char *topic_name, int topic_len,
     }
   }
 
+  if (mqtt_msg_hdr->num_buffers > 0) {
+    /** The message coalesces multiple buffers */
+    if (!_push_coalesced_buffers (self, mqtt_msg_hdr, received_mem, size) &&
+        !self->err) {
+      self->err = g_error_new (self->gquark_err_tag, ENODATA,
+          "%s: failed to unpack the coalesced message: %s",
+          __func__, g_strerror (ENODATA));
+    }
+
+    if (clock)
+      gst_object_unref (clock);
+    goto ret_unmap_hdr_mem;
+  }
+
   buffer = gst_buffer_new ();
   offset = GST_MQTT_LEN_MSG_HDR;
   for (i = 0; i < mqtt_msg_hdr->num_mems; ++i) {
@@ -1178,6 +1197,7 @@ cb_mqtt_on_message_arrived (void *context, char *topic_name, int topic_len,
   _put_timestamp_on_gst_buf (self, mqtt_msg_hdr, buffer);
   g_async_queue_push (self->aqueue, buffer);
 
+ret_unmap_hdr_mem:
   gst_memory_unmap (hdr_mem, &hdr_map_info);
   gst_memory_unref (hdr_mem);
 
@@ -1373,6 +1393,64 @@ _extract_mqtt_msg_hdr_from (GstMemory * mem, GstMemory ** hdr_mem,
   return (GstMQTTMessageHdr *) hdr_map_info->data;
 }
 
+/**
+  * @brief A utility function to unpack the coalesced message and push each buffer
+  */
+static gboolean
+_push_coalesced_buffers (GstMqttSrc * self, GstMQTTMessageHdr * hdr,
+    GstMemory * received_mem, gsize size)
+{
+  GstMQTTBufferHdr buf_hdr;
+  GstMapInfo map;
+  GstBuffer *buffer;
+  gsize offset = GST_MQTT_LEN_MSG_HDR;
+  gboolean ret = TRUE;
+  guint i, j;
+
+  if (!gst_memory_map (received_mem, &map, GST_MAP_READ))
+    return FALSE;
+
+  for (i = 0; i < hdr->num_buffers; ++i) {
+    if (offset + sizeof (buf_hdr) > size) {
+      ret = FALSE;
+      break;
+    }
+
+    /** GstMQTTBufferHdr is not aligned in the message */
+    memcpy (&buf_hdr, map.data + offset, sizeof (buf_hdr));
+    offset += sizeof (buf_hdr);
+
+    if (buf_hdr.num_mems > GST_MQTT_MAX_NUM_MEMS) {
+      ret = FALSE;
+      break;
+    }
+
+    buffer = gst_buffer_new ();
+    for (j = 0; j < buf_hdr.num_mems; ++j) {
+      if (buf_hdr.size_mems[j] > size - offset) {
+        ret = FALSE;
+        break;
+      }
+
+      gst_buffer_append_memory (buffer,
+          gst_memory_share (received_mem, offset, buf_hdr.size_mems[j]));
+      offset += buf_hdr.size_mems[j];
+    }
+
+    if (!ret) {
+      gst_buffer_unref (buffer);
+      break;
+    }
+
+    _put_buffer_timestamp_on_gst_buf (self, hdr, buf_hdr.pts, buf_hdr.dts,
+        buf_hdr.duration, buffer);
+    g_async_queue_push (self->aqueue, buffer);
+  }
+
+  gst_memory_unmap (received_mem, &map);
+  return ret;
+}
+
 /**
   * @brief A utility function to put the timestamp information
   *        onto a GstBuffer-typed buffer using the given packet header
@@ -1380,6 +1458,19 @@ _extract_mqtt_msg_hdr_from (GstMemory * mem, GstMemory ** hdr_mem,
 static void
 _put_timestamp_on_gst_buf (GstMqttSrc * self, GstMQTTMessageHdr * hdr,
     GstBuffer * buf)
+{
+  _put_buffer_timestamp_on_gst_buf (self, hdr, hdr->pts, hdr->dts,
+      hdr->duration, buf);
+}
+
+/**
+  * @brief A utility function to put the timestamp information of each buffer
+  *        onto a GstBuffer-typed buffer using the given packet header
+  */
+static void
+_put_buffer_timestamp_on_gst_buf (GstMqttSrc * self, GstMQTTMessageHdr * hdr,
+    GstClockTime pts, GstClockTime dts, GstClockTime duration,
+    GstBuffer * buf)
 {
   gint64 diff_base_epoch = hdr->base_time_epoch - self->base_time_epoch;
 
@@ -1390,18 +1481,18 @@ _put_timestamp_on_gst_buf (GstMqttSrc * self, GstMQTTMessageHdr * hdr,
   if (hdr->sent_time_epoch < self->base_time_epoch)
     return;
 
-  if (((GstClockTimeDiff) hdr->pts + diff_base_epoch) < 0)
+  if (((GstClockTimeDiff) pts + diff_base_epoch) < 0)
     return;
 
-  if (hdr->pts != GST_CLOCK_TIME_NONE) {
-    buf->pts = hdr->pts + diff_base_epoch;
+  if (pts != GST_CLOCK_TIME_NONE) {
+    buf->pts = pts + diff_base_epoch;
   }
 
-  if (hdr->dts != GST_CLOCK_TIME_NONE) {
-    buf->dts = hdr->dts + diff_base_epoch;
+  if (dts != GST_CLOCK_TIME_NONE) {
+    buf->dts = dts + diff_base_epoch;
   }
 
-  buf->duration = hdr->duration;
+  buf->duration = duration;
 
   if (self->debug) {
     GstClockTime base_time = gst_element_get_base_time (GST_ELEMENT (self));
@@ -1415,7 +1506,7 @@ _put_timestamp_on_gst_buf (GstMqttSrc * self, GstMQTTMessageHdr * hdr,
           GST_TIME_FORMAT " -> %" GST_TIME_FORMAT ")", self->mqtt_topic,
           GST_STIME_ARGS (diff_base_epoch),
           GST_TIME_ARGS (gst_clock_get_time (clock) - base_time),
-          GST_TIME_ARGS (hdr->pts), GST_TIME_ARGS (buf->pts));
+          GST_TIME_ARGS (pts), GST_TIME_ARGS (buf->pts));
 
       gst_object_unref (clock);
     }
@@ -100,6 +100,35 @@ enum
  */
 #define DEFAULT_CONCAT TRUE
 
+/**
+ * @brief The number of output windows in the memory of ring-buffer mode.
+ */
+#define RING_WINDOWS (4)
+
+/**
+ * @brief Data structure for the sliding window of frames (ring-buffer mode).
+ *
+ * Each incoming frame is written once into a linear memory, and each output is a sub-memory of the window without copy.
+ * When the memory is full, the frames in the window are moved to the head of the memory.
+ * If the sub-memories are still used in downstream, the frames are moved to a new memory.
+ */
+typedef struct
+{
+  GstMemory *mem; /**< the memory of the frames */
+  GstMapInfo map; /**< mapped info of the memory, mapped while the memory is used */
+  gsize frame_size; /**< the size of a frame */
+  guint capacity; /**< the max number of frames in the memory */
+  guint start; /**< the index of the first frame in the window */
+  guint count; /**< the number of frames in the window */
+  GstClockTime *pts; /**< presentation timestamp of each frame */
+  GstClockTime *dts; /**< decoding timestamp of each frame */
+  GstClockTime last_pts; /**< the last valid presentation timestamp of incoming buffer */
+  GstClockTime last_dts; /**< the last valid decoding timestamp of incoming buffer */
+  guint64 pts_dist; /**< the number of frames since last_pts */
+  guint64 dts_dist; /**< the number of frames since last_dts */
+  GstBuffer **meta; /**< empty buffer with the flags and meta of the incoming buffer for each frame, copied into the output from the first frame of the window */
+} GstTensorAggregatorRing;
+
 /**
  * @brief Template caps string for pads.
  */
@@ -143,6 +172,7 @@ gst_tensor_aggregator_change_state (GstElement * element,
     GstStateChange transition);
 
 static void gst_tensor_aggregator_reset (GstTensorAggregator * self);
+static void gst_tensor_aggregator_ring_free (gpointer data);
 static GstCaps *gst_tensor_aggregator_query_caps (GstTensorAggregator * self,
     GstPad * pad, GstCaps * filter);
 static gboolean gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
@@ -284,6 +314,8 @@ gst_tensor_aggregator_init (GstTensorAggregator * self)
   gst_tensors_config_init (&self->out_config);
 
   self->adapter_table = gst_tensor_aggregation_init ();
+  self->ring_table = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+      NULL, gst_tensor_aggregator_ring_free);
   gst_tensor_aggregator_reset (self);
 }
 
@@ -302,6 +334,7 @@ gst_tensor_aggregator_finalize (GObject * object)
   gst_tensors_config_free (&self->in_config);
   gst_tensors_config_free (&self->out_config);
   g_hash_table_destroy (self->adapter_table);
+  g_hash_table_destroy (self->ring_table);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -562,14 +595,15 @@ gst_tensor_aggregator_check_concat_axis (GstTensorAggregator * self,
 /**
  * @brief Change the data in buffer with given axis.
  * @param self this pointer to GstTensorAggregator
- * @param outbuf buffer to be concatenated
+ * @param srcbuf buffer to be concatenated (this function takes ownership of the buffer)
  * @param info tensor info for one frame
+ * @return Newly allocated buffer with concatenated data, NULL if failed.
  */
-static gboolean
-gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
+static GstBuffer *
+gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * srcbuf,
     const GstTensorInfo * info)
 {
-  GstBuffer *srcbuf;
+  GstBuffer *outbuf;
   GstMapInfo src_info, dest_info;
   guint f;
   gsize block_size;
@@ -579,19 +613,28 @@ gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
   frame_size = gst_tensor_info_get_size (info);
   g_assert (frame_size > 0); /** Internal error */
 
-  srcbuf = gst_buffer_copy (outbuf);
-  outbuf = gst_buffer_make_writable (outbuf);
+  /* The data is rearranged from the source directly, no need to copy the source. */
+  outbuf = gst_buffer_new_allocate (NULL, gst_buffer_get_size (srcbuf), NULL);
+  if (!outbuf) {
+    ml_logf ("Failed to allocate destination buffer with tensor_aggregator.\n");
+    gst_buffer_unref (srcbuf);
+    return NULL;
+  }
+
+  gst_buffer_copy_into (outbuf, srcbuf, GST_BUFFER_COPY_METADATA, 0, -1);
 
   if (!gst_buffer_map (srcbuf, &src_info, GST_MAP_READ)) {
     ml_logf ("Failed to map source buffer with tensor_aggregator.\n");
     gst_buffer_unref (srcbuf);
-    return FALSE;
+    gst_buffer_unref (outbuf);
+    return NULL;
   }
   if (!gst_buffer_map (outbuf, &dest_info, GST_MAP_WRITE)) {
     ml_logf ("Failed to map destination buffer with tensor_aggregator.\n");
     gst_buffer_unmap (srcbuf, &src_info);
     gst_buffer_unref (srcbuf);
-    return FALSE;
+    gst_buffer_unref (outbuf);
+    return NULL;
   }
 
   /**
@@ -795,7 +838,7 @@ gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
 
   gst_buffer_unref (srcbuf);
 
-  return TRUE;
+  return outbuf;
 }
 
 /**
@@ -816,18 +859,300 @@ gst_tensor_aggregator_push (GstTensorAggregator * self, GstBuffer * outbuf,
     ml_logf
         ("Invalid output capability of tensor_aggregator. Frame size = %"
         G_GSIZE_FORMAT "\n", frame_size);
+    gst_buffer_unref (outbuf);
     return GST_FLOW_ERROR;
   }
 
   if (gst_tensor_aggregator_check_concat_axis (self, &info)) {
     /** change data in buffer with given axis */
-    if (!gst_tensor_aggregator_concat (self, outbuf, &info))
+    outbuf = gst_tensor_aggregator_concat (self, outbuf, &info);
+    if (!outbuf)
       return GST_FLOW_ERROR;
   }
 
   return gst_pad_push (self->srcpad, outbuf);
 }
 
+/**
+ * @brief Release the memory of the sliding window.
+ */
+static void
+gst_tensor_aggregator_ring_clear (GstTensorAggregatorRing * ring)
+{
+  if (ring->mem) {
+    gst_memory_unmap (ring->mem, &ring->map);
+    gst_memory_unref (ring->mem);
+    ring->mem = NULL;
+  }
+
+  g_free (ring->pts);
+  g_free (ring->dts);
+  ring->pts = ring->dts = NULL;
+
+  if (ring->meta) {
+    guint i;
+
+    for (i = 0; i < ring->capacity; i++)
+      gst_buffer_replace (&ring->meta[i], NULL);
+    g_free (ring->meta);
+    ring->meta = NULL;
+  }
+
+  ring->frame_size = 0;
+  ring->capacity = ring->start = ring->count = 0;
+  ring->last_pts = ring->last_dts = GST_CLOCK_TIME_NONE;
+  ring->pts_dist = ring->dts_dist = 0;
+}
+
+/**
+ * @brief Free the sliding window.
+ */
+static void
+gst_tensor_aggregator_ring_free (gpointer data)
+{
+  GstTensorAggregatorRing *ring = (GstTensorAggregatorRing *) data;
+
+  if (ring) {
+    gst_tensor_aggregator_ring_clear (ring);
+    g_free (ring);
+  }
+}
+
+/**
+ * @brief Check whether the sliding window (ring-buffer mode) can be used.
+ * The frames are aggregated into the window if output has more frames than input and the window moves forward with frames-flush.
+ */
+static gboolean
+gst_tensor_aggregator_use_ring (GstTensorAggregator * self)
+{
+  return (self->frames_in < self->frames_out &&
+      self->frames_flush <= self->frames_out);
+}
+
+/**
+ * @brief Internal function to get the sliding window.
+ */
+static GstTensorAggregatorRing *
+gst_tensor_aggregator_get_ring (GstTensorAggregator * self, GstBuffer * buf)
+{
+  GstTensorAggregatorRing *ring;
+  GstMetaQuery *meta;
+  guint32 key = 0;
+
+  meta = gst_buffer_get_meta_query (buf);
+  if (meta)
+    key = meta->client_id;
+
+  ring = (GstTensorAggregatorRing *) g_hash_table_lookup (self->ring_table,
+      GUINT_TO_POINTER (key));
+  if (!ring) {
+    ring = g_new0 (GstTensorAggregatorRing, 1);
+    gst_tensor_aggregator_ring_clear (ring);
+    g_hash_table_insert (self->ring_table, GUINT_TO_POINTER (key), ring);
+  }
+
+  return ring;
+}
+
+/**
+ * @brief Prepare the space to write incoming frames into the sliding window.
+ */
+static gboolean
+gst_tensor_aggregator_ring_prepare (GstTensorAggregator * self,
+    GstTensorAggregatorRing * ring, gsize frame_size)
+{
+  GstMemory *mem;
+  GstMapInfo map;
+  gsize offset, size;
+
+  if (ring->mem && ring->frame_size != frame_size)
+    gst_tensor_aggregator_ring_clear (ring);
+
+  if (!ring->mem) {
+    ring->capacity = MAX (self->frames_out * RING_WINDOWS,
+        self->frames_out + self->frames_in);
+    ring->frame_size = frame_size;
+
+    ring->mem = gst_allocator_alloc (NULL, frame_size * ring->capacity, NULL);
+    if (!ring->mem) {
+      GST_ERROR_OBJECT (self, "Failed to allocate the memory of frames.");
+      return FALSE;
+    }
+
+    if (!gst_memory_map (ring->mem, &ring->map, GST_MAP_WRITE)) {
+      GST_ERROR_OBJECT (self, "Failed to map the memory of frames.");
+      gst_memory_unref (ring->mem);
+      ring->mem = NULL;
+      return FALSE;
+    }
+
+    ring->pts = g_new (GstClockTime, ring->capacity);
+    ring->dts = g_new (GstClockTime, ring->capacity);
+    ring->meta = g_new0 (GstBuffer *, ring->capacity);
+    ring->start = ring->count = 0;
+  }
+
+  if (ring->start + ring->count + self->frames_in <= ring->capacity)
+    return TRUE;
+
+  /* The memory is full, move the frames in the window to the head of the memory. */
+  offset = ring->start * frame_size;
+  size = ring->count * frame_size;
+
+  if (GST_MINI_OBJECT_REFCOUNT_VALUE (ring->mem) == 1) {
+    /* No output refers the memory. */
+    memmove (ring->map.data, ring->map.data + offset, size);
+  } else {
+    mem = gst_allocator_alloc (NULL, frame_size * ring->capacity, NULL);
+    if (!mem) {
+      GST_ERROR_OBJECT (self, "Failed to allocate the memory of frames.");
+      return FALSE;
+    }
+
+    if (!gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+      GST_ERROR_OBJECT (self, "Failed to map the memory of frames.");
+      gst_memory_unref (mem);
+      return FALSE;
+    }
+
+    nns_memcpy (map.data, ring->map.data + offset, size);
+
+    /* The old memory is released when downstream releases the outputs. */
+    gst_memory_unmap (ring->mem, &ring->map);
+    gst_memory_unref (ring->mem);
+
+    ring->mem = mem;
+    ring->map = map;
+  }
+
+  memmove (ring->pts, ring->pts + ring->start,
+      ring->count * sizeof (GstClockTime));
+  memmove (ring->dts, ring->dts + ring->start,
+      ring->count * sizeof (GstClockTime));
+  /* the frames before start are already released, clear the moved references */
+  memmove (ring->meta, ring->meta + ring->start,
+      ring->count * sizeof (GstBuffer *));
+  memset (ring->meta + ring->count, 0, ring->start * sizeof (GstBuffer *));
+  ring->start = 0;
+
+  return TRUE;
+}
+
+/**
+ * @brief Aggregate the frames with the sliding window (ring-buffer mode).
+ * Each incoming frame is copied once, and output buffer shares the memory of the window.
+ */
+static GstFlowReturn
+gst_tensor_aggregator_chain_ring (GstTensorAggregator * self, GstBuffer * buf,
+    gsize frame_size, GstClockTime duration)
+{
+  GstTensorAggregatorRing *ring;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMapInfo map;
+  GstBuffer *meta;
+  GstClockTime pts, dts;
+  guint i, index, frames_flush;
+  gsize out_size;
+  gint fn, fd;
+
+  ring = gst_tensor_aggregator_get_ring (self, buf);
+
+  if (!gst_tensor_aggregator_ring_prepare (self, ring, frame_size)) {
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  if (!gst_buffer_map (buf, &map, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the incoming buffer.");
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  index = ring->start + ring->count;
+  nns_memcpy (ring->map.data + index * frame_size, map.data,
+      frame_size * self->frames_in);
+  gst_buffer_unmap (buf, &map);
+
+  /**
+   * Set timestamp of each frame, same as the timestamp from gst-adapter.
+   * If frames-in is larger than 1, the timestamp is updated with framerate.
+   */
+  if (GST_BUFFER_PTS_IS_VALID (buf)) {
+    ring->last_pts = GST_BUFFER_PTS (buf);
+    ring->pts_dist = 0;
+  }
+  if (GST_BUFFER_DTS_IS_VALID (buf)) {
+    ring->last_dts = GST_BUFFER_DTS (buf);
+    ring->dts_dist = 0;
+  }
+
+  fn = self->in_config.rate_n;
+  fd = self->in_config.rate_d;
+
+  /* keep the flags and meta only, the data is already in the window */
+  meta = gst_buffer_new ();
+  gst_buffer_copy_into (meta, buf,
+      GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_META, 0, -1);
+
+  for (i = 0; i < self->frames_in; i++) {
+    pts = ring->last_pts;
+    dts = ring->last_dts;
+
+    if (self->frames_in > 1 && fn > 0 && fd > 0) {
+      if (GST_CLOCK_TIME_IS_VALID (pts))
+        pts += gst_util_uint64_scale_int (ring->pts_dist * fd, GST_SECOND, fn);
+      if (GST_CLOCK_TIME_IS_VALID (dts))
+        dts += gst_util_uint64_scale_int (ring->dts_dist * fd, GST_SECOND, fn);
+    }
+
+    ring->pts[index + i] = pts;
+    ring->dts[index + i] = dts;
+    ring->meta[index + i] = gst_buffer_ref (meta);
+    ring->pts_dist++;
+    ring->dts_dist++;
+  }
+
+  ring->count += self->frames_in;
+  gst_buffer_unref (meta);
+  gst_buffer_unref (buf);
+
+  out_size = frame_size * self->frames_out;
+  frames_flush = (self->frames_flush > 0) ? self->frames_flush : self->frames_out;
+
+  while (ring->count >= self->frames_out && ret == GST_FLOW_OK) {
+    GstBuffer *outbuf;
+    GstMemory *mem;
+
+    mem = gst_memory_share (ring->mem, ring->start * frame_size, out_size);
+    if (!mem) {
+      GST_ERROR_OBJECT (self, "Failed to get the memory of output frames.");
+      return GST_FLOW_ERROR;
+    }
+
+    /* same as gst-adapter, the meta of the first frame in the window */
+    outbuf = gst_buffer_new ();
+    gst_buffer_copy_into (outbuf, ring->meta[ring->start],
+        GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_META, 0, -1);
+    gst_buffer_append_memory (outbuf, mem);
+
+    /** set timestamp */
+    GST_BUFFER_PTS (outbuf) = ring->pts[ring->start];
+    GST_BUFFER_DTS (outbuf) = ring->dts[ring->start];
+    GST_BUFFER_DURATION (outbuf) = duration;
+
+    ret = gst_tensor_aggregator_push (self, outbuf, frame_size);
+
+    /** move the window */
+    for (i = 0; i < frames_flush; i++)
+      gst_buffer_replace (&ring->meta[ring->start + i], NULL);
+
+    ring->start += frames_flush;
+    ring->count -= frames_flush;
+  }
+
+  return ret;
+}
+
 /**
  * @brief Chain function, this function does the actual processing.
  */
@@ -858,15 +1183,20 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     return gst_tensor_aggregator_push (self, buf, frame_size);
   }
 
-  adapter = gst_tensor_aggregator_get_adapter (self, buf);
-  g_assert (adapter != NULL);
-
   duration = GST_BUFFER_DURATION (buf);
   if (GST_CLOCK_TIME_IS_VALID (duration)) {
     /** supposed same duration for incoming buffer */
     duration = gst_util_uint64_scale_int (duration, frames_out, frames_in);
   }
 
+  if (gst_tensor_aggregator_use_ring (self)) {
+    /** write the frames into the sliding window and push the outputs without copy */
+    return gst_tensor_aggregator_chain_ring (self, buf, frame_size, duration);
+  }
+
+  adapter = gst_tensor_aggregator_get_adapter (self, buf);
+  g_assert (adapter != NULL);
+
   gst_adapter_push (adapter, buf);
 
   out_size = frame_size * frames_out;
@@ -981,6 +1311,7 @@ gst_tensor_aggregator_reset (GstTensorAggregator * self)
 {
   /* remove all buffers from adapter */
   gst_tensor_aggregation_clear_all (self->adapter_table);
+  g_hash_table_remove_all (self->ring_table);
 }
 
 /**
@@ -0,0 +1,66 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Compressed Tensor support
+ */
+/**
+ * @file	gsttensor_codecdec.h
+ * @date	16 Oct 2026
+ * @brief	GStreamer element to decompress tensors from network transports
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_CODEC_DEC_H__
+#define __GST_TENSOR_CODEC_DEC_H__
+
+#include <gst/gst.h>
+#include <tensor_common.h>
+#include "gsttensor_codecutil.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_TENSOR_CODEC_DEC \
+  (gst_tensor_codec_dec_get_type())
+#define GST_TENSOR_CODEC_DEC(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_TENSOR_CODEC_DEC,GstTensorCodecDec))
+#define GST_TENSOR_CODEC_DEC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_TENSOR_CODEC_DEC,GstTensorCodecDecClass))
+#define GST_IS_TENSOR_CODEC_DEC(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_TENSOR_CODEC_DEC))
+#define GST_IS_TENSOR_CODEC_DEC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_CODEC_DEC))
+
+typedef struct _GstTensorCodecDec GstTensorCodecDec;
+typedef struct _GstTensorCodecDecClass GstTensorCodecDecClass;
+
+/**
+ * @brief GstTensorCodecDec data structure.
+ */
+struct _GstTensorCodecDec
+{
+  GstElement element; /**< parent object */
+  GstPad *sinkpad; /**< sink pad */
+  GstPad *srcpad; /**< src pad */
+
+  /* <private> */
+  GstTensorsConfig in_config; /**< input tensors config */
+  GstTensorsConfig out_config; /**< output tensors config */
+  gboolean silent; /**< true to print minimized log */
+};
+
+/**
+ * @brief GstTensorCodecDecClass data structure.
+ */
+struct _GstTensorCodecDecClass
+{
+  GstElementClass parent_class; /**< parent class */
+};
+
+/**
+ * @brief Function to get type of tensor_codec_dec.
+ */
+GType gst_tensor_codec_dec_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_TENSOR_CODEC_DEC_H__ */
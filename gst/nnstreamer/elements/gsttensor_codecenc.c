@@ -0,0 +1,602 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Compressed Tensor support
+ */
+/**
+ * @file	gsttensor_codecenc.c
+ * @date	16 Oct 2026
+ * @brief	GStreamer element to compress tensors for network transports
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+/**
+ * SECTION:element-tensor_codec_enc
+ *
+ * tensor_codec_enc is a GStreamer element to encode incoming tensor into compressed format,
+ * which reduces the payload of network transports (edgesink, mqttsink and tensor_query_client).
+ *
+ * The input is always in the format of other/tensors,format=static.
+ * The output is always in the format of other/tensors,format=compressed.
+ *
+ * The property 'codec' sets the compression method: lz (LZ77, fast general-purpose compression) or none.
+ * The property 'filter' sets the filter applied before compression: shuffle (bytes of the elements are grouped by their significance)
+ * or delta (difference from the previous element, then shuffle), which helps the compression of multi-byte and floating point elements.
+ * With the default 'auto', delta is applied to floating point tensors and shuffle to other multi-byte tensors.
+ * The property 'quantization' converts float32/float64 tensors into float16 or 8-bit (lossy).
+ * If 'max-error' is given, the tensor is quantized only if the absolute error of every element is within it.
+ * A tensor is stored without compression when the compressed data is not smaller.
+ *
+ * Please see also tensor_codec_dec.
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 ... ! other/tensors,format=static ! \
+ *    tensor_codec_enc quantization=float16 max-error=0.001 ! edgesink
+ * ]|
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <nnstreamer_util.h>
+#include "gsttensor_codecenc.h"
+
+/**
+ * @brief Macro for debug mode.
+ */
+#ifndef DBG
+#define DBG (!self->silent)
+#endif
+
+GST_DEBUG_CATEGORY_STATIC (gst_tensor_codec_enc_debug);
+#define GST_CAT_DEFAULT gst_tensor_codec_enc_debug
+
+/**
+ * @brief tensor_codec_enc properties
+ */
+enum
+{
+  PROP_0,
+  PROP_SILENT,
+  PROP_CODEC,
+  PROP_FILTER,
+  PROP_QUANTIZATION,
+  PROP_MAX_ERROR
+};
+
+/**
+ * @brief Flag to print minimized log.
+ */
+#define DEFAULT_SILENT TRUE
+
+/**
+ * @brief Default compression method.
+ */
+#define DEFAULT_CODEC "lz"
+
+/**
+ * @brief Default filter (select it with tensor type).
+ */
+#define DEFAULT_FILTER "auto"
+
+/**
+ * @brief Default quantization (lossless).
+ */
+#define DEFAULT_QUANTIZATION "none"
+
+/**
+ * @brief Default maximum error of quantization (no limit).
+ */
+#define DEFAULT_MAX_ERROR (0.0)
+
+/**
+ * @brief The names of compression method (tensor_codec).
+ */
+static const gchar *codec_string[] = {
+  [_NNS_CODEC_NONE] = "none",
+  [_NNS_CODEC_LZ] = "lz",
+  NULL
+};
+
+/**
+ * @brief The names of filter (tensor_codec_filter), the last one is auto.
+ */
+static const gchar *codec_filter_string[] = {
+  [_NNS_CODEC_FILTER_NONE] = "none",
+  [_NNS_CODEC_FILTER_SHUFFLE] = "shuffle",
+  [_NNS_CODEC_FILTER_DELTA] = "delta",
+  [_NNS_CODEC_FILTER_END] = "auto",
+  NULL
+};
+
+/**
+ * @brief The names of quantization (tensor_codec_quant).
+ */
+static const gchar *codec_quant_string[] = {
+  [_NNS_CODEC_QUANT_NONE] = "none",
+  [_NNS_CODEC_QUANT_FLOAT16] = "float16",
+  [_NNS_CODEC_QUANT_INT8] = "int8",
+  NULL
+};
+
+/**
+ * @brief Template for sink pad.
+ */
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_TENSORS_CAP_DEFAULT));
+
+/**
+ * @brief Template for src pad.
+ */
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_TENSORS_COMPRESSED_CAP_DEFAULT));
+
+#define gst_tensor_codec_enc_parent_class parent_class
+G_DEFINE_TYPE (GstTensorCodecEnc, gst_tensor_codec_enc, GST_TYPE_ELEMENT);
+
+static void gst_tensor_codec_enc_finalize (GObject * object);
+static void gst_tensor_codec_enc_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_tensor_codec_enc_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static GstFlowReturn
+gst_tensor_codec_enc_chain (GstPad * pad, GstObject * parent, GstBuffer * buf);
+static GstCaps *gst_tensor_codec_enc_query_caps (GstTensorCodecEnc * self,
+    GstPad * pad, GstCaps * filter);
+static gboolean gst_tensor_codec_enc_sink_event (GstPad * pad,
+    GstObject * parent, GstEvent * event);
+static gboolean gst_tensor_codec_enc_sink_query (GstPad * pad,
+    GstObject * parent, GstQuery * query);
+
+/**
+ * @brief Initialize the tensor_codec_enc's class.
+ */
+static void
+gst_tensor_codec_enc_class_init (GstTensorCodecEncClass * klass)
+{
+  GObjectClass *object_class;
+  GstElementClass *element_class;
+
+  GST_DEBUG_CATEGORY_INIT (gst_tensor_codec_enc_debug, "tensor_codec_enc", 0,
+      "Element to compress tensors");
+
+  object_class = (GObjectClass *) klass;
+  element_class = (GstElementClass *) klass;
+
+  object_class->set_property = gst_tensor_codec_enc_set_property;
+  object_class->get_property = gst_tensor_codec_enc_get_property;
+  object_class->finalize = gst_tensor_codec_enc_finalize;
+
+  /**
+   * GstTensorCodecEnc::silent:
+   *
+   * The flag to enable/disable debugging messages.
+   */
+  g_object_class_install_property (object_class, PROP_SILENT,
+      g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
+          DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorCodecEnc::codec:
+   *
+   * The compression method (lz or none).
+   */
+  g_object_class_install_property (object_class, PROP_CODEC,
+      g_param_spec_string ("codec", "Codec",
+          "The compression method (lz or none)",
+          DEFAULT_CODEC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorCodecEnc::filter:
+   *
+   * The filter applied before compression (auto, none, shuffle or delta).
+   * 'auto' selects delta for floating point tensors and shuffle for other multi-byte tensors.
+   */
+  g_object_class_install_property (object_class, PROP_FILTER,
+      g_param_spec_string ("filter", "Filter",
+          "The filter applied before compression (auto, none, shuffle or delta)",
+          DEFAULT_FILTER, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorCodecEnc::quantization:
+   *
+   * The quantization of float32/float64 tensors (none, float16 or int8).
+   * Quantization is lossy, the decoded tensor has the original type with the quantization error.
+   */
+  g_object_class_install_property (object_class, PROP_QUANTIZATION,
+      g_param_spec_string ("quantization", "Quantization",
+          "The quantization of float32/float64 tensors (none, float16 or int8)",
+          DEFAULT_QUANTIZATION, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorCodecEnc::max-error:
+   *
+   * The maximum absolute error of quantized elements.
+   * A tensor is not quantized if the error exceeds this. 0 means no limit.
+   */
+  g_object_class_install_property (object_class, PROP_MAX_ERROR,
+      g_param_spec_double ("max-error", "Max error",
+          "The maximum absolute error of quantized elements (0 for no limit)",
+          0.0, G_MAXDOUBLE, DEFAULT_MAX_ERROR,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_template));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_template));
+
+  gst_element_class_set_static_metadata (element_class,
+      "TensorCodecEnc",
+      "Filter/Tensor",
+      "Element to compress dense tensors for network transports",
+      "Samsung Electronics Co., Ltd.");
+}
+
+/**
+ * @brief Initialize tensor_codec_enc element.
+ */
+static void
+gst_tensor_codec_enc_init (GstTensorCodecEnc * self)
+{
+  /* setup sink pad */
+  self->sinkpad = gst_pad_new_from_static_template (&sink_template, "sink");
+  gst_element_add_pad (GST_ELEMENT (self), self->sinkpad);
+
+  /* setup src pad */
+  self->srcpad = gst_pad_new_from_static_template (&src_template, "src");
+  gst_element_add_pad (GST_ELEMENT (self), self->srcpad);
+
+  /* setup chain function */
+  gst_pad_set_chain_function (self->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_codec_enc_chain));
+
+  /* setup event function */
+  gst_pad_set_event_function (self->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_codec_enc_sink_event));
+
+  gst_pad_set_query_function (self->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_codec_enc_sink_query));
+
+  /* init properties */
+  self->silent = DEFAULT_SILENT;
+  self->codec = _NNS_CODEC_LZ;
+  self->filter = _NNS_CODEC_FILTER_END;
+  self->quant = _NNS_CODEC_QUANT_NONE;
+  self->max_error = DEFAULT_MAX_ERROR;
+  gst_tensors_config_init (&self->in_config);
+}
+
+/**
+ * @brief Function to finalize instance.
+ */
+static void
+gst_tensor_codec_enc_finalize (GObject * object)
+{
+  GstTensorCodecEnc *self;
+  self = GST_TENSOR_CODEC_ENC (object);
+
+  gst_tensors_config_free (&self->in_config);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/**
+ * @brief Setter for tensor_codec_enc properties.
+ */
+static void
+gst_tensor_codec_enc_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTensorCodecEnc *self;
+
+  self = GST_TENSOR_CODEC_ENC (object);
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      self->silent = g_value_get_boolean (value);
+      break;
+    case PROP_CODEC:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = str ? find_key_strv (codec_string, str) : -1;
+
+      if (idx < 0) {
+        GST_WARNING_OBJECT (self, "Invalid codec '%s', set lz.", str);
+        idx = _NNS_CODEC_LZ;
+      }
+
+      self->codec = (tensor_codec) idx;
+      break;
+    }
+    case PROP_FILTER:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = str ? find_key_strv (codec_filter_string, str) : -1;
+
+      if (idx < 0) {
+        GST_WARNING_OBJECT (self, "Invalid filter '%s', set auto.", str);
+        idx = _NNS_CODEC_FILTER_END;
+      }
+
+      self->filter = (tensor_codec_filter) idx;
+      break;
+    }
+    case PROP_QUANTIZATION:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = str ? find_key_strv (codec_quant_string, str) : -1;
+
+      if (idx < 0) {
+        GST_WARNING_OBJECT (self, "Invalid quantization '%s', set none.", str);
+        idx = _NNS_CODEC_QUANT_NONE;
+      }
+
+      self->quant = (tensor_codec_quant) idx;
+      break;
+    }
+    case PROP_MAX_ERROR:
+      self->max_error = g_value_get_double (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief Getter for tensor_codec_enc properties.
+ */
+static void
+gst_tensor_codec_enc_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstTensorCodecEnc *self;
+
+  self = GST_TENSOR_CODEC_ENC (object);
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      g_value_set_boolean (value, self->silent);
+      break;
+    case PROP_CODEC:
+      g_value_set_string (value, codec_string[self->codec]);
+      break;
+    case PROP_FILTER:
+      g_value_set_string (value, codec_filter_string[self->filter]);
+      break;
+    case PROP_QUANTIZATION:
+      g_value_set_string (value, codec_quant_string[self->quant]);
+      break;
+    case PROP_MAX_ERROR:
+      g_value_set_double (value, self->max_error);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief Parse caps and set tensors config
+ */
+static gboolean
+gst_tensor_codec_enc_parse_caps (GstTensorCodecEnc * self,
+    const GstCaps * caps)
+{
+  GstStructure *structure;
+  GstTensorsConfig config;
+
+  g_return_val_if_fail (caps != NULL, FALSE);
+  g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
+
+  structure = gst_caps_get_structure (caps, 0);
+
+  if (!gst_tensors_config_from_structure (&config, structure) ||
+      !gst_tensors_config_validate (&config)) {
+    /** not fully configured */
+    GST_ERROR_OBJECT (self, "Failed to configure tensors config.\n");
+    return FALSE;
+  }
+
+  self->in_config = config;
+  return TRUE;
+}
+
+/**
+ * @brief This function handles sink pad event.
+ */
+static gboolean
+gst_tensor_codec_enc_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event)
+{
+  GstTensorCodecEnc *self;
+  self = GST_TENSOR_CODEC_ENC (parent);
+
+  g_return_val_if_fail (event != NULL, FALSE);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+      gboolean ret;
+
+      gst_event_parse_caps (event, &caps);
+      silent_debug_caps (self, caps, "caps");
+
+      ret = gst_tensor_codec_enc_parse_caps (self, caps);
+      gst_event_unref (event);
+
+      /* transports serialize the caps, set compressed format for remote decoder */
+      if (ret) {
+        GstCaps *out_caps;
+
+        out_caps = gst_caps_from_string (GST_TENSORS_COMPRESSED_CAP_DEFAULT);
+        if (self->in_config.rate_n >= 0 && self->in_config.rate_d > 0) {
+          gst_caps_set_simple (out_caps, "framerate", GST_TYPE_FRACTION,
+              self->in_config.rate_n, self->in_config.rate_d, NULL);
+        }
+
+        silent_debug_caps (self, out_caps, "out_caps");
+        ret = gst_pad_set_caps (self->srcpad, out_caps);
+        gst_caps_unref (out_caps);
+      }
+
+      return ret;
+    }
+    default:
+      break;
+  }
+
+  return gst_pad_event_default (pad, parent, event);
+}
+
+/**
+ * @brief Get pad caps for caps negotiation.
+ */
+static GstCaps *
+gst_tensor_codec_enc_query_caps (GstTensorCodecEnc * self, GstPad * pad,
+    GstCaps * filter)
+{
+  GstCaps *caps;
+
+  caps = gst_pad_get_current_caps (pad);
+  if (!caps) {
+    /** pad don't have current caps. use the template caps */
+    caps = gst_pad_get_pad_template_caps (pad);
+  }
+
+  silent_debug_caps (self, caps, "caps");
+  silent_debug_caps (self, filter, "filter");
+
+  if (filter) {
+    GstCaps *intersection;
+    intersection =
+        gst_caps_intersect_full (filter, caps, GST_CAPS_INTERSECT_FIRST);
+
+    gst_caps_unref (caps);
+    caps = intersection;
+  }
+
+  silent_debug_caps (self, caps, "result");
+  return caps;
+}
+
+/**
+ * @brief This function handles sink pad query.
+ */
+static gboolean
+gst_tensor_codec_enc_sink_query (GstPad * pad, GstObject * parent,
+    GstQuery * query)
+{
+  GstTensorCodecEnc *self;
+
+  self = GST_TENSOR_CODEC_ENC (parent);
+
+  GST_DEBUG_OBJECT (self, "Received %s query: %" GST_PTR_FORMAT,
+      GST_QUERY_TYPE_NAME (query), query);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:
+    {
+      GstCaps *caps;
+      GstCaps *filter;
+
+      gst_query_parse_caps (query, &filter);
+      caps = gst_tensor_codec_enc_query_caps (self, pad, filter);
+      silent_debug_caps (self, filter, "filter");
+      silent_debug_caps (self, caps, "caps");
+      gst_query_set_caps_result (query, caps);
+      gst_caps_unref (caps);
+      return TRUE;
+    }
+    case GST_QUERY_ACCEPT_CAPS:
+    {
+      GstCaps *caps;
+      GstCaps *template_caps;
+      gboolean res = FALSE;
+
+      gst_query_parse_accept_caps (query, &caps);
+      silent_debug_caps (self, caps, "caps");
+
+      if (gst_caps_is_fixed (caps)) {
+        template_caps = gst_pad_get_pad_template_caps (pad);
+
+        res = gst_caps_can_intersect (template_caps, caps);
+        gst_caps_unref (template_caps);
+      }
+
+      gst_query_set_accept_caps_result (query, res);
+      return TRUE;
+    }
+    default:
+      break;
+  }
+
+  return gst_pad_query_default (pad, parent, query);
+}
+
+
+/**
+ * @brief Internal function to transform the input buffer.
+ */
+static GstFlowReturn
+gst_tensor_codec_enc_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstTensorCodecEnc *self = GST_TENSOR_CODEC_ENC (parent);
+  GstMemory *in_mem, *out_mem;
+  GstBuffer *outbuf;
+  GstTensorsInfo *info;
+  GstTensorInfo *_info;
+  guint i;
+
+  UNUSED (pad);
+
+  info = &self->in_config.info;
+  buf = gst_tensor_buffer_from_config (buf, &self->in_config);
+  outbuf = gst_buffer_new ();
+
+  for (i = 0; i < info->num_tensors; ++i) {
+    GstTensorMetaInfo meta;
+
+    _info = gst_tensors_info_get_nth_info (info, i);
+    gst_tensor_info_convert_to_meta (_info, &meta);
+
+    meta.media_type = _NNS_TENSOR;
+
+    /* do real encoding here */
+    in_mem = gst_tensor_buffer_get_nth_memory (buf, i);
+    out_mem = gst_tensor_codec_encode (&meta, in_mem, self->codec,
+        self->filter, self->quant, self->max_error);
+    gst_memory_unref (in_mem);
+
+    if (!out_mem) {
+      nns_loge ("failed to compress tensor");
+      ret = GST_FLOW_ERROR;
+      goto done;
+    }
+
+    gst_tensor_buffer_append_memory (outbuf, out_mem, _info);
+  }
+
+  /* gst_pad_push() takes the ownership of the buffer */
+  ret = gst_pad_push (self->srcpad, outbuf);
+  outbuf = NULL;
+
+done:
+  gst_buffer_unref (buf);
+  if (outbuf)
+    gst_buffer_unref (outbuf);
+
+  return ret;
+}
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Compressed Tensor support
+ */
+/**
+ * @file	gsttensor_codecenc.h
+ * @date	16 Oct 2026
+ * @brief	GStreamer element to compress tensors for network transports
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_CODEC_ENC_H__
+#define __GST_TENSOR_CODEC_ENC_H__
+
+#include <gst/gst.h>
+#include <tensor_common.h>
+#include "gsttensor_codecutil.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_TENSOR_CODEC_ENC \
+  (gst_tensor_codec_enc_get_type())
+#define GST_TENSOR_CODEC_ENC(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_TENSOR_CODEC_ENC,GstTensorCodecEnc))
+#define GST_TENSOR_CODEC_ENC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_TENSOR_CODEC_ENC,GstTensorCodecEncClass))
+#define GST_IS_TENSOR_CODEC_ENC(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_TENSOR_CODEC_ENC))
+#define GST_IS_TENSOR_CODEC_ENC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_CODEC_ENC))
+
+typedef struct _GstTensorCodecEnc GstTensorCodecEnc;
+typedef struct _GstTensorCodecEncClass GstTensorCodecEncClass;
+
+/**
+ * @brief GstTensorCodecEnc data structure.
+ */
+struct _GstTensorCodecEnc
+{
+  GstElement element; /**< parent object */
+  GstPad *sinkpad; /**< sink pad */
+  GstPad *srcpad; /**< src pad */
+
+  /* <private> */
+  GstTensorsConfig in_config; /**< input tensors config */
+  gboolean silent; /**< true to print minimized log */
+  tensor_codec codec; /**< compression method */
+  tensor_codec_filter filter; /**< filter before compression, _NNS_CODEC_FILTER_END to select it with tensor type */
+  tensor_codec_quant quant; /**< quantization of floating point tensors */
+  gdouble max_error; /**< the maximum absolute error of quantization, 0 for no limit */
+};
+
+/**
+ * @brief GstTensorCodecEncClass data structure.
+ */
+struct _GstTensorCodecEncClass
+{
+  GstElementClass parent_class; /**< parent class */
+};
+
+/**
+ * @brief Function to get type of tensor_codec_enc.
+ */
+GType gst_tensor_codec_enc_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_TENSOR_CODEC_ENC_H__ */
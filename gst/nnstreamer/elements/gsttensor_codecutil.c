@@ -0,0 +1,757 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Compressed Tensor support
+ */
+/**
+ * @file	gsttensor_codecutil.c
+ * @date	16 Oct 2026
+ * @brief	Util functions for tensor_codec encoder and decoder.
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ *
+ * A tensor is encoded in three steps, each of them is optional:
+ * 1. quantization of floating point elements (float16, or 8-bit with scale and zero point),
+ * 2. filter (byte-shuffle of the elements, with the difference from the previous element for delta),
+ * 3. compression (LZ77 with literal runs and 16-bit back-references).
+ *
+ * The compressed data is a list of sequences. Each sequence starts with a token,
+ * the upper 4 bits are the length of literals and the lower 4 bits are the length of match minus 4.
+ * The length 15 is extended with the following bytes (added until a byte is not 255).
+ * The literals follow the token, then the offset of match (16-bit, little endian) and the extended match length.
+ * The last sequence has the literals only.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <nnstreamer_util.h>
+#include <tensor_common.h>
+#include "gsttensor_codecutil.h"
+
+/**
+ * @brief The minimum length of match in LZ compression.
+ */
+#define CODEC_LZ_MIN_MATCH (4U)
+
+/**
+ * @brief The maximum offset of match in LZ compression.
+ */
+#define CODEC_LZ_MAX_OFFSET (65535U)
+
+/**
+ * @brief The number of bits of hash table in LZ compression.
+ */
+#define CODEC_LZ_HASH_BITS (14U)
+
+/**
+ * @brief The search step increases after 2^(this) consecutive misses (incompressible data).
+ */
+#define CODEC_LZ_SKIP_TRIGGER (6U)
+
+/**
+ * @brief Macro to get the hash of 4 bytes.
+ */
+#define CODEC_LZ_HASH(v) (((guint32) (v) * 2654435761U) >> (32U - CODEC_LZ_HASH_BITS))
+
+/**
+ * @brief The maximum size of compressed data.
+ */
+#define CODEC_LZ_BOUND(s) ((s) + (s) / 255U + 16U)
+
+/**
+ * @brief Macro to group the bytes of the elements by their significance (with the difference from previous element if delta is true).
+ */
+#define codec_shuffle_loop(T,s,d,n,delta) do { \
+    const T *_in = (const T *) (s); \
+    guint8 *_out = (guint8 *) (d); \
+    T _v, _prev = 0; \
+    gsize _i, _b; \
+    for (_i = 0; _i < (n); _i++) { \
+      _v = (delta) ? (T) (_in[_i] - _prev) : _in[_i]; \
+      _prev = _in[_i]; \
+      for (_b = 0; _b < sizeof (T); _b++) \
+        _out[_b * (n) + _i] = (guint8) (_v >> (_b * 8)); \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to restore the elements from the bytes grouped by their significance.
+ */
+#define codec_unshuffle_loop(T,s,d,n,delta) do { \
+    const guint8 *_in = (const guint8 *) (s); \
+    T *_out = (T *) (d); \
+    T _v, _prev = 0; \
+    gsize _i, _b; \
+    for (_i = 0; _i < (n); _i++) { \
+      _v = 0; \
+      for (_b = 0; _b < sizeof (T); _b++) \
+        _v |= (T) ((T) _in[_b * (n) + _i] << (_b * 8)); \
+      if (delta) \
+        _v = (T) (_v + _prev); \
+      _out[_i] = _prev = _v; \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to get the floating point element as double.
+ */
+#define codec_get_value(d,t,i) \
+    (((t) == _NNS_FLOAT32) ? (gdouble) ((const gfloat *) (d))[i] : ((const gdouble *) (d))[i])
+
+/**
+ * @brief Macro to set the floating point element.
+ */
+#define codec_set_value(d,t,i,v) do { \
+    if ((t) == _NNS_FLOAT32) \
+      ((gfloat *) (d))[i] = (gfloat) (v); \
+    else \
+      ((gdouble *) (d))[i] = (v); \
+  } while (0)
+
+/**
+ * @brief Internal function to read 4 bytes (unaligned).
+ */
+static inline guint32
+gst_tensor_codec_read32 (const guint8 * p)
+{
+  guint32 v;
+
+  memcpy (&v, p, sizeof (guint32));
+  return v;
+}
+
+/**
+ * @brief Internal function to write the extended length.
+ */
+static guint8 *
+gst_tensor_codec_lz_put_length (guint8 * op, gsize len)
+{
+  while (len >= 255U) {
+    *op++ = 255U;
+    len -= 255U;
+  }
+
+  *op++ = (guint8) len;
+  return op;
+}
+
+/**
+ * @brief Internal function to read the extended length.
+ */
+static gboolean
+gst_tensor_codec_lz_get_length (const guint8 ** ip, const guint8 * iend,
+    gsize * len)
+{
+  guint8 b;
+
+  do {
+    if (*ip >= iend)
+      return FALSE;
+
+    b = *(*ip)++;
+    *len += b;
+  } while (b == 255U);
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to write a sequence (literals and match). The match length is 0 for the last sequence.
+ */
+static guint8 *
+gst_tensor_codec_lz_put_sequence (guint8 * op, const guint8 * literals,
+    gsize literal_len, gsize offset, gsize match_len)
+{
+  guint8 *token = op++;
+  gsize mlen = (match_len > 0) ? match_len - CODEC_LZ_MIN_MATCH : 0;
+
+  *token = (guint8) ((MIN (literal_len, 15U) << 4) | MIN (mlen, 15U));
+
+  if (literal_len >= 15U)
+    op = gst_tensor_codec_lz_put_length (op, literal_len - 15U);
+
+  memcpy (op, literals, literal_len);
+  op += literal_len;
+
+  if (match_len > 0) {
+    *op++ = (guint8) (offset & 0xFF);
+    *op++ = (guint8) (offset >> 8);
+
+    if (mlen >= 15U)
+      op = gst_tensor_codec_lz_put_length (op, mlen - 15U);
+  }
+
+  return op;
+}
+
+/**
+ * @brief Internal function to compress the data. The output should be larger than CODEC_LZ_BOUND (size).
+ * @return The size of compressed data.
+ */
+static gsize
+gst_tensor_codec_lz_compress (const guint8 * src, gsize size, guint8 * dst)
+{
+  const guint8 *ip = src, *anchor = src, *iend = src + size, *match;
+  guint8 *op = dst;
+  guint32 *table;
+  guint32 seq, h;
+  gsize pos, ref, len, misses = 0;
+
+  /* position + 1 of the last 4 bytes with same hash, 0 if empty */
+  table = g_new0 (guint32, 1U << CODEC_LZ_HASH_BITS);
+
+  while (ip + CODEC_LZ_MIN_MATCH <= iend) {
+    pos = (gsize) (ip - src);
+    seq = gst_tensor_codec_read32 (ip);
+    h = CODEC_LZ_HASH (seq);
+    ref = table[h];
+    table[h] = (guint32) (pos + 1);
+
+    if (ref == 0 || pos + 1 - ref > CODEC_LZ_MAX_OFFSET ||
+        gst_tensor_codec_read32 (src + ref - 1) != seq) {
+      ip += 1 + (misses++ >> CODEC_LZ_SKIP_TRIGGER);
+      continue;
+    }
+
+    match = src + ref - 1;
+    len = CODEC_LZ_MIN_MATCH;
+    while (ip + len < iend && match[len] == ip[len])
+      len++;
+
+    op = gst_tensor_codec_lz_put_sequence (op, anchor, (gsize) (ip - anchor),
+        (gsize) (ip - match), len);
+
+    ip += len;
+    anchor = ip;
+    misses = 0;
+  }
+
+  op = gst_tensor_codec_lz_put_sequence (op, anchor, (gsize) (iend - anchor),
+      0, 0);
+
+  g_free (table);
+  return (gsize) (op - dst);
+}
+
+/**
+ * @brief Internal function to decompress the data.
+ * @return TRUE if the size of decompressed data is exactly same as the output size.
+ */
+static gboolean
+gst_tensor_codec_lz_decompress (const guint8 * src, gsize size, guint8 * dst,
+    gsize dst_size)
+{
+  const guint8 *ip = src, *iend = src + size;
+  guint8 *op = dst, *oend = dst + dst_size;
+  guint8 token;
+  gsize len, offset, i;
+
+  while (ip < iend) {
+    token = *ip++;
+
+    /* literals */
+    len = token >> 4;
+    if (len == 15U && !gst_tensor_codec_lz_get_length (&ip, iend, &len))
+      return FALSE;
+
+    if (len > (gsize) (iend - ip) || len > (gsize) (oend - op))
+      return FALSE;
+
+    memcpy (op, ip, len);
+    op += len;
+    ip += len;
+
+    /* the last sequence */
+    if (ip == iend)
+      break;
+
+    /* match */
+    if (iend - ip < 2)
+      return FALSE;
+
+    offset = (gsize) ip[0] | ((gsize) ip[1] << 8);
+    ip += 2;
+
+    if (offset == 0 || offset > (gsize) (op - dst))
+      return FALSE;
+
+    len = token & 0x0F;
+    if (len == 15U && !gst_tensor_codec_lz_get_length (&ip, iend, &len))
+      return FALSE;
+
+    len += CODEC_LZ_MIN_MATCH;
+    if (len > (gsize) (oend - op))
+      return FALSE;
+
+    if (offset >= len) {
+      memcpy (op, op - offset, len);
+    } else {
+      /* overlapped match, repeat the pattern */
+      for (i = 0; i < len; i++)
+        op[i] = op[i - offset];
+    }
+
+    op += len;
+  }
+
+  return (op == oend);
+}
+
+/**
+ * @brief Internal function to group the bytes of the elements.
+ */
+static void
+gst_tensor_codec_shuffle (gconstpointer src, gpointer dst, gsize esize,
+    gsize count, gboolean delta)
+{
+  switch (esize) {
+    case 1:
+      codec_shuffle_loop (guint8, src, dst, count, delta);
+      break;
+    case 2:
+      codec_shuffle_loop (guint16, src, dst, count, delta);
+      break;
+    case 4:
+      codec_shuffle_loop (guint32, src, dst, count, delta);
+      break;
+    default:
+      codec_shuffle_loop (guint64, src, dst, count, delta);
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to restore the elements from the grouped bytes.
+ */
+static void
+gst_tensor_codec_unshuffle (gconstpointer src, gpointer dst, gsize esize,
+    gsize count, gboolean delta)
+{
+  switch (esize) {
+    case 1:
+      codec_unshuffle_loop (guint8, src, dst, count, delta);
+      break;
+    case 2:
+      codec_unshuffle_loop (guint16, src, dst, count, delta);
+      break;
+    case 4:
+      codec_unshuffle_loop (guint32, src, dst, count, delta);
+      break;
+    default:
+      codec_unshuffle_loop (guint64, src, dst, count, delta);
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to convert float to IEEE half precision (round to nearest even).
+ */
+static guint16
+gst_tensor_codec_float_to_half (gfloat value)
+{
+  guint32 x, mant, rem, halfway, shift;
+  guint16 sign, half;
+  gint32 exp;
+
+  memcpy (&x, &value, sizeof (guint32));
+
+  sign = (guint16) ((x >> 16) & 0x8000U);
+  mant = x & 0x7FFFFFU;
+
+  /* inf or nan */
+  if (((x >> 23) & 0xFFU) == 0xFFU)
+    return sign | 0x7C00U | (mant ? 0x200U : 0U);
+
+  exp = (gint32) ((x >> 23) & 0xFFU) - 127 + 15;
+
+  /* overflow */
+  if (exp >= 31)
+    return sign | 0x7C00U;
+
+  /* subnormal or zero */
+  if (exp <= 0) {
+    if (exp < -10)
+      return sign;
+
+    mant |= 0x800000U;
+    shift = (guint32) (14 - exp);
+    half = (guint16) (mant >> shift);
+    rem = mant & ((1U << shift) - 1U);
+    halfway = 1U << (shift - 1U);
+
+    if (rem > halfway || (rem == halfway && (half & 1U)))
+      half++;
+
+    return sign | half;
+  }
+
+  /* the carry of rounding goes to the exponent */
+  half = (guint16) (((guint32) exp << 10) | (mant >> 13));
+  rem = mant & 0x1FFFU;
+
+  if (rem > 0x1000U || (rem == 0x1000U && (half & 1U)))
+    half++;
+
+  return sign | half;
+}
+
+/**
+ * @brief Internal function to convert IEEE half precision to float.
+ */
+static gfloat
+gst_tensor_codec_half_to_float (guint16 half)
+{
+  guint32 x, sign, exp, mant;
+  gfloat value;
+
+  sign = ((guint32) half & 0x8000U) << 16;
+  exp = ((guint32) half >> 10) & 0x1FU;
+  mant = (guint32) half & 0x3FFU;
+
+  if (exp == 0x1FU) {
+    x = sign | 0x7F800000U | (mant << 13);
+  } else if (exp == 0) {
+    if (mant == 0) {
+      x = sign;
+    } else {
+      /* normalize subnormal */
+      exp = 113U;
+      while (!(mant & 0x400U)) {
+        mant <<= 1;
+        exp--;
+      }
+
+      x = sign | (exp << 23) | ((mant & 0x3FFU) << 13);
+    }
+  } else {
+    x = sign | ((exp + 112U) << 23) | (mant << 13);
+  }
+
+  memcpy (&value, &x, sizeof (gfloat));
+  return value;
+}
+
+/**
+ * @brief Internal function to quantize floating point elements.
+ * @return FALSE if the elements cannot be quantized within the error bound.
+ */
+static gboolean
+gst_tensor_codec_quantize (gconstpointer data, tensor_type type, gsize count,
+    tensor_codec_quant quant, gdouble max_error, gpointer out,
+    GstCompressedTensorInfo * info)
+{
+  gdouble v, r, q, min, max, err = 0.0;
+  gfloat scale, zero;
+  guint16 half;
+  gsize i;
+
+  if (quant == _NNS_CODEC_QUANT_FLOAT16) {
+    for (i = 0; i < count; i++) {
+      v = codec_get_value (data, type, i);
+      half = gst_tensor_codec_float_to_half ((gfloat) v);
+      ((guint16 *) out)[i] = half;
+
+      if (!isfinite (v))
+        continue;
+
+      /* overflow */
+      r = gst_tensor_codec_half_to_float (half);
+      if (!isfinite (r))
+        return FALSE;
+
+      err = MAX (err, fabs (v - r));
+    }
+  } else {
+    min = G_MAXDOUBLE;
+    max = -G_MAXDOUBLE;
+
+    for (i = 0; i < count; i++) {
+      v = codec_get_value (data, type, i);
+      if (!isfinite (v))
+        return FALSE;
+
+      min = MIN (min, v);
+      max = MAX (max, v);
+    }
+
+    scale = (gfloat) ((max - min) / 255.0);
+    zero = (gfloat) min;
+
+    if (!isfinite (scale) || !isfinite (zero))
+      return FALSE;
+
+    /* all elements are same */
+    if (scale <= 0.0f)
+      scale = 1.0f;
+
+    for (i = 0; i < count; i++) {
+      v = codec_get_value (data, type, i);
+      q = floor ((v - zero) / scale + 0.5);
+      q = CLAMP (q, 0.0, 255.0);
+      ((guint8 *) out)[i] = (guint8) q;
+
+      r = zero + q * scale;
+      err = MAX (err, fabs (v - r));
+    }
+
+    if (max_error > 0.0 && err > max_error)
+      return FALSE;
+
+    info->scale = scale;
+    info->zero_point = zero;
+  }
+
+  return (max_error <= 0.0 || err <= max_error);
+}
+
+/**
+ * @brief Internal function to restore floating point elements from quantized data.
+ */
+static void
+gst_tensor_codec_dequantize (gconstpointer data, tensor_type type,
+    gsize count, const GstCompressedTensorInfo * info, gpointer out)
+{
+  gdouble v;
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    if (info->quant == _NNS_CODEC_QUANT_FLOAT16) {
+      v = gst_tensor_codec_half_to_float (((const guint16 *) data)[i]);
+    } else {
+      v = (gdouble) info->zero_point +
+          (gdouble) ((const guint8 *) data)[i] * info->scale;
+    }
+
+    codec_set_value (out, type, i, v);
+  }
+}
+
+/**
+ * @brief Make compressed tensor with input dense tensor.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of dense tensor data
+ * @param[in] codec compression method, _NNS_CODEC_NONE to store the filtered elements
+ * @param[in] filter filter applied before compression, _NNS_CODEC_FILTER_END to select it with tensor type
+ * @param[in] quant quantization of floating point elements, ignored for other types
+ * @param[in] max_error the maximum absolute error of quantized elements, 0 for no limit. The tensor is not quantized if the error exceeds this.
+ * @return pointer of GstMemory with compressed tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+GstMemory *
+gst_tensor_codec_encode (GstTensorMetaInfo * meta, GstMemory * mem,
+    tensor_codec codec, tensor_codec_filter filter, tensor_codec_quant quant,
+    gdouble max_error)
+{
+  GstMemory *compressed = NULL;
+  GstMapInfo map;
+  GstCompressedTensorInfo info;
+  gconstpointer input;
+  guint8 *output, *quantized = NULL, *filtered = NULL;
+  gsize header_size, element_size, element_count, data_size, size, bound;
+  gboolean is_float;
+
+  if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
+    nns_loge ("Failed to map given memory");
+    return NULL;
+  }
+
+  header_size = gst_tensor_meta_info_get_header_size (meta);
+  element_size = gst_tensor_get_element_size (meta->type);
+  element_count = gst_tensor_get_element_count (meta->dimension);
+
+  if (header_size == 0 || element_count == 0 || (element_size != 1 &&
+          element_size != 2 && element_size != 4 && element_size != 8)) {
+    nns_loge ("Got invalid meta info");
+    goto done;
+  }
+
+  if (map.size < element_size * element_count) {
+    nns_loge ("Invalid dense tensor, the size is too small (%zd, expected %zd).",
+        map.size, element_size * element_count);
+    goto done;
+  }
+
+  memset (&info, 0, sizeof (GstCompressedTensorInfo));
+  input = map.data;
+  is_float = (meta->type == _NNS_FLOAT16 || meta->type == _NNS_FLOAT32 ||
+      meta->type == _NNS_FLOAT64);
+
+  /* quantization is lossy, keep the elements if it exceeds the error bound */
+  if (quant > _NNS_CODEC_QUANT_NONE && quant < _NNS_CODEC_QUANT_END &&
+      (meta->type == _NNS_FLOAT32 || meta->type == _NNS_FLOAT64)) {
+    quantized = g_malloc (element_count * sizeof (guint16));
+
+    if (gst_tensor_codec_quantize (map.data, (tensor_type) meta->type,
+            element_count, quant, max_error, quantized, &info)) {
+      input = quantized;
+      element_size = (quant == _NNS_CODEC_QUANT_FLOAT16) ? 2 : 1;
+      info.quant = quant;
+    } else {
+      nns_logd ("Cannot quantize the tensor within the error bound, keep the elements.");
+    }
+  }
+
+  data_size = element_size * element_count;
+  if (data_size > G_MAXUINT32) {
+    nns_loge ("The tensor is too large to be compressed (%zd).", data_size);
+    goto done;
+  }
+
+  /* select the filter with tensor type */
+  if (filter >= _NNS_CODEC_FILTER_END) {
+    if (is_float)
+      filter = _NNS_CODEC_FILTER_DELTA;
+    else
+      filter = (element_size > 1) ? _NNS_CODEC_FILTER_SHUFFLE :
+          _NNS_CODEC_FILTER_NONE;
+  }
+
+  /* byte-shuffle of 1-byte elements does nothing */
+  if (filter == _NNS_CODEC_FILTER_SHUFFLE && element_size == 1)
+    filter = _NNS_CODEC_FILTER_NONE;
+
+  if (filter != _NNS_CODEC_FILTER_NONE) {
+    filtered = g_malloc (data_size);
+    gst_tensor_codec_shuffle (input, filtered, element_size, element_count,
+        filter == _NNS_CODEC_FILTER_DELTA);
+    input = filtered;
+  }
+
+  info.filter = filter;
+
+  /* store the elements if compressed data is not smaller */
+  bound = (codec == _NNS_CODEC_LZ) ? CODEC_LZ_BOUND (data_size) : data_size;
+  output = g_malloc (header_size + bound);
+  size = 0;
+
+  if (codec == _NNS_CODEC_LZ)
+    size = gst_tensor_codec_lz_compress (input, data_size,
+        output + header_size);
+
+  if (codec != _NNS_CODEC_LZ || size >= data_size) {
+    codec = _NNS_CODEC_NONE;
+    size = data_size;
+    memcpy (output + header_size, input, data_size);
+  }
+
+  info.codec = codec;
+  info.size = (uint32_t) size;
+
+  /** update meta and the parameters of compressed data */
+  if (!gst_tensor_meta_info_set_compressed (meta, &info) ||
+      !gst_tensor_meta_info_update_compressed_header (meta, &info, output)) {
+    nns_loge ("Failed to update the header of compressed tensor.");
+    g_free (output);
+    goto done;
+  }
+
+  compressed = gst_memory_new_wrapped (0, output, header_size + bound, 0,
+      header_size + size, output, g_free);
+
+done:
+  g_free (quantized);
+  g_free (filtered);
+  gst_memory_unmap (mem, &map);
+  return compressed;
+}
+
+/**
+ * @brief Make dense tensor with input compressed tensor.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of compressed tensor data
+ * @return pointer of GstMemory with dense tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+GstMemory *
+gst_tensor_codec_decode (GstTensorMetaInfo * meta, GstMemory * mem)
+{
+  GstMemory *dense = NULL;
+  GstMapInfo map;
+  GstCompressedTensorInfo info;
+  gconstpointer input;
+  guint8 *output, *decompressed = NULL, *filtered = NULL;
+  gsize header_size, element_size, element_count, data_size, output_size;
+
+  if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
+    nns_loge ("Failed to map given memory");
+    return NULL;
+  }
+
+  if (!gst_tensor_meta_info_parse_compressed_header (meta, &info, map.data)) {
+    nns_loge ("Failed to parse compressed tensor meta info from given memory");
+    goto done;
+  }
+
+  header_size = gst_tensor_meta_info_get_header_size (meta);
+  if (header_size + info.size > map.size) {
+    nns_loge ("Invalid compressed tensor, the size is too small (%zd, expected %zd).",
+        map.size, header_size + info.size);
+    goto done;
+  }
+
+  input = map.data + header_size;
+
+  meta->format = _NNS_TENSOR_FORMAT_STATIC;
+
+  element_size = gst_tensor_get_element_size (meta->type);
+  element_count = gst_tensor_get_element_count (meta->dimension);
+  output_size = gst_tensor_meta_info_get_data_size (meta);
+
+  if (output_size == 0 || (element_size != 1 && element_size != 2 &&
+          element_size != 4 && element_size != 8)) {
+    nns_loge ("Got invalid meta info");
+    goto done;
+  }
+
+  if (info.quant == _NNS_CODEC_QUANT_FLOAT16)
+    element_size = 2;
+  else if (info.quant == _NNS_CODEC_QUANT_INT8)
+    element_size = 1;
+
+  data_size = element_size * element_count;
+
+  if (info.codec == _NNS_CODEC_LZ) {
+    decompressed = g_malloc (data_size);
+
+    if (!gst_tensor_codec_lz_decompress (input, info.size, decompressed,
+            data_size)) {
+      nns_loge ("Failed to decompress tensor data (%u bytes, expected %zd).",
+          info.size, data_size);
+      goto done;
+    }
+
+    input = decompressed;
+  } else if (info.size != data_size) {
+    nns_loge ("Invalid compressed tensor, unexpected data size (%u, expected %zd).",
+        info.size, data_size);
+    goto done;
+  }
+
+  if (info.filter == _NNS_CODEC_FILTER_DELTA ||
+      (info.filter == _NNS_CODEC_FILTER_SHUFFLE && element_size > 1)) {
+    filtered = g_malloc (data_size);
+    gst_tensor_codec_unshuffle (input, filtered, element_size, element_count,
+        info.filter == _NNS_CODEC_FILTER_DELTA);
+    input = filtered;
+  }
+
+  if (info.quant != _NNS_CODEC_QUANT_NONE) {
+    output = g_malloc (output_size);
+    gst_tensor_codec_dequantize (input, (tensor_type) meta->type,
+        element_count, &info, output);
+  } else if (filtered) {
+    output = filtered;
+    filtered = NULL;
+  } else if (decompressed) {
+    output = decompressed;
+    decompressed = NULL;
+  } else {
+    output = _g_memdup (input, output_size);
+  }
+
+  dense = gst_memory_new_wrapped (0, output, output_size, 0, output_size,
+      output, g_free);
+
+done:
+  g_free (decompressed);
+  g_free (filtered);
+  gst_memory_unmap (mem, &map);
+  return dense;
+}
@@ -0,0 +1,46 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Compressed Tensor support
+ */
+/**
+ * @file	gsttensor_codecutil.h
+ * @date	16 Oct 2026
+ * @brief	Util functions for tensor_codec encoder and decoder.
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_CODEC_UTIL_H__
+#define __GST_TENSOR_CODEC_UTIL_H__
+
+#include <gst/gst.h>
+#include <tensor_typedef.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Make compressed tensor with input dense tensor.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of dense tensor data
+ * @param[in] codec compression method, _NNS_CODEC_NONE to store the filtered elements
+ * @param[in] filter filter applied before compression, _NNS_CODEC_FILTER_END to select it with tensor type
+ * @param[in] quant quantization of floating point elements, ignored for other types
+ * @param[in] max_error the maximum absolute error of quantized elements, 0 for no limit. The tensor is not quantized if the error exceeds this.
+ * @return pointer of GstMemory with compressed tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+extern GstMemory *
+gst_tensor_codec_encode (GstTensorMetaInfo * meta, GstMemory * mem,
+    tensor_codec codec, tensor_codec_filter filter, tensor_codec_quant quant,
+    gdouble max_error);
+
+/**
+ * @brief Make dense tensor with input compressed tensor.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of compressed tensor data
+ * @return pointer of GstMemory with dense tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+extern GstMemory *
+gst_tensor_codec_decode (GstTensorMetaInfo * meta, GstMemory * mem);
+
+G_END_DECLS
+#endif /* __GST_TENSOR_CODEC_UTIL_H__ */
@@ -165,6 +165,8 @@ gst_tensor_converter_change_state (GstElement * element,
 static void gst_tensor_converter_reset (GstTensorConverter * self);
 static GstCaps *gst_tensor_converter_query_caps (GstTensorConverter * self,
     GstPad * pad, GstCaps * filter);
+static GstCaps *gst_tensor_converter_get_sink_template_caps (GstTensorConverter
+    * self);
 static gboolean gst_tensor_converter_parse_caps (GstTensorConverter * self,
     const GstCaps * caps);
 static void gst_tensor_converter_update_caps (GstTensorConverter * self);
@@ -270,7 +272,7 @@ gst_tensor_converter_class_init (GstTensorConverterClass * klass)
    */
   g_object_class_install_property (object_class, PROP_MODE,
       g_param_spec_string ("mode", "Mode",
-          "Converter mode. e.g., mode=custom-code:<registered callback name>. For detail, refer to https://github.com/nnstreamer/nnstreamer/blob/main/gst/nnstreamer/elements/gsttensor_converter.md#custom-converter",
+          "Converter mode. e.g., mode=custom-code:<registered callback name> or mode=preprocess:width:224,height:224,type:float32. For detail, refer to https://github.com/nnstreamer/nnstreamer/blob/main/gst/nnstreamer/elements/gsttensor_converter.md",
           "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   /* set src pad template */
@@ -366,11 +368,14 @@ gst_tensor_converter_init (GstTensorConverter * self)
   self->custom.func = NULL;
   self->custom.data = NULL;
   self->do_not_append_header = FALSE;
+  self->preprocess = NULL;
   gst_tensors_info_init (&self->tensors_info);
   gst_tensors_config_init (&self->tensors_config);
   self->tensors_configured = FALSE;
 
   self->adapter_table = gst_tensor_aggregation_init ();
+  self->metrics = gst_tensor_metrics_new (GST_ELEMENT (self),
+      "tensor_converter");
   gst_tensor_converter_reset (self);
 }
 
@@ -392,10 +397,12 @@ gst_tensor_converter_finalize (GObject * object)
 
   g_free (self->mode_option);
   g_free (self->ext_fw);
+  gst_tensor_preprocess_free (self->preprocess);
   self->custom.func = NULL;
   self->custom.data = NULL;
   if (self->externalConverter && self->externalConverter->close)
     self->externalConverter->close (&self->priv_data);
+  gst_tensor_metrics_free (self->metrics);
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -480,7 +487,14 @@ gst_tensor_converter_set_property (GObject * object, guint prop_id,
         break;
       }
 
-      self->mode_option = g_strdup (strv[1]);
+      g_free (self->mode_option);
+      if (g_ascii_strcasecmp (strv[0], "preprocess") == 0) {
+        /* the options of preprocess mode have key:value pairs, keep all after the mode */
+        self->mode_option = g_strdup (strchr (param, ':') + 1);
+      } else {
+        self->mode_option = g_strdup (strv[1]);
+      }
+
       if (g_ascii_strcasecmp (strv[0], "custom-code") == 0) {
         self->mode = _CONVERTER_MODE_CUSTOM_CODE;
         ptr = get_subplugin (NNS_CUSTOM_CONVERTER, self->mode_option);
@@ -496,6 +510,15 @@ gst_tensor_converter_set_property (GObject * object, guint prop_id,
         self->mode = _CONVERTER_MODE_CUSTOM_SCRIPT;
         /** @todo detects framework based on the script extension */
         self->ext_fw = g_strdup ("python3");
+      } else if (g_ascii_strcasecmp (strv[0], "preprocess") == 0) {
+        gst_tensor_preprocess_free (self->preprocess);
+        self->preprocess = gst_tensor_preprocess_new (self->mode_option);
+        if (!self->preprocess) {
+          nns_logw
+              ("Failed to parse the option of tensor_converter preprocess mode, \"%s\". Refer to https://github.com/nnstreamer/nnstreamer/blob/main/gst/nnstreamer/elements/gsttensor_converter.md#preprocess-mode for detail.",
+              self->mode_option);
+        }
+        self->mode = _CONVERTER_MODE_PREPROCESS;
       }
       g_strfreev (strv);
 
@@ -569,6 +592,9 @@ gst_tensor_converter_get_property (GObject * object, guint prop_id,
         else if (self->mode == _CONVERTER_MODE_CUSTOM_SCRIPT)
           mode_str =
               g_strdup_printf ("%s:%s", "custom-script", self->mode_option);
+        else if (self->mode == _CONVERTER_MODE_PREPROCESS)
+          mode_str =
+              g_strdup_printf ("%s:%s", "preprocess", self->mode_option);
       }
       g_value_take_string (value, mode_str);
       break;
@@ -683,7 +709,7 @@ gst_tensor_converter_sink_query (GstPad * pad, GstObject * parent,
       silent_debug_caps (self, caps, "accept-caps");
 
       if (gst_caps_is_fixed (caps)) {
-        template_caps = gst_pad_get_pad_template_caps (pad);
+        template_caps = gst_tensor_converter_get_sink_template_caps (self);
 
         res = gst_caps_can_intersect (template_caps, caps);
         gst_caps_unref (template_caps);
@@ -951,6 +977,13 @@ _gst_tensor_converter_chain_push (GstTensorConverter * self, GstBuffer * buf)
   }
 
   silent_debug_timestamp (self, buffer);
+
+  /* the conversion time, excluding the downstream processing */
+  gst_tensor_metrics_record (self->metrics, -1,
+      g_get_monotonic_time () - self->chain_time, self->chain_size,
+      gst_buffer_get_size (buffer));
+  self->chain_size = 0;
+
   return gst_pad_push (self->srcpad, buffer);
 }
 
@@ -1021,6 +1054,64 @@ _gst_tensor_converter_chain_chunk (GstTensorConverter * self,
   return ret;
 }
 
+/**
+ * @brief Convert the video frame to the output tensor with the fused preprocessing (mode=preprocess).
+ * @return The buffer with the output tensor, NULL on error.
+ */
+static GstBuffer *
+gst_tensor_converter_chain_preprocess (GstTensorConverter * self,
+    GstBuffer * buf)
+{
+  GstMapInfo src_info, dest_info;
+  GstTensorInfo info;
+  GstBuffer *outbuf;
+  gsize out_size;
+  gboolean ret;
+
+  gst_tensor_preprocess_get_info (self->preprocess, &info);
+  out_size = gst_tensor_info_get_size (&info);
+  gst_tensor_info_free (&info);
+
+  if (!gst_buffer_map (buf, &src_info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self,
+        "Cannot map src buffer at tensor_converter/preprocess. The incoming buffer (GstBuffer) for the sinkpad of tensor_converter cannot be mapped for reading.");
+    return NULL;
+  }
+
+  if (src_info.size < gst_tensor_preprocess_get_input_size (self->preprocess)) {
+    GST_ERROR_OBJECT (self,
+        "The incoming video frame is too small (%zd bytes) for the negotiated video info (%zd bytes).",
+        src_info.size, gst_tensor_preprocess_get_input_size (self->preprocess));
+    gst_buffer_unmap (buf, &src_info);
+    return NULL;
+  }
+
+  outbuf = gst_buffer_new_and_alloc (out_size);
+  if (!gst_buffer_map (outbuf, &dest_info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self,
+        "Cannot map dest buffer at tensor_converter/preprocess. The outgoing buffer (GstBuffer) for the srcpad of tensor_converter cannot be mapped for writing.");
+    gst_buffer_unmap (buf, &src_info);
+    gst_buffer_unref (outbuf);
+    return NULL;
+  }
+
+  ret = gst_tensor_preprocess_process (self->preprocess, src_info.data,
+      dest_info.data);
+
+  gst_buffer_unmap (buf, &src_info);
+  gst_buffer_unmap (outbuf, &dest_info);
+
+  if (!ret) {
+    GST_ERROR_OBJECT (self, "Failed to preprocess the incoming video frame.");
+    gst_buffer_unref (outbuf);
+    return NULL;
+  }
+
+  /** copy timestamps */
+  gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  return outbuf;
+}
+
 /**
  * @brief Chain function, this function does the actual processing.
  */
@@ -1040,6 +1131,8 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   g_return_val_if_fail (buf_size > 0, GST_FLOW_ERROR);
 
   self = GST_TENSOR_CONVERTER (parent);
+  self->chain_time = g_get_monotonic_time ();
+  self->chain_size += buf_size;
 
   /** This is an internal logic error. */
   g_assert (self->tensors_configured);
@@ -1062,6 +1155,16 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       guint color, width, height;
       gsize type;
 
+      if (self->mode == _CONVERTER_MODE_PREPROCESS) {
+        /* colorspace, resize and normalization in a single pass */
+        inbuf = gst_tensor_converter_chain_preprocess (self, buf);
+        if (inbuf == NULL)
+          goto error;
+
+        frame_size = gst_buffer_get_size (inbuf);
+        break;
+      }
+
       color = config->info.info[0].dimension[0];
       width = config->info.info[0].dimension[1];
       height = config->info.info[0].dimension[2];
@@ -1354,6 +1457,7 @@ gst_tensor_converter_change_state (GstElement * element,
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_tensor_converter_reset (self);
+      gst_tensor_metrics_dump (TRUE);
       break;
     default:
       break;
@@ -1376,6 +1480,8 @@ gst_tensor_converter_reset (GstTensorConverter * self)
   gst_segment_init (&self->segment, GST_FORMAT_TIME);
 
   self->old_timestamp = GST_CLOCK_TIME_NONE;
+  self->chain_time = 0;
+  self->chain_size = 0;
 }
 
 /**
@@ -1541,6 +1647,79 @@ gst_tensor_converter_parse_video (GstTensorConverter * self,
   return (config->info.info[0].type != _NNS_END);
 }
 
+/**
+ * @brief Set the tensors config structure from video info with the preprocessing options (mode=preprocess).
+ * @param self this pointer to GstTensorConverter
+ * @param caps caps for media stream
+ * @param config tensors config structure to be filled
+ * @note The plane offsets and strides of the video info are given to the preprocessing, so the stride padding is skipped without a copy.
+ * @return TRUE if supported type
+ */
+static gboolean
+gst_tensor_converter_parse_video_preprocess (GstTensorConverter * self,
+    const GstCaps * caps, GstTensorsConfig * config)
+{
+  GstVideoInfo vinfo;
+  tensor_preprocess_format format;
+  gsize offset[3] = { 0, };
+  gint stride[3] = { 0, };
+  guint i;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  gst_tensors_config_init (config);
+
+  if (self->preprocess == NULL) {
+    GST_ERROR_OBJECT (self,
+        "The option of preprocess mode is not given or invalid (mode=preprocess:%s).",
+        GST_STR_NULL (self->mode_option));
+    return FALSE;
+  }
+
+  gst_video_info_init (&vinfo);
+  if (!gst_video_info_from_caps (&vinfo, caps)) {
+    char *capstr = gst_caps_to_string (caps);
+    GST_ERROR_OBJECT (self,
+        "Failed to get video info from caps; gst_video_info_from_caps (&info, \"%s\") has returned FALSE, which means the given caps cannot be parsed as a video.",
+        capstr);
+    g_free (capstr);
+    return FALSE;
+  }
+
+  format = gst_tensor_preprocess_get_format (gst_video_format_to_string
+      (GST_VIDEO_INFO_FORMAT (&vinfo)));
+  if (format == PREPROCESS_FORMAT_UNKNOWN) {
+    GST_ERROR_OBJECT (self,
+        "The given video caps with format \"%s\" is not supported in preprocess mode. Please use NV12, NV21, I420, YV12, YUY2, UYVY, RGB, BGR, RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR or GRAY8.",
+        GST_STR_NULL (gst_video_format_to_string (GST_VIDEO_INFO_FORMAT
+                (&vinfo))));
+    return FALSE;
+  }
+
+  for (i = 0; i < GST_VIDEO_INFO_N_PLANES (&vinfo) && i < 3; i++) {
+    offset[i] = GST_VIDEO_INFO_PLANE_OFFSET (&vinfo, i);
+    stride[i] = GST_VIDEO_INFO_PLANE_STRIDE (&vinfo, i);
+  }
+
+  if (!gst_tensor_preprocess_configure (self->preprocess, format,
+          GST_VIDEO_INFO_WIDTH (&vinfo), GST_VIDEO_INFO_HEIGHT (&vinfo),
+          offset, stride, gst_tensor_converter_video_is_bt709 (&vinfo),
+          gst_tensor_converter_video_is_full_range (&vinfo))) {
+    GST_ERROR_OBJECT (self, "Failed to configure the preprocessing.");
+    return FALSE;
+  }
+
+  config->info.num_tensors = 1;
+  gst_tensor_preprocess_get_info (self->preprocess, &config->info.info[0]);
+
+  config->rate_n = GST_VIDEO_INFO_FPS_N (&vinfo);
+  config->rate_d = GST_VIDEO_INFO_FPS_D (&vinfo);
+
+  self->remove_padding = FALSE;
+  self->frame_size = GST_VIDEO_INFO_SIZE (&vinfo);
+  return TRUE;
+}
+
 /**
  * @brief Set the tensors config structure from audio info (internal static function)
  * @param self this pointer to GstTensorConverter
@@ -1945,6 +2124,10 @@ gst_tensor_converter_get_possible_media_caps (GstTensorConverter * self)
   GstCaps *media_caps = NULL;
   GstTensorsConfig config;
 
+  /* the video size and format are not related to the output in preprocess mode */
+  if (self->mode == _CONVERTER_MODE_PREPROCESS)
+    return NULL;
+
   /* get possible caps from downstream element */
   if (gst_tensors_config_from_peer (self->srcpad, &config, NULL)) {
     GstStructure *st;
@@ -2075,6 +2258,19 @@ gst_tensor_converter_get_possible_media_caps (GstTensorConverter * self)
   return media_caps;
 }
 
+/**
+ * @brief Get the sink pad template caps for the converter mode.
+ * @details Preprocess mode supports video only, including YUV formats which are not in the static pad template.
+ */
+static GstCaps *
+gst_tensor_converter_get_sink_template_caps (GstTensorConverter * self)
+{
+  if (self->mode == _CONVERTER_MODE_PREPROCESS)
+    return gst_caps_from_string (VIDEO_PREPROCESS_CAPS_STR);
+
+  return gst_pad_get_pad_template_caps (self->sinkpad);
+}
+
 /**
  * @brief Get pad caps for caps negotiation.
  */
@@ -2086,7 +2282,10 @@ gst_tensor_converter_query_caps (GstTensorConverter * self, GstPad * pad,
 
   caps = gst_pad_get_current_caps (pad);
   if (!caps) {
-    caps = gst_pad_get_pad_template_caps (pad);
+    if (pad == self->sinkpad)
+      caps = gst_tensor_converter_get_sink_template_caps (self);
+    else
+      caps = gst_pad_get_pad_template_caps (pad);
   }
 
   if (pad == self->sinkpad) {
@@ -2137,7 +2336,14 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
   g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
 
   structure = gst_caps_get_structure (caps, 0);
-  if (self->mode != _CONVERTER_MODE_NONE) {
+  if (self->mode == _CONVERTER_MODE_PREPROCESS) {
+    in_type = gst_structure_get_media_type (structure);
+    if (in_type != _NNS_VIDEO) {
+      GST_ERROR_OBJECT (self,
+          "Tensor converter in preprocess mode supports video streams only.");
+      return FALSE;
+    }
+  } else if (self->mode != _CONVERTER_MODE_NONE) {
     in_type = _NNS_MEDIA_ANY;
   } else {
     in_type = gst_structure_get_media_type (structure);
@@ -2146,7 +2352,15 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
   switch (in_type) {
     case _NNS_VIDEO:
       if (is_video_supported (self)) {
-        if (!gst_tensor_converter_parse_video (self, caps, &config)) {
+        gboolean parsed;
+
+        if (self->mode == _CONVERTER_MODE_PREPROCESS)
+          parsed = gst_tensor_converter_parse_video_preprocess (self, caps,
+              &config);
+        else
+          parsed = gst_tensor_converter_parse_video (self, caps, &config);
+
+        if (!parsed) {
           char *capstr = gst_caps_to_string (caps);
           GST_ERROR_OBJECT (self,
               "Failed to configure tensor from gst cap \"%s\" for video streams.",
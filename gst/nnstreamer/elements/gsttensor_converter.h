@@ -38,6 +38,8 @@
 #include <tensor_common.h>
 #include "nnstreamer_plugin_api_converter.h"
 #include "tensor_converter_custom.h"
+#include "gsttensor_converter_preprocess.h"
+#include "tensor_metrics.h"
 
 G_BEGIN_DECLS
 
@@ -67,6 +69,7 @@ typedef enum {
   _CONVERTER_MODE_NONE = 0,	/**< Normal mode (default) */
   _CONVERTER_MODE_CUSTOM_CODE = 1,	/**<  Custom mode (callback type) */
   _CONVERTER_MODE_CUSTOM_SCRIPT = 2,	/**<  Custom mode (script type) */
+  _CONVERTER_MODE_PREPROCESS = 3,	/**<  Fused colorspace conversion, resize and normalization of video */
 } tensor_converter_mode;
 
 /**
@@ -105,8 +108,13 @@ struct _GstTensorConverter
   gchar *ext_fw; /**< tensor converter custom mode framework */
   converter_custom_cb_s custom;
   gboolean do_not_append_header;
+  GstTensorPreprocess *preprocess; /**< preprocessing context (mode=preprocess) */
 
   void *priv_data; /**< plugin's private data */
+
+  GstTensorMetrics *metrics; /**< Latency histograms and bytes of the conversion */
+  gint64 chain_time; /**< Monotonic time (usec) when the latest input arrived */
+  gsize chain_size; /**< Bytes of the input not pushed yet */
 };
 
 /**
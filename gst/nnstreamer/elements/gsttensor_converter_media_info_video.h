@@ -29,8 +29,20 @@
     GST_VIDEO_CAPS_MAKE ("{ RGB, BGR, RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR, GRAY8, GRAY16_BE, GRAY16_LE }") \
     ", interlace-mode = (string) progressive"
 
+/**
+ * @brief Caps string for video formats supported in preprocess mode
+ */
+#define VIDEO_PREPROCESS_CAPS_STR \
+    GST_VIDEO_CAPS_MAKE ("{ NV12, NV21, I420, YV12, YUY2, UYVY, RGB, BGR, RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR, GRAY8 }") \
+    ", interlace-mode = (string) progressive"
+
 #define append_video_caps_template(caps) \
     gst_caps_append (caps, gst_caps_from_string (VIDEO_CAPS_STR))
 
+#define gst_tensor_converter_video_is_bt709(info) \
+    (GST_VIDEO_INFO_COLORIMETRY (info).matrix == GST_VIDEO_COLOR_MATRIX_BT709)
+#define gst_tensor_converter_video_is_full_range(info) \
+    (GST_VIDEO_INFO_COLORIMETRY (info).range == GST_VIDEO_COLOR_RANGE_0_255)
+
 #define is_video_supported(...) TRUE
 #endif /* __GST_TENSOR_CONVERTER_MEDIA_INFO_VIDEO_H__ */
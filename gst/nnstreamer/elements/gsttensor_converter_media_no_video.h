@@ -21,6 +21,7 @@
 #endif
 
 #define append_video_caps_template(caps)
+#define VIDEO_PREPROCESS_CAPS_STR "video/x-raw"
 #define is_video_supported(...) FALSE
 
 #define GstVideoInfo gsize
@@ -53,5 +54,11 @@ typedef enum {
 #define GST_VIDEO_INFO_SIZE(...) 0
 #define GST_VIDEO_INFO_FPS_N(...) 0
 #define GST_VIDEO_INFO_FPS_D(...) 1
+#define GST_VIDEO_INFO_N_PLANES(...) 0
+#define GST_VIDEO_INFO_PLANE_OFFSET(...) 0
+#define GST_VIDEO_INFO_PLANE_STRIDE(...) 0
+
+#define gst_tensor_converter_video_is_bt709(...) FALSE
+#define gst_tensor_converter_video_is_full_range(...) FALSE
 
 #endif /* __GST_TENSOR_CONVERTER_MEDIA_NO_VIDEO_H__ */
@@ -0,0 +1,1055 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer tensor_converter preprocessing
+ */
+/**
+ * @file	gsttensor_converter_preprocess.c
+ * @date	16 Oct 2026
+ * @brief	Fused colorspace conversion, resize and normalization for tensor_converter (mode=preprocess)
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ *
+ * The output tensor is computed row by row. Each output row resamples the
+ * required source rows horizontally, converting the pixels to RGB while
+ * fetching them, blends the resampled rows vertically and stores the result
+ * with the normalization and the type conversion. Nothing but a few rows of
+ * float scratch is written besides the output, and the output rows can be
+ * split over a thread pool.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <nnstreamer_log.h>
+#include <nnstreamer_plugin_api_util.h>
+#include <nnstreamer_util.h>
+#include "gsttensor_converter_preprocess.h"
+
+/**
+ * @brief Max number of threads to process a frame.
+ */
+#define PREPROCESS_MAX_THREADS 16U
+
+/**
+ * @brief Min number of output rows per thread.
+ */
+#define PREPROCESS_MIN_ROWS_PER_THREAD 16U
+
+/**
+ * @brief Resize table of an axis.
+ */
+typedef struct
+{
+  guint taps; /**< number of source samples per output sample */
+  gint *index; /**< source index of each tap, [out][taps] */
+  gfloat *weight; /**< weight of each tap, [out][taps] */
+} GstTensorPreprocessTable;
+
+/**
+ * @brief Data structure of the preprocessing context.
+ */
+struct _GstTensorPreprocess
+{
+  /* options */
+  guint out_width; /**< output width */
+  guint out_height; /**< output height */
+  tensor_preprocess_color color; /**< output color */
+  tensor_preprocess_resize resize; /**< resize method */
+  tensor_preprocess_layout layout; /**< output layout */
+  tensor_type out_type; /**< output type */
+  gfloat scale; /**< normalization, output = value * scale + bias */
+  gfloat bias; /**< normalization, output = value * scale + bias */
+  guint num_threads; /**< number of threads to process a frame */
+
+  /* input frame */
+  tensor_preprocess_format format; /**< input format */
+  guint in_width; /**< input width */
+  guint in_height; /**< input height */
+  gsize offset[3]; /**< byte offset of each plane */
+  gint stride[3]; /**< byte stride of each plane */
+  gsize in_size; /**< min byte size of an input frame */
+  gboolean is_yuv; /**< TRUE if input is YUV */
+
+  /* packed RGB and gray (byte offsets in a pixel) */
+  guint pixel_stride; /**< bytes per pixel */
+  guint r_off, g_off, b_off; /**< offsets of R, G and B */
+
+  /* YUV */
+  guint y_plane, u_plane, v_plane; /**< plane index of each component */
+  guint y_off, u_off, v_off; /**< byte offset of each component in a row */
+  guint y_step; /**< bytes between luma samples */
+  guint uv_step; /**< bytes between chroma samples */
+  guint uv_vshift; /**< vertical subsampling of chroma */
+  gfloat ky, ky_off, krv, kgu, kgv, kbu; /**< YUV to RGB coefficients */
+
+  GstTensorPreprocessTable table_x; /**< horizontal resize table */
+  GstTensorPreprocessTable table_y; /**< vertical resize table */
+  gboolean convert_rows; /**< TRUE to convert whole source rows before the horizontal resize */
+
+  GThreadPool *pool; /**< thread pool to process a frame */
+  GMutex lock; /**< lock for pending jobs */
+  GCond cond; /**< signaled when a job is done */
+  guint pending; /**< number of jobs in progress */
+};
+
+/**
+ * @brief Job to process the range of output rows.
+ */
+typedef struct
+{
+  GstTensorPreprocess *pp;
+  const guint8 *input;
+  guint8 *output;
+  guint y_start;
+  guint y_end;
+} GstTensorPreprocessJob;
+
+/**
+ * @brief Parse the option string of preprocessing mode.
+ */
+static gboolean
+_preprocess_parse_option (GstTensorPreprocess * pp, const gchar * option)
+{
+  gchar **opts;
+  guint i, num;
+  gdouble add = 0.0, div = 1.0;
+  gboolean ret = TRUE;
+
+  opts = g_strsplit (option, ",", -1);
+  num = g_strv_length (opts);
+
+  for (i = 0; i < num && ret; i++) {
+    gchar **kv = g_strsplit (g_strstrip (opts[i]), ":", 2);
+    const gchar *key, *val;
+
+    if (g_strv_length (kv) != 2) {
+      if (kv[0] && kv[0][0] != '\0') {
+        nns_loge ("Invalid preprocess option '%s', use key:value.", opts[i]);
+        ret = FALSE;
+      }
+      g_strfreev (kv);
+      continue;
+    }
+
+    key = g_strstrip (kv[0]);
+    val = g_strstrip (kv[1]);
+
+    if (g_ascii_strcasecmp (key, "width") == 0) {
+      pp->out_width = (guint) g_ascii_strtoull (val, NULL, 10);
+    } else if (g_ascii_strcasecmp (key, "height") == 0) {
+      pp->out_height = (guint) g_ascii_strtoull (val, NULL, 10);
+    } else if (g_ascii_strcasecmp (key, "color") == 0) {
+      if (g_ascii_strcasecmp (val, "RGB") == 0)
+        pp->color = PREPROCESS_COLOR_RGB;
+      else if (g_ascii_strcasecmp (val, "BGR") == 0)
+        pp->color = PREPROCESS_COLOR_BGR;
+      else if (g_ascii_strcasecmp (val, "GRAY") == 0)
+        pp->color = PREPROCESS_COLOR_GRAY;
+      else
+        ret = FALSE;
+    } else if (g_ascii_strcasecmp (key, "resize") == 0) {
+      if (g_ascii_strcasecmp (val, "bilinear") == 0)
+        pp->resize = PREPROCESS_RESIZE_BILINEAR;
+      else if (g_ascii_strcasecmp (val, "area") == 0)
+        pp->resize = PREPROCESS_RESIZE_AREA;
+      else if (g_ascii_strcasecmp (val, "nearest") == 0)
+        pp->resize = PREPROCESS_RESIZE_NEAREST;
+      else
+        ret = FALSE;
+    } else if (g_ascii_strcasecmp (key, "layout") == 0) {
+      if (g_ascii_strcasecmp (val, "NHWC") == 0)
+        pp->layout = PREPROCESS_LAYOUT_NHWC;
+      else if (g_ascii_strcasecmp (val, "NCHW") == 0)
+        pp->layout = PREPROCESS_LAYOUT_NCHW;
+      else
+        ret = FALSE;
+    } else if (g_ascii_strcasecmp (key, "type") == 0) {
+      pp->out_type = gst_tensor_get_type (val);
+      if (pp->out_type != _NNS_UINT8 && pp->out_type != _NNS_INT8 &&
+          pp->out_type != _NNS_FLOAT32)
+        ret = FALSE;
+    } else if (g_ascii_strcasecmp (key, "add") == 0) {
+      add = g_ascii_strtod (val, NULL);
+    } else if (g_ascii_strcasecmp (key, "div") == 0) {
+      div = g_ascii_strtod (val, NULL);
+      if (div == 0.0)
+        ret = FALSE;
+    } else if (g_ascii_strcasecmp (key, "threads") == 0) {
+      pp->num_threads = (guint) g_ascii_strtoull (val, NULL, 10);
+      if (pp->num_threads == 0)
+        pp->num_threads = g_get_num_processors ();
+      pp->num_threads = MIN (pp->num_threads, PREPROCESS_MAX_THREADS);
+    } else {
+      nns_loge ("Unknown preprocess option '%s'.", key);
+      ret = FALSE;
+    }
+
+    if (!ret)
+      nns_loge ("Invalid preprocess option '%s:%s'.", key, val);
+    g_strfreev (kv);
+  }
+
+  g_strfreev (opts);
+
+  if (ret && (pp->out_width == 0 || pp->out_height == 0)) {
+    nns_loge ("The output width and height of preprocess mode are required, "
+        "e.g., mode=preprocess:width:224,height:224");
+    ret = FALSE;
+  }
+
+  pp->scale = (gfloat) (1.0 / div);
+  pp->bias = (gfloat) (add / div);
+  return ret;
+}
+
+/**
+ * @brief Worker function of the thread pool.
+ */
+static void _preprocess_worker (gpointer data, gpointer user_data);
+
+/**
+ * @brief Create the preprocessing context from the option string of the mode.
+ */
+GstTensorPreprocess *
+gst_tensor_preprocess_new (const gchar * option)
+{
+  GstTensorPreprocess *pp;
+
+  g_return_val_if_fail (option != NULL, NULL);
+
+  pp = g_new0 (GstTensorPreprocess, 1);
+  pp->color = PREPROCESS_COLOR_RGB;
+  pp->resize = PREPROCESS_RESIZE_BILINEAR;
+  pp->layout = PREPROCESS_LAYOUT_NHWC;
+  pp->out_type = _NNS_UINT8;
+  pp->num_threads = 1;
+  g_mutex_init (&pp->lock);
+  g_cond_init (&pp->cond);
+
+  if (!_preprocess_parse_option (pp, option)) {
+    gst_tensor_preprocess_free (pp);
+    return NULL;
+  }
+
+  if (pp->num_threads > 1) {
+    pp->pool = g_thread_pool_new (_preprocess_worker, NULL,
+        (gint) pp->num_threads - 1, TRUE, NULL);
+    if (pp->pool == NULL)
+      pp->num_threads = 1;
+  }
+
+  return pp;
+}
+
+/**
+ * @brief Free the resize table.
+ */
+static void
+_preprocess_table_free (GstTensorPreprocessTable * table)
+{
+  g_free (table->index);
+  g_free (table->weight);
+  table->index = NULL;
+  table->weight = NULL;
+  table->taps = 0;
+}
+
+/**
+ * @brief Free the preprocessing context.
+ */
+void
+gst_tensor_preprocess_free (GstTensorPreprocess * pp)
+{
+  if (pp == NULL)
+    return;
+
+  if (pp->pool)
+    g_thread_pool_free (pp->pool, FALSE, TRUE);
+
+  _preprocess_table_free (&pp->table_x);
+  _preprocess_table_free (&pp->table_y);
+  g_mutex_clear (&pp->lock);
+  g_cond_clear (&pp->cond);
+  g_free (pp);
+}
+
+/**
+ * @brief Get the input format from the name of GstVideoFormat.
+ */
+tensor_preprocess_format
+gst_tensor_preprocess_get_format (const gchar * name)
+{
+  static const struct
+  {
+    const gchar *name;
+    tensor_preprocess_format format;
+  } formats[] = {
+    {"GRAY8", PREPROCESS_FORMAT_GRAY8},
+    {"RGB", PREPROCESS_FORMAT_RGB},
+    {"BGR", PREPROCESS_FORMAT_BGR},
+    {"RGBx", PREPROCESS_FORMAT_RGBx},
+    {"BGRx", PREPROCESS_FORMAT_BGRx},
+    {"xRGB", PREPROCESS_FORMAT_xRGB},
+    {"xBGR", PREPROCESS_FORMAT_xBGR},
+    {"RGBA", PREPROCESS_FORMAT_RGBA},
+    {"BGRA", PREPROCESS_FORMAT_BGRA},
+    {"ARGB", PREPROCESS_FORMAT_ARGB},
+    {"ABGR", PREPROCESS_FORMAT_ABGR},
+    {"I420", PREPROCESS_FORMAT_I420},
+    {"YV12", PREPROCESS_FORMAT_YV12},
+    {"NV12", PREPROCESS_FORMAT_NV12},
+    {"NV21", PREPROCESS_FORMAT_NV21},
+    {"YUY2", PREPROCESS_FORMAT_YUY2},
+    {"UYVY", PREPROCESS_FORMAT_UYVY},
+  };
+  guint i;
+
+  if (name == NULL)
+    return PREPROCESS_FORMAT_UNKNOWN;
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    if (g_str_equal (name, formats[i].name))
+      return formats[i].format;
+  }
+
+  return PREPROCESS_FORMAT_UNKNOWN;
+}
+
+/**
+ * @brief Build the resize table of an axis.
+ * @details Bilinear and nearest sample at the pixel centers. Area averages the covered source pixels with the overlapped ratio, and falls back to bilinear when upscaling.
+ */
+static void
+_preprocess_table_build (GstTensorPreprocessTable * table, guint in_size,
+    guint out_size, tensor_preprocess_resize resize)
+{
+  gdouble scale = (gdouble) in_size / (gdouble) out_size;
+  guint o, t;
+
+  _preprocess_table_free (table);
+
+  if (resize == PREPROCESS_RESIZE_AREA && scale <= 1.0)
+    resize = PREPROCESS_RESIZE_BILINEAR;
+
+  switch (resize) {
+    case PREPROCESS_RESIZE_NEAREST:
+      table->taps = 1;
+      break;
+    case PREPROCESS_RESIZE_AREA:
+      table->taps = (guint) ceil (scale) + 1;
+      break;
+    case PREPROCESS_RESIZE_BILINEAR:
+    default:
+      table->taps = 2;
+      break;
+  }
+
+  table->index = g_new0 (gint, out_size * table->taps);
+  table->weight = g_new0 (gfloat, out_size * table->taps);
+
+  for (o = 0; o < out_size; o++) {
+    gint *index = table->index + o * table->taps;
+    gfloat *weight = table->weight + o * table->taps;
+
+    switch (resize) {
+      case PREPROCESS_RESIZE_NEAREST:
+        index[0] = MIN ((gint) ((o + 0.5) * scale), (gint) in_size - 1);
+        weight[0] = 1.0f;
+        break;
+      case PREPROCESS_RESIZE_AREA:
+      {
+        gdouble start = o * scale;
+        gdouble end = MIN ((o + 1) * scale, (gdouble) in_size);
+        gint i = (gint) floor (start);
+
+        for (t = 0; t < table->taps; t++, i++) {
+          gdouble overlap = 0.0;
+
+          if (i < (gint) in_size && i < end)
+            overlap = MIN (end, i + 1.0) - MAX (start, (gdouble) i);
+
+          index[t] = MIN (i, (gint) in_size - 1);
+          weight[t] = (overlap > 0.0) ? (gfloat) (overlap / scale) : 0.0f;
+        }
+        break;
+      }
+      case PREPROCESS_RESIZE_BILINEAR:
+      default:
+      {
+        gdouble f = (o + 0.5) * scale - 0.5;
+        gint i;
+
+        if (f < 0.0)
+          f = 0.0;
+
+        i = (gint) f;
+        f -= i;
+        if (i >= (gint) in_size - 1) {
+          i = in_size - 1;
+          f = 0.0;
+        }
+
+        index[0] = i;
+        index[1] = MIN (i + 1, (gint) in_size - 1);
+        weight[0] = (gfloat) (1.0 - f);
+        weight[1] = (gfloat) f;
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Configure the input frame and build the resize tables.
+ */
+gboolean
+gst_tensor_preprocess_configure (GstTensorPreprocess * pp,
+    tensor_preprocess_format format, guint width, guint height,
+    const gsize offset[3], const gint stride[3], gboolean bt709,
+    gboolean full_range)
+{
+  guint i, n_planes = 1;
+
+  g_return_val_if_fail (pp != NULL, FALSE);
+
+  if (width == 0 || height == 0)
+    return FALSE;
+
+  pp->format = format;
+  pp->in_width = width;
+  pp->in_height = height;
+  pp->is_yuv = FALSE;
+  pp->pixel_stride = 4;
+  pp->y_step = pp->uv_step = 1;
+  pp->y_off = pp->u_off = pp->v_off = 0;
+  pp->uv_vshift = 1;
+
+  switch (format) {
+    case PREPROCESS_FORMAT_GRAY8:
+      pp->pixel_stride = 1;
+      pp->r_off = pp->g_off = pp->b_off = 0;
+      break;
+    case PREPROCESS_FORMAT_RGB:
+      pp->pixel_stride = 3;
+      pp->r_off = 0, pp->g_off = 1, pp->b_off = 2;
+      break;
+    case PREPROCESS_FORMAT_BGR:
+      pp->pixel_stride = 3;
+      pp->r_off = 2, pp->g_off = 1, pp->b_off = 0;
+      break;
+    case PREPROCESS_FORMAT_RGBx:
+    case PREPROCESS_FORMAT_RGBA:
+      pp->r_off = 0, pp->g_off = 1, pp->b_off = 2;
+      break;
+    case PREPROCESS_FORMAT_BGRx:
+    case PREPROCESS_FORMAT_BGRA:
+      pp->r_off = 2, pp->g_off = 1, pp->b_off = 0;
+      break;
+    case PREPROCESS_FORMAT_xRGB:
+    case PREPROCESS_FORMAT_ARGB:
+      pp->r_off = 1, pp->g_off = 2, pp->b_off = 3;
+      break;
+    case PREPROCESS_FORMAT_xBGR:
+    case PREPROCESS_FORMAT_ABGR:
+      pp->r_off = 3, pp->g_off = 2, pp->b_off = 1;
+      break;
+    case PREPROCESS_FORMAT_I420:
+      pp->is_yuv = TRUE;
+      pp->y_plane = 0, pp->u_plane = 1, pp->v_plane = 2;
+      n_planes = 3;
+      break;
+    case PREPROCESS_FORMAT_YV12:
+      pp->is_yuv = TRUE;
+      pp->y_plane = 0, pp->u_plane = 2, pp->v_plane = 1;
+      n_planes = 3;
+      break;
+    case PREPROCESS_FORMAT_NV12:
+    case PREPROCESS_FORMAT_NV21:
+      pp->is_yuv = TRUE;
+      pp->y_plane = 0, pp->u_plane = pp->v_plane = 1;
+      pp->uv_step = 2;
+      pp->u_off = (format == PREPROCESS_FORMAT_NV12) ? 0 : 1;
+      pp->v_off = (format == PREPROCESS_FORMAT_NV12) ? 1 : 0;
+      n_planes = 2;
+      break;
+    case PREPROCESS_FORMAT_YUY2:
+    case PREPROCESS_FORMAT_UYVY:
+      pp->is_yuv = TRUE;
+      pp->y_plane = pp->u_plane = pp->v_plane = 0;
+      pp->y_step = 2;
+      pp->uv_step = 4;
+      pp->uv_vshift = 0;
+      pp->y_off = (format == PREPROCESS_FORMAT_YUY2) ? 0 : 1;
+      pp->u_off = (format == PREPROCESS_FORMAT_YUY2) ? 1 : 0;
+      pp->v_off = (format == PREPROCESS_FORMAT_YUY2) ? 3 : 2;
+      break;
+    default:
+      nns_loge ("The input format of preprocess mode is not supported.");
+      return FALSE;
+  }
+
+  pp->in_size = 0;
+  for (i = 0; i < 3; i++) {
+    pp->offset[i] = (i < n_planes) ? offset[i] : 0;
+    pp->stride[i] = (i < n_planes) ? stride[i] : 0;
+  }
+
+  /* the end of the last row of each plane */
+  for (i = 0; i < n_planes; i++) {
+    guint rows = height;
+    gsize row_size;
+
+    if (pp->is_yuv && i > 0)
+      rows = (height + 1) >> pp->uv_vshift;
+
+    if (!pp->is_yuv)
+      row_size = (gsize) width * pp->pixel_stride;
+    else if (i == 0 && pp->u_plane != 0)
+      row_size = (gsize) width * pp->y_step;
+    else
+      /* packed 4:2:2 with odd width reads the chroma of the last macro-pixel */
+      row_size = (gsize) ((width + 1) / 2) * pp->uv_step;
+
+    if (pp->stride[i] <= 0 || (gsize) pp->stride[i] < row_size) {
+      nns_loge ("Invalid stride %d of plane %u in preprocess mode.",
+          pp->stride[i], i);
+      return FALSE;
+    }
+
+    pp->in_size = MAX (pp->in_size,
+        pp->offset[i] + (gsize) pp->stride[i] * (rows - 1) + row_size);
+  }
+
+  /* YUV to RGB, R = ky * (Y - ky_off) + krv * V', G = ... - kgu * U' - kgv * V', B = ... + kbu * U' */
+  if (full_range) {
+    pp->ky = 1.0f;
+    pp->ky_off = 0.0f;
+  } else {
+    pp->ky = 255.0f / 219.0f;
+    pp->ky_off = 16.0f;
+  }
+
+  if (bt709) {
+    pp->krv = 1.5748f, pp->kgu = 0.1873f, pp->kgv = 0.4681f, pp->kbu = 1.8556f;
+  } else {
+    pp->krv = 1.402f, pp->kgu = 0.3441f, pp->kgv = 0.7141f, pp->kbu = 1.772f;
+  }
+
+  if (!full_range) {
+    /* chroma range 16-240 */
+    gfloat kc = 255.0f / 224.0f;
+
+    pp->krv *= kc, pp->kgu *= kc, pp->kgv *= kc, pp->kbu *= kc;
+  }
+
+  _preprocess_table_build (&pp->table_x, width, pp->out_width, pp->resize);
+  _preprocess_table_build (&pp->table_y, height, pp->out_height, pp->resize);
+
+  /**
+   * Convert the pixel only once if the horizontal taps touch every source pixel.
+   * Otherwise (e.g., 4K to 224 with bilinear) convert the sampled pixels only.
+   */
+  pp->convert_rows = (pp->table_x.taps * pp->out_width >= width);
+  return TRUE;
+}
+
+/**
+ * @brief Get the number of output channels.
+ */
+static inline guint
+_preprocess_get_channels (GstTensorPreprocess * pp)
+{
+  return (pp->color == PREPROCESS_COLOR_GRAY) ? 1 : 3;
+}
+
+/**
+ * @brief Get the output tensor info (type and dimension with 1 frame).
+ */
+void
+gst_tensor_preprocess_get_info (GstTensorPreprocess * pp, GstTensorInfo * info)
+{
+  guint ch;
+
+  g_return_if_fail (pp != NULL);
+  g_return_if_fail (info != NULL);
+
+  gst_tensor_info_init (info);
+  ch = _preprocess_get_channels (pp);
+
+  info->type = pp->out_type;
+  if (pp->layout == PREPROCESS_LAYOUT_NCHW) {
+    info->dimension[0] = pp->out_width;
+    info->dimension[1] = pp->out_height;
+    info->dimension[2] = ch;
+  } else {
+    info->dimension[0] = ch;
+    info->dimension[1] = pp->out_width;
+    info->dimension[2] = pp->out_height;
+  }
+  info->dimension[3] = 1;
+}
+
+/**
+ * @brief Get the byte size of an input frame, which is required to process a frame.
+ */
+gsize
+gst_tensor_preprocess_get_input_size (GstTensorPreprocess * pp)
+{
+  g_return_val_if_fail (pp != NULL, 0);
+  return pp->in_size;
+}
+
+/**
+ * @brief Resample a source row horizontally into RGB float samples (packed RGB or gray input).
+ */
+static void
+_preprocess_hrow_rgb (GstTensorPreprocess * pp, const guint8 * input,
+    guint sy, gfloat * out)
+{
+  const GstTensorPreprocessTable *tx = &pp->table_x;
+  const guint8 *row = input + pp->offset[0] + (gsize) sy * pp->stride[0];
+  const guint ps = pp->pixel_stride;
+  const guint ro = pp->r_off, go = pp->g_off, bo = pp->b_off;
+  guint x, t;
+
+  for (x = 0; x < pp->out_width; x++) {
+    const gint *index = tx->index + x * tx->taps;
+    const gfloat *weight = tx->weight + x * tx->taps;
+    gfloat r = 0.0f, g = 0.0f, b = 0.0f;
+
+    for (t = 0; t < tx->taps; t++) {
+      const guint8 *p = row + (gsize) index[t] * ps;
+
+      r += weight[t] * p[ro];
+      g += weight[t] * p[go];
+      b += weight[t] * p[bo];
+    }
+
+    out[x * 3] = r;
+    out[x * 3 + 1] = g;
+    out[x * 3 + 2] = b;
+  }
+}
+
+/**
+ * @brief Resample a source row horizontally into RGB float samples (YUV input).
+ * @note Each fetched pixel is converted to RGB and clamped before it is blended, as the colorspace conversion does before the resize.
+ */
+static void
+_preprocess_hrow_yuv (GstTensorPreprocess * pp, const guint8 * input,
+    guint sy, gfloat * out)
+{
+  const GstTensorPreprocessTable *tx = &pp->table_x;
+  const guint cy = sy >> pp->uv_vshift;
+  const guint8 *yrow = input + pp->offset[pp->y_plane] +
+      (gsize) sy * pp->stride[pp->y_plane] + pp->y_off;
+  const guint8 *urow = input + pp->offset[pp->u_plane] +
+      (gsize) cy * pp->stride[pp->u_plane] + pp->u_off;
+  const guint8 *vrow = input + pp->offset[pp->v_plane] +
+      (gsize) cy * pp->stride[pp->v_plane] + pp->v_off;
+  const guint ys = pp->y_step, uvs = pp->uv_step;
+  const gfloat ky = pp->ky, ky_off = pp->ky_off;
+  const gfloat krv = pp->krv, kgu = pp->kgu, kgv = pp->kgv, kbu = pp->kbu;
+  guint x, t;
+
+  for (x = 0; x < pp->out_width; x++) {
+    const gint *index = tx->index + x * tx->taps;
+    const gfloat *weight = tx->weight + x * tx->taps;
+    gfloat r = 0.0f, g = 0.0f, b = 0.0f;
+
+    for (t = 0; t < tx->taps; t++) {
+      const guint sx = (guint) index[t];
+      const gsize c = (gsize) (sx >> 1) * uvs;
+      gfloat Y = ky * ((gfloat) yrow[(gsize) sx * ys] - ky_off);
+      gfloat U = (gfloat) urow[c] - 128.0f;
+      gfloat V = (gfloat) vrow[c] - 128.0f;
+
+      r += weight[t] * CLAMP (Y + krv * V, 0.0f, 255.0f);
+      g += weight[t] * CLAMP (Y - kgu * U - kgv * V, 0.0f, 255.0f);
+      b += weight[t] * CLAMP (Y + kbu * U, 0.0f, 255.0f);
+    }
+
+    out[x * 3] = r;
+    out[x * 3 + 1] = g;
+    out[x * 3 + 2] = b;
+  }
+}
+
+/**
+ * @brief Convert a source row to RGB float samples (packed RGB or gray input).
+ */
+static void
+_preprocess_convert_row_rgb (GstTensorPreprocess * pp, const guint8 * input,
+    guint sy, gfloat * rgb)
+{
+  const guint8 *row = input + pp->offset[0] + (gsize) sy * pp->stride[0];
+  const guint ps = pp->pixel_stride;
+  const guint ro = pp->r_off, go = pp->g_off, bo = pp->b_off;
+  guint x;
+
+  for (x = 0; x < pp->in_width; x++) {
+    const guint8 *p = row + (gsize) x * ps;
+
+    rgb[x * 3] = p[ro];
+    rgb[x * 3 + 1] = p[go];
+    rgb[x * 3 + 2] = p[bo];
+  }
+}
+
+/**
+ * @brief Convert a source row to RGB float samples (YUV input). The chroma is shared by the pair of pixels.
+ */
+static void
+_preprocess_convert_row_yuv (GstTensorPreprocess * pp, const guint8 * input,
+    guint sy, gfloat * rgb)
+{
+  const guint cy = sy >> pp->uv_vshift;
+  const guint8 *yrow = input + pp->offset[pp->y_plane] +
+      (gsize) sy * pp->stride[pp->y_plane] + pp->y_off;
+  const guint8 *urow = input + pp->offset[pp->u_plane] +
+      (gsize) cy * pp->stride[pp->u_plane] + pp->u_off;
+  const guint8 *vrow = input + pp->offset[pp->v_plane] +
+      (gsize) cy * pp->stride[pp->v_plane] + pp->v_off;
+  const guint ys = pp->y_step, uvs = pp->uv_step;
+  const gfloat ky = pp->ky, ky_off = pp->ky_off;
+  const gfloat krv = pp->krv, kgu = pp->kgu, kgv = pp->kgv, kbu = pp->kbu;
+  guint x;
+
+  for (x = 0; x < pp->in_width; x += 2) {
+    const gsize c = (gsize) (x >> 1) * uvs;
+    const gfloat U = (gfloat) urow[c] - 128.0f;
+    const gfloat V = (gfloat) vrow[c] - 128.0f;
+    const gfloat dr = krv * V, dg = -kgu * U - kgv * V, db = kbu * U;
+    guint i, n = MIN (2U, pp->in_width - x);
+
+    for (i = 0; i < n; i++) {
+      gfloat Y = ky * ((gfloat) yrow[(gsize) (x + i) * ys] - ky_off);
+      gfloat *o = rgb + (x + i) * 3;
+
+      o[0] = CLAMP (Y + dr, 0.0f, 255.0f);
+      o[1] = CLAMP (Y + dg, 0.0f, 255.0f);
+      o[2] = CLAMP (Y + db, 0.0f, 255.0f);
+    }
+  }
+}
+
+/**
+ * @brief Resample a converted source row horizontally.
+ */
+static void
+_preprocess_hrow_float (GstTensorPreprocess * pp, const gfloat * rgb,
+    gfloat * out)
+{
+  const GstTensorPreprocessTable *tx = &pp->table_x;
+  guint x, t;
+
+  if (tx->taps == 2) {
+    for (x = 0; x < pp->out_width; x++) {
+      const gfloat *p0 = rgb + tx->index[x * 2] * 3;
+      const gfloat *p1 = rgb + tx->index[x * 2 + 1] * 3;
+      const gfloat w0 = tx->weight[x * 2], w1 = tx->weight[x * 2 + 1];
+
+      out[x * 3] = w0 * p0[0] + w1 * p1[0];
+      out[x * 3 + 1] = w0 * p0[1] + w1 * p1[1];
+      out[x * 3 + 2] = w0 * p0[2] + w1 * p1[2];
+    }
+    return;
+  }
+
+  for (x = 0; x < pp->out_width; x++) {
+    const gint *index = tx->index + x * tx->taps;
+    const gfloat *weight = tx->weight + x * tx->taps;
+    gfloat r = 0.0f, g = 0.0f, b = 0.0f;
+
+    for (t = 0; t < tx->taps; t++) {
+      const gfloat *p = rgb + index[t] * 3;
+
+      r += weight[t] * p[0];
+      g += weight[t] * p[1];
+      b += weight[t] * p[2];
+    }
+
+    out[x * 3] = r;
+    out[x * 3 + 1] = g;
+    out[x * 3 + 2] = b;
+  }
+}
+
+/**
+ * @brief Normalize a value and cast it to uint8.
+ */
+static inline guint8
+_preprocess_to_u8 (gfloat v)
+{
+  return (guint8) CLAMP (v + 0.5f, 0.0f, 255.0f);
+}
+
+/**
+ * @brief Normalize a value and cast it to int8.
+ */
+static inline gint8
+_preprocess_to_s8 (gfloat v)
+{
+  return (gint8) floorf (CLAMP (v + 0.5f, -128.0f, 127.0f));
+}
+
+/**
+ * @brief Store the output row (RGB float samples) with the color, layout, normalization and type.
+ */
+static void
+_preprocess_store_row (GstTensorPreprocess * pp, gfloat * acc, guint y,
+    guint8 * output)
+{
+  const guint w = pp->out_width;
+  const guint ch = _preprocess_get_channels (pp);
+  const gfloat scale = pp->scale, bias = pp->bias;
+  const gsize esize = gst_tensor_get_element_size (pp->out_type);
+  gsize plane = (gsize) w * pp->out_height;
+  gsize c_step, x_step, base;
+  guint x, c, n = w * ch;
+
+  /* reorder channels in place, then normalize */
+  if (pp->color == PREPROCESS_COLOR_GRAY) {
+    for (x = 0; x < w; x++)
+      acc[x] = 0.299f * acc[x * 3] + 0.587f * acc[x * 3 + 1] +
+          0.114f * acc[x * 3 + 2];
+  } else if (pp->color == PREPROCESS_COLOR_BGR) {
+    for (x = 0; x < w; x++) {
+      gfloat tmp = acc[x * 3];
+
+      acc[x * 3] = acc[x * 3 + 2];
+      acc[x * 3 + 2] = tmp;
+    }
+  }
+
+  for (x = 0; x < n; x++)
+    acc[x] = acc[x] * scale + bias;
+
+  if (pp->layout == PREPROCESS_LAYOUT_NCHW) {
+    base = (gsize) y * w;
+    c_step = plane;
+    x_step = 1;
+  } else {
+    base = (gsize) y * w * ch;
+    c_step = 1;
+    x_step = ch;
+  }
+
+  if (pp->layout == PREPROCESS_LAYOUT_NHWC || ch == 1) {
+    /* contiguous output row */
+    guint8 *dest = output + base * esize;
+
+    switch (pp->out_type) {
+      case _NNS_FLOAT32:
+        memcpy (dest, acc, n * sizeof (gfloat));
+        break;
+      case _NNS_INT8:
+        for (x = 0; x < n; x++)
+          ((gint8 *) dest)[x] = _preprocess_to_s8 (acc[x]);
+        break;
+      default:
+        for (x = 0; x < n; x++)
+          dest[x] = _preprocess_to_u8 (acc[x]);
+        break;
+    }
+    return;
+  }
+
+  for (c = 0; c < ch; c++) {
+    gsize o = base + c * c_step;
+
+    switch (pp->out_type) {
+      case _NNS_FLOAT32:
+      {
+        gfloat *dest = (gfloat *) output + o;
+        for (x = 0; x < w; x++)
+          dest[x * x_step] = acc[x * ch + c];
+        break;
+      }
+      case _NNS_INT8:
+      {
+        gint8 *dest = (gint8 *) output + o;
+        for (x = 0; x < w; x++)
+          dest[x * x_step] = _preprocess_to_s8 (acc[x * ch + c]);
+        break;
+      }
+      default:
+      {
+        guint8 *dest = output + o;
+        for (x = 0; x < w; x++)
+          dest[x * x_step] = _preprocess_to_u8 (acc[x * ch + c]);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Process the range of output rows.
+ * @details The horizontally resampled source rows are cached, so that adjacent output rows sharing the source rows do not resample them again.
+ */
+static void
+_preprocess_rows (GstTensorPreprocess * pp, const guint8 * input,
+    guint8 * output, guint y_start, guint y_end)
+{
+  const GstTensorPreprocessTable *ty = &pp->table_y;
+  const gsize row_len = (gsize) pp->out_width * 3;
+  gfloat *scratch, *acc, *conv = NULL, **rows;
+  gint *keys;
+  gboolean *used;
+  guint y, t, k, i;
+
+  scratch = g_new (gfloat, row_len * (ty->taps + 1));
+  acc = scratch + row_len * ty->taps;
+  keys = g_new (gint, ty->taps);
+  used = g_new (gboolean, ty->taps);
+  rows = g_new (gfloat *, ty->taps);
+  if (pp->convert_rows)
+    conv = g_new (gfloat, (gsize) pp->in_width * 3);
+
+  for (k = 0; k < ty->taps; k++)
+    keys[k] = -1;
+
+  for (y = y_start; y < y_end; y++) {
+    const gint *index = ty->index + y * ty->taps;
+    const gfloat *weight = ty->weight + y * ty->taps;
+
+    /* keep the cached rows used by this output row */
+    for (k = 0; k < ty->taps; k++) {
+      used[k] = FALSE;
+      for (t = 0; t < ty->taps; t++) {
+        if (keys[k] == index[t]) {
+          used[k] = TRUE;
+          break;
+        }
+      }
+    }
+
+    for (t = 0; t < ty->taps; t++) {
+      for (k = 0; k < ty->taps; k++) {
+        if (keys[k] == index[t])
+          break;
+      }
+
+      if (k == ty->taps) {
+        /* resample the source row into an unused slot */
+        k = 0;
+        while (k < ty->taps - 1 && used[k])
+          k++;
+
+        if (conv) {
+          if (pp->is_yuv)
+            _preprocess_convert_row_yuv (pp, input, index[t], conv);
+          else
+            _preprocess_convert_row_rgb (pp, input, index[t], conv);
+
+          _preprocess_hrow_float (pp, conv, scratch + k * row_len);
+        } else if (pp->is_yuv) {
+          _preprocess_hrow_yuv (pp, input, index[t], scratch + k * row_len);
+        } else {
+          _preprocess_hrow_rgb (pp, input, index[t], scratch + k * row_len);
+        }
+
+        keys[k] = index[t];
+        used[k] = TRUE;
+      }
+
+      rows[t] = scratch + k * row_len;
+    }
+
+    /* vertical blend */
+    for (i = 0; i < row_len; i++)
+      acc[i] = weight[0] * rows[0][i];
+
+    for (t = 1; t < ty->taps; t++) {
+      const gfloat wt = weight[t];
+      const gfloat *src = rows[t];
+
+      if (wt == 0.0f)
+        continue;
+
+      for (i = 0; i < row_len; i++)
+        acc[i] += wt * src[i];
+    }
+
+    _preprocess_store_row (pp, acc, y, output);
+  }
+
+  g_free (conv);
+  g_free (rows);
+  g_free (used);
+  g_free (keys);
+  g_free (scratch);
+}
+
+/**
+ * @brief Worker function of the thread pool.
+ */
+static void
+_preprocess_worker (gpointer data, gpointer user_data)
+{
+  GstTensorPreprocessJob *job = (GstTensorPreprocessJob *) data;
+  GstTensorPreprocess *pp = job->pp;
+  UNUSED (user_data);
+
+  _preprocess_rows (pp, job->input, job->output, job->y_start, job->y_end);
+
+  g_mutex_lock (&pp->lock);
+  pp->pending--;
+  g_cond_signal (&pp->cond);
+  g_mutex_unlock (&pp->lock);
+}
+
+/**
+ * @brief Convert an input frame to the output tensor in a single pass.
+ */
+gboolean
+gst_tensor_preprocess_process (GstTensorPreprocess * pp,
+    const guint8 * input, guint8 * output)
+{
+  GstTensorPreprocessJob jobs[PREPROCESS_MAX_THREADS];
+  guint i, n, rows;
+
+  g_return_val_if_fail (pp != NULL, FALSE);
+  g_return_val_if_fail (input != NULL && output != NULL, FALSE);
+  g_return_val_if_fail (pp->table_y.taps > 0, FALSE);
+
+  n = 1;
+  if (pp->pool)
+    n = CLAMP (pp->out_height / PREPROCESS_MIN_ROWS_PER_THREAD, 1U,
+        pp->num_threads);
+
+  if (n == 1) {
+    _preprocess_rows (pp, input, output, 0, pp->out_height);
+    return TRUE;
+  }
+
+  rows = (pp->out_height + n - 1) / n;
+  for (i = 0; i < n; i++) {
+    jobs[i].pp = pp;
+    jobs[i].input = input;
+    jobs[i].output = output;
+    jobs[i].y_start = MIN (i * rows, pp->out_height);
+    jobs[i].y_end = MIN ((i + 1) * rows, pp->out_height);
+  }
+
+  g_mutex_lock (&pp->lock);
+  pp->pending = n - 1;
+  g_mutex_unlock (&pp->lock);
+
+  for (i = 1; i < n; i++) {
+    if (!g_thread_pool_push (pp->pool, &jobs[i], NULL)) {
+      /* failed to queue the job, process it here */
+      _preprocess_worker (&jobs[i], NULL);
+    }
+  }
+
+  /* the caller thread processes the first range */
+  _preprocess_rows (pp, input, output, jobs[0].y_start, jobs[0].y_end);
+
+  g_mutex_lock (&pp->lock);
+  while (pp->pending > 0)
+    g_cond_wait (&pp->cond, &pp->lock);
+  g_mutex_unlock (&pp->lock);
+
+  return TRUE;
+}
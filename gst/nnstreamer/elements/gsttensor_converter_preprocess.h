@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer tensor_converter preprocessing
+ */
+/**
+ * @file	gsttensor_converter_preprocess.h
+ * @date	16 Oct 2026
+ * @brief	Fused colorspace conversion, resize and normalization for tensor_converter (mode=preprocess)
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_CONVERTER_PREPROCESS_H__
+#define __GST_TENSOR_CONVERTER_PREPROCESS_H__
+
+#include <glib.h>
+#include <tensor_typedef.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Input pixel formats of the preprocessing mode.
+ */
+typedef enum
+{
+  PREPROCESS_FORMAT_UNKNOWN = 0,
+  PREPROCESS_FORMAT_GRAY8,
+  PREPROCESS_FORMAT_RGB,
+  PREPROCESS_FORMAT_BGR,
+  PREPROCESS_FORMAT_RGBx,
+  PREPROCESS_FORMAT_BGRx,
+  PREPROCESS_FORMAT_xRGB,
+  PREPROCESS_FORMAT_xBGR,
+  PREPROCESS_FORMAT_RGBA,
+  PREPROCESS_FORMAT_BGRA,
+  PREPROCESS_FORMAT_ARGB,
+  PREPROCESS_FORMAT_ABGR,
+  PREPROCESS_FORMAT_I420,
+  PREPROCESS_FORMAT_YV12,
+  PREPROCESS_FORMAT_NV12,
+  PREPROCESS_FORMAT_NV21,
+  PREPROCESS_FORMAT_YUY2,
+  PREPROCESS_FORMAT_UYVY,
+} tensor_preprocess_format;
+
+/**
+ * @brief Resize methods of the preprocessing mode.
+ */
+typedef enum
+{
+  PREPROCESS_RESIZE_BILINEAR = 0,
+  PREPROCESS_RESIZE_AREA,
+  PREPROCESS_RESIZE_NEAREST,
+} tensor_preprocess_resize;
+
+/**
+ * @brief Output layouts of the preprocessing mode.
+ */
+typedef enum
+{
+  PREPROCESS_LAYOUT_NHWC = 0, /**< dimension C:W:H:N */
+  PREPROCESS_LAYOUT_NCHW,     /**< dimension W:H:C:N */
+} tensor_preprocess_layout;
+
+/**
+ * @brief Output color of the preprocessing mode.
+ */
+typedef enum
+{
+  PREPROCESS_COLOR_RGB = 0,
+  PREPROCESS_COLOR_BGR,
+  PREPROCESS_COLOR_GRAY,
+} tensor_preprocess_color;
+
+typedef struct _GstTensorPreprocess GstTensorPreprocess;
+
+/**
+ * @brief Create the preprocessing context from the option string of the mode.
+ * @param option comma-separated key:value list, e.g., "width:224,height:224,type:float32,add:-127.5,div:127.5"
+ * @return Newly allocated context, or NULL if the option is invalid. Free it with gst_tensor_preprocess_free().
+ */
+extern GstTensorPreprocess *
+gst_tensor_preprocess_new (const gchar * option);
+
+/**
+ * @brief Free the preprocessing context.
+ */
+extern void
+gst_tensor_preprocess_free (GstTensorPreprocess * pp);
+
+/**
+ * @brief Get the input format from the name of GstVideoFormat.
+ * @return PREPROCESS_FORMAT_UNKNOWN if the format is not supported.
+ */
+extern tensor_preprocess_format
+gst_tensor_preprocess_get_format (const gchar * name);
+
+/**
+ * @brief Configure the input frame and build the resize tables.
+ * @param pp the preprocessing context
+ * @param format input pixel format
+ * @param width input width
+ * @param height input height
+ * @param offset byte offset of each plane (up to 3 planes)
+ * @param stride byte stride of each plane (up to 3 planes)
+ * @param bt709 TRUE to use BT.709 matrix for YUV input, FALSE for BT.601
+ * @param full_range TRUE if YUV input is full range (0-255)
+ * @return TRUE if successfully configured
+ */
+extern gboolean
+gst_tensor_preprocess_configure (GstTensorPreprocess * pp,
+    tensor_preprocess_format format, guint width, guint height,
+    const gsize offset[3], const gint stride[3], gboolean bt709,
+    gboolean full_range);
+
+/**
+ * @brief Get the output tensor info (type and dimension with 1 frame).
+ */
+extern void
+gst_tensor_preprocess_get_info (GstTensorPreprocess * pp,
+    GstTensorInfo * info);
+
+/**
+ * @brief Get the byte size of an input frame, which is required to process a frame.
+ */
+extern gsize
+gst_tensor_preprocess_get_input_size (GstTensorPreprocess * pp);
+
+/**
+ * @brief Convert an input frame to the output tensor in a single pass.
+ * @param pp the configured preprocessing context
+ * @param input input frame data
+ * @param output output tensor data, the size should be the size of output info
+ * @return TRUE if successfully converted
+ */
+extern gboolean
+gst_tensor_preprocess_process (GstTensorPreprocess * pp,
+    const guint8 * input, guint8 * output);
+
+G_END_DECLS
+#endif /* __GST_TENSOR_CONVERTER_PREPROCESS_H__ */
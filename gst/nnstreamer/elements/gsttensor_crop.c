@@ -24,6 +24,10 @@
  *
  * The output is always in the format of other/tensors-flexible.
  *
+ * If the property 'resize' is given (e.g., resize=224:224), tensor_crop resamples each region to the given size
+ * with bilinear interpolation and pushes a single batched tensor (dimension C:W:H:N, N regions) instead of a tensor per region.
+ * The property 'batch-size' fixes N, the regions exceeding the batch size are dropped and the remaining slots are filled with zero.
+ *
  * <refsect2>
  * <title>Example launch line</title>
  * |[
@@ -32,6 +36,10 @@
  *       t. ! queue ! crop.raw \
  *       t. ! queue ! (process raw video tensor and push buffer which includes crop info) ! crop.info
  * ]|
+ * |[
+ * gst-launch-1.0 tensor_crop name=crop resize=64:64 batch-size=4 ! (batched tensor 3:64:64:4) ... \
+ *     (raw video tensor and crop info are linked in the same way)
+ * ]|
  * </refsect2>
  */
 
@@ -40,9 +48,11 @@
 #endif
 
 #include <string.h>
+#include <math.h>
 #include <nnstreamer_util.h>
 #include "gsttensor_crop.h"
 #include "tensor_data.h"
+#include "tensor_simd.h"
 
 /**
  * @brief Internal data structure to describe tensor region.
@@ -65,6 +75,16 @@ typedef struct
   tensor_region_s region[NNS_TENSOR_SIZE_LIMIT];
 } tensor_crop_info_s;
 
+/**
+ * @brief Internal data structure of horizontal tap to resize the region.
+ */
+typedef struct
+{
+  guint i0; /**< offset of left element in the row (x * ch) */
+  guint i1; /**< offset of right element in the row (x * ch) */
+  gdouble w; /**< weight of right element */
+} tensor_crop_tap_s;
+
 GST_DEBUG_CATEGORY_STATIC (gst_tensor_crop_debug);
 #define GST_CAT_DEFAULT gst_tensor_crop_debug
 
@@ -75,7 +95,9 @@ enum
 {
   PROP_0,
   PROP_LATENESS,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_RESIZE,
+  PROP_BATCH_SIZE
 };
 
 /**
@@ -88,6 +110,11 @@ enum
  */
 #define DEFAULT_LATENESS (-1)
 
+/**
+ * @brief Default batch size of the resized output (0 means the number of regions).
+ */
+#define DEFAULT_BATCH_SIZE (0)
+
 /**
  * @brief Template for sink pad (raw data).
  */
@@ -171,6 +198,31 @@ gst_tensor_crop_class_init (GstTensorCropClass * klass)
       g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
           DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorCrop::resize:
+   *
+   * The size of output region (WIDTH:HEIGHT). If this is given, tensor-crop resizes each region
+   * with bilinear interpolation and pushes a single batched tensor (dimension C:W:H:N).
+   * Empty string (default) pushes the cropped regions as they are.
+   */
+  g_object_class_install_property (object_class, PROP_RESIZE,
+      g_param_spec_string ("resize", "Resize",
+          "The size of output region (WIDTH:HEIGHT) to push a batched tensor",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorCrop::batch-size:
+   *
+   * The batch size of resized output. If this is 0 (default), the batch size is the number of regions.
+   * Otherwise, the output always has the given batch size. The regions exceeding the batch size are dropped
+   * and the remaining slots are filled with zero.
+   */
+  g_object_class_install_property (object_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch size",
+          "The batch size of resized output (0 for the number of regions)",
+          0, NNS_TENSOR_SIZE_LIMIT, DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   element_class->change_state =
       GST_DEBUG_FUNCPTR (gst_tensor_crop_change_state);
 
@@ -256,6 +308,9 @@ gst_tensor_crop_init (GstTensorCrop * self)
   self->lateness = DEFAULT_LATENESS;
   self->silent = DEFAULT_SILENT;
   self->send_stream_start = TRUE;
+  self->resize_width = 0;
+  self->resize_height = 0;
+  self->batch_size = DEFAULT_BATCH_SIZE;
 }
 
 /**
@@ -278,6 +333,38 @@ gst_tensor_crop_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/**
+ * @brief Internal function to parse the size of resized region (WIDTH:HEIGHT).
+ */
+static gboolean
+gst_tensor_crop_parse_resize (const gchar * str, guint * width, guint * height)
+{
+  gchar **strv;
+  guint64 w, h;
+  gboolean ret = FALSE;
+
+  *width = *height = 0;
+
+  if (!str || str[0] == '\0')
+    return TRUE;
+
+  strv = g_strsplit (str, ":", -1);
+
+  if (g_strv_length (strv) == 2) {
+    w = g_ascii_strtoull (strv[0], NULL, 10);
+    h = g_ascii_strtoull (strv[1], NULL, 10);
+
+    if (w > 0 && w <= G_MAXUINT16 && h > 0 && h <= G_MAXUINT16) {
+      *width = (guint) w;
+      *height = (guint) h;
+      ret = TRUE;
+    }
+  }
+
+  g_strfreev (strv);
+  return ret;
+}
+
 /**
  * @brief Setter for tensor_crop properties.
  */
@@ -296,6 +383,24 @@ gst_tensor_crop_set_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       break;
+    case PROP_RESIZE:
+    {
+      const gchar *str = g_value_get_string (value);
+      guint width, height;
+
+      if (gst_tensor_crop_parse_resize (str, &width, &height)) {
+        self->resize_width = width;
+        self->resize_height = height;
+      } else {
+        GST_ERROR_OBJECT (self,
+            "Invalid resize option '%s', it should be WIDTH:HEIGHT. Keep the previous size %u:%u.",
+            str, self->resize_width, self->resize_height);
+      }
+      break;
+    }
+    case PROP_BATCH_SIZE:
+      self->batch_size = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -320,6 +425,17 @@ gst_tensor_crop_get_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
+    case PROP_RESIZE:
+      if (self->resize_width > 0 && self->resize_height > 0) {
+        g_value_take_string (value, g_strdup_printf ("%u:%u",
+                self->resize_width, self->resize_height));
+      } else {
+        g_value_set_string (value, "");
+      }
+      break;
+    case PROP_BATCH_SIZE:
+      g_value_set_uint (value, self->batch_size);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -612,6 +728,433 @@ done:
   return ret;
 }
 
+/**
+ * @brief Internal function to clip the region into the raw tensor (width mw, height mh).
+ */
+static void
+gst_tensor_crop_clip_region (const tensor_region_s * region, guint mw,
+    guint mh, tensor_region_s * clipped)
+{
+  clipped->x = (region->x < mw) ? region->x : mw;
+  clipped->y = (region->y < mh) ? region->y : mh;
+  clipped->w = (clipped->x + region->w - 1 < mw) ?
+      region->w : (mw - clipped->x);
+  clipped->h = (clipped->y + region->h - 1 < mh) ?
+      region->h : (mh - clipped->y);
+}
+
+/**
+ * @brief Macro to convert the elements of given type to float or double.
+ */
+#define crop_load_row(T,src,dst,n) do { \
+    const T *_s = (const T *) (src); \
+    guint _k; \
+    for (_k = 0; _k < (n); _k++) \
+      (dst)[_k] = _s[_k]; \
+  } while (0)
+
+/**
+ * @brief Macro to convert float or double to the elements of given type. (round to nearest for integer types)
+ */
+#define crop_store_row(T,src,dst,n,op) do { \
+    T *_d = (T *) (dst); \
+    guint _k; \
+    for (_k = 0; _k < (n); _k++) \
+      _d[_k] = (T) op ((src)[_k]); \
+  } while (0)
+
+#define crop_round_unsigned(v) ((v) + 0.5)
+#define crop_round_signed(v) floor ((v) + 0.5)
+#define crop_round_none(v) (v)
+
+/**
+ * @brief Macro to blend two rows, out = a + (b - a) * w.
+ */
+#define crop_lerp_row(a,b,out,n,w) do { \
+    guint _k; \
+    for (_k = 0; _k < (n); _k++) \
+      (out)[_k] = (a)[_k] + ((b)[_k] - (a)[_k]) * (w); \
+  } while (0)
+
+/**
+ * @brief Macro to resize the region with bilinear interpolation, the elements are interpolated in type F (gfloat or gdouble).
+ * The two source rows are converted once and blended vertically,
+ * then the output row is sampled horizontally with precomputed taps.
+ */
+#define crop_resize_region_loop(F,load,lerp,store) do { \
+    F *_row0, *_row1, *_blend, *_orow, *_tmp; \
+    gdouble _scale, _wy; \
+    gsize _esize, _rstride; \
+    guint _x, _y, _c, _k, _rlen, _olen, _iy0, _iy1; \
+    gint _l0, _l1; \
+    _esize = gst_tensor_get_element_size (type); \
+    _rstride = _esize * ch * mw; \
+    _rlen = region->w * ch; \
+    _olen = ow * ch; \
+    _row0 = (F *) buf; \
+    _row1 = _row0 + _rlen; \
+    _blend = _row1 + _rlen; \
+    _orow = _blend + _rlen; \
+    data += _esize * ch * (region->x + (gsize) region->y * mw); \
+    _scale = (gdouble) region->w / (gdouble) ow; \
+    for (_x = 0; _x < ow; _x++) { \
+      _k = gst_tensor_crop_get_src_index (_x, _scale, region->w, &taps[_x].w); \
+      taps[_x].i0 = _k * ch; \
+      taps[_x].i1 = MIN (_k + 1, region->w - 1) * ch; \
+    } \
+    _scale = (gdouble) region->h / (gdouble) oh; \
+    _l0 = _l1 = -1; \
+    for (_y = 0; _y < oh; _y++) { \
+      _iy0 = gst_tensor_crop_get_src_index (_y, _scale, region->h, &_wy); \
+      _iy1 = MIN (_iy0 + 1, region->h - 1); \
+      /* reuse the converted rows, the source rows are increasing. */ \
+      if ((gint) _iy0 != _l0) { \
+        if ((gint) _iy0 == _l1) { \
+          _tmp = _row0; \
+          _row0 = _row1; \
+          _row1 = _tmp; \
+          _l0 = _l1; \
+          _l1 = -1; \
+        } else { \
+          load (type, data + _rstride * _iy0, _row0, _rlen); \
+          _l0 = _iy0; \
+        } \
+      } \
+      if (_wy > 0.0) { \
+        if ((gint) _iy1 != _l1) { \
+          load (type, data + _rstride * _iy1, _row1, _rlen); \
+          _l1 = _iy1; \
+        } \
+        lerp (_row0, _row1, _blend, _rlen, (F) _wy); \
+      } else { \
+        memcpy (_blend, _row0, sizeof (F) * _rlen); \
+      } \
+      for (_x = 0; _x < ow; _x++) { \
+        const F *_p0 = _blend + taps[_x].i0; \
+        const F *_p1 = _blend + taps[_x].i1; \
+        const F _wx = (F) taps[_x].w; \
+        for (_c = 0; _c < ch; _c++) \
+          _orow[_x * ch + _c] = _p0[_c] + (_p1[_c] - _p0[_c]) * _wx; \
+      } \
+      store (type, _orow, out + _esize * _olen * _y, _olen); \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to check the tensor type is supported to resize the region.
+ */
+static gboolean
+gst_tensor_crop_is_resizable_type (tensor_type type)
+{
+  switch (type) {
+    case _NNS_INT8:
+    case _NNS_UINT8:
+    case _NNS_INT16:
+    case _NNS_UINT16:
+    case _NNS_INT32:
+    case _NNS_UINT32:
+    case _NNS_INT64:
+    case _NNS_UINT64:
+    case _NNS_FLOAT32:
+    case _NNS_FLOAT64:
+      return TRUE;
+    default:
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Internal function to check the elements are interpolated in double, float loses the precision of the type.
+ */
+static gboolean
+gst_tensor_crop_resize_in_double (tensor_type type)
+{
+  switch (type) {
+    case _NNS_INT32:
+    case _NNS_UINT32:
+    case _NNS_INT64:
+    case _NNS_UINT64:
+    case _NNS_FLOAT64:
+      return TRUE;
+    default:
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Internal function to load a row of raw tensor (8-bit, 16-bit or float32) into float array.
+ */
+static void
+gst_tensor_crop_load_row_f32 (tensor_type type, const guint8 * src,
+    gfloat * dst, guint n)
+{
+  if (gst_tensor_simd_typecast_f32 (src, type, dst, n))
+    return;
+
+  switch (type) {
+    case _NNS_INT8:
+      crop_load_row (gint8, src, dst, n);
+      break;
+    case _NNS_UINT8:
+      crop_load_row (guint8, src, dst, n);
+      break;
+    case _NNS_INT16:
+      crop_load_row (gint16, src, dst, n);
+      break;
+    case _NNS_UINT16:
+      crop_load_row (guint16, src, dst, n);
+      break;
+    case _NNS_FLOAT32:
+      memcpy (dst, src, sizeof (gfloat) * n);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to load a row of raw tensor (32-bit integer, 64-bit or float64) into double array.
+ */
+static void
+gst_tensor_crop_load_row_f64 (tensor_type type, const guint8 * src,
+    gdouble * dst, guint n)
+{
+  switch (type) {
+    case _NNS_INT32:
+      crop_load_row (gint32, src, dst, n);
+      break;
+    case _NNS_UINT32:
+      crop_load_row (guint32, src, dst, n);
+      break;
+    case _NNS_INT64:
+      crop_load_row (gint64, src, dst, n);
+      break;
+    case _NNS_UINT64:
+      crop_load_row (guint64, src, dst, n);
+      break;
+    case _NNS_FLOAT64:
+      memcpy (dst, src, sizeof (gdouble) * n);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to blend two float rows.
+ */
+static inline void
+gst_tensor_crop_lerp_row_f32 (const gfloat * a, const gfloat * b,
+    gfloat * out, guint n, gfloat w)
+{
+  if (!gst_tensor_simd_lerp_f32 (a, b, out, n, w))
+    crop_lerp_row (a, b, out, n, w);
+}
+
+/**
+ * @brief Internal function to blend two double rows.
+ */
+static inline void
+gst_tensor_crop_lerp_row_f64 (const gdouble * a, const gdouble * b,
+    gdouble * out, guint n, gdouble w)
+{
+  crop_lerp_row (a, b, out, n, w);
+}
+
+/**
+ * @brief Internal function to store float array into a row of output tensor (8-bit, 16-bit or float32).
+ */
+static void
+gst_tensor_crop_store_row_f32 (tensor_type type, const gfloat * src,
+    guint8 * dst, guint n)
+{
+  switch (type) {
+    case _NNS_INT8:
+      crop_store_row (gint8, src, dst, n, crop_round_signed);
+      break;
+    case _NNS_UINT8:
+      crop_store_row (guint8, src, dst, n, crop_round_unsigned);
+      break;
+    case _NNS_INT16:
+      crop_store_row (gint16, src, dst, n, crop_round_signed);
+      break;
+    case _NNS_UINT16:
+      crop_store_row (guint16, src, dst, n, crop_round_unsigned);
+      break;
+    case _NNS_FLOAT32:
+      memcpy (dst, src, sizeof (gfloat) * n);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to store double array into a row of output tensor (32-bit integer, 64-bit or float64).
+ */
+static void
+gst_tensor_crop_store_row_f64 (tensor_type type, const gdouble * src,
+    guint8 * dst, guint n)
+{
+  switch (type) {
+    case _NNS_INT32:
+      crop_store_row (gint32, src, dst, n, crop_round_signed);
+      break;
+    case _NNS_UINT32:
+      crop_store_row (guint32, src, dst, n, crop_round_unsigned);
+      break;
+    case _NNS_INT64:
+      crop_store_row (gint64, src, dst, n, crop_round_signed);
+      break;
+    case _NNS_UINT64:
+      crop_store_row (guint64, src, dst, n, crop_round_unsigned);
+      break;
+    case _NNS_FLOAT64:
+      memcpy (dst, src, sizeof (gdouble) * n);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to get the source index and weight of bilinear interpolation.
+ * The centers of pixels are aligned (half-pixel offset) and the index is clamped into the region.
+ */
+static guint
+gst_tensor_crop_get_src_index (guint pos, gdouble scale, guint size,
+    gdouble * weight)
+{
+  gdouble f;
+  guint i;
+
+  f = ((gdouble) pos + 0.5) * scale - 0.5;
+  if (f < 0.0)
+    f = 0.0;
+
+  i = (guint) f;
+  if (i >= size - 1) {
+    *weight = 0.0;
+    return size - 1;
+  }
+
+  *weight = f - (gdouble) i;
+  return i;
+}
+
+/**
+ * @brief Internal function to resize the region of NHWC tensor with bilinear interpolation.
+ * 8-bit, 16-bit and float32 elements are interpolated in float (rows are converted and blended with SIMD kernels),
+ * the other types are interpolated in double to keep the precision.
+ * @param data raw tensor data (width mw, ch channels)
+ * @param region clipped region, the width and height should be larger than 0
+ * @param out output data, ow * oh * ch elements
+ * @param taps scratch array of ow taps
+ * @param buf scratch array of (3 * region->w * ch + ow * ch) doubles
+ */
+static void
+gst_tensor_crop_resize_region (tensor_type type, const guint8 * data,
+    guint ch, guint mw, const tensor_region_s * region, guint ow, guint oh,
+    guint8 * out, tensor_crop_tap_s * taps, gpointer buf)
+{
+  if (gst_tensor_crop_resize_in_double (type)) {
+    crop_resize_region_loop (gdouble, gst_tensor_crop_load_row_f64,
+        gst_tensor_crop_lerp_row_f64, gst_tensor_crop_store_row_f64);
+  } else {
+    crop_resize_region_loop (gfloat, gst_tensor_crop_load_row_f32,
+        gst_tensor_crop_lerp_row_f32, gst_tensor_crop_store_row_f32);
+  }
+}
+
+/**
+ * @brief Internal function to resize the regions and make a batched tensor (dimension C:W:H:N).
+ */
+static GstBuffer *
+gst_tensor_crop_resize_batch (GstTensorCrop * self, const guint8 * data,
+    GstTensorInfo * info, GstTensorMetaInfo * meta, tensor_crop_info_s * cinfo)
+{
+  GstBuffer *result;
+  GstMemory *mem;
+  GstTensorInfo out_info;
+  tensor_region_s clipped;
+  tensor_crop_tap_s *taps;
+  gpointer buf;
+  gsize hsize, esize, dsize, fsize;
+  guint8 *batched;
+  guint i, n, ch, mw, mh, ow, oh;
+
+  if (!gst_tensor_crop_is_resizable_type (info->type)) {
+    GST_ERROR_OBJECT (self, "Cannot resize the region of %s tensor.",
+        gst_tensor_get_type_string (info->type));
+    return NULL;
+  }
+
+  result = gst_buffer_new ();
+
+  ch = info->dimension[0];
+  mw = info->dimension[1];
+  mh = info->dimension[2];
+  ow = self->resize_width;
+  oh = self->resize_height;
+  n = (self->batch_size > 0) ? self->batch_size : cinfo->num;
+
+  if (n == 0)
+    return result;
+
+  if (cinfo->num > n) {
+    GST_DEBUG_OBJECT (self, "Drop %u regions exceeding batch size %u.",
+        cinfo->num - n, n);
+  }
+
+  esize = gst_tensor_get_element_size (info->type);
+  fsize = esize * ch * ow * oh;
+
+  meta->dimension[0] = ch;
+  meta->dimension[1] = ow;
+  meta->dimension[2] = oh;
+  meta->dimension[3] = n;
+  hsize = gst_tensor_meta_info_get_header_size (meta);
+  dsize = hsize + fsize * n;
+
+  /* zero-filled for the slots without the region */
+  batched = (guint8 *) g_malloc0 (dsize);
+  gst_tensor_meta_info_update_header (meta, batched);
+
+  taps = g_new (tensor_crop_tap_s, ow);
+  buf = g_malloc (sizeof (gdouble) * ch * (3 * (gsize) mw + ow));
+
+  for (i = 0; i < MIN (n, cinfo->num); i++) {
+    gst_tensor_crop_clip_region (&cinfo->region[i], mw, mh, &clipped);
+
+    if (clipped.w == 0 || clipped.h == 0) {
+      GST_DEBUG_OBJECT (self, "Region %u is out of the raw tensor.", i);
+      continue;
+    }
+
+    gst_tensor_crop_resize_region (info->type, data, ch, mw, &clipped,
+        ow, oh, batched + hsize + fsize * i, taps, buf);
+  }
+
+  g_free (taps);
+  g_free (buf);
+
+  gst_tensor_meta_info_convert (meta, &out_info);
+  mem = gst_memory_new_wrapped (0, batched, dsize, 0, dsize, batched, g_free);
+
+  gst_tensor_buffer_append_memory (result, mem, &out_info);
+  gst_tensor_info_free (&out_info);
+
+  return result;
+}
+
 /**
  * @brief Internal function to crop incoming buffer.
  */
@@ -658,6 +1201,13 @@ gst_tensor_crop_do_cropping (GstTensorCrop * self, GstBuffer * raw,
     goto done;
   }
 
+  if (self->resize_width > 0 && self->resize_height > 0) {
+    result = gst_tensor_crop_resize_batch (self, dpos, &info, &meta, cinfo);
+    if (result)
+      gst_buffer_copy_into (result, raw, GST_BUFFER_COPY_METADATA, 0, -1);
+    goto done;
+  }
+
   result = gst_buffer_new ();
 
   /** @todo Add various mode to crop tensor. */
@@ -670,11 +1220,13 @@ gst_tensor_crop_do_cropping (GstTensorCrop * self, GstBuffer * raw,
   for (i = 0; i < cinfo->num; i++) {
     GstTensorInfo crop_info;
     GstMemory *crop_mem;
+    tensor_region_s clipped;
 
-    _x = (cinfo->region[i].x < mw) ? cinfo->region[i].x : mw;
-    _y = (cinfo->region[i].y < mh) ? cinfo->region[i].y : mh;
-    _w = (_x + cinfo->region[i].w - 1 < mw) ? cinfo->region[i].w : (mw - _x);
-    _h = (_y + cinfo->region[i].h - 1 < mh) ? cinfo->region[i].h : (mh - _y);
+    gst_tensor_crop_clip_region (&cinfo->region[i], mw, mh, &clipped);
+    _x = clipped.x;
+    _y = clipped.y;
+    _w = clipped.w;
+    _h = clipped.h;
 
     g_assert (_w > 0 && _h > 0);
     dsize = hsize + (esize * ch * _w * _h);
@@ -783,6 +1335,11 @@ gst_tensor_crop_chain (GstTensorCrop * self,
   }
 
   result = gst_tensor_crop_do_cropping (self, buf_raw, &cinfo);
+  if (!result) {
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
+
   ret = gst_pad_push (self->srcpad, result);
 
 done:
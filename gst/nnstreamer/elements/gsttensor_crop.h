@@ -59,6 +59,10 @@ struct _GstTensorCrop
   gboolean silent; /**< true to print minimized log */
   gboolean send_stream_start; /**< flag to send STREAM_START event */
   GstCollectPads *collect; /**< sink pads */
+
+  guint resize_width; /**< width of the resized region, 0 to disable batched output */
+  guint resize_height; /**< height of the resized region, 0 to disable batched output */
+  guint batch_size; /**< fixed batch size of the resized output, 0 for the number of regions */
 };
 
 /**
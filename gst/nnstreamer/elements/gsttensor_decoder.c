@@ -430,6 +430,7 @@ gst_tensordec_init (GstTensorDecoder * self)
     self->option[i] = NULL;
 
   gst_tensors_config_init (&self->tensor_config);
+  self->metrics = gst_tensor_metrics_new (GST_ELEMENT (self), "tensor_decoder");
 }
 
 /**
@@ -630,6 +631,7 @@ gst_tensordec_class_finalize (GObject * object)
   }
   self->custom.func = NULL;
   self->custom.data = NULL;
+  gst_tensor_metrics_free (self->metrics);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -711,6 +713,7 @@ gst_tensordec_transform (GstBaseTransform * trans,
     GstMapInfo in_info[NNS_TENSOR_SIZE_LIMIT];
     GstTensorMemory input[NNS_TENSOR_SIZE_LIMIT];
     guint i, num_tensors, num_mems;
+    gint64 start_time = g_get_monotonic_time ();
 
     num_mems = gst_tensor_buffer_get_count (inbuf);
     if (gst_tensors_config_is_flexible (&self->tensor_config)) {
@@ -752,6 +755,12 @@ gst_tensordec_transform (GstBaseTransform * trans,
       gst_memory_unmap (in_mem[i], &in_info[i]);
       gst_memory_unref (in_mem[i]);
     }
+
+    if (res == GST_FLOW_OK) {
+      gst_tensor_metrics_record (self->metrics, -1,
+          g_get_monotonic_time () - start_time, gst_buffer_get_size (inbuf),
+          gst_buffer_get_size (outbuf));
+    }
   } else {
     GST_ERROR_OBJECT (self, "Decoder plugin not yet configured.");
     goto unknown_type;
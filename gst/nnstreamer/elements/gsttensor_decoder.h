@@ -36,6 +36,7 @@
 #include "nnstreamer_subplugin.h"
 #include "nnstreamer_plugin_api_decoder.h"
 #include "tensor_decoder_custom.h"
+#include "tensor_metrics.h"
 
 G_BEGIN_DECLS
 
@@ -84,6 +85,8 @@ struct _GstTensorDecoder
 
   const GstTensorDecoderDef *decoder; /**< Plugin object */
   void *plugin_data;
+
+  GstTensorMetrics *metrics; /**< Latency histograms and bytes of the decoding */
 };
 
 /**
@@ -42,6 +42,19 @@
  *      tif.src_1 ! queue ! (tensor(s) stream for FALSE action) ...
  * </refsect2>
  *
+ * Statistics of tensors or regions may be combined with an expression,
+ * which is compiled once when the property is set:
+ * <refsect2>
+ * <title>Example launch line with expression</title>
+ * gst-launch ... (some tensor stream) !
+ *      tensor_if name=tif
+ *        compared-value=EXPRESSION
+ *        compared-value-option="(max(t0) > 0.8) && (mean(t1[0:10]) < 0.2)"
+ *        then=PASSTHROUGH
+ *        else=SKIP
+ *      tif.src_0 ! queue ! (tensor(s) stream for TRUE action) ...
+ * </refsect2>
+ *
  * However, if the if-condition is complex and cannot be expressed with
  * tensor-if expressions, you may create a corresponding custom filter
  * with tensor-filter, whose output is other/tensors with an additional tensor
@@ -152,6 +165,8 @@ gst_tensor_if_cv_get_type (void)
       {TIFCV_TENSOR_AVERAGE_VALUE, "TENSOR_AVERAGE_VALUE",
           "Decide based on a average value of a specific tensor"},
       {TIFCV_CUSTOM, "CUSTOM", "Decide based on a user defined callback"},
+      {TIFCV_EXPRESSION, "EXPRESSION",
+          "Decide based on an expression of reductions and conditions"},
       {0, NULL, NULL},
     };
     mode_type = g_enum_register_static ("tensor_if_compared_value", mode_types);
@@ -279,6 +294,7 @@ gst_tensor_if_init (GstTensorIf * tensor_if)
   memset (tensor_if->sv, 0, sizeof (tensor_if_sv_s) * 2);
   memset (&tensor_if->custom, 0, sizeof (custom_cb_s));
   tensor_if->custom_configured = FALSE;
+  tensor_if->expr = NULL;
 
   g_mutex_init (&tensor_if->lock);
 }
@@ -317,6 +333,8 @@ gst_tensor_if_dispose (GObject * object)
   tensor_if->custom.func = NULL;
   tensor_if->custom.data = NULL;
   tensor_if->custom_configured = FALSE;
+  gst_tensor_if_expr_free (tensor_if->expr);
+  tensor_if->expr = NULL;
 
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
@@ -446,6 +464,19 @@ gst_tensor_if_configure_custom_prop (GstTensorIf * self)
     self->custom_configured = TRUE;
     self->custom.func = (*ptr).func;
     self->custom.data = (*ptr).data;
+  } else if (self->cv == TIFCV_EXPRESSION) {
+    tensor_if_expr *expr, *old;
+
+    expr = gst_tensor_if_expr_compile (self->custom.name);
+    if (!expr)
+      nns_logw ("Failed to compile the expression of the tensor_if");
+
+    g_mutex_lock (&self->lock);
+    old = self->expr;
+    self->expr = expr;
+    g_mutex_unlock (&self->lock);
+
+    gst_tensor_if_expr_free (old);
   }
 }
 
@@ -467,7 +498,8 @@ gst_tensor_if_set_property (GObject * object, guint prop_id,
       g_free (self->custom.name);
       self->custom.name = g_value_dup_string (value);
       gst_tensor_if_configure_custom_prop (self);
-      gst_tensor_if_set_property_cv_option (value, &self->cv_option);
+      if (self->cv != TIFCV_EXPRESSION)
+        gst_tensor_if_set_property_cv_option (value, &self->cv_option);
       break;
     case PROP_OP:
       self->op = g_value_get_enum (value);
@@ -586,7 +618,7 @@ gst_tensor_if_get_property (GObject * object, guint prop_id,
       g_value_set_enum (value, self->cv);
       break;
     case PROP_CV_OPTION:
-      if (self->cv == TIFCV_CUSTOM) {
+      if (self->cv == TIFCV_CUSTOM || self->cv == TIFCV_EXPRESSION) {
         g_value_set_string (value, self->custom.name ? self->custom.name : "");
       } else {
         gst_tensor_if_property_to_string (value, self->cv_option, prop_id);
@@ -907,7 +939,8 @@ gst_tensor_if_get_tensor_average (GstTensorIf * tensor_if,
   GstTensorInfo *_info;
   GstMemory *in_mem;
   GstMapInfo in_info;
-  gdouble *avg = NULL;
+  gdouble avg = 0.0;
+  gboolean ret;
   tensor_type type;
 
   in_mem = gst_tensor_buffer_get_nth_memory (buf, nth);
@@ -920,15 +953,21 @@ gst_tensor_if_get_tensor_average (GstTensorIf * tensor_if,
   _info = gst_tensors_info_get_nth_info (&tensor_if->in_config.info, nth);
   type = _info->type;
 
-  gst_tensor_data_raw_average (in_info.data, in_info.size, type, &avg);
+  ret = gst_tensor_if_reduce (_info, in_info.data, in_info.size, NULL,
+      TIF_REDUCE_MEAN, 0.0, &avg);
 
   gst_memory_unmap (in_mem, &in_info);
   gst_memory_unref (in_mem);
 
-  gst_tensor_data_set (cv, _NNS_FLOAT64, avg);
+  if (!ret) {
+    GST_ERROR_OBJECT (tensor_if, "Failed to get the average of tensor %u.",
+        nth);
+    return FALSE;
+  }
+
+  gst_tensor_data_set (cv, _NNS_FLOAT64, &avg);
   gst_tensor_data_typecast (cv, type);
 
-  g_free (avg);
   return TRUE;
 }
 
@@ -1106,6 +1145,32 @@ gst_tensor_if_check_condition (GstTensorIf * tensor_if, GstBuffer * buf,
       gst_memory_unmap (in_mem[i], &in_info[i]);
       gst_memory_unref (in_mem[i]);
     }
+  } else if (tensor_if->cv == TIFCV_EXPRESSION) {
+    tensor_data_s cv = {.type = _NNS_FLOAT64,.data._double = 0.0 };
+
+    g_mutex_lock (&tensor_if->lock);
+    if (!tensor_if->expr) {
+      g_mutex_unlock (&tensor_if->lock);
+      nns_loge ("expression of the tensor_if is not configured.");
+      return FALSE;
+    }
+
+    ret = gst_tensor_if_expr_eval (tensor_if->expr, &tensor_if->in_config.info,
+        buf, &cv.data._double);
+    g_mutex_unlock (&tensor_if->lock);
+
+    if (!ret) {
+      GST_ERROR_OBJECT (tensor_if, " failed to evaluate the expression");
+      return FALSE;
+    }
+
+    /* without supplied value, non-zero result of the expression is true */
+    if (tensor_if->sv->num == 0) {
+      *result = (cv.data._double != 0.0);
+      ret = TRUE;
+    } else {
+      ret = gst_tensor_if_get_comparison_result (tensor_if, &cv, result);
+    }
   } else {
     tensor_data_s cv = {.type = _NNS_END,.data._uint8_t = 0 };
     if (!gst_tensor_if_calculate_cv (tensor_if, buf, &cv)) {
@@ -23,6 +23,7 @@
 #include <tensor_common.h>
 #include <tensor_data.h>
 #include <tensor_if.h>
+#include "gsttensor_ifexpr.h"
 
 G_BEGIN_DECLS
 
@@ -51,6 +52,8 @@ typedef enum {
   TIFCV_ALL_TENSORS_AVERAGE_VALUE = 4,	/**< Decide based on a average value of
 					     tensors or a specific tensor */
   TIFCV_CUSTOM = 5,    /**< Decide based on a user defined condition */
+  TIFCV_EXPRESSION = 6,	/**< Decide based on an expression of reductions
+			     and conditions of tensors */
   TIFCV_END,
 } tensor_if_compared_value;
 
@@ -141,8 +144,9 @@ struct _GstTensorIf
 
   gboolean custom_configured;
   custom_cb_s custom;
+  tensor_if_expr *expr; /**< compiled expression of compared value */
 
-  GMutex lock; /**< Lock for custom callback */
+  GMutex lock; /**< Lock for custom callback and expression */
 };
 
 /**
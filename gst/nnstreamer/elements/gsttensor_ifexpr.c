@@ -0,0 +1,1127 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Tensor-IF
+ */
+/**
+ * @file	gsttensor_ifexpr.c
+ * @date	16 Oct 2026
+ * @brief	Region reductions and condition expressions of tensor_if.
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ *
+ * The expression is compiled once into a tree of nodes. Each node has its
+ * own evaluation function, so the expression is evaluated without parsing
+ * or dispatching the operator for each frame.
+ *
+ * expr    := and ( '||' and )*
+ * and     := cmp ( '&&' cmp )*
+ * cmp     := add [ ( '==' | '!=' | '>' | '>=' | '<' | '<=' ) add ]
+ * add     := mul ( ( '+' | '-' ) mul )*
+ * mul     := unary ( ( '*' | '/' ) unary )*
+ * unary   := ( '-' | '!' ) unary | primary
+ * primary := number | '(' expr ')' | tensor | func '(' tensor ')'
+ *            | 'count' '(' tensor ',' number ')'
+ * func    := 'sum' | 'mean' | 'max' | 'min' | 'argmax' | 'argmin'
+ * tensor  := 't' N [ '[' slice ( ',' slice )* ']' ]
+ * slice   := [ start ] [ ':' [ end ] ]
+ *
+ * Slices are given from the first (innermost) dimension, same as the
+ * dimension string of tensor caps. A tensor without a function should be
+ * a single element, e.g., t0[0,1,2].
+ */
+
+#include <math.h>
+#include <string.h>
+#include <nnstreamer_log.h>
+#include <nnstreamer_util.h>
+#include <tensor_data.h>
+#include "gsttensor_ifexpr.h"
+#include "tensor_simd.h"
+
+/**
+ * @brief Accumulator of the reduction.
+ */
+typedef struct
+{
+  gdouble value; /**< sum, max or min value */
+  gsize index; /**< index of max or min element */
+  gsize count; /**< the number of reduced or counted elements */
+} tif_reduce_acc;
+
+/**
+ * @brief Macro to reduce contiguous elements with given type.
+ * @details lo and hi are the initial values of max and min.
+ */
+#define reduce_run(T,lo,hi,p,num,op,th,acc,base) do { \
+    const T *_p = (const T *) (p); \
+    gsize _i; \
+    switch (op) { \
+      case TIF_REDUCE_SUM: \
+      case TIF_REDUCE_MEAN: \
+      { \
+        gdouble _s = 0.0; \
+        for (_i = 0; _i < (num); _i++) \
+          _s += (gdouble) _p[_i]; \
+        (acc)->value += _s; \
+        break; \
+      } \
+      case TIF_REDUCE_MAX: \
+      case TIF_REDUCE_ARGMAX: \
+      { \
+        T _m = (lo); \
+        for (_i = 0; _i < (num); _i++) \
+          _m = (_p[_i] > _m) ? _p[_i] : _m; \
+        if ((gdouble) _m > (acc)->value) { \
+          (acc)->value = (gdouble) _m; \
+          _i = 0; \
+          while (_i < (num) && _p[_i] != _m) \
+            _i++; \
+          (acc)->index = (base) + _i; \
+        } \
+        break; \
+      } \
+      case TIF_REDUCE_MIN: \
+      case TIF_REDUCE_ARGMIN: \
+      { \
+        T _m = (hi); \
+        for (_i = 0; _i < (num); _i++) \
+          _m = (_p[_i] < _m) ? _p[_i] : _m; \
+        if ((gdouble) _m < (acc)->value) { \
+          (acc)->value = (gdouble) _m; \
+          _i = 0; \
+          while (_i < (num) && _p[_i] != _m) \
+            _i++; \
+          (acc)->index = (base) + _i; \
+        } \
+        break; \
+      } \
+      case TIF_REDUCE_COUNT: \
+      { \
+        gsize _c = 0; \
+        for (_i = 0; _i < (num); _i++) \
+          _c += ((gdouble) _p[_i] > (th)); \
+        (acc)->count += _c; \
+        break; \
+      } \
+      default: \
+        break; \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to reduce contiguous float32 elements with SIMD kernels.
+ * @return FALSE if SIMD is not available
+ */
+static gboolean
+_reduce_run_f32 (const gfloat * p, gsize num, tensor_if_reduce op,
+    gdouble threshold, tif_reduce_acc * acc, gsize base)
+{
+  gdouble v;
+  gsize i;
+
+  switch (op) {
+    case TIF_REDUCE_SUM:
+    case TIF_REDUCE_MEAN:
+      if (!gst_tensor_simd_reduce_f32 (p, num, NNS_SIMD_REDUCE_SUM, 0.0f, &v))
+        return FALSE;
+      acc->value += v;
+      break;
+    case TIF_REDUCE_MAX:
+    case TIF_REDUCE_ARGMAX:
+      if (!gst_tensor_simd_reduce_f32 (p, num, NNS_SIMD_REDUCE_MAX, 0.0f, &v))
+        return FALSE;
+      if (v > acc->value) {
+        acc->value = v;
+        i = 0;
+        while (i < num && p[i] != (gfloat) v)
+          i++;
+        acc->index = base + i;
+      }
+      break;
+    case TIF_REDUCE_MIN:
+    case TIF_REDUCE_ARGMIN:
+      if (!gst_tensor_simd_reduce_f32 (p, num, NNS_SIMD_REDUCE_MIN, 0.0f, &v))
+        return FALSE;
+      if (v < acc->value) {
+        acc->value = v;
+        i = 0;
+        while (i < num && p[i] != (gfloat) v)
+          i++;
+        acc->index = base + i;
+      }
+      break;
+    case TIF_REDUCE_COUNT:
+      /* the threshold is compared in float32 */
+      if (!gst_tensor_simd_reduce_f32 (p, num, NNS_SIMD_REDUCE_COUNT_GT,
+              (gfloat) threshold, &v))
+        return FALSE;
+      acc->count += (gsize) v;
+      break;
+    default:
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to reduce contiguous elements.
+ */
+static gboolean
+_reduce_run (const guint8 * p, tensor_type type, gsize num,
+    tensor_if_reduce op, gdouble threshold, tif_reduce_acc * acc, gsize base)
+{
+  switch (type) {
+    case _NNS_INT32:
+      reduce_run (gint32, G_MININT32, G_MAXINT32, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_UINT32:
+      reduce_run (guint32, 0, G_MAXUINT32, p, num, op, threshold, acc, base);
+      break;
+    case _NNS_INT16:
+      reduce_run (gint16, G_MININT16, G_MAXINT16, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_UINT16:
+      reduce_run (guint16, 0, G_MAXUINT16, p, num, op, threshold, acc, base);
+      break;
+    case _NNS_INT8:
+      reduce_run (gint8, G_MININT8, G_MAXINT8, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_UINT8:
+      reduce_run (guint8, 0, G_MAXUINT8, p, num, op, threshold, acc, base);
+      break;
+    case _NNS_INT64:
+      reduce_run (gint64, G_MININT64, G_MAXINT64, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_UINT64:
+      reduce_run (guint64, 0, G_MAXUINT64, p, num, op, threshold, acc, base);
+      break;
+    case _NNS_FLOAT64:
+      reduce_run (gdouble, -INFINITY, INFINITY, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_FLOAT32:
+      /* compare the threshold in float32 with or without SIMD kernels */
+      threshold = (gdouble) (gfloat) threshold;
+      if (_reduce_run_f32 ((const gfloat *) p, num, op, threshold, acc, base))
+        break;
+      reduce_run (gfloat, -INFINITY, INFINITY, p, num, op, threshold, acc,
+          base);
+      break;
+    case _NNS_FLOAT16:
+#ifdef FLOAT16_SUPPORT
+      reduce_run (float16, -INFINITY, INFINITY, p, num, op, threshold, acc,
+          base);
+      break;
+#else
+      nns_loge
+          ("NNStreamer requires -DFLOAT16_SUPPORT as a build option to enable float16 type. This binary does not have float16 feature enabled; thus, float16 type is not supported in this instance.\n");
+      return FALSE;
+#endif
+    default:
+      nns_loge ("Unknown tensor type %d to reduce.", type);
+      return FALSE;
+  }
+
+  /* the number of elements for average */
+  if (op != TIF_REDUCE_COUNT)
+    acc->count += num;
+
+  return TRUE;
+}
+
+/**
+ * @brief Initialize the region to the whole tensor.
+ */
+void
+gst_tensor_if_region_init (tensor_if_region * region)
+{
+  guint i;
+
+  g_return_if_fail (region != NULL);
+
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    region->start[i] = 0;
+    region->end[i] = TIF_REGION_END;
+  }
+}
+
+/**
+ * @brief Reduce the elements in the region of a tensor.
+ */
+gboolean
+gst_tensor_if_reduce (const GstTensorInfo * info, gconstpointer data,
+    gsize size, const tensor_if_region * region, tensor_if_reduce op,
+    gdouble threshold, gdouble * result)
+{
+  gsize start[NNS_TENSOR_RANK_LIMIT], len[NNS_TENSOR_RANK_LIMIT];
+  gsize stride[NNS_TENSOR_RANK_LIMIT], pos[NNS_TENSOR_RANK_LIMIT];
+  gsize esize, run, offset, base;
+  guint rank, d, k;
+  tif_reduce_acc acc;
+
+  g_return_val_if_fail (info != NULL, FALSE);
+  g_return_val_if_fail (data != NULL, FALSE);
+  g_return_val_if_fail (op < TIF_REDUCE_END, FALSE);
+  g_return_val_if_fail (result != NULL, FALSE);
+
+  rank = gst_tensor_info_get_rank (info);
+  esize = gst_tensor_get_element_size (info->type);
+  if (rank == 0 || esize == 0 || gst_tensor_info_get_size (info) > size) {
+    nns_loge ("Invalid tensor info or data to reduce.");
+    return FALSE;
+  }
+
+  for (d = 0; d < NNS_TENSOR_RANK_LIMIT; d++) {
+    gsize s = 0, e = TIF_REGION_END;
+    gsize dim = (d < rank) ? info->dimension[d] : 1;
+
+    if (region) {
+      s = region->start[d];
+      e = region->end[d];
+    }
+
+    if (e == TIF_REGION_END)
+      e = dim;
+
+    if (s >= e || e > dim) {
+      nns_loge ("Invalid region [%" G_GSIZE_FORMAT ":%" G_GSIZE_FORMAT
+          "] of the dimension %u (%" G_GSIZE_FORMAT ").", s, e, d, dim);
+      return FALSE;
+    }
+
+    if (d < rank) {
+      start[d] = s;
+      len[d] = e - s;
+      stride[d] = (d == 0) ? 1 : stride[d - 1] * info->dimension[d - 1];
+      pos[d] = 0;
+    }
+  }
+
+  /* merge the leading dimensions into a contiguous run */
+  k = 0;
+  run = len[0];
+  while (k + 1 < rank && len[k] == info->dimension[k]) {
+    k++;
+    run *= len[k];
+  }
+
+  acc.value = 0.0;
+  acc.index = 0;
+  acc.count = 0;
+
+  if (op == TIF_REDUCE_MAX || op == TIF_REDUCE_ARGMAX)
+    acc.value = -INFINITY;
+  else if (op == TIF_REDUCE_MIN || op == TIF_REDUCE_ARGMIN)
+    acc.value = INFINITY;
+
+  base = 0;
+  while (TRUE) {
+    offset = start[k] * stride[k];
+    for (d = k + 1; d < rank; d++)
+      offset += (start[d] + pos[d]) * stride[d];
+
+    if (!_reduce_run ((const guint8 *) data + offset * esize, info->type, run,
+            op, threshold, &acc, base))
+      return FALSE;
+
+    base += run;
+
+    /* next run in the outer dimensions */
+    for (d = k + 1; d < rank; d++) {
+      if (++pos[d] < len[d])
+        break;
+      pos[d] = 0;
+    }
+
+    if (d >= rank)
+      break;
+  }
+
+  switch (op) {
+    case TIF_REDUCE_MEAN:
+      *result = acc.value / acc.count;
+      break;
+    case TIF_REDUCE_ARGMAX:
+    case TIF_REDUCE_ARGMIN:
+      *result = (gdouble) acc.index;
+      break;
+    case TIF_REDUCE_COUNT:
+      *result = (gdouble) acc.count;
+      break;
+    default:
+      *result = acc.value;
+      break;
+  }
+
+  return TRUE;
+}
+
+typedef struct _tif_node tif_node;
+typedef struct _tif_eval_ctx tif_eval_ctx;
+
+/**
+ * @brief Evaluation function of the expression node.
+ */
+typedef gboolean (*tif_eval_func) (const tif_node * node, tif_eval_ctx * ctx,
+    gdouble * value);
+
+/**
+ * @brief Node of the compiled expression.
+ */
+struct _tif_node
+{
+  tif_eval_func eval; /**< evaluation function of the node */
+  tif_node *left; /**< first operand */
+  tif_node *right; /**< second operand */
+  gdouble value; /**< constant value or the threshold of count */
+  guint ref; /**< index of the referred tensor in the expression */
+  tensor_if_reduce reduce; /**< reduction of the tensor region */
+  tensor_if_region region; /**< region of the tensor */
+};
+
+/**
+ * @brief Compiled expression of tensor_if.
+ */
+struct _tensor_if_expr
+{
+  tif_node *root; /**< root node of the expression */
+  GArray *nth; /**< the tensor index of each reference (guint) */
+  GstMemory **mem; /**< mapped memories of the references */
+  GstMapInfo *map; /**< map info of the references */
+};
+
+/**
+ * @brief Context to evaluate the expression.
+ */
+struct _tif_eval_ctx
+{
+  tensor_if_expr *expr;
+  const GstTensorsInfo *info;
+  GstBuffer *buf;
+};
+
+/**
+ * @brief Internal function to map the referred tensor once.
+ */
+static gboolean
+_expr_get_tensor (tif_eval_ctx * ctx, guint ref, GstTensorInfo ** info,
+    GstMapInfo ** map)
+{
+  tensor_if_expr *expr = ctx->expr;
+  guint nth = g_array_index (expr->nth, guint, ref);
+
+  if (nth >= ctx->info->num_tensors) {
+    nns_loge ("Invalid tensor index t%u, the number of tensors is %u.", nth,
+        ctx->info->num_tensors);
+    return FALSE;
+  }
+
+  if (expr->mem[ref] == NULL) {
+    expr->mem[ref] = gst_tensor_buffer_get_nth_memory (ctx->buf, nth);
+    if (expr->mem[ref] == NULL)
+      return FALSE;
+
+    if (!gst_memory_map (expr->mem[ref], &expr->map[ref], GST_MAP_READ)) {
+      nns_loge ("Failed to map the tensor t%u.", nth);
+      gst_memory_unref (expr->mem[ref]);
+      expr->mem[ref] = NULL;
+      return FALSE;
+    }
+  }
+
+  *info = gst_tensors_info_get_nth_info ((GstTensorsInfo *) ctx->info, nth);
+  *map = &expr->map[ref];
+  return TRUE;
+}
+
+/**
+ * @brief Evaluate the constant.
+ */
+static gboolean
+_eval_const (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  UNUSED (ctx);
+  *value = node->value;
+  return TRUE;
+}
+
+/**
+ * @brief Evaluate the reduction of a tensor region.
+ */
+static gboolean
+_eval_reduce (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  GstTensorInfo *info;
+  GstMapInfo *map;
+
+  if (!_expr_get_tensor (ctx, node->ref, &info, &map))
+    return FALSE;
+
+  return gst_tensor_if_reduce (info, map->data, map->size, &node->region,
+      node->reduce, node->value, value);
+}
+
+/**
+ * @brief Evaluate an element of a tensor.
+ */
+static gboolean
+_eval_element (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  GstTensorInfo *info;
+  GstMapInfo *map;
+  gsize offset = 0, stride = 1;
+  guint d, rank;
+
+  if (!_expr_get_tensor (ctx, node->ref, &info, &map))
+    return FALSE;
+
+  rank = gst_tensor_info_get_rank (info);
+  for (d = 0; d < NNS_TENSOR_RANK_LIMIT; d++) {
+    guint32 dim = (d < rank) ? info->dimension[d] : 1;
+
+    if (node->region.start[d] >= dim) {
+      nns_loge ("Invalid index %u of the dimension %u (%u).",
+          node->region.start[d], d, dim);
+      return FALSE;
+    }
+
+    offset += node->region.start[d] * stride;
+    stride *= dim;
+  }
+
+  offset *= gst_tensor_get_element_size (info->type);
+  if (offset >= map->size) {
+    nns_loge ("Invalid element index, the tensor size is %" G_GSIZE_FORMAT
+        ".", map->size);
+    return FALSE;
+  }
+
+  return gst_tensor_data_raw_typecast (map->data + offset, info->type, value,
+      _NNS_FLOAT64);
+}
+
+/**
+ * @brief Evaluate the negation.
+ */
+static gboolean
+_eval_neg (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  if (!node->left->eval (node->left, ctx, value))
+    return FALSE;
+
+  *value = -(*value);
+  return TRUE;
+}
+
+/**
+ * @brief Evaluate the logical not.
+ */
+static gboolean
+_eval_not (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  if (!node->left->eval (node->left, ctx, value))
+    return FALSE;
+
+  *value = (*value == 0.0) ? 1.0 : 0.0;
+  return TRUE;
+}
+
+/**
+ * @brief Evaluate the logical and. The second operand is not evaluated if the first is false.
+ */
+static gboolean
+_eval_and (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  if (!node->left->eval (node->left, ctx, value))
+    return FALSE;
+
+  if (*value == 0.0)
+    return TRUE;
+
+  if (!node->right->eval (node->right, ctx, value))
+    return FALSE;
+
+  *value = (*value != 0.0) ? 1.0 : 0.0;
+  return TRUE;
+}
+
+/**
+ * @brief Evaluate the logical or. The second operand is not evaluated if the first is true.
+ */
+static gboolean
+_eval_or (const tif_node * node, tif_eval_ctx * ctx, gdouble * value)
+{
+  if (!node->left->eval (node->left, ctx, value))
+    return FALSE;
+
+  if (*value == 0.0 && !node->right->eval (node->right, ctx, value))
+    return FALSE;
+
+  *value = (*value != 0.0) ? 1.0 : 0.0;
+  return TRUE;
+}
+
+/**
+ * @brief Macro to define the evaluation function of binary operator.
+ */
+#define TIF_EVAL_BINARY(name,expr) \
+static gboolean \
+_eval_##name (const tif_node * node, tif_eval_ctx * ctx, gdouble * value) \
+{ \
+  gdouble a, b; \
+  if (!node->left->eval (node->left, ctx, &a) || \
+      !node->right->eval (node->right, ctx, &b)) \
+    return FALSE; \
+  *value = (expr); \
+  return TRUE; \
+}
+
+/**
+ * @brief Evaluation functions of arithmetic and comparison operators.
+ */
+TIF_EVAL_BINARY (add, a + b)
+TIF_EVAL_BINARY (sub, a - b)
+TIF_EVAL_BINARY (mul, a * b)
+TIF_EVAL_BINARY (div, a / b)
+TIF_EVAL_BINARY (eq, (a == b) ? 1.0 : 0.0)
+TIF_EVAL_BINARY (ne, (a != b) ? 1.0 : 0.0)
+TIF_EVAL_BINARY (gt, (a > b) ? 1.0 : 0.0)
+TIF_EVAL_BINARY (ge, (a >= b) ? 1.0 : 0.0)
+TIF_EVAL_BINARY (lt, (a < b) ? 1.0 : 0.0)
+TIF_EVAL_BINARY (le, (a <= b) ? 1.0 : 0.0)
+
+/**
+ * @brief Parser of the expression.
+ */
+typedef struct
+{
+  const gchar *str; /**< the expression */
+  const gchar *p; /**< current position */
+  tensor_if_expr *expr; /**< the expression being compiled */
+  gboolean failed; /**< TRUE if an error is found */
+} tif_parser;
+
+/**
+ * @brief Names of the reduction functions.
+ */
+static const gchar *tif_reduce_names[] = {
+  [TIF_REDUCE_SUM] = "sum",
+  [TIF_REDUCE_MEAN] = "mean",
+  [TIF_REDUCE_MAX] = "max",
+  [TIF_REDUCE_MIN] = "min",
+  [TIF_REDUCE_ARGMAX] = "argmax",
+  [TIF_REDUCE_ARGMIN] = "argmin",
+  [TIF_REDUCE_COUNT] = "count",
+  [TIF_REDUCE_END] = NULL,
+};
+
+static tif_node *_parse_expr (tif_parser * parser);
+
+/**
+ * @brief Internal function to report the parse error.
+ */
+static tif_node *
+_parse_error (tif_parser * parser, const gchar * reason)
+{
+  if (!parser->failed) {
+    nns_loge ("Invalid expression of tensor_if at %ld (%s): %s",
+        (long) (parser->p - parser->str), reason, parser->str);
+    parser->failed = TRUE;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to free the nodes.
+ */
+static void
+_node_free (tif_node * node)
+{
+  if (node) {
+    _node_free (node->left);
+    _node_free (node->right);
+    g_free (node);
+  }
+}
+
+/**
+ * @brief Internal function to create a node.
+ */
+static tif_node *
+_node_new (tif_eval_func eval, tif_node * left, tif_node * right)
+{
+  tif_node *node = g_new0 (tif_node, 1);
+
+  node->eval = eval;
+  node->left = left;
+  node->right = right;
+  gst_tensor_if_region_init (&node->region);
+  return node;
+}
+
+/**
+ * @brief Internal function to skip spaces.
+ */
+static void
+_skip_space (tif_parser * parser)
+{
+  while (g_ascii_isspace (*parser->p))
+    parser->p++;
+}
+
+/**
+ * @brief Internal function to consume the token if it is matched.
+ */
+static gboolean
+_accept (tif_parser * parser, const gchar * token)
+{
+  gsize len = strlen (token);
+
+  _skip_space (parser);
+  if (strncmp (parser->p, token, len) != 0)
+    return FALSE;
+
+  /* do not split '>=' into '>' and '=' */
+  if (len == 1 && (token[0] == '<' || token[0] == '>' || token[0] == '!') &&
+      parser->p[1] == '=')
+    return FALSE;
+
+  parser->p += len;
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to parse an unsigned integer.
+ */
+static gboolean
+_parse_uint (tif_parser * parser, guint32 * value)
+{
+  gchar *end;
+  guint64 v;
+
+  _skip_space (parser);
+  if (!g_ascii_isdigit (*parser->p))
+    return FALSE;
+
+  v = g_ascii_strtoull (parser->p, &end, 10);
+  if (v >= G_MAXUINT32)
+    return FALSE;
+
+  parser->p = end;
+  *value = (guint32) v;
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to parse the tensor reference, 't' N [ '[' slices ']' ].
+ * @param[out] single TRUE if the region is a single element
+ */
+static tif_node *
+_parse_tensor (tif_parser * parser, gboolean * single)
+{
+  tif_node *node;
+  guint32 nth;
+  guint d, i;
+
+  _skip_space (parser);
+  if (*parser->p != 't')
+    return _parse_error (parser, "tensor is expected, e.g., t0");
+  parser->p++;
+
+  if (!_parse_uint (parser, &nth) || nth >= NNS_TENSOR_SIZE_LIMIT)
+    return _parse_error (parser, "invalid tensor index");
+
+  node = _node_new (_eval_reduce, NULL, NULL);
+  *single = FALSE;
+
+  /* add the reference of the tensor */
+  for (i = 0; i < parser->expr->nth->len; i++) {
+    if (g_array_index (parser->expr->nth, guint, i) == nth)
+      break;
+  }
+  if (i == parser->expr->nth->len)
+    g_array_append_val (parser->expr->nth, nth);
+  node->ref = i;
+
+  if (!_accept (parser, "["))
+    return node;
+
+  *single = TRUE;
+  d = 0;
+  do {
+    guint32 s = 0, e = TIF_REGION_END;
+    gboolean has_start;
+
+    if (d >= NNS_TENSOR_RANK_LIMIT) {
+      _node_free (node);
+      return _parse_error (parser, "too many dimensions");
+    }
+
+    has_start = _parse_uint (parser, &s);
+    if (_accept (parser, ":")) {
+      _skip_space (parser);
+      if (g_ascii_isdigit (*parser->p) && !_parse_uint (parser, &e)) {
+        _node_free (node);
+        return _parse_error (parser, "invalid end index");
+      }
+
+      if (e <= s) {
+        _node_free (node);
+        return _parse_error (parser, "empty slice");
+      }
+
+      *single = FALSE;
+    } else if (has_start) {
+      e = s + 1;
+    } else {
+      _node_free (node);
+      return _parse_error (parser, "index or slice is expected");
+    }
+
+    node->region.start[d] = s;
+    node->region.end[d] = e;
+    d++;
+  } while (_accept (parser, ","));
+
+  if (!_accept (parser, "]")) {
+    _node_free (node);
+    return _parse_error (parser, "']' is expected");
+  }
+
+  /* the rest dimensions of a single element */
+  if (*single) {
+    for (; d < NNS_TENSOR_RANK_LIMIT; d++)
+      node->region.end[d] = 1;
+  }
+
+  return node;
+}
+
+/**
+ * @brief Internal function to parse the primary expression.
+ */
+static tif_node *
+_parse_primary (tif_parser * parser)
+{
+  tif_node *node;
+  gboolean single;
+  guint i;
+
+  _skip_space (parser);
+
+  if (g_ascii_isdigit (*parser->p) || *parser->p == '.') {
+    gchar *end;
+
+    node = _node_new (_eval_const, NULL, NULL);
+    node->value = g_ascii_strtod (parser->p, &end);
+    if (end == parser->p) {
+      _node_free (node);
+      return _parse_error (parser, "invalid number");
+    }
+
+    parser->p = end;
+    return node;
+  }
+
+  if (_accept (parser, "(")) {
+    node = _parse_expr (parser);
+    if (node && !_accept (parser, ")")) {
+      _node_free (node);
+      return _parse_error (parser, "')' is expected");
+    }
+    return node;
+  }
+
+  /* tensor element */
+  if (parser->p[0] == 't' && g_ascii_isdigit (parser->p[1])) {
+    node = _parse_tensor (parser, &single);
+    if (node && !single) {
+      _node_free (node);
+      return _parse_error (parser,
+          "a tensor region should be reduced, e.g., mean(t0[0:10])");
+    }
+
+    if (node)
+      node->eval = _eval_element;
+    return node;
+  }
+
+  /* reduction */
+  for (i = TIF_REDUCE_END; i > 0; i--) {
+    const gchar *name = tif_reduce_names[i - 1];
+    gsize len = strlen (name);
+
+    if (strncmp (parser->p, name, len) != 0)
+      continue;
+
+    parser->p += len;
+    if (!_accept (parser, "("))
+      return _parse_error (parser, "'(' is expected");
+
+    node = _parse_tensor (parser, &single);
+    if (!node)
+      return NULL;
+
+    node->reduce = (tensor_if_reduce) (i - 1);
+
+    if (node->reduce == TIF_REDUCE_COUNT) {
+      gboolean neg = FALSE;
+      gchar *end;
+
+      if (!_accept (parser, ",")) {
+        _node_free (node);
+        return _parse_error (parser, "threshold is expected, e.g., count(t0, 0.5)");
+      }
+
+      if (_accept (parser, "-"))
+        neg = TRUE;
+
+      _skip_space (parser);
+      node->value = g_ascii_strtod (parser->p, &end);
+      if (end == parser->p) {
+        _node_free (node);
+        return _parse_error (parser, "invalid threshold");
+      }
+
+      parser->p = end;
+      if (neg)
+        node->value = -node->value;
+    }
+
+    if (!_accept (parser, ")")) {
+      _node_free (node);
+      return _parse_error (parser, "')' is expected");
+    }
+
+    return node;
+  }
+
+  return _parse_error (parser, "unknown token");
+}
+
+/**
+ * @brief Internal function to parse the unary expression.
+ */
+static tif_node *
+_parse_unary (tif_parser * parser)
+{
+  tif_node *node;
+
+  if (_accept (parser, "-")) {
+    node = _parse_unary (parser);
+    return node ? _node_new (_eval_neg, node, NULL) : NULL;
+  }
+
+  if (_accept (parser, "!")) {
+    node = _parse_unary (parser);
+    return node ? _node_new (_eval_not, node, NULL) : NULL;
+  }
+
+  return _parse_primary (parser);
+}
+
+/**
+ * @brief Operators of the binary expression.
+ */
+typedef struct
+{
+  const gchar *token; /**< operator token */
+  tif_eval_func eval; /**< evaluation function */
+} tif_operator;
+
+/**
+ * @brief Internal function to parse the binary expression with given operators.
+ * @param operators operators in this level, terminated with NULL token
+ * @param next parser of the operand
+ * @param repeat FALSE if the operator is not associative
+ */
+static tif_node *
+_parse_binary (tif_parser * parser, const tif_operator * operators,
+    tif_node * (*next) (tif_parser *), gboolean repeat)
+{
+  tif_node *left, *right;
+  guint i;
+
+  left = next (parser);
+
+  while (left) {
+    for (i = 0; operators[i].token != NULL; i++) {
+      if (_accept (parser, operators[i].token))
+        break;
+    }
+
+    if (operators[i].token == NULL)
+      break;
+
+    right = next (parser);
+    if (!right) {
+      _node_free (left);
+      return NULL;
+    }
+
+    left = _node_new (operators[i].eval, left, right);
+    if (!repeat)
+      break;
+  }
+
+  return left;
+}
+
+/**
+ * @brief Internal function to parse the multiplicative expression.
+ */
+static tif_node *
+_parse_mul (tif_parser * parser)
+{
+  static const tif_operator ops[] = {
+    {"*", _eval_mul}, {"/", _eval_div}, {NULL, NULL}
+  };
+
+  return _parse_binary (parser, ops, _parse_unary, TRUE);
+}
+
+/**
+ * @brief Internal function to parse the additive expression.
+ */
+static tif_node *
+_parse_add (tif_parser * parser)
+{
+  static const tif_operator ops[] = {
+    {"+", _eval_add}, {"-", _eval_sub}, {NULL, NULL}
+  };
+
+  return _parse_binary (parser, ops, _parse_mul, TRUE);
+}
+
+/**
+ * @brief Internal function to parse the comparison.
+ */
+static tif_node *
+_parse_cmp (tif_parser * parser)
+{
+  static const tif_operator ops[] = {
+    {"==", _eval_eq}, {"!=", _eval_ne}, {">=", _eval_ge}, {"<=", _eval_le},
+    {">", _eval_gt}, {"<", _eval_lt}, {NULL, NULL}
+  };
+
+  return _parse_binary (parser, ops, _parse_add, FALSE);
+}
+
+/**
+ * @brief Internal function to parse the logical and.
+ */
+static tif_node *
+_parse_and (tif_parser * parser)
+{
+  static const tif_operator ops[] = {
+    {"&&", _eval_and}, {NULL, NULL}
+  };
+
+  return _parse_binary (parser, ops, _parse_cmp, TRUE);
+}
+
+/**
+ * @brief Internal function to parse the expression (logical or).
+ */
+static tif_node *
+_parse_expr (tif_parser * parser)
+{
+  static const tif_operator ops[] = {
+    {"||", _eval_or}, {NULL, NULL}
+  };
+
+  return _parse_binary (parser, ops, _parse_and, TRUE);
+}
+
+/**
+ * @brief Compile the expression of reductions and conditions.
+ */
+tensor_if_expr *
+gst_tensor_if_expr_compile (const gchar * str)
+{
+  tensor_if_expr *expr;
+  tif_parser parser;
+
+  g_return_val_if_fail (str != NULL, NULL);
+
+  expr = g_new0 (tensor_if_expr, 1);
+  expr->nth = g_array_new (FALSE, FALSE, sizeof (guint));
+
+  parser.str = str;
+  parser.p = str;
+  parser.expr = expr;
+  parser.failed = FALSE;
+
+  expr->root = _parse_expr (&parser);
+  if (expr->root) {
+    _skip_space (&parser);
+    if (*parser.p != '\0')
+      _parse_error (&parser, "unexpected token");
+  } else {
+    _parse_error (&parser, "empty expression");
+  }
+
+  if (parser.failed) {
+    gst_tensor_if_expr_free (expr);
+    return NULL;
+  }
+
+  expr->mem = g_new0 (GstMemory *, expr->nth->len);
+  expr->map = g_new0 (GstMapInfo, expr->nth->len);
+  return expr;
+}
+
+/**
+ * @brief Free the compiled expression.
+ */
+void
+gst_tensor_if_expr_free (tensor_if_expr * expr)
+{
+  if (expr == NULL)
+    return;
+
+  _node_free (expr->root);
+  g_array_free (expr->nth, TRUE);
+  g_free (expr->mem);
+  g_free (expr->map);
+  g_free (expr);
+}
+
+/**
+ * @brief Evaluate the compiled expression with input tensors.
+ */
+gboolean
+gst_tensor_if_expr_eval (tensor_if_expr * expr, const GstTensorsInfo * info,
+    GstBuffer * buf, gdouble * result)
+{
+  tif_eval_ctx ctx;
+  gboolean ret;
+  guint i;
+
+  g_return_val_if_fail (expr != NULL, FALSE);
+  g_return_val_if_fail (info != NULL, FALSE);
+  g_return_val_if_fail (GST_IS_BUFFER (buf), FALSE);
+  g_return_val_if_fail (result != NULL, FALSE);
+
+  ctx.expr = expr;
+  ctx.info = info;
+  ctx.buf = buf;
+
+  ret = expr->root->eval (expr->root, &ctx, result);
+
+  for (i = 0; i < expr->nth->len; i++) {
+    if (expr->mem[i]) {
+      gst_memory_unmap (expr->mem[i], &expr->map[i]);
+      gst_memory_unref (expr->mem[i]);
+      expr->mem[i] = NULL;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * GStreamer / NNStreamer Tensor-IF
+ */
+/**
+ * @file	gsttensor_ifexpr.h
+ * @date	16 Oct 2026
+ * @brief	Region reductions and condition expressions of tensor_if.
+ * @see		https://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_IF_EXPR_H__
+#define __GST_TENSOR_IF_EXPR_H__
+
+#include <gst/gst.h>
+#include <tensor_common.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Reductions over a region of a tensor.
+ */
+typedef enum {
+  TIF_REDUCE_SUM = 0,	/**< sum of the elements */
+  TIF_REDUCE_MEAN,	/**< average of the elements */
+  TIF_REDUCE_MAX,	/**< max value of the elements */
+  TIF_REDUCE_MIN,	/**< min value of the elements */
+  TIF_REDUCE_ARGMAX,	/**< flat index of the first max element within the region, not within the tensor */
+  TIF_REDUCE_ARGMIN,	/**< flat index of the first min element within the region, not within the tensor */
+  TIF_REDUCE_COUNT,	/**< the number of elements greater than the threshold (compared in float32 for float32 tensors) */
+  TIF_REDUCE_END,
+} tensor_if_reduce;
+
+/**
+ * @brief Macro for the end of the dimension in the region.
+ */
+#define TIF_REGION_END G_MAXUINT32
+
+/**
+ * @brief Region of a tensor, [start, end) of each dimension.
+ */
+typedef struct
+{
+  guint32 start[NNS_TENSOR_RANK_LIMIT]; /**< start index of each dimension */
+  guint32 end[NNS_TENSOR_RANK_LIMIT]; /**< end index (exclusive) of each dimension, TIF_REGION_END for the end of dimension */
+} tensor_if_region;
+
+/**
+ * @brief Compiled expression of tensor_if.
+ */
+typedef struct _tensor_if_expr tensor_if_expr;
+
+/**
+ * @brief Initialize the region to the whole tensor.
+ * @param region the region to be initialized
+ */
+extern void
+gst_tensor_if_region_init (tensor_if_region * region);
+
+/**
+ * @brief Reduce the elements in the region of a tensor.
+ * @param info tensor info
+ * @param data pointer of tensor data
+ * @param size byte size of tensor data
+ * @param region the region to be reduced, NULL for the whole tensor
+ * @param op reduction
+ * @param threshold the threshold of TIF_REDUCE_COUNT
+ * @param[out] result the reduced value. For TIF_REDUCE_ARGMAX and TIF_REDUCE_ARGMIN, this is the flat index within the region.
+ * @return TRUE if no error
+ */
+extern gboolean
+gst_tensor_if_reduce (const GstTensorInfo * info, gconstpointer data,
+    gsize size, const tensor_if_region * region, tensor_if_reduce op,
+    gdouble threshold, gdouble * result);
+
+/**
+ * @brief Compile the expression of reductions and conditions.
+ * @param str the expression, e.g., "(max(t0) > 0.8) && (mean(t1[0:10]) < 0.2)"
+ * @return compiled expression or NULL on error. Caller should release it with gst_tensor_if_expr_free().
+ */
+extern tensor_if_expr *
+gst_tensor_if_expr_compile (const gchar * str);
+
+/**
+ * @brief Free the compiled expression.
+ * @param expr the compiled expression
+ */
+extern void
+gst_tensor_if_expr_free (tensor_if_expr * expr);
+
+/**
+ * @brief Evaluate the compiled expression with input tensors.
+ * @details The referred tensors are mapped once while evaluating. Conditions and logical operators return 1 (true) or 0 (false).
+ * @param expr the compiled expression
+ * @param info tensors info of the buffer
+ * @param buf the buffer of input tensors
+ * @param[out] result the value of the expression
+ * @return TRUE if no error
+ */
+extern gboolean
+gst_tensor_if_expr_eval (tensor_if_expr * expr, const GstTensorsInfo * info,
+    GstBuffer * buf, gdouble * result);
+
+G_END_DECLS
+#endif /* __GST_TENSOR_IF_EXPR_H__ */
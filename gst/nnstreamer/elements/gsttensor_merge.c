@@ -453,6 +453,137 @@ gst_tensor_merge_collect_buffer (GstTensorMerge * tensor_merge,
       &tensor_merge->tensors_config, is_eos);
 }
 
+/**
+ * @brief Bytes of output to be interleaved at once, to keep the block in cache.
+ */
+#define MERGE_INTERLEAVE_BLOCK (16 * 1024)
+
+/**
+ * @brief Minimum bytes of slice to copy the slices in turn (slice strategy).
+ */
+#define MERGE_SLICE_THRESHOLD (256)
+
+/**
+ * @brief Decide the strategy to build the merged tensor with the merge axis and the size of slices.
+ * @param tensor_merge tensor merger
+ */
+static void
+gst_tensor_merge_set_strategy (GstTensorMerge * tensor_merge)
+{
+  GstTensorsInfo *info = &tensor_merge->tensors_config.info;
+  guint axis = tensor_merge->data_linear.direction;
+  gsize esize, size, min_size = G_MAXSIZE;
+  guint i, j;
+
+  esize = gst_tensor_get_element_size (info->info[0].type);
+
+  /* the dimensions above merge axis are same in all inputs */
+  tensor_merge->num_slices = 1;
+  for (j = axis + 1; j < NNS_TENSOR_RANK_LIMIT; j++) {
+    if (info->info[0].dimension[j] == 0)
+      break;
+    tensor_merge->num_slices *= info->info[0].dimension[j];
+  }
+
+  for (i = 0; i < info->num_tensors; i++) {
+    size = esize;
+    for (j = 0; j <= axis; j++) {
+      if (info->info[i].dimension[j] == 0)
+        break;
+      size *= info->info[i].dimension[j];
+    }
+
+    tensor_merge->slice_size[i] = size;
+    min_size = MIN (min_size, size);
+  }
+
+  if (tensor_merge->num_slices == 1)
+    tensor_merge->strategy = MERGE_STRATEGY_GATHER;
+  else if (min_size >= MERGE_SLICE_THRESHOLD)
+    tensor_merge->strategy = MERGE_STRATEGY_SLICE;
+  else
+    tensor_merge->strategy = MERGE_STRATEGY_INTERLEAVE;
+
+  GST_DEBUG_OBJECT (tensor_merge,
+      "merge strategy %d (%" G_GSIZE_FORMAT " slices, min slice %"
+      G_GSIZE_FORMAT " bytes)", tensor_merge->strategy,
+      tensor_merge->num_slices, min_size);
+}
+
+/**
+ * @brief Macro to copy the slices of an input with constant size.
+ */
+#define merge_interleave_copy(sz) do { \
+    for (o = 0; o < n; o++) \
+      memcpy (dst + o * stride, src + o * (sz), (sz)); \
+  } while (0)
+
+/**
+ * @brief Interleave the small slices of the inputs.
+ * The output is filled block by block, and each input is copied into the block with a loop of fixed-size copy.
+ * @param outptr output data
+ * @param inptr input data
+ * @param slice_size bytes of a slice of each input
+ * @param num_mem the number of inputs
+ * @param num_slices the number of slices
+ */
+static void
+gst_tensor_merge_interleave (guint8 * outptr, const guint8 ** inptr,
+    const gsize * slice_size, guint num_mem, gsize num_slices)
+{
+  gsize stride = 0, block, start, n, o, offset;
+  const guint8 *src;
+  guint8 *dst;
+  guint k;
+
+  for (k = 0; k < num_mem; k++)
+    stride += slice_size[k];
+
+  block = MAX (MERGE_INTERLEAVE_BLOCK / stride, 1);
+
+  for (start = 0; start < num_slices; start += block) {
+    n = MIN (block, num_slices - start);
+    offset = 0;
+
+    for (k = 0; k < num_mem; k++) {
+      dst = outptr + start * stride + offset;
+      src = inptr[k] + start * slice_size[k];
+
+      switch (slice_size[k]) {
+        case 1:
+          merge_interleave_copy (1);
+          break;
+        case 2:
+          merge_interleave_copy (2);
+          break;
+        case 3:
+          merge_interleave_copy (3);
+          break;
+        case 4:
+          merge_interleave_copy (4);
+          break;
+        case 6:
+          merge_interleave_copy (6);
+          break;
+        case 8:
+          merge_interleave_copy (8);
+          break;
+        case 12:
+          merge_interleave_copy (12);
+          break;
+        case 16:
+          merge_interleave_copy (16);
+          break;
+        default:
+          merge_interleave_copy (slice_size[k]);
+          break;
+      }
+
+      offset += slice_size[k];
+    }
+  }
+}
+
 /**
  * @brief Generate Output GstMemory
  * @param tensor_merge tensor merger
@@ -467,129 +598,103 @@ gst_tensor_merge_generate_mem (GstTensorMerge * tensor_merge,
   GstFlowReturn ret = GST_FLOW_OK;
   GstMapInfo mInfo[NNS_TENSOR_SIZE_LIMIT];
   GstMemory *mem[NNS_TENSOR_SIZE_LIMIT];
+  const guint8 *inptr[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo outInfo;
-  GstMemory *outMem;
-  uint8_t *inptr, *outptr;
+  GstMemory *outMem = NULL;
+  uint8_t *outptr;
   guint num_mem = tensor_merge->tensors_config.info.num_tensors;
-  guint i, j, k, l;
-  size_t c, s;
+  guint i, k;
+  gsize o, s, offset, poffset = 0;
   gsize outSize = 0;
-  gsize element_size;
-  tensor_dim dim;
-  tensor_type type;
+  gboolean is_span;
 
-  memcpy (&dim, &tensor_merge->tensors_config.info.info[0].dimension,
-      sizeof (tensor_dim));
-  type = tensor_merge->tensors_config.info.info[0].type;
-  element_size = gst_tensor_get_element_size (type);
+  if (tensor_merge->mode != GTT_LINEAR)
+    return GST_FLOW_ERROR;
 
   for (i = 0; i < num_mem; i++) {
     mem[i] = gst_tensor_buffer_get_nth_memory (tensors_buf, i);
-    if (!gst_memory_map (mem[i], &mInfo[i], GST_MAP_READ)) {
+    if (!mem[i] || !gst_memory_map (mem[i], &mInfo[i], GST_MAP_READ)) {
       ml_logf ("Cannot map input memory buffers (%d)\n", i);
-      gst_memory_unref (mem[i]);
+      if (mem[i])
+        gst_memory_unref (mem[i]);
       num_mem = i;
       ret = GST_FLOW_ERROR;
       goto error_ret;
     }
-    outSize += mInfo[i].size;
-  }
 
-  outMem = gst_allocator_alloc (NULL, outSize, NULL);
-  if (!gst_memory_map (outMem, &outInfo, GST_MAP_WRITE)) {
-    gst_allocator_free (NULL, outMem);
-    ml_logf ("Cannot map output memory buffer\n");
-    ret = GST_FLOW_ERROR;
-    goto error_ret;
+    if (mInfo[i].size !=
+        tensor_merge->slice_size[i] * tensor_merge->num_slices) {
+      GST_ERROR_OBJECT (tensor_merge,
+          "Invalid size of input %u (received %" G_GSIZE_FORMAT ", expected %"
+          G_GSIZE_FORMAT ").", i, mInfo[i].size,
+          tensor_merge->slice_size[i] * tensor_merge->num_slices);
+      num_mem = i + 1;
+      ret = GST_FLOW_ERROR;
+      goto error_ret;
+    }
+
+    inptr[i] = mInfo[i].data;
+    outSize += mInfo[i].size;
   }
-  outptr = outInfo.data;
 
-  switch (tensor_merge->mode) {
-    case GTT_LINEAR:
-    {
-      switch (tensor_merge->data_linear.direction) {
-        case LINEAR_FIRST:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (j = 0; j < dim[1]; j++) {
-                for (k = 0; k < num_mem; k++) {
-                  c = tensor_merge->tensors_config.info.info[k].dimension[0];
-                  s = element_size * c;
-                  inptr =
-                      mInfo[k].data + (l * dim[2] * dim[1] + i * dim[1] +
-                      j) * s;
-                  memcpy (outptr, inptr, s);
-                  outptr += s;
-                }
-              }
-            }
-          }
-          break;
-        }
-        case LINEAR_SECOND:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (k = 0; k < num_mem; k++) {
-                c = 1;
-                for (j = 0; j < LINEAR_SECOND + 1; j++)
-                  c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-                s = element_size * c;
-
-                inptr = mInfo[k].data + (l * dim[2] + i) * s;
-
-                memcpy (outptr, inptr, s);
-                outptr += s;
-              }
-            }
-          }
-          break;
-        }
-        case LINEAR_THIRD:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (k = 0; k < num_mem; k++) {
-              c = 1;
-              for (j = 0; j < LINEAR_THIRD + 1; j++)
-                c *= tensor_merge->tensors_config.info.info[k].dimension[j];
+  if (tensor_merge->strategy == MERGE_STRATEGY_GATHER) {
+    /**
+     * Zero-copy if the inputs are adjacent in the same parent memory
+     * (e.g., the tensors split from a buffer), same as merging the memories in GstBuffer.
+     */
+    if (num_mem == 1) {
+      outMem = gst_memory_ref (mem[0]);
+    } else {
+      is_span = TRUE;
+      for (i = 1; i < num_mem && is_span; i++) {
+        is_span = gst_memory_is_span (mem[i - 1], mem[i], &offset);
+        if (i == 1)
+          poffset = offset;
+      }
 
-              s = element_size * c;
+      if (is_span)
+        outMem = gst_memory_share (mem[0]->parent, poffset, outSize);
+    }
+  }
 
-              inptr = mInfo[k].data + l * s;
+  if (!outMem) {
+    outMem = gst_allocator_alloc (NULL, outSize, NULL);
+    if (!gst_memory_map (outMem, &outInfo, GST_MAP_WRITE)) {
+      gst_allocator_free (NULL, outMem);
+      ml_logf ("Cannot map output memory buffer\n");
+      ret = GST_FLOW_ERROR;
+      goto error_ret;
+    }
+    outptr = outInfo.data;
 
-              memcpy (outptr, inptr, s);
-              outptr += s;
-            }
-          }
-          break;
+    switch (tensor_merge->strategy) {
+      case MERGE_STRATEGY_GATHER:
+        for (k = 0; k < num_mem; k++) {
+          memcpy (outptr, inptr[k], mInfo[k].size);
+          outptr += mInfo[k].size;
         }
-        case LINEAR_FOURTH:
-        {
+        break;
+      case MERGE_STRATEGY_SLICE:
+        for (o = 0; o < tensor_merge->num_slices; o++) {
           for (k = 0; k < num_mem; k++) {
-            c = 1;
-            for (j = 0; j < LINEAR_FOURTH + 1; j++)
-              c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-            s = element_size * c;
-
-            inptr = mInfo[k].data;
-            memcpy (outptr, inptr, s);
+            s = tensor_merge->slice_size[k];
+            memcpy (outptr, inptr[k] + o * s, s);
             outptr += s;
           }
-          break;
         }
-        default:
-          ret = GST_FLOW_ERROR;
-      }
-      break;
+        break;
+      case MERGE_STRATEGY_INTERLEAVE:
+        gst_tensor_merge_interleave (outptr, inptr, tensor_merge->slice_size,
+            num_mem, tensor_merge->num_slices);
+        break;
+      default:
+        ret = GST_FLOW_ERROR;
+        break;
     }
-    default:
-      ret = GST_FLOW_ERROR;
+
+    gst_memory_unmap (outMem, &outInfo);
   }
 
-  gst_memory_unmap (outMem, &outInfo);
   gst_buffer_append_memory (tensor_buf, outMem);
   gst_buffer_copy_into (tensor_buf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
       -1);
@@ -622,6 +727,7 @@ gst_tensor_merge_set_src_caps (GstTensorMerge * tensor_merge)
     newcaps = gst_tensor_pad_caps_from_config (tensor_merge->srcpad, &config);
 
     if (gst_pad_set_caps (tensor_merge->srcpad, newcaps)) {
+      gst_tensor_merge_set_strategy (tensor_merge);
       tensor_merge->negotiated = TRUE;
     }
 
@@ -717,7 +823,11 @@ gst_tensor_merge_collected (GstCollectPads * pads,
     goto beach;
   }
 
-  gst_tensor_merge_generate_mem (tensor_merge, tensors_buf, tensor_buf);
+  ret = gst_tensor_merge_generate_mem (tensor_merge, tensors_buf, tensor_buf);
+  if (ret != GST_FLOW_OK) {
+    gst_buffer_unref (tensor_buf);
+    goto beach;
+  }
 
   ret = gst_pad_push (tensor_merge->srcpad, tensor_buf);
   tensor_merge->need_set_time = TRUE;
@@ -58,6 +58,16 @@ typedef enum
 } tensor_merge_linear_mode;
 
 
+/**
+ * @brief Strategy to build the merged tensor, decided when src caps is negotiated.
+ */
+typedef enum
+{
+  MERGE_STRATEGY_GATHER = 0,	/* merge axis is outermost, each input is a contiguous block of output */
+  MERGE_STRATEGY_SLICE,		/* copy large slices of the inputs in turn */
+  MERGE_STRATEGY_INTERLEAVE,	/* interleave small slices of the inputs in cache-sized blocks */
+} tensor_merge_strategy;
+
 /**
  * @brief Internal data structure for linear mode.
  */
@@ -91,6 +101,10 @@ struct _GstTensorMerge
   GstClockTime current_time;
   gboolean need_set_time;
   GstTensorsConfig tensors_config; /**< output tensors info */
+
+  tensor_merge_strategy strategy; /**< strategy to build the merged tensor */
+  gsize slice_size[NNS_TENSOR_SIZE_LIMIT]; /**< bytes of a slice (dimensions up to merge axis) of each input */
+  gsize num_slices; /**< the number of slices (product of dimensions above merge axis) */
 };
 
 /**
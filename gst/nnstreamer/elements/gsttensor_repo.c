@@ -160,46 +160,110 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
   return ret;
 }
 
+/**
+ * @brief Internal function to take the buffer out of the slot.
+ */
+static GstBuffer *
+_repo_take_buffer (GstTensorRepoData * data)
+{
+  GstBuffer *buf;
+
+  do {
+    buf = (GstBuffer *) g_atomic_pointer_get (&data->buffer);
+  } while (buf != NULL &&
+      !g_atomic_pointer_compare_and_exchange (&data->buffer, buf, NULL));
+
+  return buf;
+}
+
+/**
+ * @brief Internal function to wake up the thread waiting with given condition.
+ */
+static void
+_repo_signal (GstTensorRepoData * data, GCond * cond, gint * waiting)
+{
+  if (g_atomic_int_get (waiting) > 0) {
+    g_mutex_lock (&data->lock);
+    g_cond_signal (cond);
+    g_mutex_unlock (&data->lock);
+  }
+}
+
 /**
  * @brief Push GstBuffer into repo.
  */
 gboolean
-gst_tensor_repo_set_buffer (guint nth, GstBuffer * buffer, GstCaps * caps)
+gst_tensor_repo_set_buffer (guint nth, GstBuffer * buffer, GstCaps * caps,
+    gboolean copy)
 {
   GstTensorRepoData *data;
+  GstBuffer *buf;
+  gboolean pushed = FALSE;
 
   data = gst_tensor_repo_get_repodata (nth);
 
   g_return_val_if_fail (data != NULL, FALSE);
 
+  if (g_atomic_int_get (&data->eos))
+    return FALSE;
+
+  /**
+   * The reference of the buffer is shared with the puller.
+   * Writable buffer is not allowed while shared, the element which modifies
+   * the data will copy it (gst_buffer_make_writable).
+   */
+  buf = copy ? gst_buffer_copy_deep (buffer) : gst_buffer_ref (buffer);
+
+  /* fast path, the slot is empty and caps is not changed */
+  if (g_atomic_pointer_get (&data->caps) == (gpointer) caps &&
+      g_atomic_pointer_compare_and_exchange (&data->buffer, NULL, buf)) {
+    _repo_signal (data, &data->cond_push, &data->waiting_push);
+    pushed = TRUE;
+    goto done;
+  }
+
   g_mutex_lock (&data->lock);
+  g_atomic_int_inc (&data->waiting_pull);
+
+  while (!data->eos) {
+    if (g_atomic_pointer_compare_and_exchange (&data->buffer, NULL, buf)) {
+      pushed = TRUE;
+      break;
+    }
 
-  while (data->buffer != NULL && !data->eos) {
     /* wait pull */
     g_cond_wait (&data->cond_pull, &data->lock);
   }
 
-  if (data->eos) {
-    g_mutex_unlock (&data->lock);
-    return FALSE;
+  g_atomic_int_add (&data->waiting_pull, -1);
+
+  if (pushed) {
+    /* the puller requesting caps gets it with the lock */
+    if (data->caps != caps) {
+      GstCaps *old_caps = data->caps;
+
+      g_atomic_pointer_set (&data->caps, gst_caps_ref (caps));
+      if (old_caps)
+        gst_caps_unref (old_caps);
+    }
+
+    /* signal push */
+    g_cond_signal (&data->cond_push);
   }
 
-  data->buffer = gst_buffer_copy_deep (buffer);
-  if (!data->caps || !gst_caps_is_equal (data->caps, caps)) {
-    if (data->caps)
-      gst_caps_unref (data->caps);
-    data->caps = gst_caps_copy (caps);
+  g_mutex_unlock (&data->lock);
+
+done:
+  if (!pushed) {
+    gst_buffer_unref (buf);
+    return FALSE;
   }
 
   if (DBG) {
-    unsigned long size = gst_buffer_get_size (data->buffer);
+    unsigned long size = gst_buffer_get_size (buffer);
     GST_DEBUG ("Pushed [%d] (size : %lu)\n", nth, size);
   }
 
-  /* signal push */
-  g_cond_signal (&data->cond_push);
-
-  g_mutex_unlock (&data->lock);
   return TRUE;
 }
 
@@ -216,7 +280,7 @@ gst_tensor_repo_check_eos (guint nth)
   if (data) {
     if (DBG)
       GST_DEBUG ("check eos done [%s]\n", data->eos ? "TRUE" : "FALSE");
-    return data->eos;
+    return g_atomic_int_get (&data->eos);
   }
 
   return FALSE;
@@ -268,7 +332,7 @@ gst_tensor_repo_set_eos (guint nth)
 
   g_mutex_lock (&data->lock);
 
-  data->eos = TRUE;
+  g_atomic_int_set (&data->eos, TRUE);
   g_cond_signal (&data->cond_push);
   g_cond_signal (&data->cond_pull);
 
@@ -290,37 +354,50 @@ gst_tensor_repo_get_buffer (guint nth, gboolean * eos, guint * newid,
 
   g_return_val_if_fail (data != NULL, NULL);
 
+  /* fast path, take the buffer without locking the slot */
+  if (caps == NULL) {
+    buf = _repo_take_buffer (data);
+    if (buf)
+      goto done;
+  }
+
   g_mutex_lock (&data->lock);
+  g_atomic_int_inc (&data->waiting_push);
 
-  while (!data->buffer) {
-    if (gst_tensor_repo_check_changed (nth, newid, FALSE)) {
-      buf = NULL;
-      goto done;
+  while ((buf = _repo_take_buffer (data)) == NULL) {
+    if (data->src_changed) {
+      *newid = data->src_id;
+      break;
     }
 
-    if (gst_tensor_repo_check_eos (nth)) {
+    if (data->eos) {
       *eos = TRUE;
-      buf = NULL;
-      goto done;
+      break;
     }
 
     /* wait push */
     g_cond_wait (&data->cond_push, &data->lock);
   }
 
+  g_atomic_int_add (&data->waiting_push, -1);
+
+  if (buf && caps)
+    *caps = gst_caps_ref (data->caps);
+
+  g_mutex_unlock (&data->lock);
+
+  if (buf == NULL)
+    return NULL;
+
+done:
   /* Current buffer will be wasted. */
-  buf = data->buffer;
-  *caps = gst_caps_ref (data->caps);
   if (DBG) {
     unsigned long size = gst_buffer_get_size (buf);
     GST_DEBUG ("Popped [ %d ] (size: %lu)\n", nth, size);
   }
 
-done:
-  data->buffer = NULL;
   /* signal pull */
-  g_cond_signal (&data->cond_pull);
-  g_mutex_unlock (&data->lock);
+  _repo_signal (data, &data->cond_pull, &data->waiting_pull);
   return buf;
 }
 
@@ -348,7 +425,7 @@ gst_tensor_repo_remove_repodata (guint nth)
 
       g_mutex_lock (&data->lock);
       if (data->buffer)
-        gst_buffer_unref (data->buffer);
+        gst_buffer_unref (_repo_take_buffer (data));
       if (data->caps)
         gst_caps_unref (data->caps);
       g_mutex_unlock (&data->lock);
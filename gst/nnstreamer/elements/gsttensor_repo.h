@@ -36,11 +36,13 @@ G_BEGIN_DECLS
  * @brief GstTensorRepo internal data structure.
  *
  * GstTensorRepo has GSlist of GstTensorRepoData.
+ * The buffer of a slot is exchanged with atomic operations. The lock and
+ * conditions are used only when the pusher or the puller has to wait.
  */
 typedef struct
 {
-  GstBuffer *buffer;
-  GstCaps *caps;
+  GstBuffer *buffer; /**< the buffer in the slot (atomic) */
+  GstCaps *caps; /**< the caps of the buffer, updated with the lock */
   GCond cond_push;
   GCond cond_pull;
   GMutex lock;
@@ -50,6 +52,8 @@ typedef struct
   gboolean sink_changed;
   guint sink_id;
   gboolean pushed;
+  gint waiting_push; /**< the number of pullers waiting for a buffer (atomic) */
+  gint waiting_pull; /**< the number of pushers waiting for an empty slot (atomic) */
 } GstTensorRepoData;
 
 /**
@@ -78,9 +82,13 @@ gst_tensor_repo_add_repodata (guint myid, gboolean is_sink);
 
 /**
  * @brief Push GstBuffer into repo.
+ * @param nth the slot index
+ * @param buffer the buffer to be pushed
+ * @param caps the caps of the buffer
+ * @param copy TRUE to push a deep copy of the buffer, FALSE to push the reference of the buffer (the buffer is copied on write).
  */
 gboolean
-gst_tensor_repo_set_buffer (guint nth, GstBuffer * buffer, GstCaps * caps);
+gst_tensor_repo_set_buffer (guint nth, GstBuffer * buffer, GstCaps * caps, gboolean copy);
 
 /**
  * @brief Check EOS (End-of-Stream) of slot.
@@ -102,6 +110,7 @@ gst_tensor_repo_set_changed (guint o_nth, guint nth, gboolean is_sink);
 
 /**
  * @brief Get GstTensorRepoData from repo.
+ * @param caps the caps of the buffer, NULL if caller does not need the caps (without locking the slot).
  */
 GstBuffer *
 gst_tensor_repo_get_buffer (guint nth, gboolean * eos, guint * newid, GstCaps ** caps);
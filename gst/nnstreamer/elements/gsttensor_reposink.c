@@ -47,13 +47,15 @@ enum
   PROP_0,
   PROP_SIGNAL_RATE,
   PROP_SLOT,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_ZERO_COPY
 };
 
 #define DEFAULT_SIGNAL_RATE 0
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_QOS TRUE
 #define DEFAULT_INDEX 0
+#define DEFAULT_ZERO_COPY FALSE
 
 static void gst_tensor_reposink_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -116,6 +118,12 @@ gst_tensor_reposink_class_init (GstTensorRepoSinkClass * klass)
       g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
           DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_ZERO_COPY,
+      g_param_spec_boolean ("zero-copy", "Zero copy",
+          "Pass the reference of the buffer to tensor_reposrc instead of "
+          "a deep copy. The buffer is copied only when an element modifies it",
+          DEFAULT_ZERO_COPY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "TensorRepoSink",
       "Sink/Tensor/Repository",
@@ -157,6 +165,7 @@ gst_tensor_reposink_init (GstTensorRepoSink * self)
 
   self->silent = DEFAULT_SILENT;
   self->signal_rate = DEFAULT_SIGNAL_RATE;
+  self->zero_copy = DEFAULT_ZERO_COPY;
   self->last_render_time = GST_CLOCK_TIME_NONE;
   self->set_startid = FALSE;
   self->in_caps = NULL;
@@ -186,6 +195,9 @@ gst_tensor_reposink_set_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       break;
+    case PROP_ZERO_COPY:
+      self->zero_copy = g_value_get_boolean (value);
+      break;
     case PROP_SLOT:
       self->o_myid = self->myid;
       self->myid = g_value_get_uint (value);
@@ -224,6 +236,9 @@ gst_tensor_reposink_get_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
+    case PROP_ZERO_COPY:
+      g_value_set_boolean (value, self->zero_copy);
+      break;
     case PROP_SLOT:
       g_value_set_uint (value, self->myid);
       break;
@@ -360,7 +375,8 @@ gst_tensor_reposink_render_buffer (GstTensorRepoSink * self, GstBuffer * buffer)
   if (notify) {
     self->last_render_time = now;
 
-    if (!gst_tensor_repo_set_buffer (self->myid, buffer, self->in_caps)) {
+    if (!gst_tensor_repo_set_buffer (self->myid, buffer, self->in_caps,
+            !self->zero_copy)) {
       GST_ELEMENT_ERROR (self, RESOURCE, WRITE,
           ("Cannot Set buffer into repo [key: %d]", self->myid), NULL);
       return FALSE;
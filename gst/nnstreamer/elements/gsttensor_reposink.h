@@ -57,6 +57,7 @@ struct _GstTensorRepoSink
 
   gboolean silent;
   guint signal_rate;
+  gboolean zero_copy;
   GstClockTime last_render_time;
   GstCaps *in_caps;
   gboolean set_startid;
@@ -339,7 +339,9 @@ gst_tensor_reposrc_create (GstPushSrc * src, GstBuffer ** buffer)
     self->ini = TRUE;
   } else {
     while (!buf && !eos) {
-      buf = gst_tensor_repo_get_buffer (self->myid, &eos, &newid, &caps);
+      /* caps is required only for the negotiation */
+      buf = gst_tensor_repo_get_buffer (self->myid, &eos, &newid,
+          self->negotiation ? NULL : &caps);
     }
 
     if (eos)
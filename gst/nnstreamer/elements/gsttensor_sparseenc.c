@@ -18,6 +18,11 @@
  * The input is always in the format of other/tensors,format=static.
  * The output is always in the format of ohter/tensors,format=sparse.
  *
+ * The property 'encoding' sets the layout of sparse data: coo (values and flat indices of non-zero elements),
+ * bitmap (bitmap of non-zero elements and the values) or block (indices and values of non-zero blocks).
+ * The default is 'coo', which old versions of tensor_sparse_dec can decode. 'auto' selects the smallest one for each tensor.
+ * Bitmap and block encodings are written with tensor meta version 2, and old versions of NNStreamer cannot decode them.
+ *
  * Please see also tensor_sparse_dec.
  *
  * <refsect2>
@@ -53,7 +58,8 @@ GST_DEBUG_CATEGORY_STATIC (gst_tensor_sparse_enc_debug);
 enum
 {
   PROP_0,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_ENCODING
 };
 
 /**
@@ -61,6 +67,22 @@ enum
  */
 #define DEFAULT_SILENT TRUE
 
+/**
+ * @brief Default sparse encoding (compatible with tensor meta version 1).
+ */
+#define DEFAULT_ENCODING "coo"
+
+/**
+ * @brief The names of sparse encoding (tensor_sparse_encoding), the last one is auto.
+ */
+static const gchar *sparse_encoding_string[] = {
+  [_NNS_SPARSE_COO] = "coo",
+  [_NNS_SPARSE_BITMAP] = "bitmap",
+  [_NNS_SPARSE_BLOCK] = "block",
+  [_NNS_SPARSE_END] = "auto",
+  NULL
+};
+
 /**
  * @brief Template for sink pad.
  */
@@ -122,6 +144,18 @@ gst_tensor_sparse_enc_class_init (GstTensorSparseEncClass * klass)
       g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
           DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorSparseEnc::encoding:
+   *
+   * The encoding of sparse tensor (auto, coo, bitmap or block).
+   * 'auto' selects the smallest encoding for each tensor.
+   * Bitmap and block encodings need tensor meta version 2.
+   */
+  g_object_class_install_property (object_class, PROP_ENCODING,
+      g_param_spec_string ("encoding", "Encoding",
+          "The encoding of sparse tensor (auto, coo, bitmap or block)",
+          DEFAULT_ENCODING, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_pad_template (element_class,
       gst_static_pad_template_get (&src_template));
 
@@ -162,6 +196,7 @@ gst_tensor_sparse_enc_init (GstTensorSparseEnc * self)
 
   /* init properties */
   self->silent = DEFAULT_SILENT;
+  self->encoding = _NNS_SPARSE_COO;
   gst_tensors_config_init (&self->in_config);
 }
 
@@ -194,6 +229,20 @@ gst_tensor_sparse_enc_set_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       break;
+    case PROP_ENCODING:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = str ? find_key_strv (sparse_encoding_string, str) : -1;
+
+      if (idx < 0) {
+        GST_WARNING_OBJECT (self, "Invalid encoding '%s', set %s.", str,
+            DEFAULT_ENCODING);
+        idx = _NNS_SPARSE_COO;
+      }
+
+      self->encoding = (tensor_sparse_encoding) idx;
+      break;
+    }
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -215,6 +264,9 @@ gst_tensor_sparse_enc_get_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
+    case PROP_ENCODING:
+      g_value_set_string (value, sparse_encoding_string[self->encoding]);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -396,7 +448,7 @@ gst_tensor_sparse_enc_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
     /* do real encoding here */
     in_mem = gst_tensor_buffer_get_nth_memory (buf, i);
-    out_mem = gst_tensor_sparse_from_dense (&meta, in_mem);
+    out_mem = gst_tensor_sparse_from_dense_full (&meta, in_mem, self->encoding);
     gst_memory_unref (in_mem);
 
     if (!out_mem) {
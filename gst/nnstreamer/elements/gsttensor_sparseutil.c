@@ -16,6 +16,160 @@
 #include <tensor_common.h>
 #include <tensor_data.h>
 #include "gsttensor_sparseutil.h"
+#include "tensor_simd.h"
+
+/**
+ * @brief Candidates of the number of elements in a block (block encoding).
+ */
+static const guint sparse_block_sizes[] = { 8, 16, 32, 64 };
+
+/**
+ * @brief Macro to set the bits of non-zero elements.
+ */
+#define sparse_mask_loop(T,d,m,n) do { \
+    const T *_p = (const T *) (d); \
+    gsize _i; \
+    for (_i = 0; _i < (n); _i++) \
+      (m)[_i >> 6] |= (guint64) (_p[_i] != 0) << (_i & 63); \
+  } while (0)
+
+/**
+ * @brief Macro to gather the non-zero elements with the bitmap (and the indices if given).
+ */
+#define sparse_gather_loop(T,d,m,words,v,idx) do { \
+    const T *_in = (const T *) (d); \
+    T *_out = (T *) (v); \
+    guint64 _bits; \
+    gsize _w, _k = 0, _pos; \
+    for (_w = 0; _w < (words); _w++) { \
+      _bits = (m)[_w]; \
+      while (_bits) { \
+        _pos = (_w << 6) + __builtin_ctzll (_bits); \
+        if (idx) \
+          (idx)[_k] = (guint) _pos; \
+        _out[_k++] = _in[_pos]; \
+        _bits &= _bits - 1; \
+      } \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to scatter the values with the bitmap.
+ */
+#define sparse_scatter_bitmap_loop(T,d,m,words,v) do { \
+    T *_out = (T *) (d); \
+    const T *_in = (const T *) (v); \
+    guint64 _bits; \
+    gsize _w, _k = 0; \
+    for (_w = 0; _w < (words); _w++) { \
+      _bits = (m)[_w]; \
+      while (_bits) { \
+        _out[(_w << 6) + __builtin_ctzll (_bits)] = _in[_k++]; \
+        _bits &= _bits - 1; \
+      } \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to scatter the values with the indices.
+ */
+#define sparse_scatter_coo_loop(T,d,idx,nnz,v) do { \
+    T *_out = (T *) (d); \
+    const T *_in = (const T *) (v); \
+    gsize _k; \
+    for (_k = 0; _k < (nnz); _k++) \
+      _out[(idx)[_k]] = _in[_k]; \
+  } while (0)
+
+/**
+ * @brief Build the bitmap of non-zero elements.
+ * @param data dense tensor data
+ * @param esize element size (1, 2, 4 or 8)
+ * @param mask zero-initialized bitmap, (count + 63) / 64 words
+ * @param count the number of elements
+ * @return the number of non-zero elements
+ */
+static gsize
+gst_tensor_sparse_build_mask (gconstpointer data, gsize esize,
+    guint64 * mask, gsize count)
+{
+  gsize i, nnz = 0;
+
+  if (!gst_tensor_simd_nonzero_mask (data, esize, mask, count)) {
+    switch (esize) {
+      case 1:
+        sparse_mask_loop (guint8, data, mask, count);
+        break;
+      case 2:
+        sparse_mask_loop (guint16, data, mask, count);
+        break;
+      case 4:
+        sparse_mask_loop (guint32, data, mask, count);
+        break;
+      default:
+        sparse_mask_loop (guint64, data, mask, count);
+        break;
+    }
+  }
+
+  for (i = 0; i < (count + 63) / 64; i++)
+    nnz += __builtin_popcountll (mask[i]);
+
+  return nnz;
+}
+
+/**
+ * @brief Count the non-zero blocks with the bitmap.
+ * @param mask bitmap of non-zero elements
+ * @param words the number of words in the bitmap
+ * @param block the number of elements in a block (8, 16, 32 or 64)
+ */
+static gsize
+gst_tensor_sparse_count_blocks (const guint64 * mask, gsize words,
+    guint block)
+{
+  guint64 bmask, w;
+  gsize i, n = 0;
+  guint j;
+
+  bmask = (block >= 64) ? G_MAXUINT64 : (((guint64) 1 << block) - 1);
+
+  for (i = 0; i < words; i++) {
+    w = mask[i];
+    if (w == 0)
+      continue;
+
+    for (j = 0; j < 64; j += block) {
+      if ((w >> j) & bmask)
+        n++;
+    }
+  }
+
+  return n;
+}
+
+/**
+ * @brief Gather the non-zero elements.
+ */
+static void
+gst_tensor_sparse_gather (gconstpointer data, gsize esize,
+    const guint64 * mask, gsize words, gpointer values, guint * indices)
+{
+  switch (esize) {
+    case 1:
+      sparse_gather_loop (guint8, data, mask, words, values, indices);
+      break;
+    case 2:
+      sparse_gather_loop (guint16, data, mask, words, values, indices);
+      break;
+    case 4:
+      sparse_gather_loop (guint32, data, mask, words, values, indices);
+      break;
+    default:
+      sparse_gather_loop (guint64, data, mask, words, values, indices);
+      break;
+  }
+}
 
 /**
  * @brief Make dense tensor with input sparse tensor.
@@ -28,74 +182,125 @@ gst_tensor_sparse_to_dense (GstTensorMetaInfo * meta, GstMemory * mem)
 {
   GstMemory *dense = NULL;
   GstMapInfo map;
-  guint i, nnz;
-  guint8 *output, *input;
+  GstSparseTensorEncodingInfo sparse;
+  guint i, nnz, block;
+  guint8 *output, *input, *values;
   guint *indices;
-  gsize output_size, element_size;
+  const guint64 *bitmap;
+  gsize output_size, element_size, element_count, input_size, words, start,
+      bits;
 
   if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
     nns_loge ("Failed to map given memory");
     return NULL;
   }
 
-  if (!gst_tensor_meta_info_parse_header (meta, map.data)) {
+  if (!gst_tensor_meta_info_parse_sparse_header (meta, &sparse, map.data)) {
     nns_loge ("Failed to parse meta info from given memory");
     goto done;
   }
 
+  input_size = gst_tensor_meta_info_get_header_size (meta) +
+      gst_tensor_meta_info_get_data_size (meta);
+  if (input_size > map.size) {
+    nns_loge ("Invalid sparse tensor, the size is too small (%zd, expected %zd).",
+        map.size, input_size);
+    goto done;
+  }
+
+  input = map.data + gst_tensor_meta_info_get_header_size (meta);
+  nnz = sparse.nnz;
+
   meta->format = _NNS_TENSOR_FORMAT_STATIC;
 
   element_size = gst_tensor_get_element_size (meta->type);
+  element_count = gst_tensor_get_element_count (meta->dimension);
   output_size = gst_tensor_meta_info_get_data_size (meta);
 
-  if (element_size == 0 || output_size == 0) {
+  if (output_size == 0 || (element_size != 1 && element_size != 2 &&
+          element_size != 4 && element_size != 8)) {
     nns_loge ("Got invalid meta info");
     goto done;
   }
 
   output = (guint8 *) g_malloc0 (output_size);
 
-  nnz = meta->sparse_info.nnz;
-  input = map.data + gst_tensor_meta_info_get_header_size (meta);
-  indices = (guint *) (input + element_size * nnz);
+  switch (sparse.encoding) {
+    case _NNS_SPARSE_BITMAP:
+      words = (element_count + 63) / 64;
+      bitmap = (const guint64 *) input;
+      values = input + words * sizeof (guint64);
 
-  for (i = 0; i < nnz; ++i) {
-    switch (meta->type) {
-      case _NNS_INT32:
-        ((int32_t *) output)[indices[i]] = ((int32_t *) input)[i];
-        break;
-      case _NNS_UINT32:
-        ((uint32_t *) output)[indices[i]] = ((uint32_t *) input)[i];
-        break;
-      case _NNS_INT16:
-        ((int16_t *) output)[indices[i]] = ((int16_t *) input)[i];
-        break;
-      case _NNS_UINT16:
-        ((uint16_t *) output)[indices[i]] = ((uint16_t *) input)[i];
-        break;
-      case _NNS_INT8:
-        ((int8_t *) output)[indices[i]] = ((int8_t *) input)[i];
-        break;
-      case _NNS_UINT8:
-        ((uint8_t *) output)[indices[i]] = ((uint8_t *) input)[i];
-        break;
-      case _NNS_FLOAT64:
-        ((double *) output)[indices[i]] = ((double *) input)[i];
-        break;
-      case _NNS_FLOAT32:
-        ((float *) output)[indices[i]] = ((float *) input)[i];
-        break;
-      case _NNS_INT64:
-        ((int64_t *) output)[indices[i]] = ((int64_t *) input)[i];
-        break;
-      case _NNS_UINT64:
-        ((uint64_t *) output)[indices[i]] = ((uint64_t *) input)[i];
-        break;
-      default:
-        nns_loge ("Error occured during get tensor value");
+      /* the bitmap should have nnz bits within the elements */
+      for (i = 0, bits = 0; i < words; ++i)
+        bits += __builtin_popcountll (bitmap[i]);
+
+      if (bits != nnz || ((element_count & 63) &&
+              (bitmap[words - 1] >> (element_count & 63)))) {
+        nns_loge ("Invalid bitmap, %zd bits set (expected %u).", bits, nnz);
         g_free (output);
         goto done;
-    }
+      }
+
+      switch (element_size) {
+        case 1:
+          sparse_scatter_bitmap_loop (guint8, output, bitmap, words, values);
+          break;
+        case 2:
+          sparse_scatter_bitmap_loop (guint16, output, bitmap, words, values);
+          break;
+        case 4:
+          sparse_scatter_bitmap_loop (guint32, output, bitmap, words, values);
+          break;
+        default:
+          sparse_scatter_bitmap_loop (guint64, output, bitmap, words, values);
+          break;
+      }
+      break;
+    case _NNS_SPARSE_BLOCK:
+      block = sparse.block_size;
+      indices = (guint *) input;
+      values = input + sizeof (guint) * sparse.num_blocks;
+
+      for (i = 0; i < sparse.num_blocks; ++i) {
+        start = (gsize) indices[i] * block;
+        if (start >= element_count) {
+          nns_loge ("Invalid block index %u", indices[i]);
+          g_free (output);
+          goto done;
+        }
+
+        memcpy (output + start * element_size,
+            values + (gsize) i * block * element_size,
+            MIN (block, element_count - start) * element_size);
+      }
+      break;
+    default:
+      indices = (guint *) (input + element_size * nnz);
+
+      for (i = 0; i < nnz; ++i) {
+        if (indices[i] >= element_count) {
+          nns_loge ("Invalid index %u", indices[i]);
+          g_free (output);
+          goto done;
+        }
+      }
+
+      switch (element_size) {
+        case 1:
+          sparse_scatter_coo_loop (guint8, output, indices, nnz, input);
+          break;
+        case 2:
+          sparse_scatter_coo_loop (guint16, output, indices, nnz, input);
+          break;
+        case 4:
+          sparse_scatter_coo_loop (guint32, output, indices, nnz, input);
+          break;
+        default:
+          sparse_scatter_coo_loop (guint64, output, indices, nnz, input);
+          break;
+      }
+      break;
   }
 
   dense = gst_memory_new_wrapped (0, output, output_size, 0, output_size,
@@ -107,23 +312,39 @@ done:
 }
 
 /**
- * @brief Make sparse tensor with input dense tensor.
+ * @brief Make sparse tensor with input dense tensor (COO encoding).
  * @param[in,out] meta tensor meta structure to be updated
  * @param[in] mem gst-memory of dense tensor data
  * @return pointer of GstMemory with sparse tensor data or NULL on error. Caller should handle this newly allocated memory.
  */
 GstMemory *
 gst_tensor_sparse_from_dense (GstTensorMetaInfo * meta, GstMemory * mem)
+{
+  return gst_tensor_sparse_from_dense_full (meta, mem, _NNS_SPARSE_COO);
+}
+
+/**
+ * @brief Make sparse tensor with input dense tensor and given encoding.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of dense tensor data
+ * @param[in] encoding sparse encoding, _NNS_SPARSE_END to select the smallest one
+ * @return pointer of GstMemory with sparse tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+GstMemory *
+gst_tensor_sparse_from_dense_full (GstTensorMetaInfo * meta, GstMemory * mem,
+    tensor_sparse_encoding encoding)
 {
   GstMemory *sparse = NULL;
   GstMapInfo map;
-  guint i, nnz = 0;
-  guint8 *output;
-  tensor_type data_type;
-  void *values;
+  GstSparseTensorEncodingInfo info;
+  guint8 *output, *values;
   guint *indices;
-  gsize output_size, header_size, element_size;
-  gulong element_count;
+  guint64 *mask;
+  gsize output_size, header_size, element_size, element_count;
+  gsize nnz, words, num_blocks, size, coo_size, bitmap_size, block_size;
+  gsize w, pos, k;
+  guint i, j, block;
+  guint64 bits, bmask;
 
   if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
     nns_loge ("Failed to map given memory");
@@ -134,117 +355,113 @@ gst_tensor_sparse_from_dense (GstTensorMetaInfo * meta, GstMemory * mem)
   element_size = gst_tensor_get_element_size (meta->type);
   element_count = gst_tensor_get_element_count (meta->dimension);
 
-  if (element_size == 0 || element_count == 0) {
+  if (element_count == 0 || (element_size != 1 && element_size != 2 &&
+          element_size != 4 && element_size != 8)) {
     nns_loge ("Got invalid meta info");
     goto done;
   }
 
-  /** alloc maximum possible size of memory */
-  values = g_malloc0 (element_size * element_count);
-  indices = g_malloc0 (sizeof (guint) * element_count);
+  if (map.size < element_size * element_count) {
+    nns_loge ("Invalid dense tensor, the size is too small (%zd, expected %zd).",
+        map.size, element_size * element_count);
+    goto done;
+  }
 
-  data_type = meta->type;
+  /* 1st pass: bitmap of non-zero elements */
+  words = (element_count + 63) / 64;
+  mask = g_new0 (guint64, words);
+  nnz = gst_tensor_sparse_build_mask (map.data, element_size, mask,
+      element_count);
 
-  /** Consider using macro to reduce loc and readability */
-  for (i = 0; i < element_count; ++i) {
-    switch (data_type) {
-      case _NNS_INT32:
-        if (((int32_t *) map.data)[i] != 0) {
-          ((int32_t *) values)[nnz] = ((int32_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_UINT32:
-        if (((uint32_t *) map.data)[i] != 0) {
-          ((uint32_t *) values)[nnz] = ((uint32_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_INT16:
-        if (((int16_t *) map.data)[i] != 0) {
-          ((int16_t *) values)[nnz] = ((int16_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_UINT16:
-        if (((uint16_t *) map.data)[i] != 0) {
-          ((uint16_t *) values)[nnz] = ((uint16_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_INT8:
-        if (((int8_t *) map.data)[i] != 0) {
-          ((int8_t *) values)[nnz] = ((int8_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_UINT8:
-        if (((uint8_t *) map.data)[i] != 0) {
-          ((uint8_t *) values)[nnz] = ((uint8_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_FLOAT64:
-        if (((double *) map.data)[i] != 0) {
-          ((double *) values)[nnz] = ((double *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_FLOAT32:
-        if (((float *) map.data)[i] != 0) {
-          ((float *) values)[nnz] = ((float *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_INT64:
-        if (((int64_t *) map.data)[i] != 0) {
-          ((int64_t *) values)[nnz] = ((int64_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      case _NNS_UINT64:
-        if (((uint64_t *) map.data)[i] != 0) {
-          ((uint64_t *) values)[nnz] = ((uint64_t *) map.data)[i];
-          indices[nnz] = i;
-          nnz += 1;
-        }
-        break;
-      default:
-        nns_loge ("Error occured during get tensor value");
-        g_free (values);
-        g_free (indices);
-        goto done;
+  /* compare the size of each encoding */
+  coo_size = nnz * (element_size + sizeof (guint));
+  bitmap_size = words * sizeof (guint64) + nnz * element_size;
+
+  block = sparse_block_sizes[0];
+  num_blocks = gst_tensor_sparse_count_blocks (mask, words, block);
+  block_size = num_blocks * (sizeof (guint) + block * element_size);
+
+  for (i = 1; i < G_N_ELEMENTS (sparse_block_sizes); i++) {
+    gsize n = gst_tensor_sparse_count_blocks (mask, words,
+        sparse_block_sizes[i]);
+
+    size = n * (sizeof (guint) + sparse_block_sizes[i] * element_size);
+    if (size < block_size) {
+      block = sparse_block_sizes[i];
+      num_blocks = n;
+      block_size = size;
     }
   }
 
-  /** update meta nnz info */
-  meta->format = _NNS_TENSOR_FORMAT_SPARSE;
-  meta->sparse_info.nnz = nnz;
+  if (encoding >= _NNS_SPARSE_END) {
+    encoding = _NNS_SPARSE_COO;
+    size = coo_size;
+
+    if (bitmap_size < size) {
+      encoding = _NNS_SPARSE_BITMAP;
+      size = bitmap_size;
+    }
+
+    if (block_size < size)
+      encoding = _NNS_SPARSE_BLOCK;
+  }
 
-  /** write to output buffer */
-  output_size = element_size * nnz + sizeof (guint) * nnz;
+  /** update meta sparse info */
+  info.encoding = encoding;
+  info.nnz = (uint32_t) nnz;
+  info.block_size = (encoding == _NNS_SPARSE_BLOCK) ? block : 0;
+  info.num_blocks = (encoding == _NNS_SPARSE_BLOCK) ? (uint32_t) num_blocks : 0;
 
-  /** add meta info header */
-  output_size += header_size;
+  if (!gst_tensor_meta_info_set_sparse (meta, &info)) {
+    nns_loge ("Failed to set sparse encoding %d", encoding);
+    g_free (mask);
+    goto done;
+  }
+
+  /* 2nd pass: write the exact size of sparse data */
+  output_size = header_size + gst_tensor_meta_info_get_data_size (meta);
   output = g_malloc0 (output_size);
 
-  gst_tensor_meta_info_update_header (meta, output);
+  gst_tensor_meta_info_update_sparse_header (meta, &info, output);
+  values = output + header_size;
+
+  switch (encoding) {
+    case _NNS_SPARSE_BITMAP:
+      memcpy (values, mask, words * sizeof (guint64));
+      gst_tensor_sparse_gather (map.data, element_size, mask, words,
+          values + words * sizeof (guint64), NULL);
+      break;
+    case _NNS_SPARSE_BLOCK:
+      indices = (guint *) values;
+      values += sizeof (guint) * num_blocks;
+      bmask = (block >= 64) ? G_MAXUINT64 : (((guint64) 1 << block) - 1);
+      k = 0;
+
+      for (w = 0; w < words; w++) {
+        bits = mask[w];
+        if (bits == 0)
+          continue;
 
-  memcpy (output + header_size, values, element_size * nnz);
-  memcpy (output + header_size + (element_size * nnz),
-      indices, sizeof (guint) * nnz);
+        for (j = 0; j < 64; j += block) {
+          if (((bits >> j) & bmask) == 0)
+            continue;
+
+          pos = (w << 6) + j;
+          indices[k] = (guint) (pos / block);
+          memcpy (values + k * block * element_size,
+              map.data + pos * element_size,
+              MIN (block, element_count - pos) * element_size);
+          k++;
+        }
+      }
+      break;
+    default:
+      gst_tensor_sparse_gather (map.data, element_size, mask, words, values,
+          (guint *) (values + element_size * nnz));
+      break;
+  }
 
-  g_free (values);
-  g_free (indices);
+  g_free (mask);
 
   sparse = gst_memory_new_wrapped (0, output, output_size, 0, output_size,
       output, g_free);
@@ -30,7 +30,7 @@ extern GstMemory *
 gst_tensor_sparse_to_dense (GstTensorMetaInfo * meta, GstMemory * mem);
 
 /**
- * @brief Make sparse tensor with input dense tensor.
+ * @brief Make sparse tensor with input dense tensor (COO encoding).
  * @param[in,out] meta tensor meta structure to be updated
  * @param[in] mem gst-memory of dense tensor data
  * @return pointer of GstMemory with sparse tensor data or NULL on error. Caller should handle this newly allocated memory.
@@ -38,5 +38,16 @@ gst_tensor_sparse_to_dense (GstTensorMetaInfo * meta, GstMemory * mem);
 extern GstMemory *
 gst_tensor_sparse_from_dense (GstTensorMetaInfo * meta, GstMemory * mem);
 
+/**
+ * @brief Make sparse tensor with input dense tensor and given encoding.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] mem gst-memory of dense tensor data
+ * @param[in] encoding sparse encoding, _NNS_SPARSE_END to select the smallest one
+ * @return pointer of GstMemory with sparse tensor data or NULL on error. Caller should handle this newly allocated memory.
+ */
+extern GstMemory *
+gst_tensor_sparse_from_dense_full (GstTensorMetaInfo * meta, GstMemory * mem,
+    tensor_sparse_encoding encoding);
+
 G_END_DECLS
 #endif /* __GST_TENSOR_SPARSE_UTIL_H__ */
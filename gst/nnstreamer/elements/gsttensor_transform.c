@@ -52,6 +52,7 @@
 #include <nnstreamer_log.h>
 #include <nnstreamer_util.h>
 #include "gsttensor_transform.h"
+#include "tensor_simd.h"
 
 #ifdef HAVE_ORC
 #include "nnstreamer-orc.h"
@@ -69,7 +70,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_tensor_transform_debug);
 #define CAPS_STRING GST_TENSOR_CAP_DEFAULT ";" GST_TENSORS_CAP_MAKE ("{ static, flexible }")
 #define REGEX_DIMCHG_OPTION "^([0-9]|1[0-5]):([0-9]|1[0-5])$"
 #define REGEX_TYPECAST_OPTION "(^[u]?int(8|16|32|64)$|^float(16|32|64)$)"
-#define REGEX_TRANSPOSE_OPTION "^(?:([0-2]):(?!.*\\1)){3}3$"
+#define REGEX_TRANSPOSE_OPTION "^([0-9]|1[0-5])(:([0-9]|1[0-5])){1,15}$"
 #define REGEX_STAND_OPTION "^(default|dc-average)(:([u]?int(8|16|32|64)|float(16|32|64)))?(,per-channel:(true|false))?$"
 #define REGEX_CLAMP_OPTION "^((([-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?))):"\
     "((([-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?)))$"
@@ -81,10 +82,9 @@ GST_DEBUG_CATEGORY_STATIC (gst_tensor_transform_debug);
 #define REGEX_ARITH_OPTION_TYPECAST "(typecast:([u]?int(8|16|32|64)|float(16|32|64)))"
 
 /**
- * @brief The transpose rank is fixed to 4.
- * This RANK does not affect other/tensors(s)'s NNS_TENSOR_RANK_LIMIT.
+ * @brief The transpose supports all ranks of tensor.
  */
-#define NNS_TENSOR_TRANSPOSE_RANK_LIMIT (4)
+#define NNS_TENSOR_TRANSPOSE_RANK_LIMIT (NNS_TENSOR_RANK_LIMIT)
 
 /**
  * @brief The padding rank is fixed to 3.
@@ -195,7 +195,7 @@ gst_tensor_transform_mode_get_type (void)
             "option=[typecast:TYPE,][per-channel:(false|true@DIM),]add|mul|div:NUMBER[@CH_IDX], ...",
           "arithmetic"},
       {GTT_TRANSPOSE, "Mode for transposing shape of tensor, "
-            "option=D1\':D2\':D3\':D4 (fixed to 3)",
+            "option=D1\':D2\':...:DN\' (permutation of the dimension indices)",
           "transpose"},
       {GTT_STAND, "Mode for statistical standardization of tensor, "
             "option=(default|dc-average)[:TYPE][,per-channel:(false|true)]",
@@ -303,11 +303,15 @@ gst_tensor_transform_init (GstTensorTransform * filter)
   filter->option = NULL;
   filter->loaded = FALSE;
   filter->operators = NULL;
+  filter->fused_ops = NULL;
+  filter->num_fused_ops = 0;
   filter->acceleration = DEFAULT_ACCELERATION;
   filter->apply = NULL;
 
   gst_tensors_config_init (&filter->in_config);
   gst_tensors_config_init (&filter->out_config);
+  filter->metrics = gst_tensor_metrics_new (GST_ELEMENT (filter),
+      "tensor_transform");
 }
 
 /**
@@ -372,6 +376,47 @@ refrain_from_heavy_op_on_float16 (gulong n)
   }
 }
 
+/**
+ * @brief Apply the operator to float16 data with SIMD, converting the data to float32 by chunk.
+ * @return TRUE if done, FALSE if SIMD is not available.
+ */
+static gboolean
+gst_tensor_transform_op_float16_simd (gpointer data, gulong n,
+    tensor_transform_operator op, float16 v)
+{
+  gfloat chunk[256];
+  float16 *ptr = (float16 *) data;
+  nns_simd_op simd_op;
+  gulong idx, len;
+
+  switch (op) {
+    case GTT_OP_ADD:
+      simd_op = NNS_SIMD_OP_ADD;
+      break;
+    case GTT_OP_MUL:
+      simd_op = NNS_SIMD_OP_MUL;
+      break;
+    case GTT_OP_DIV:
+      simd_op = NNS_SIMD_OP_DIV;
+      break;
+    default:
+      return FALSE;
+  }
+
+  /* float16 arithmetic is done in float32 and rounded to float16. */
+  for (idx = 0; idx < n; idx += len) {
+    len = MIN (n - idx, G_N_ELEMENTS (chunk));
+
+    if (!gst_tensor_simd_f16_to_f32 (ptr + idx, chunk, len) ||
+        !gst_tensor_simd_operator_f32 (chunk, len, simd_op, (gfloat) v))
+      return FALSE;
+
+    gst_tensor_simd_f32_to_f16 (chunk, ptr + idx, len);
+  }
+
+  return TRUE;
+}
+
 /** @todo Make this use SIMD or ORC */
 #define _conv_to_f16(intype, o, i, n) \
   do { \
@@ -442,6 +487,8 @@ refrain_from_heavy_op_on_float16 (gulong n)
   do { \
     gulong idx; \
     float16 *data_in = (float16 *) (i); \
+    if (gst_tensor_transform_op_float16_simd (data_in, n, op, v)) \
+      break; \
     refrain_from_heavy_op_on_float16 (n); \
     switch (op) { \
       case GTT_OP_ADD: \
@@ -654,6 +701,49 @@ gst_tensor_transform_do_operator (GstTensorTransform * filter,
   return TRUE;
 }
 
+/**
+ * @brief Compile the arithmetic operators for the fused single-pass kernel.
+ * @details The operators can be fused if all operators are applied to all channels.
+ *          Typecast (at the first) is excluded, the kernel writes the output type directly.
+ */
+static void
+gst_tensor_transform_fuse_operators (GstTensorTransform * filter)
+{
+  GSList *walk;
+  tensor_transform_operator_s *op_s;
+  guint n = 0;
+
+  g_free (filter->fused_ops);
+  filter->fused_ops = NULL;
+  filter->num_fused_ops = 0;
+
+  for (walk = filter->operators; walk; walk = g_slist_next (walk)) {
+    op_s = (tensor_transform_operator_s *) walk->data;
+
+    if (op_s->op == GTT_OP_TYPECAST) {
+      if (walk != filter->operators)
+        return;
+      continue;
+    }
+
+    if (op_s->applying_ch != -1)
+      return;
+    n++;
+  }
+
+  if (n == 0)
+    return;
+
+  filter->fused_ops = g_new0 (tensor_transform_operator_s, n);
+
+  for (walk = filter->operators; walk; walk = g_slist_next (walk)) {
+    op_s = (tensor_transform_operator_s *) walk->data;
+
+    if (op_s->op != GTT_OP_TYPECAST)
+      filter->fused_ops[filter->num_fused_ops++] = *op_s;
+  }
+}
+
 /**
  * @brief Setup internal data (data_* in GstTensorTransform)
  * @param[in/out] filter "this" pointer. mode & option MUST BE set already.
@@ -725,6 +815,10 @@ gst_tensor_transform_set_option_data (GstTensorTransform * filter)
         filter->operators = NULL;
       }
 
+      g_free (filter->fused_ops);
+      filter->fused_ops = NULL;
+      filter->num_fused_ops = 0;
+
       regex_option_tc = g_regex_new (REGEX_ARITH_OPTION_TYPECAST,
           G_REGEX_CASELESS, 0, 0);
 
@@ -847,31 +941,56 @@ gst_tensor_transform_set_option_data (GstTensorTransform * filter)
       }
 
       ret = filter->loaded = (filter->operators != NULL);
+      if (ret)
+        gst_tensor_transform_fuse_operators (filter);
+
       g_strfreev (str_operators);
       g_free (str_option);
       break;
     }
     case GTT_TRANSPOSE:
     {
-      int i;
+      guint i, rank, idx;
+      guint32 used = 0;
       gchar **strv = NULL;
 
       if (!g_regex_match_simple (REGEX_TRANSPOSE_OPTION, filter->option,
               G_REGEX_CASELESS, 0)) {
         ml_loge
-            ("%s: transpose: \'%s\' is not valid option string: it should be in the form of NEW_IDX_DIM0:NEW_IDX_DIM1:NEW_IDX_DIM2:3 (Now transpose mode's rank is fixed to 3. Note that the index of the last dim is always fixed to 3)\n",
+            ("%s: transpose: \'%s\' is not valid option string: it should be in the form of NEW_IDX_DIM0:NEW_IDX_DIM1:...:NEW_IDX_DIMN, the permutation of the dimension indices (e.g., 1:2:0:3)\n",
             filter_name, filter->option);
         break;
       }
 
       strv = g_strsplit (filter->option, ":", NNS_TENSOR_TRANSPOSE_RANK_LIMIT);
-      for (i = 0; i < NNS_TENSOR_TRANSPOSE_RANK_LIMIT; i++) {
-        filter->data_transpose.trans_order[i] =
-            (uint8_t) g_ascii_strtoull (strv[i], NULL, 10);
+      rank = g_strv_length (strv);
+
+      for (i = 0; i < rank; i++) {
+        idx = (guint) g_ascii_strtoull (strv[i], NULL, 10);
+
+        /* each index should be given once */
+        if (idx >= rank || (used & (1U << idx)))
+          break;
+
+        used |= (1U << idx);
+        filter->data_transpose.trans_order[i] = (uint8_t) idx;
       }
 
-      ret = filter->loaded = TRUE;
       g_strfreev (strv);
+
+      if (i < rank) {
+        ml_loge
+            ("%s: transpose: \'%s\' is not valid option string: it should be the permutation of the dimension indices 0 to %u\n",
+            filter_name, filter->option, rank - 1);
+        break;
+      }
+
+      /* other dimensions are not changed */
+      for (i = rank; i < NNS_TENSOR_RANK_LIMIT; i++)
+        filter->data_transpose.trans_order[i] = (uint8_t) i;
+
+      filter->data_transpose.rank = rank;
+      ret = filter->loaded = TRUE;
       break;
     }
     case GTT_STAND:
@@ -1176,11 +1295,17 @@ gst_tensor_transform_finalize (GObject * object)
     filter->operators = NULL;
   }
 
+  g_free (filter->fused_ops);
+  filter->fused_ops = NULL;
+
   if (filter->apply) {
     g_list_free (filter->apply);
     filter->apply = NULL;
   }
 
+  gst_tensor_metrics_free (filter->metrics);
+  filter->metrics = NULL;
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -1279,6 +1404,344 @@ gst_tensor_transform_dimchg (GstTensorTransform * filter,
   return GST_FLOW_OK;
 }
 
+/**
+ * @brief Typecast the tensor data with SIMD kernels.
+ * @return TRUE if done, FALSE if the types are not supported (caller should run scalar code).
+ */
+static gboolean
+gst_tensor_transform_typecast_simd (tensor_type in_type, tensor_type out_type,
+    const uint8_t * inptr, uint8_t * outptr, gulong num)
+{
+#ifdef FLOAT16_SUPPORT
+  if (in_type == _NNS_FLOAT16 && out_type == _NNS_FLOAT32)
+    return gst_tensor_simd_f16_to_f32 (inptr, (gfloat *) outptr, num);
+
+  if (in_type == _NNS_FLOAT32 && out_type == _NNS_FLOAT16)
+    return gst_tensor_simd_f32_to_f16 ((const gfloat *) inptr, outptr, num);
+#endif
+
+  if (out_type == _NNS_FLOAT32)
+    return gst_tensor_simd_typecast_f32 (inptr, in_type, (gfloat *) outptr,
+        num);
+
+  return FALSE;
+}
+
+/**
+ * @brief Convert the arithmetic operator for SIMD kernels.
+ */
+static nns_simd_op
+gst_tensor_transform_get_simd_op (tensor_transform_operator op)
+{
+  switch (op) {
+    case GTT_OP_ADD:
+      return NNS_SIMD_OP_ADD;
+    case GTT_OP_MUL:
+      return NNS_SIMD_OP_MUL;
+    case GTT_OP_DIV:
+      return NNS_SIMD_OP_DIV;
+    default:
+      break;
+  }
+
+  return NNS_SIMD_OP_UNKNOWN;
+}
+
+/**
+ * @brief Max length of repeated operands for per-channel arithmetic with SIMD.
+ */
+#define SIMD_PATTERN_MAX (1024)
+
+/**
+ * @brief Per-channel arithmetic with SIMD kernels (in-place).
+ * @return TRUE if done
+ */
+static gboolean
+gst_tensor_transform_arithmetic_ch_simd (gfloat * data, gulong num,
+    nns_simd_op op, gfloat value, int applying_ch, gsize ch_size, guint n_ch)
+{
+  gfloat pattern[SIMD_PATTERN_MAX + 8];
+  gfloat identity;
+  gsize ch_offset, i;
+
+  ch_offset = ch_size * n_ch;
+
+  if (ch_size < 8 && ch_offset <= SIMD_PATTERN_MAX) {
+    /**
+     * Small channel (e.g., RGB in innermost dimension).
+     * Repeat the value for the channel and the identity for other channels.
+     */
+    identity = (op == NNS_SIMD_OP_ADD) ? -0.0f : 1.0f;
+    for (i = 0; i < ch_offset + 8; i++)
+      pattern[i] = ((int) ((i % ch_offset) / ch_size) == applying_ch) ?
+          value : identity;
+
+    return gst_tensor_simd_operator_pattern_f32 (data,
+        (num / ch_offset) * ch_offset, op, pattern, ch_offset);
+  }
+
+  for (i = 0; i < num / ch_offset; ++i) {
+    if (!gst_tensor_simd_operator_f32 (data + ch_offset * i +
+            ch_size * applying_ch, ch_size, op, value))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Arithmetic with SIMD kernels. This is available when the operators are done in float32.
+ * @return TRUE if done, FALSE if not supported (caller should run scalar code).
+ */
+static gboolean
+gst_tensor_transform_arithmetic_simd (GstTensorTransform * filter,
+    GstTensorInfo * in_info, GstTensorInfo * out_info,
+    const uint8_t * inptr, uint8_t * outptr)
+{
+  GSList *walk;
+  tensor_transform_operator_s *op_s;
+  gfloat *data = (gfloat *) outptr;
+  gulong i, num;
+  gsize ch_size = 1;
+  guint ch_dim, n_ch = 1;
+  nns_simd_op simd_op;
+
+  if (out_info->type != _NNS_FLOAT32 || !gst_tensor_simd_is_available ())
+    return FALSE;
+
+  /* Typecast is allowed at the first, and all operators should be done in float32. */
+  for (walk = filter->operators; walk; walk = g_slist_next (walk)) {
+    op_s = (tensor_transform_operator_s *) walk->data;
+
+    if (op_s->op == GTT_OP_TYPECAST) {
+      if (walk != filter->operators || op_s->value.type != _NNS_FLOAT32)
+        return FALSE;
+    } else if (gst_tensor_transform_get_simd_op (op_s->op) ==
+        NNS_SIMD_OP_UNKNOWN) {
+      return FALSE;
+    } else if (walk == filter->operators && in_info->type != _NNS_FLOAT32) {
+      return FALSE;
+    }
+  }
+
+  num = gst_tensor_get_element_count (in_info->dimension);
+
+  if (filter->data_arithmetic.per_channel_arith) {
+    ch_dim = filter->data_arithmetic.ch_dim;
+    for (i = 0; i < ch_dim; ++i)
+      ch_size *= in_info->dimension[i];
+    n_ch = in_info->dimension[ch_dim];
+  }
+
+  for (walk = filter->operators; walk; walk = g_slist_next (walk)) {
+    op_s = (tensor_transform_operator_s *) walk->data;
+
+    if (op_s->op != GTT_OP_TYPECAST) {
+      gst_tensor_data_typecast (&op_s->value, _NNS_FLOAT32);
+
+      /* scalar code handles the error case */
+      if (op_s->op == GTT_OP_DIV && op_s->value.data._float == 0)
+        return FALSE;
+    }
+  }
+
+  if (!gst_tensor_transform_typecast_simd (in_info->type, out_info->type,
+          inptr, outptr, num))
+    return FALSE;
+
+  for (walk = filter->operators; walk; walk = g_slist_next (walk)) {
+    op_s = (tensor_transform_operator_s *) walk->data;
+    simd_op = gst_tensor_transform_get_simd_op (op_s->op);
+
+    if (simd_op == NNS_SIMD_OP_UNKNOWN)
+      continue;
+
+    if (!filter->data_arithmetic.per_channel_arith || op_s->applying_ch == -1) {
+      gst_tensor_simd_operator_f32 (data, num, simd_op,
+          op_s->value.data._float);
+    } else if (op_s->applying_ch < (int) n_ch) {
+      gst_tensor_transform_arithmetic_ch_simd (data, num, simd_op,
+          op_s->value.data._float, op_s->applying_ch, ch_size, n_ch);
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief The number of elements in a chunk of fused arithmetic, to keep the chunk in L1 cache.
+ */
+#define FUSED_CHUNK_SIZE (512)
+
+/**
+ * @brief Function to run the fused arithmetic for (input type, output type).
+ */
+typedef void (*fused_arith_func) (const uint8_t * inptr, uint8_t * outptr,
+    gulong num, const tensor_transform_operator_s * ops, guint num_ops);
+
+/**
+ * @brief Macro to define the fused arithmetic kernel.
+ *        Each chunk is typecasted once and the operators are applied while the chunk is in cache.
+ */
+#define fused_arith_define(itype, otype, ntype) \
+static void \
+fused_arith_##itype##_##otype (const uint8_t * inptr, uint8_t * outptr, \
+    gulong num, const tensor_transform_operator_s * ops, guint num_ops) \
+{ \
+  const itype *ip = (const itype *) inptr; \
+  otype *d; \
+  otype v; \
+  tensor_data_s value; \
+  gulong i, k, len; \
+  guint o; \
+  for (i = 0; i < num; i += len) { \
+    len = MIN (num - i, FUSED_CHUNK_SIZE); \
+    d = (otype *) outptr + i; \
+    for (k = 0; k < len; k++) \
+      d[k] = (otype) ip[i + k]; \
+    for (o = 0; o < num_ops; o++) { \
+      value = ops[o].value; \
+      gst_tensor_data_typecast (&value, ntype); \
+      gst_tensor_data_get (&value, &v); \
+      switch (ops[o].op) { \
+        case GTT_OP_ADD: \
+          for (k = 0; k < len; k++) d[k] = d[k] + v; \
+          break; \
+        case GTT_OP_MUL: \
+          for (k = 0; k < len; k++) d[k] = d[k] * v; \
+          break; \
+        case GTT_OP_DIV: \
+          for (k = 0; k < len; k++) d[k] = d[k] / v; \
+          break; \
+        default: \
+          break; \
+      } \
+    } \
+  } \
+}
+
+/**
+ * @brief Macro to define the fused arithmetic kernels for all input types.
+ */
+#define fused_arith_define_all(otype, ntype) \
+  fused_arith_define (int32_t, otype, ntype) \
+  fused_arith_define (uint32_t, otype, ntype) \
+  fused_arith_define (int16_t, otype, ntype) \
+  fused_arith_define (uint16_t, otype, ntype) \
+  fused_arith_define (int8_t, otype, ntype) \
+  fused_arith_define (uint8_t, otype, ntype) \
+  fused_arith_define (double, otype, ntype) \
+  fused_arith_define (float, otype, ntype) \
+  fused_arith_define (int64_t, otype, ntype) \
+  fused_arith_define (uint64_t, otype, ntype)
+
+/**
+ * @brief Macro to list the fused arithmetic kernels for the output type.
+ */
+#define fused_arith_table(otype) { \
+    [_NNS_INT32] = fused_arith_int32_t_##otype, \
+    [_NNS_UINT32] = fused_arith_uint32_t_##otype, \
+    [_NNS_INT16] = fused_arith_int16_t_##otype, \
+    [_NNS_UINT16] = fused_arith_uint16_t_##otype, \
+    [_NNS_INT8] = fused_arith_int8_t_##otype, \
+    [_NNS_UINT8] = fused_arith_uint8_t_##otype, \
+    [_NNS_FLOAT64] = fused_arith_double_##otype, \
+    [_NNS_FLOAT32] = fused_arith_float_##otype, \
+    [_NNS_INT64] = fused_arith_int64_t_##otype, \
+    [_NNS_UINT64] = fused_arith_uint64_t_##otype, \
+  }
+
+/* Normalization chains generally produce floating point tensors. */
+fused_arith_define_all (float, _NNS_FLOAT32)
+fused_arith_define_all (double, _NNS_FLOAT64)
+
+static const fused_arith_func fused_arith_float[_NNS_END] =
+    fused_arith_table (float);
+static const fused_arith_func fused_arith_double[_NNS_END] =
+    fused_arith_table (double);
+
+/**
+ * @brief Fused arithmetic for float32 output with SIMD kernels.
+ * @return TRUE if done
+ */
+static gboolean
+gst_tensor_transform_arithmetic_fused_simd (GstTensorTransform * filter,
+    tensor_type in_type, const uint8_t * inptr, uint8_t * outptr, gulong num)
+{
+  tensor_transform_operator_s *ops = filter->fused_ops;
+  gsize in_element_size = gst_tensor_get_element_size (in_type);
+  gfloat *d;
+  tensor_data_s value;
+  gulong i, len;
+  guint o;
+
+  for (i = 0; i < num; i += len) {
+    len = MIN (num - i, FUSED_CHUNK_SIZE);
+    d = (gfloat *) outptr + i;
+
+    if (!gst_tensor_simd_typecast_f32 (inptr + in_element_size * i, in_type,
+            d, len))
+      return FALSE;
+
+    for (o = 0; o < filter->num_fused_ops; o++) {
+      value = ops[o].value;
+      gst_tensor_data_typecast (&value, _NNS_FLOAT32);
+      gst_tensor_simd_operator_f32 (d, len,
+          gst_tensor_transform_get_simd_op (ops[o].op), value.data._float);
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Run the fused arithmetic kernel in a single pass over the tensor.
+ * @return TRUE if done, FALSE if the operators cannot be fused (caller should run other code).
+ */
+static gboolean
+gst_tensor_transform_arithmetic_fused (GstTensorTransform * filter,
+    GstTensorInfo * in_info, GstTensorInfo * out_info,
+    const uint8_t * inptr, uint8_t * outptr)
+{
+  fused_arith_func func = NULL;
+  tensor_data_s value;
+  gulong num;
+  guint o;
+
+  if (!filter->fused_ops || in_info->type >= _NNS_END)
+    return FALSE;
+
+  if (out_info->type == _NNS_FLOAT32)
+    func = fused_arith_float[in_info->type];
+  else if (out_info->type == _NNS_FLOAT64)
+    func = fused_arith_double[in_info->type];
+
+  if (!func)
+    return FALSE;
+
+  /* scalar code handles the error case */
+  for (o = 0; o < filter->num_fused_ops; o++) {
+    if (filter->fused_ops[o].op == GTT_OP_DIV) {
+      value = filter->fused_ops[o].value;
+      gst_tensor_data_typecast (&value, out_info->type);
+
+      if ((out_info->type == _NNS_FLOAT32 && value.data._float == 0) ||
+          (out_info->type == _NNS_FLOAT64 && value.data._double == 0))
+        return FALSE;
+    }
+  }
+
+  num = gst_tensor_get_element_count (in_info->dimension);
+
+  if (out_info->type == _NNS_FLOAT32 && gst_tensor_simd_is_available () &&
+      gst_tensor_transform_arithmetic_fused_simd (filter, in_info->type,
+          inptr, outptr, num))
+    return TRUE;
+
+  func (inptr, outptr, num, filter->fused_ops, filter->num_fused_ops);
+  return TRUE;
+}
+
 /**
  * @brief subrouting for tensor-tranform, "typecast" case.
  * @param[in/out] filter "this" pointer
@@ -1298,6 +1761,10 @@ gst_tensor_transform_typecast (GstTensorTransform * filter,
 
   num = gst_tensor_get_element_count (in_info->dimension);
 
+  if (gst_tensor_transform_typecast_simd (in_info->type, out_info->type,
+          inptr, outptr, num))
+    return GST_FLOW_OK;
+
 #ifdef HAVE_ORC
   if (orc_supported (filter, in_info->type, out_info->type)) {
     orc_typecast (inptr, outptr, num, in_info->type, out_info->type);
@@ -1340,6 +1807,14 @@ gst_tensor_transform_arithmetic (GstTensorTransform * filter,
 
   num = gst_tensor_get_element_count (in_info->dimension);
 
+  if (gst_tensor_transform_arithmetic_fused (filter, in_info, out_info,
+          inptr, outptr))
+    return GST_FLOW_OK;
+
+  if (gst_tensor_transform_arithmetic_simd (filter, in_info, out_info,
+          inptr, outptr))
+    return GST_FLOW_OK;
+
 #ifdef HAVE_ORC
   if (orc_supported (filter, in_info->type, out_info->type)) {
     walk = filter->operators;
@@ -1503,25 +1978,52 @@ gst_tensor_transform_arithmetic (GstTensorTransform * filter,
 /**
  * Macro to run loop for various data types with transpose
  */
-#define transposeloop(cl,ck,cj,ci,sl,sk,sj,si,typesize) do { \
-    size_t i, j, k, l;                                  \
-    int inidx = 0, outidx=0;                            \
-    for(cl=0;cl<sl;cl++)                      \
-      for(ci=0;ci<si;ci++)                    \
-        for(cj=0;cj<sj;cj++)                  \
-          for(ck=0;ck<sk;ck++){               \
-            const uint8_t *_in; \
-            uint8_t *_out; \
-            outidx = si*sj*sk*cl + sj*sk*ci + sk*cj + ck; \
-            inidx = SK*SJ*SI*l + SJ*SI*k + SI*j + i; \
-            _in = inptr + inidx * typesize; \
-            _out = outptr + outidx * typesize; \
-            nns_memcpy(_out, _in, typesize); \
-	  }                                                      \
-  } while(0);
+/**
+ * @brief The number of elements in a side of the tile for transpose.
+ */
+#define TRANSPOSE_TILE_SIZE (16)
+
+/**
+ * @brief Macro to define the tiled 2D transpose for the element type.
+ * @details Transpose the plane of (n0 x np) elements. The dimension 0 is contiguous in input,
+ *          and the dimension p (stride: isp) becomes the contiguous dimension in output.
+ *          The dimension 0 is written with the stride os0 in output.
+ */
+#define transpose_tile_define(etype) \
+static void \
+transpose_tile_##etype (const uint8_t * inptr, uint8_t * outptr, \
+    gsize n0, gsize np, gsize isp, gsize os0) \
+{ \
+  const etype *ip = (const etype *) inptr; \
+  etype *op = (etype *) outptr; \
+  gsize b0, bp, x, y, e0, ep; \
+  for (b0 = 0; b0 < n0; b0 += TRANSPOSE_TILE_SIZE) { \
+    e0 = MIN (b0 + TRANSPOSE_TILE_SIZE, n0); \
+    for (bp = 0; bp < np; bp += TRANSPOSE_TILE_SIZE) { \
+      ep = MIN (bp + TRANSPOSE_TILE_SIZE, np); \
+      for (y = b0; y < e0; y++) \
+        for (x = bp; x < ep; x++) \
+          op[y * os0 + x] = ip[x * isp + y]; \
+    } \
+  } \
+}
+
+transpose_tile_define (uint8_t)
+transpose_tile_define (uint16_t)
+transpose_tile_define (uint32_t)
+transpose_tile_define (uint64_t)
+
+/**
+ * @brief Function to transpose the plane of tensor.
+ */
+typedef void (*transpose_tile_func) (const uint8_t * inptr, uint8_t * outptr,
+    gsize n0, gsize np, gsize isp, gsize os0);
 
 /**
  * @brief subrouting for tensor-tranform, "transpose" case.
+ * @details The dimensions of size 1 are removed and the dimensions adjacent in both input and output are merged.
+ *          Then common layout swaps (e.g., NHWC <-> NCHW) are reduced to 2D transpose of planes,
+ *          which are transposed in tiles to keep both read and write in cache.
  * @param[in/out] filter "this" pointer
  * @param[in] in_info input tensor info
  * @param[in] out_info output tensor info
@@ -1534,57 +2036,141 @@ gst_tensor_transform_transpose (GstTensorTransform * filter,
     GstTensorInfo * in_info, GstTensorInfo * out_info,
     const uint8_t * inptr, uint8_t * outptr)
 {
-  int i, from, to;
-  gboolean checkdim = FALSE;
-  uint32_t *fromDim = in_info->dimension;
+  const uint8_t *order = filter->data_transpose.trans_order;
+  guint rank;
   gsize type_size = gst_tensor_get_element_size (in_info->type);
-  gsize indexI, indexJ, SL, SI, SJ, SK;
+  gsize dim[NNS_TENSOR_RANK_LIMIT], in_stride[NNS_TENSOR_RANK_LIMIT];
+  gsize n[NNS_TENSOR_RANK_LIMIT], is[NNS_TENSOR_RANK_LIMIT];
+  gsize os[NNS_TENSOR_RANK_LIMIT], cnt[NNS_TENSOR_RANK_LIMIT];
+  gsize stride, in_off, out_off, n0, np = 1, isp = 0, os0 = 0;
+  guint i, k, r, q = 0;
+  transpose_tile_func tile = NULL;
   UNUSED (out_info);
 
-  for (i = 0; i < NNS_TENSOR_TRANSPOSE_RANK_LIMIT; i++) {
-    from = i;
-    to = filter->data_transpose.trans_order[i];
-    if (from != to) {
-      checkdim = TRUE;
-      break;
+  /**
+   * The option may be shorter than the rank of the tensor.
+   * trans_order keeps the outer dimensions (identity), so iterate all dimensions of the tensor.
+   */
+  rank = MAX (filter->data_transpose.rank, gst_tensor_info_get_rank (in_info));
+
+  /* input dimensions and strides (in elements) */
+  stride = 1;
+  for (i = 0; i < rank; i++) {
+    dim[i] = in_info->dimension[i] > 0 ? in_info->dimension[i] : 1;
+    in_stride[i] = stride;
+    stride *= dim[i];
+  }
+
+  /**
+   * Reduce the dimensions in output order: skip the dimension of size 1,
+   * and merge the dimension if it follows the previous one in input.
+   * n[r]: size, is[r]: input stride, os[r]: output stride of the reduced dimension r.
+   */
+  r = 0;
+  stride = 1;
+  for (i = 0; i < rank; i++) {
+    k = order[i];
+    if (dim[k] == 1)
+      continue;
+
+    if (r > 0 && is[r - 1] * n[r - 1] == in_stride[k]) {
+      n[r - 1] *= dim[k];
+    } else {
+      n[r] = dim[k];
+      is[r] = in_stride[k];
+      os[r] = stride;
+      r++;
     }
+
+    stride *= dim[k];
   }
 
-  if (!checkdim) {
+  /* the data layout is not changed */
+  if (r <= 1) {
+    for (i = 0; i < rank; i++) {
+      if (order[i] != i)
+        break;
+    }
+
+    if (i == rank)
+      GST_WARNING_OBJECT (filter,
+          "Calling tensor_transform with high memcpy overhead WITHOUT any effects!");
+
     nns_memcpy (outptr, inptr, gst_tensor_info_get_size (in_info));
-    GST_WARNING_OBJECT (filter,
-        "Calling tensor_transform with high memcpy overhead WITHOUT any effects!");
     return GST_FLOW_OK;
   }
 
-  indexI = filter->data_transpose.trans_order[0];
-  indexJ = filter->data_transpose.trans_order[1];
-  SL = fromDim[3] > 0 ? fromDim[3] : 1;
-  SI = fromDim[0] > 0 ? fromDim[0] : 1;
-  SJ = fromDim[1] > 0 ? fromDim[1] : 1;
-  SK = fromDim[2] > 0 ? fromDim[2] : 1;
-
-  switch (indexI) {
-    case 0:
-      if (indexJ == 1) {
-        transposeloop (l, i, j, k, SL, SI, SJ, SK, type_size);
-      } else {
-        transposeloop (l, i, k, j, SL, SI, SK, SJ, type_size);
-      }
-      break;
-    case 1:
-      if (indexJ == 0) {
-        transposeloop (l, j, i, k, SL, SJ, SI, SK, type_size);
-      } else {
-        transposeloop (l, j, k, i, SL, SJ, SK, SI, type_size);
-      }
-      break;
-    case 2:
-      if (indexJ == 0) {
-        transposeloop (l, k, i, j, SL, SK, SI, SJ, type_size);
-      } else {
-        transposeloop (l, k, j, i, SL, SK, SJ, SI, type_size);
-      }
+  /**
+   * The reduced dimension q is contiguous in input.
+   * If q is not the first one, transpose the plane (q, 0) in tiles.
+   * Otherwise, copy the contiguous block of the first dimension.
+   */
+  for (i = 0; i < r; i++) {
+    if (is[i] == 1)
+      q = i;
+  }
+
+  n0 = n[q];
+  if (q > 0) {
+    np = n[0];
+    isp = is[0];
+    os0 = os[q];
+
+    switch (type_size) {
+      case 1:
+        tile = transpose_tile_uint8_t;
+        break;
+      case 2:
+        tile = transpose_tile_uint16_t;
+        break;
+      case 4:
+        tile = transpose_tile_uint32_t;
+        break;
+      case 8:
+        tile = transpose_tile_uint64_t;
+        break;
+      default:
+        GST_ERROR_OBJECT (filter,
+            "Unsupported element size %" G_GSIZE_FORMAT, type_size);
+        return GST_FLOW_ERROR;
+    }
+  }
+
+  /* remove the dimensions of the plane, other dimensions are iterated in output order. */
+  for (i = 0, k = 0; i < r; i++) {
+    if (i == q || i == 0)
+      continue;
+
+    n[k] = n[i];
+    is[k] = is[i];
+    os[k] = os[i];
+    cnt[k] = 0;
+    k++;
+  }
+  r = k;
+
+  in_off = out_off = 0;
+  while (TRUE) {
+    if (tile) {
+      tile (inptr + in_off * type_size, outptr + out_off * type_size,
+          n0, np, isp, os0);
+    } else {
+      nns_memcpy (outptr + out_off * type_size, inptr + in_off * type_size,
+          n0 * type_size);
+    }
+
+    for (k = 0; k < r; k++) {
+      in_off += is[k];
+      out_off += os[k];
+      if (++cnt[k] < n[k])
+        break;
+
+      in_off -= is[k] * n[k];
+      out_off -= os[k] * n[k];
+      cnt[k] = 0;
+    }
+
+    if (k == r)
       break;
   }
 
@@ -1618,6 +2204,18 @@ gst_tensor_transform_stand (GstTensorTransform * filter,
   data_size = gst_tensor_info_get_size (in_info);
   ch_size = in_info->dimension[0];
 
+  /* standardize the whole tensor to float32 with SIMD kernels */
+  if (!filter->data_stand.per_channel && out_info->type == _NNS_FLOAT32) {
+    gdouble simd_avg, simd_std;
+
+    if (gst_tensor_simd_average_std (inptr, in_info->type, num, &simd_avg,
+            &simd_std) &&
+        gst_tensor_simd_stand_f32 (inptr, in_info->type, (gfloat *) outptr,
+            num, simd_avg, (filter->data_stand.mode == STAND_DEFAULT) ?
+            &simd_std : NULL))
+      return GST_FLOW_OK;
+  }
+
   /* calc average and std */
   average = std = NULL;
   if (filter->data_stand.per_channel) {
@@ -1734,6 +2332,12 @@ gst_tensor_transform_clamp (GstTensorTransform * filter,
   out_element_size = gst_tensor_get_element_size (out_info->type);
   num = gst_tensor_get_element_count (in_info->dimension);
 
+  if (in_info->type == _NNS_FLOAT32 && out_info->type == _NNS_FLOAT32 &&
+      gst_tensor_simd_clamp_f32 ((const gfloat *) inptr, (gfloat *) outptr,
+          num, (gfloat) filter->data_clamp.min,
+          (gfloat) filter->data_clamp.max))
+    return GST_FLOW_OK;
+
   for (i = 0; i < num; ++i) {
     data_idx = in_element_size * i;
     gst_tensor_data_raw_typecast ((gpointer) (inptr + data_idx), in_info->type,
@@ -1828,6 +2432,7 @@ gst_tensor_transform_transform (GstBaseTransform * trans,
   GstTensorMetaInfo meta;
   GstTensorInfo in_flex_info, out_flex_info;
   gboolean in_flexible, out_flexible;
+  gint64 start_time = g_get_monotonic_time ();
 
   filter = GST_TENSOR_TRANSFORM_CAST (trans);
 
@@ -1964,6 +2569,12 @@ done:
       gst_memory_unmap (out_mem[i], &out_map[i]);
   }
 
+  if (res == GST_FLOW_OK) {
+    gst_tensor_metrics_record (filter->metrics, -1,
+        g_get_monotonic_time () - start_time, gst_buffer_get_size (inbuf),
+        gst_buffer_get_size (outbuf));
+  }
+
   return res;
 }
 
@@ -2076,12 +2687,12 @@ gst_tensor_transform_convert_dimension (GstTensorTransform * filter,
 
     case GTT_TRANSPOSE:
       if (direction == GST_PAD_SINK) {
-        for (i = 0; i < NNS_TENSOR_TRANSPOSE_RANK_LIMIT; i++) {
+        for (i = 0; i < filter->data_transpose.rank; i++) {
           out_info->dimension[i] =
               in_info->dimension[filter->data_transpose.trans_order[i]];
         }
       } else {
-        for (i = 0; i < NNS_TENSOR_TRANSPOSE_RANK_LIMIT; i++) {
+        for (i = 0; i < filter->data_transpose.rank; i++) {
           g_assert (filter->data_transpose.trans_order[i] <
               NNS_TENSOR_RANK_LIMIT);
           out_info->dimension[filter->data_transpose.trans_order[i]] =
@@ -36,6 +36,7 @@
 #include <gst/base/gstbasetransform.h>
 #include <tensor_common.h>
 #include <tensor_data.h>
+#include "tensor_metrics.h"
 
 G_BEGIN_DECLS
 
@@ -134,6 +135,7 @@ typedef struct _tensor_transform_arithmetic {
  */
 typedef struct _tensor_transform_transpose {
   uint8_t trans_order[NNS_TENSOR_RANK_LIMIT];
+  guint rank; /**< The number of dimensions in trans_order, other dimensions are not changed. */
 } tensor_transform_transpose;
 
 /**
@@ -182,10 +184,13 @@ struct _GstTensorTransform
   gboolean loaded; /**< TRUE if mode & option are loaded */
   gboolean acceleration; /**< TRUE to set orc acceleration */
   GSList *operators; /**< operators list */
+  tensor_transform_operator_s *fused_ops; /**< arithmetic operators compiled for single-pass kernel, NULL if the operators cannot be fused */
+  guint num_fused_ops; /**< the number of fused operators */
 
   GstTensorsConfig in_config; /**< input tensors config */
   GstTensorsConfig out_config; /**< output tensors config */
   GList *apply; /**< Select the tensors to apply transformation */
+  GstTensorMetrics *metrics; /**< Latency histograms and bytes of the transform */
 };
 
 /**
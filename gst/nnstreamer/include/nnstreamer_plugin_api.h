@@ -83,6 +83,36 @@ gst_tensors_caps_from_config (const GstTensorsConfig * config);
 extern void
 gst_tensor_alloc_init (gsize alignment);
 
+/**
+ * @brief Create new buffer pool of pre-allocated tensor memories.
+ * @param info tensors info of the buffer
+ * @param flexible TRUE to append the header of flexible tensor to each memory
+ * @return Newly created buffer pool (Caller should release it using gst_object_unref()). NULL if the info is invalid or the number of tensors exceeds NNS_TENSOR_MEMORY_MAX.
+ */
+extern GstBufferPool *
+gst_tensor_buffer_pool_new (const GstTensorsInfo * info, gboolean flexible);
+
+/**
+ * @brief Create new buffer pool of a buffer wrapping the given tensor memories.
+ * @param info tensors info of the buffer
+ * @param memory the array of tensor memories (e.g., the input tensors allocated by nnfw). The memories should be valid until the notify is called.
+ * @param notify called when the pool and all buffers wrapping the given memories are released (NULL to ignore)
+ * @param user_data user data of the notify
+ * @return Newly created buffer pool (Caller should release it using gst_object_unref()). NULL if the info is invalid or the memory is smaller than the tensor.
+ * @note Only one buffer wraps the given memories at a time, and upstream writes the data into them. If that buffer is in use, the pool allocates new memories for other buffers.
+ */
+extern GstBufferPool *
+gst_tensor_buffer_pool_new_wrapped (const GstTensorsInfo * info,
+    const GstTensorMemory * memory, GDestroyNotify notify, gpointer user_data);
+
+/**
+ * @brief Get the metrics (latency percentiles, bytes in and out) of all running nnstreamer elements.
+ * @return Newly allocated string in Prometheus text format. Caller should free the value.
+ * @note The metrics is disabled by default. Set the configuration [metrics] enable to TRUE to record it.
+ */
+extern gchar *
+gst_tensor_metrics_to_text (void);
+
 /**
  * @brief Parse memory and fill the tensor meta.
  * @param[out] meta tensor meta structure to be filled
@@ -165,6 +165,7 @@ typedef struct _GstTensorFilterFrameworkInfo
   accl_hw accl_auto;  /**< accelerator to be used in auto mode (acceleration to be used but accelerator is not specified for the filter) - default -1 implies use first entry from hw_list. */
   accl_hw accl_default;   /**< accelerator to be used by default (valid user input is not provided) - default -1 implies use first entry from hw_list. */
   const GstTensorFilterFrameworkStatistics *statistics;  /**< usage statistics by the framework. This is shared across all opened instances of this framework. */
+  int zero_copy_input; /**< TRUE(nonzero) if the framework provides its input tensors with the event GET_INPUT_MEMORY, so that upstream may write the input data into the framework without copy. Available with V1 only. Do not change this value after cap negotiation is complete (or the stream has been started). */
 } GstTensorFilterFrameworkInfo;
 
 /**
@@ -181,6 +182,7 @@ typedef enum
   SET_OUTPUT_PROP,  /**< Update output tensor info and layout */
   SET_ACCELERATOR,  /**< Update accelerator of the subplugin to be used as backend */
   CHECK_HW_AVAILABILITY, /**< Check the hw availability with custom option */
+  GET_INPUT_MEMORY, /**< Get the input tensors allocated by the framework */
 } event_ops;
 
 /**
@@ -232,6 +234,11 @@ typedef struct _GstTensorFilterFrameworkEventData
       accl_hw hw; /**< accelerator to check availability */
       const char *custom; /**< custom option for hardware detection */
     };
+
+    /** for GET_INPUT_MEMORY event */
+    struct {
+      GstTensorMemory *input_memory; /**< [out] The array of input tensors (data and size) allocated by the framework */
+    };
   };
 } GstTensorFilterFrameworkEventData;
 
@@ -450,6 +457,7 @@ struct _GstTensorFilterFramework
        * If ops == SET_INPUT_PROP: Tensor-filter will call to update the property of the subplugin. This function will take tensor info and layout as the argument. This operation can update input tensor shape, type, name and layout.
        * If ops == SET_OUTPUT_PROP: Tensor-filter will call to update the property of the subplugin. This function will take tensor info and layout as the argument. This operation can update output tensor shape, type, name and layout.
        * If ops == SET_ACCELERATOR: Tensor-filter will call to update the property of the subplugin. This function will take accelerator list as the argument. This operation will update the backend to be used by the corresponding subplugin.
+       * If ops == GET_INPUT_MEMORY: Tensor-filter will call it after cap negotiation when 'zero_copy_input' of the framework info is TRUE. The subplugin fills the data and size of each input tensor which invoke reads. Tensor-filter proposes a buffer pool wrapping these memories to upstream, thus the input pointer of invoke may be the same as the given memory; then the subplugin should skip copying the input. Upstream may write the next frame into these memories while invoke reads other input, thus the subplugin should not copy other input into them. The memories should be valid and not be moved until the framework is closed or the input info is changed. Tensor-filter closes the framework after upstream releases all buffers wrapping these memories, and allocates other buffers while the memories are in use. If it returns -ENOENT, tensor-filter proposes a buffer pool of aligned memories instead.
        * List of operations to be supported are optional.
        * Note: In these operations, the argument 'prop' will not contain the updated information, but will be updated after the corresponding operation is succeeded.
        *
@@ -283,6 +283,11 @@ gst_tensors_config_to_string (const GstTensorsConfig * config);
  */
 #define gst_tensors_config_is_sparse(c) ((c)->info.format == _NNS_TENSOR_FORMAT_SPARSE)
 
+/**
+ * @brief Macro to check stream format (compressed tensors for caps negotiation)
+ */
+#define gst_tensors_config_is_compressed(c) ((c)->info.format == _NNS_TENSOR_FORMAT_COMPRESSED)
+
 /**
  * @brief Check the tensor dimension is valid
  * @param dim tensor dimension
@@ -461,6 +466,66 @@ gst_tensor_meta_info_update_header (GstTensorMetaInfo * meta, gpointer header);
 extern gboolean
 gst_tensor_meta_info_parse_header (GstTensorMetaInfo * meta, gpointer header);
 
+/**
+ * @brief Set the sparse encoding to tensor meta.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] sparse parameters of sparse encoding
+ * @return TRUE if successfully set the sparse encoding
+ * @note COO encoding is kept in tensor meta version 1. Other encodings set tensor meta version 2 and the data size.
+ */
+extern gboolean
+gst_tensor_meta_info_set_sparse (GstTensorMetaInfo * meta, const GstSparseTensorEncodingInfo * sparse);
+
+/**
+ * @brief Update header from tensor meta and the parameters of sparse encoding.
+ * @param[in] meta tensor meta structure (see gst_tensor_meta_info_set_sparse())
+ * @param[in] sparse parameters of sparse encoding
+ * @param[out] header pointer to header to be updated
+ * @return TRUE if successfully set the header
+ */
+extern gboolean
+gst_tensor_meta_info_update_sparse_header (GstTensorMetaInfo * meta, const GstSparseTensorEncodingInfo * sparse, gpointer header);
+
+/**
+ * @brief Parse header and fill the tensor meta and the parameters of sparse encoding.
+ * @param[out] meta tensor meta structure to be filled
+ * @param[out] sparse parameters of sparse encoding to be filled
+ * @param[in] header pointer to header to be parsed
+ * @return TRUE if successfully set the meta and sparse encoding
+ */
+extern gboolean
+gst_tensor_meta_info_parse_sparse_header (GstTensorMetaInfo * meta, GstSparseTensorEncodingInfo * sparse, gpointer header);
+
+/**
+ * @brief Set the parameters of compressed data to tensor meta.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] compressed parameters of compressed data
+ * @return TRUE if successfully set the compressed data
+ * @note Compressed data is written with tensor meta version 2, the meta keeps the size of compressed data.
+ */
+extern gboolean
+gst_tensor_meta_info_set_compressed (GstTensorMetaInfo * meta, const GstCompressedTensorInfo * compressed);
+
+/**
+ * @brief Update header from tensor meta and the parameters of compressed data.
+ * @param[in] meta tensor meta structure (see gst_tensor_meta_info_set_compressed())
+ * @param[in] compressed parameters of compressed data
+ * @param[out] header pointer to header to be updated
+ * @return TRUE if successfully set the header
+ */
+extern gboolean
+gst_tensor_meta_info_update_compressed_header (GstTensorMetaInfo * meta, const GstCompressedTensorInfo * compressed, gpointer header);
+
+/**
+ * @brief Parse header and fill the tensor meta and the parameters of compressed data.
+ * @param[out] meta tensor meta structure to be filled
+ * @param[out] compressed parameters of compressed data to be filled
+ * @param[in] header pointer to header to be parsed
+ * @return TRUE if successfully set the meta and compressed data
+ */
+extern gboolean
+gst_tensor_meta_info_parse_compressed_header (GstTensorMetaInfo * meta, GstCompressedTensorInfo * compressed, gpointer header);
+
 /**
  * @brief Convert GstTensorMetaInfo structure to GstTensorInfo.
  * @param[in] meta tensor meta structure to be converted
@@ -70,7 +70,7 @@
 /**
  * @brief Possible tensor formats
  */
-#define GST_TENSOR_FORMAT_ALL "{ static, flexible, sparse }"
+#define GST_TENSOR_FORMAT_ALL "{ static, flexible, sparse, compressed }"
 
 /**
  * @brief Default static capability for other/tensor
@@ -131,6 +131,14 @@
 #define GST_TENSORS_SPARSE_CAP_DEFAULT \
     GST_TENSORS_CAP_MAKE ("sparse")
 
+/**
+ * @brief Caps string for the caps template of compressed tensors.
+ * This mimetype handles non-static, compressed tensor stream without specifying the data type and shape of the tensor.
+ * The maximum number of tensors in a buffer is 16 (NNS_TENSOR_SIZE_LIMIT).
+ */
+#define GST_TENSORS_COMPRESSED_CAP_DEFAULT \
+    GST_TENSORS_CAP_MAKE ("compressed")
+
 /**
  * @brief Possible data element types of other/tensor.
  * @note When changing tensor type, you should update related type in ML-API and protobuf/flatbuf schema also.
@@ -195,6 +203,7 @@ typedef enum _tensor_format
   _NNS_TENSOR_FORMAT_STATIC = 0,
   _NNS_TENSOR_FORMAT_FLEXIBLE,
   _NNS_TENSOR_FORMAT_SPARSE,
+  _NNS_TENSOR_FORMAT_COMPRESSED,
 
   _NNS_TENSOR_FORMAT_END
 } tensor_format;
@@ -296,6 +305,80 @@ typedef struct
   uint32_t nnz; /**< the number of "non-zero" elements */
 } GstSparseTensorInfo;
 
+/**
+ * @brief Encoding of sparse tensor data.
+ * COO is the layout of tensor meta version 1. Bitmap and block encodings need tensor meta version 2.
+ */
+typedef enum _tensor_sparse_encoding
+{
+  _NNS_SPARSE_COO = 0, /**< values of non-zero elements followed by their flat indices (uint32) */
+  _NNS_SPARSE_BITMAP, /**< bitmap of non-zero elements (uint64 words) followed by the values */
+  _NNS_SPARSE_BLOCK, /**< indices of non-zero blocks (uint32) followed by the values of the blocks */
+
+  _NNS_SPARSE_END
+} tensor_sparse_encoding;
+
+/**
+ * @brief Parameters of sparse encoding.
+ * With tensor meta version 2, these are kept in the reserved words of the header, not in GstTensorMetaInfo.
+ */
+typedef struct
+{
+  uint32_t encoding; /**< the encoding of sparse data (tensor_sparse_encoding) */
+  uint32_t nnz; /**< the number of "non-zero" elements */
+  uint32_t block_size; /**< the number of elements in a block (block encoding) */
+  uint32_t num_blocks; /**< the number of non-zero blocks (block encoding) */
+} GstSparseTensorEncodingInfo;
+
+/**
+ * @brief Compression method of compressed tensor data.
+ */
+typedef enum _tensor_codec
+{
+  _NNS_CODEC_NONE = 0, /**< stored without compression */
+  _NNS_CODEC_LZ, /**< byte-oriented LZ77 compression (literal runs and 16-bit back-references) */
+
+  _NNS_CODEC_END
+} tensor_codec;
+
+/**
+ * @brief Filter applied to the elements before compression.
+ */
+typedef enum _tensor_codec_filter
+{
+  _NNS_CODEC_FILTER_NONE = 0, /**< elements are compressed as they are */
+  _NNS_CODEC_FILTER_SHUFFLE, /**< bytes of the elements are grouped by their significance */
+  _NNS_CODEC_FILTER_DELTA, /**< difference from the previous element, then byte-shuffle */
+
+  _NNS_CODEC_FILTER_END
+} tensor_codec_filter;
+
+/**
+ * @brief Quantization of floating point elements before compression (lossy).
+ */
+typedef enum _tensor_codec_quant
+{
+  _NNS_CODEC_QUANT_NONE = 0, /**< lossless */
+  _NNS_CODEC_QUANT_FLOAT16, /**< elements are stored in IEEE half precision */
+  _NNS_CODEC_QUANT_INT8, /**< elements are stored in 8-bit with scale and zero point (min) */
+
+  _NNS_CODEC_QUANT_END
+} tensor_codec_quant;
+
+/**
+ * @brief Parameters of compressed tensor data.
+ * Compressed tensors are written with tensor meta version 2, these are kept in the reserved words of the header, not in GstTensorMetaInfo.
+ */
+typedef struct
+{
+  uint32_t codec; /**< the compression method (tensor_codec) */
+  uint32_t filter; /**< the filter applied before compression (tensor_codec_filter) */
+  uint32_t quant; /**< the quantization of elements (tensor_codec_quant) */
+  uint32_t size; /**< the size of compressed data in bytes */
+  float scale; /**< the scale of quantized elements (int8 quantization) */
+  float zero_point; /**< the value of quantized zero (int8 quantization) */
+} GstCompressedTensorInfo;
+
 /**
  * @brief Data structure to describe a tensor data.
  * This represents the basic information of a memory block for tensor stream.
@@ -306,6 +389,9 @@ typedef struct
  * - dimension: The dimension of tensor. This also denotes the rank of tensor. (e.g., [3:224:224:0] means rank 3.)
  * - format: The data format in the tensor. This should be a value of enumeration tensor_format.
  * - media_type: The media type of tensor. This should be a value of enumeration media_type.
+ *
+ * The size of this structure is a part of the API, subplugins allocate it. Do not add fields.
+ * The header of tensor meta version 2 keeps the parameters of the format in the reserved words, and the union holds the data size.
  */
 typedef struct
 {
@@ -321,6 +407,7 @@ typedef struct
    */
   union {
     GstSparseTensorInfo sparse_info;
+    uint32_t data_size; /**< the size of data in bytes (tensor meta version 2) */
   };
 
 } GstTensorMetaInfo;
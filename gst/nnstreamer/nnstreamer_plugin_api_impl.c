@@ -1586,7 +1586,7 @@ GstMemory *
 gst_tensor_buffer_get_nth_memory (GstBuffer * buffer, const guint index)
 {
   guint i, num_tensors;
-  gsize offset;
+  gsize offset, size;
   GstMemory *extra_tensors_memory, *res_mem = NULL;
   GstMapInfo extra_tensors_map;
   GstTensorExtraInfo *extra_info;
@@ -1633,22 +1633,23 @@ gst_tensor_buffer_get_nth_memory (GstBuffer * buffer, const guint index)
 
   /* If index is NNS_TENSOR_MEMORY_MAX - 1 */
   if (index == NNS_TENSOR_MEMORY_MAX - 1) {
-    res_mem =
-        gst_memory_share (extra_tensors_memory, offset, extra_info->reserved);
-    goto done;
-  }
+    size = extra_info->reserved;
+  } else {
+    offset += extra_info->reserved;
 
-  offset += extra_info->reserved;
+    for (i = 1; i <= index - NNS_TENSOR_MEMORY_MAX; ++i) {
+      offset += gst_tensor_info_get_size (&extra_info->infos[i - 1]);
+    }
 
-  for (i = 1; i <= index - NNS_TENSOR_MEMORY_MAX; ++i) {
-    offset += gst_tensor_info_get_size (&extra_info->infos[i - 1]);
+    size = gst_tensor_info_get_size (&extra_info->infos[index -
+            NNS_TENSOR_MEMORY_MAX]);
   }
 
-  /* wrap it as GstMemory */
-  res_mem =
-      gst_memory_share (extra_tensors_memory, offset,
-      gst_tensor_info_get_size (&extra_info->infos[index -
-              NNS_TENSOR_MEMORY_MAX]));
+  /* wrap it as GstMemory, sub-memory shares the data without copy. */
+  if (GST_MEMORY_FLAG_IS_SET (extra_tensors_memory, GST_MEMORY_FLAG_NO_SHARE))
+    res_mem = gst_memory_copy (extra_tensors_memory, offset, size);
+  else
+    res_mem = gst_memory_share (extra_tensors_memory, offset, size);
 
 done:
   gst_memory_unmap (extra_tensors_memory, &extra_tensors_map);
@@ -1668,11 +1669,12 @@ gst_tensor_buffer_append_memory (GstBuffer * buffer, GstMemory * memory,
 {
   guint num_mems, new_mem_index;
   GstMemory *new_memory = NULL, *last_memory = NULL;
-  gsize offset, new_mem_size, last_mem_size;
+  gsize offset, new_mem_size, last_mem_size, last_offset, last_maxsize;
+  gsize incoming_size, capacity;
   GstMapInfo new_memory_map, last_memory_map, incoming_memory_map;
   GstTensorExtraInfo *extra_info;
   GstTensorMetaInfo meta;
-  gboolean is_extra, is_static;
+  gboolean is_extra, is_static, in_place;
   gboolean appended = FALSE;
 
   if (!GST_IS_BUFFER (buffer)) {
@@ -1719,7 +1721,10 @@ gst_tensor_buffer_append_memory (GstBuffer * buffer, GstMemory * memory,
     goto failed;
   }
 
-  new_mem_size = last_mem_size = gst_memory_get_sizes (last_memory, NULL, NULL);
+  last_mem_size = gst_memory_get_sizes (last_memory, &last_offset,
+      &last_maxsize);
+  incoming_size = gst_memory_get_sizes (memory, NULL, NULL);
+  new_mem_size = last_mem_size + incoming_size;
 
   /* if the memory does not have proper header, append it */
   is_extra = gst_memory_map_is_extra_tensor (&last_memory_map);
@@ -1727,39 +1732,75 @@ gst_tensor_buffer_append_memory (GstBuffer * buffer, GstMemory * memory,
     new_mem_size += sizeof (GstTensorExtraInfo);
   }
 
-  new_mem_size += gst_memory_get_sizes (memory, NULL, NULL);
-
-  new_memory = gst_allocator_alloc (NULL, new_mem_size, NULL);
-  if (!new_memory) {
-    nns_loge ("Failed to allocate memory for extra tensors.");
-    goto failed;
-  }
-
-  if (!gst_memory_map (new_memory, &new_memory_map, GST_MAP_WRITE)) {
-    nns_loge ("Failed to map extra memory");
-    gst_memory_unref (new_memory);
-    new_memory = NULL;
-    goto failed;
-  }
+  /**
+   * The extra memory is allocated with spare capacity.
+   * If the buffer owns it exclusively, the incoming tensor is appended in place
+   * and only the incoming data is copied (amortized O(1) for each tensor).
+   */
+  in_place = (is_extra && gst_buffer_is_writable (buffer) &&
+      gst_memory_is_writable (last_memory) &&
+      last_maxsize - last_offset >= new_mem_size);
 
   if (!gst_memory_map (memory, &incoming_memory_map, GST_MAP_READ)) {
     nns_loge ("Failed to map incoming memory");
     goto failed;
   }
 
-  extra_info = (GstTensorExtraInfo *) new_memory_map.data;
+  if (in_place) {
+    gst_memory_unmap (last_memory, &last_memory_map);
 
-  /* if the last_memory does not have proper header, append it */
-  if (!is_extra) {
-    gst_tensor_extra_info_init (extra_info, last_mem_size);
-    offset = sizeof (GstTensorExtraInfo);
+    new_memory = last_memory;
+    last_memory = NULL;
+
+    gst_memory_resize (new_memory, 0, new_mem_size);
+    if (!gst_memory_map (new_memory, &new_memory_map, GST_MAP_WRITE)) {
+      nns_loge ("Failed to map extra memory");
+      gst_memory_resize (new_memory, 0, new_mem_size - incoming_size);
+      new_memory = NULL;
+      gst_memory_unmap (memory, &incoming_memory_map);
+      goto failed;
+    }
+
+    extra_info = (GstTensorExtraInfo *) new_memory_map.data;
+    offset = last_mem_size;
   } else {
-    offset = 0;
-  }
+    /* Grow the capacity geometrically when the extra memory is reallocated. */
+    capacity = is_extra ? new_mem_size + new_mem_size / 2 : new_mem_size;
+
+    new_memory = gst_allocator_alloc (NULL, capacity, NULL);
+    if (!new_memory) {
+      nns_loge ("Failed to allocate memory for extra tensors.");
+      gst_memory_unmap (memory, &incoming_memory_map);
+      goto failed;
+    }
+
+    gst_memory_resize (new_memory, 0, new_mem_size);
+    if (!gst_memory_map (new_memory, &new_memory_map, GST_MAP_WRITE)) {
+      nns_loge ("Failed to map extra memory");
+      gst_memory_unref (new_memory);
+      new_memory = NULL;
+      gst_memory_unmap (memory, &incoming_memory_map);
+      goto failed;
+    }
+
+    extra_info = (GstTensorExtraInfo *) new_memory_map.data;
 
-  /* copy last_memory into new_memory */
-  memcpy (new_memory_map.data + offset, last_memory_map.data,
-      last_memory_map.size);
+    /* if the last_memory does not have proper header, append it */
+    if (!is_extra) {
+      gst_tensor_extra_info_init (extra_info, last_mem_size);
+      offset = sizeof (GstTensorExtraInfo);
+    } else {
+      offset = 0;
+    }
+
+    /* copy last_memory into new_memory */
+    memcpy (new_memory_map.data + offset, last_memory_map.data,
+        last_memory_map.size);
+    offset += last_memory_map.size;
+
+    gst_memory_unmap (last_memory, &last_memory_map);
+    last_memory = NULL;
+  }
 
   /* copy incoming_memory into new_memory */
   new_mem_index = extra_info->num_extra_tensors;
@@ -1779,22 +1820,20 @@ gst_tensor_buffer_append_memory (GstBuffer * buffer, GstMemory * memory,
     gst_tensor_meta_info_convert (&meta, &extra_info->infos[new_mem_index]);
   }
 
-  memcpy (new_memory_map.data + offset + last_memory_map.size,
-      incoming_memory_map.data, incoming_memory_map.size);
+  memcpy (new_memory_map.data + offset, incoming_memory_map.data,
+      incoming_memory_map.size);
 
   gst_memory_unmap (memory, &incoming_memory_map);
-  gst_memory_unmap (last_memory, &last_memory_map);
-  last_memory = NULL;
+  gst_memory_unmap (new_memory, &new_memory_map);
 
-  gst_buffer_replace_memory (buffer, num_mems - 1, new_memory);
+  if (!in_place)
+    gst_buffer_replace_memory (buffer, num_mems - 1, new_memory);
+  new_memory = NULL;
   appended = TRUE;
 
 failed:
-  if (new_memory) {
-    gst_memory_unmap (new_memory, &new_memory_map);
-    if (!appended)
-      gst_memory_unref (new_memory);
-  }
+  if (new_memory)
+    gst_memory_unref (new_memory);
 
   if (last_memory)
     gst_memory_unmap (last_memory, &last_memory_map);
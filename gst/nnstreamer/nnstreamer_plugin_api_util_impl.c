@@ -57,6 +57,7 @@ static const gchar *tensor_format_name[] = {
   [_NNS_TENSOR_FORMAT_STATIC] = "static",
   [_NNS_TENSOR_FORMAT_FLEXIBLE] = "flexible",
   [_NNS_TENSOR_FORMAT_SPARSE] = "sparse",
+  [_NNS_TENSOR_FORMAT_COMPRESSED] = "compressed",
   [_NNS_TENSOR_FORMAT_END] = NULL
 };
 
@@ -1345,11 +1346,27 @@ gst_tensor_get_format_string (tensor_format format)
  */
 #define GST_TENSOR_META_VERSION GST_TENSOR_META_MAKE_VERSION(1,0)
 
+/**
+ * @brief The version of tensor meta with the parameters of the format in the reserved words of the header.
+ * The older versions of NNStreamer cannot parse this header.
+ */
+#define GST_TENSOR_META_VERSION_2 GST_TENSOR_META_MAKE_VERSION(2,0)
+
 /**
  * @brief Macro to check the version of tensor meta.
  */
 #define GST_TENSOR_META_IS_V1(v) (GST_TENSOR_META_VERSION_VALID(v) && (((v) & 0x00FFF000) & GST_TENSOR_META_MAKE_VERSION(1,0)))
 
+/**
+ * @brief Macro to check the version 2 of tensor meta.
+ */
+#define GST_TENSOR_META_IS_V2(v) (GST_TENSOR_META_VERSION_VALID(v) && (((v) & 0x00FFF000) == (2 << 12)))
+
+/**
+ * @brief Index of the first reserved word in the header (after the fields of GstTensorMetaInfo).
+ */
+#define GST_TENSOR_META_RESERVED_WORD (22)
+
 /**
  * @brief Macro to check the meta is valid.
  */
@@ -1435,6 +1452,12 @@ gst_tensor_meta_info_validate (GstTensorMetaInfo * meta)
     return FALSE;
   }
 
+  if (meta->format == _NNS_TENSOR_FORMAT_COMPRESSED &&
+      !GST_TENSOR_META_IS_V2 (meta->version)) {
+    nns_logd ("Failed to validate tensor meta info. compressed tensor with meta version 1.");
+    return FALSE;
+  }
+
   return TRUE;
 }
 
@@ -1452,7 +1475,8 @@ gst_tensor_meta_info_get_header_size (GstTensorMetaInfo * meta)
     return 0;
 
   /* return fixed size for meta version */
-  if (GST_TENSOR_META_IS_V1 (meta->version)) {
+  if (GST_TENSOR_META_IS_V1 (meta->version) ||
+      GST_TENSOR_META_IS_V2 (meta->version)) {
     return 128;
   }
 
@@ -1474,9 +1498,17 @@ gst_tensor_meta_info_get_data_size (GstTensorMetaInfo * meta)
   if (!GST_TENSOR_META_IS_VALID (meta))
     return 0;
 
+  /* the parameters of compressed data are in the header */
+  if (meta->format == _NNS_TENSOR_FORMAT_COMPRESSED)
+    return meta->data_size;
+
   dsize = gst_tensor_get_element_size (meta->type);
 
   if (meta->format == _NNS_TENSOR_FORMAT_SPARSE) {
+    /* the parameters of bitmap and block encodings are in the header */
+    if (GST_TENSOR_META_IS_V2 (meta->version))
+      return meta->data_size;
+
     return meta->sparse_info.nnz * (dsize + sizeof (guint));
   }
 
@@ -1535,6 +1567,9 @@ gst_tensor_meta_info_parse_header (GstTensorMetaInfo * meta, gpointer header)
     case _NNS_TENSOR_FORMAT_SPARSE:
       meta->sparse_info.nnz = val[21];
       break;
+    case _NNS_TENSOR_FORMAT_COMPRESSED:
+      meta->data_size = val[21];
+      break;
     default:
       break;
   }
@@ -1543,6 +1578,275 @@ gst_tensor_meta_info_parse_header (GstTensorMetaInfo * meta, gpointer header)
   return gst_tensor_meta_info_validate (meta);
 }
 
+/**
+ * @brief Set the sparse encoding to tensor meta.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] sparse parameters of sparse encoding
+ * @return TRUE if successfully set the sparse encoding
+ * @note COO encoding is kept in tensor meta version 1. Other encodings set tensor meta version 2 and the data size.
+ */
+gboolean
+gst_tensor_meta_info_set_sparse (GstTensorMetaInfo * meta,
+    const GstSparseTensorEncodingInfo * sparse)
+{
+  gsize dsize, count, size;
+
+  g_return_val_if_fail (meta != NULL, FALSE);
+  g_return_val_if_fail (sparse != NULL, FALSE);
+
+  dsize = gst_tensor_get_element_size (meta->type);
+  count = gst_tensor_get_element_count (meta->dimension);
+
+  meta->format = _NNS_TENSOR_FORMAT_SPARSE;
+
+  switch (sparse->encoding) {
+    case _NNS_SPARSE_COO:
+      meta->version = GST_TENSOR_META_VERSION;
+      meta->sparse_info.nnz = sparse->nnz;
+      return TRUE;
+    case _NNS_SPARSE_BITMAP:
+      /* bitmap in 64-bit words, then the values */
+      size = ((count + 63) / 64) * sizeof (guint64) +
+          (gsize) sparse->nnz * dsize;
+      break;
+    case _NNS_SPARSE_BLOCK:
+      if (sparse->block_size == 0) {
+        nns_logd ("Failed to set sparse encoding, invalid block size.");
+        return FALSE;
+      }
+
+      /* index and values of a block */
+      size = sizeof (guint) + (gsize) sparse->block_size * dsize;
+      if (sparse->num_blocks > 0 && size > G_MAXUINT32 / sparse->num_blocks) {
+        nns_logd ("Failed to set sparse encoding, the data size is too large.");
+        return FALSE;
+      }
+
+      size *= sparse->num_blocks;
+      break;
+    default:
+      nns_logd ("Failed to set sparse encoding, invalid encoding: %u.",
+          sparse->encoding);
+      return FALSE;
+  }
+
+  /* the data size is kept in 32-bit */
+  if (size > G_MAXUINT32) {
+    nns_logd ("Failed to set sparse encoding, the data size is too large.");
+    return FALSE;
+  }
+
+  meta->version = GST_TENSOR_META_VERSION_2;
+  meta->data_size = (uint32_t) size;
+
+  return TRUE;
+}
+
+/**
+ * @brief Update header from tensor meta and the parameters of sparse encoding.
+ * @param[in] meta tensor meta structure (see gst_tensor_meta_info_set_sparse())
+ * @param[in] sparse parameters of sparse encoding
+ * @param[out] header pointer to header to be updated
+ * @return TRUE if successfully set the header
+ */
+gboolean
+gst_tensor_meta_info_update_sparse_header (GstTensorMetaInfo * meta,
+    const GstSparseTensorEncodingInfo * sparse, gpointer header)
+{
+  uint32_t *val = (uint32_t *) header;
+
+  g_return_val_if_fail (sparse != NULL, FALSE);
+
+  if (!gst_tensor_meta_info_update_header (meta, header))
+    return FALSE;
+
+  if (GST_TENSOR_META_IS_V2 (meta->version)) {
+    val[GST_TENSOR_META_RESERVED_WORD] = sparse->encoding;
+    val[GST_TENSOR_META_RESERVED_WORD + 1] = sparse->nnz;
+    val[GST_TENSOR_META_RESERVED_WORD + 2] = sparse->block_size;
+    val[GST_TENSOR_META_RESERVED_WORD + 3] = sparse->num_blocks;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Parse header and fill the tensor meta and the parameters of sparse encoding.
+ * @param[out] meta tensor meta structure to be filled
+ * @param[out] sparse parameters of sparse encoding to be filled
+ * @param[in] header pointer to header to be parsed
+ * @return TRUE if successfully set the meta and sparse encoding
+ */
+gboolean
+gst_tensor_meta_info_parse_sparse_header (GstTensorMetaInfo * meta,
+    GstSparseTensorEncodingInfo * sparse, gpointer header)
+{
+  uint32_t *val = (uint32_t *) header;
+  GstTensorMetaInfo expected;
+  gsize count;
+
+  g_return_val_if_fail (sparse != NULL, FALSE);
+
+  if (!gst_tensor_meta_info_parse_header (meta, header))
+    return FALSE;
+
+  if (meta->format != _NNS_TENSOR_FORMAT_SPARSE)
+    return FALSE;
+
+  memset (sparse, 0, sizeof (GstSparseTensorEncodingInfo));
+  count = gst_tensor_get_element_count (meta->dimension);
+
+  if (!GST_TENSOR_META_IS_V2 (meta->version)) {
+    sparse->encoding = _NNS_SPARSE_COO;
+    sparse->nnz = meta->sparse_info.nnz;
+
+    if (sparse->nnz > count) {
+      nns_logd ("Failed to parse sparse header, invalid nnz: %u.", sparse->nnz);
+      return FALSE;
+    }
+
+    return TRUE;
+  }
+
+  sparse->encoding = val[GST_TENSOR_META_RESERVED_WORD];
+  sparse->nnz = val[GST_TENSOR_META_RESERVED_WORD + 1];
+  sparse->block_size = val[GST_TENSOR_META_RESERVED_WORD + 2];
+  sparse->num_blocks = val[GST_TENSOR_META_RESERVED_WORD + 3];
+
+  /* the parameters should not exceed the number of elements */
+  if (sparse->nnz > count || (sparse->encoding == _NNS_SPARSE_BLOCK &&
+          sparse->block_size > 0 &&
+          sparse->num_blocks > (count + sparse->block_size - 1) /
+          sparse->block_size)) {
+    nns_logd ("Failed to parse sparse header, invalid nnz or blocks: %u/%u.",
+        sparse->nnz, sparse->num_blocks);
+    return FALSE;
+  }
+
+  /* the data size should be same with the parameters */
+  expected = *meta;
+  if (!gst_tensor_meta_info_set_sparse (&expected, sparse) ||
+      expected.version != meta->version ||
+      expected.data_size != meta->data_size) {
+    nns_logd ("Failed to parse sparse header, invalid encoding: %u.",
+        sparse->encoding);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Set the parameters of compressed data to tensor meta.
+ * @param[in,out] meta tensor meta structure to be updated
+ * @param[in] compressed parameters of compressed data
+ * @return TRUE if successfully set the compressed data
+ * @note Compressed data is written with tensor meta version 2, the meta keeps the size of compressed data.
+ */
+gboolean
+gst_tensor_meta_info_set_compressed (GstTensorMetaInfo * meta,
+    const GstCompressedTensorInfo * compressed)
+{
+  g_return_val_if_fail (meta != NULL, FALSE);
+  g_return_val_if_fail (compressed != NULL, FALSE);
+
+  if (compressed->codec >= _NNS_CODEC_END ||
+      compressed->filter >= _NNS_CODEC_FILTER_END ||
+      compressed->quant >= _NNS_CODEC_QUANT_END) {
+    nns_logd ("Failed to set compressed data, invalid codec: %u/%u/%u.",
+        compressed->codec, compressed->filter, compressed->quant);
+    return FALSE;
+  }
+
+  if (compressed->quant != _NNS_CODEC_QUANT_NONE &&
+      meta->type != _NNS_FLOAT32 && meta->type != _NNS_FLOAT64) {
+    nns_logd ("Failed to set compressed data, quantized %s tensor.",
+        _STR_NULL (gst_tensor_get_type_string (meta->type)));
+    return FALSE;
+  }
+
+  meta->version = GST_TENSOR_META_VERSION_2;
+  meta->format = _NNS_TENSOR_FORMAT_COMPRESSED;
+  meta->data_size = compressed->size;
+
+  return TRUE;
+}
+
+/**
+ * @brief Update header from tensor meta and the parameters of compressed data.
+ * @param[in] meta tensor meta structure (see gst_tensor_meta_info_set_compressed())
+ * @param[in] compressed parameters of compressed data
+ * @param[out] header pointer to header to be updated
+ * @return TRUE if successfully set the header
+ */
+gboolean
+gst_tensor_meta_info_update_compressed_header (GstTensorMetaInfo * meta,
+    const GstCompressedTensorInfo * compressed, gpointer header)
+{
+  uint32_t *val = (uint32_t *) header;
+
+  g_return_val_if_fail (compressed != NULL, FALSE);
+
+  if (!gst_tensor_meta_info_update_header (meta, header))
+    return FALSE;
+
+  if (meta->format != _NNS_TENSOR_FORMAT_COMPRESSED)
+    return FALSE;
+
+  val[GST_TENSOR_META_RESERVED_WORD] = compressed->codec;
+  val[GST_TENSOR_META_RESERVED_WORD + 1] = compressed->filter;
+  val[GST_TENSOR_META_RESERVED_WORD + 2] = compressed->quant;
+  memcpy (&val[GST_TENSOR_META_RESERVED_WORD + 3], &compressed->scale,
+      sizeof (float));
+  memcpy (&val[GST_TENSOR_META_RESERVED_WORD + 4], &compressed->zero_point,
+      sizeof (float));
+
+  return TRUE;
+}
+
+/**
+ * @brief Parse header and fill the tensor meta and the parameters of compressed data.
+ * @param[out] meta tensor meta structure to be filled
+ * @param[out] compressed parameters of compressed data to be filled
+ * @param[in] header pointer to header to be parsed
+ * @return TRUE if successfully set the meta and compressed data
+ */
+gboolean
+gst_tensor_meta_info_parse_compressed_header (GstTensorMetaInfo * meta,
+    GstCompressedTensorInfo * compressed, gpointer header)
+{
+  uint32_t *val = (uint32_t *) header;
+  GstTensorMetaInfo expected;
+
+  g_return_val_if_fail (compressed != NULL, FALSE);
+
+  if (!gst_tensor_meta_info_parse_header (meta, header))
+    return FALSE;
+
+  if (meta->format != _NNS_TENSOR_FORMAT_COMPRESSED)
+    return FALSE;
+
+  memset (compressed, 0, sizeof (GstCompressedTensorInfo));
+
+  compressed->codec = val[GST_TENSOR_META_RESERVED_WORD];
+  compressed->filter = val[GST_TENSOR_META_RESERVED_WORD + 1];
+  compressed->quant = val[GST_TENSOR_META_RESERVED_WORD + 2];
+  compressed->size = meta->data_size;
+  memcpy (&compressed->scale, &val[GST_TENSOR_META_RESERVED_WORD + 3],
+      sizeof (float));
+  memcpy (&compressed->zero_point, &val[GST_TENSOR_META_RESERVED_WORD + 4],
+      sizeof (float));
+
+  /* check the parameters with the type of tensor */
+  expected = *meta;
+  if (!gst_tensor_meta_info_set_compressed (&expected, compressed)) {
+    nns_logd ("Failed to parse compressed header, invalid parameters.");
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief Convert GstTensorMetaInfo structure to GstTensorInfo.
  * @param[in] meta tensor meta structure to be converted
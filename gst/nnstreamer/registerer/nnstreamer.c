@@ -48,6 +48,8 @@
 #include <gst/gst.h>
 
 #include <elements/gsttensor_aggregator.h>
+#include <elements/gsttensor_codecdec.h>
+#include <elements/gsttensor_codecenc.h>
 #include <elements/gsttensor_converter.h>
 #include <elements/gsttensor_crop.h>
 #include <elements/gsttensor_debug.h>
@@ -92,6 +94,8 @@ static gboolean
 gst_nnstreamer_init (GstPlugin * plugin)
 {
   NNSTREAMER_INIT (plugin, aggregator, AGGREGATOR);
+  NNSTREAMER_INIT (plugin, codec_enc, CODEC_ENC);
+  NNSTREAMER_INIT (plugin, codec_dec, CODEC_DEC);
   NNSTREAMER_INIT (plugin, converter, CONVERTER);
   NNSTREAMER_INIT (plugin, crop, CROP);
   NNSTREAMER_INIT (plugin, debug, DEBUG);
@@ -4,7 +4,7 @@
  *
  * @file    tensor_allocator.c
  * @date    12 May 2021
- * @brief   Allocator for memory alignment
+ * @brief   Allocator for memory alignment and buffer pool of tensor memories
  * @author  Junhwan Kim <jejudo.kim@samsung.com>
  * @see     http://github.com/nnstreamer/nnstreamer
  * @bug     No known bugs
@@ -12,7 +12,9 @@
  */
 
 #include <gst/gst.h>
+#include "nnstreamer_log.h"
 #include "nnstreamer_plugin_api.h"
+#include "nnstreamer_util.h"
 
 #define GST_TENSOR_ALLOCATOR "GstTensorAllocator"
 
@@ -126,3 +128,302 @@ gst_tensor_alloc_init (gsize alignment)
   }
   gst_allocator_set_default (allocator);
 }
+
+/**
+ * @brief Default alignment (64 bytes, mask for GstAllocationParams) of the memory in tensor buffer pool.
+ */
+#define GST_TENSOR_BUFFER_POOL_ALIGN (63)
+
+/**
+ * @brief Data shared by the pool and the memories wrapping the external tensor memories.
+ */
+typedef struct
+{
+  gint refcount; /**< Reference count of the pool and each wrapped memory */
+  gint in_use; /**< The number of alive memories wrapping the external memories */
+  GDestroyNotify notify; /**< Called when the pool and all wrapped memories are released */
+  gpointer user_data; /**< User data of the notify */
+} GstTensorBufferPoolWrapped;
+
+/**
+ * @brief struct for type GstTensorBufferPool
+ */
+typedef struct
+{
+  GstBufferPool parent;
+
+  GstTensorsInfo info; /**< tensors info of the buffer */
+  gboolean flexible; /**< TRUE to append the header of flexible tensor */
+  GstAllocator *allocator; /**< allocator for each tensor memory */
+  GstAllocationParams params; /**< allocation params */
+  GstTensorMemory wrapped[NNS_TENSOR_MEMORY_MAX]; /**< external memories to be wrapped (one buffer wraps them at a time) */
+  gboolean is_wrapped; /**< TRUE if the buffer wraps external memories */
+  GstTensorBufferPoolWrapped *wrapped_data; /**< Shared data to notify the release of external memories */
+} GstTensorBufferPool;
+
+/**
+ * @brief struct for class GstTensorBufferPoolClass
+ */
+typedef struct
+{
+  GstBufferPoolClass parent_class;
+} GstTensorBufferPoolClass;
+
+static GType gst_tensor_buffer_pool_get_type (void);
+G_DEFINE_TYPE (GstTensorBufferPool, gst_tensor_buffer_pool,
+    GST_TYPE_BUFFER_POOL);
+
+/**
+ * @brief Release the shared data of wrapped memories, call the notify when it is not used anymore.
+ */
+static void
+gst_tensor_buffer_pool_wrapped_unref (gpointer data)
+{
+  GstTensorBufferPoolWrapped *wrapped = (GstTensorBufferPoolWrapped *) data;
+
+  if (g_atomic_int_dec_and_test (&wrapped->refcount)) {
+    if (wrapped->notify)
+      wrapped->notify (wrapped->user_data);
+    g_free (wrapped);
+  }
+}
+
+/**
+ * @brief Called when a memory wrapping the external memory is freed.
+ */
+static void
+gst_tensor_buffer_pool_wrapped_release (gpointer data)
+{
+  GstTensorBufferPoolWrapped *wrapped = (GstTensorBufferPoolWrapped *) data;
+
+  g_atomic_int_add (&wrapped->in_use, -1);
+  gst_tensor_buffer_pool_wrapped_unref (wrapped);
+}
+
+/**
+ * @brief set the config of the pool, fetch the allocator and its params.
+ */
+static gboolean
+gst_tensor_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
+{
+  GstTensorBufferPool *self = (GstTensorBufferPool *) pool;
+  GstAllocator *allocator = NULL;
+  GstAllocationParams params;
+
+  gst_allocation_params_init (&params);
+  gst_buffer_pool_config_get_allocator (config, &allocator, &params);
+
+  if (self->allocator)
+    gst_object_unref (self->allocator);
+  self->allocator = allocator ? gst_object_ref (allocator) : NULL;
+
+  params.align = MAX (params.align,
+      MAX (gst_tensor_allocator_alignment, GST_TENSOR_BUFFER_POOL_ALIGN));
+  self->params = params;
+
+  return GST_BUFFER_POOL_CLASS (gst_tensor_buffer_pool_parent_class)->set_config
+      (pool, config);
+}
+
+/**
+ * @brief allocate new buffer with a memory block for each tensor.
+ */
+static GstFlowReturn
+gst_tensor_buffer_pool_alloc_buffer (GstBufferPool * pool, GstBuffer ** buffer,
+    GstBufferPoolAcquireParams * params)
+{
+  GstTensorBufferPool *self = (GstTensorBufferPool *) pool;
+  GstTensorInfo *_info;
+  GstTensorMetaInfo meta;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstBuffer *buf;
+  gsize size, hsize;
+  gboolean wrap = FALSE;
+  guint i;
+
+  UNUSED (params);
+  buf = gst_buffer_new ();
+
+  /**
+   * The external memories cannot be shared with other buffers.
+   * Only one buffer wraps them at a time, others allocate the memories so that upstream is not blocked.
+   */
+  if (self->is_wrapped) {
+    wrap = g_atomic_int_compare_and_exchange (&self->wrapped_data->in_use, 0,
+        (gint) self->info.num_tensors);
+  }
+
+  for (i = 0; i < self->info.num_tensors; i++) {
+    _info = gst_tensors_info_get_nth_info (&self->info, i);
+    size = gst_tensor_info_get_size (_info);
+    hsize = 0;
+
+    if (self->flexible) {
+      gst_tensor_info_convert_to_meta (_info, &meta);
+      hsize = gst_tensor_meta_info_get_header_size (&meta);
+    }
+
+    if (wrap) {
+      if (self->wrapped[i].size < size)
+        goto error;
+
+      mem = gst_memory_new_wrapped (0, self->wrapped[i].data,
+          self->wrapped[i].size, 0, size, self->wrapped_data,
+          gst_tensor_buffer_pool_wrapped_release);
+      if (mem)
+        g_atomic_int_inc (&self->wrapped_data->refcount);
+    } else {
+      mem = gst_allocator_alloc (self->allocator, size + hsize, &self->params);
+    }
+
+    if (!mem)
+      goto error;
+
+    /* the header is not changed, write it once. */
+    if (self->flexible) {
+      if (!gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+        gst_memory_unref (mem);
+        goto error;
+      }
+
+      gst_tensor_meta_info_update_header (&meta, map.data);
+      gst_memory_unmap (mem, &map);
+    }
+
+    gst_buffer_append_memory (buf, mem);
+  }
+
+  *buffer = buf;
+  return GST_FLOW_OK;
+
+error:
+  nns_loge ("Failed to allocate the memory for %u'th tensor in buffer pool.",
+      i);
+  /* the memories from i'th tensor are not wrapped */
+  if (wrap)
+    g_atomic_int_add (&self->wrapped_data->in_use,
+        -((gint) (self->info.num_tensors - i)));
+  gst_buffer_unref (buf);
+  return GST_FLOW_ERROR;
+}
+
+/**
+ * @brief finalize the pool.
+ */
+static void
+gst_tensor_buffer_pool_finalize (GObject * object)
+{
+  GstTensorBufferPool *self = (GstTensorBufferPool *) object;
+
+  gst_tensors_info_free (&self->info);
+  if (self->allocator)
+    gst_object_unref (self->allocator);
+  if (self->wrapped_data)
+    gst_tensor_buffer_pool_wrapped_unref (self->wrapped_data);
+
+  G_OBJECT_CLASS (gst_tensor_buffer_pool_parent_class)->finalize (object);
+}
+
+/**
+ * @brief class initization for GstTensorBufferPoolClass
+ */
+static void
+gst_tensor_buffer_pool_class_init (GstTensorBufferPoolClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+  GstBufferPoolClass *pool_class = (GstBufferPoolClass *) klass;
+
+  gobject_class->finalize = gst_tensor_buffer_pool_finalize;
+
+  pool_class->set_config = gst_tensor_buffer_pool_set_config;
+  pool_class->alloc_buffer = gst_tensor_buffer_pool_alloc_buffer;
+}
+
+/**
+ * @brief initialzation for GstTensorBufferPool
+ */
+static void
+gst_tensor_buffer_pool_init (GstTensorBufferPool * pool)
+{
+  gst_tensors_info_init (&pool->info);
+  pool->flexible = FALSE;
+  pool->allocator = NULL;
+  gst_allocation_params_init (&pool->params);
+  pool->is_wrapped = FALSE;
+  pool->wrapped_data = NULL;
+}
+
+/**
+ * @brief Create new buffer pool of pre-allocated tensor memories.
+ * @param info tensors info of the buffer
+ * @param flexible TRUE to append the header of flexible tensor to each memory
+ * @return Newly created buffer pool (NULL if the info is invalid or the number of tensors exceeds the memory limit of a buffer).
+ */
+GstBufferPool *
+gst_tensor_buffer_pool_new (const GstTensorsInfo * info, gboolean flexible)
+{
+  GstTensorBufferPool *pool;
+
+  g_return_val_if_fail (info != NULL, NULL);
+
+  if (info->num_tensors == 0 || info->num_tensors > NNS_TENSOR_MEMORY_MAX) {
+    nns_logw ("Cannot create tensor buffer pool with %u tensors.",
+        info->num_tensors);
+    return NULL;
+  }
+
+  pool = g_object_new (gst_tensor_buffer_pool_get_type (), NULL);
+  gst_tensors_info_copy (&pool->info, info);
+  pool->flexible = flexible;
+
+  /* clear floating flag */
+  gst_object_ref_sink (pool);
+
+  return GST_BUFFER_POOL_CAST (pool);
+}
+
+/**
+ * @brief Create new buffer pool of a buffer wrapping the given tensor memories.
+ * @param info tensors info of the buffer
+ * @param memory the array of tensor memories (e.g., the input tensors allocated by nnfw)
+ * @param notify called when the pool and all memories wrapping the given memories are released
+ * @param user_data user data of the notify
+ * @return Newly created buffer pool (NULL if the info is invalid or the memory is smaller than the tensor).
+ */
+GstBufferPool *
+gst_tensor_buffer_pool_new_wrapped (const GstTensorsInfo * info,
+    const GstTensorMemory * memory, GDestroyNotify notify, gpointer user_data)
+{
+  GstTensorBufferPool *pool;
+  GstBufferPool *bpool;
+  GstTensorInfo *_info;
+  guint i;
+
+  g_return_val_if_fail (memory != NULL, NULL);
+
+  bpool = gst_tensor_buffer_pool_new (info, FALSE);
+  if (!bpool)
+    return NULL;
+
+  pool = (GstTensorBufferPool *) bpool;
+  for (i = 0; i < pool->info.num_tensors; i++) {
+    _info = gst_tensors_info_get_nth_info (&pool->info, i);
+
+    if (!memory[i].data || memory[i].size < gst_tensor_info_get_size (_info)) {
+      nns_logw ("Cannot wrap the memory of %u'th tensor in buffer pool.", i);
+      gst_object_unref (bpool);
+      return NULL;
+    }
+
+    pool->wrapped[i] = memory[i];
+  }
+
+  pool->wrapped_data = g_new0 (GstTensorBufferPoolWrapped, 1);
+  pool->wrapped_data->refcount = 1;
+  pool->wrapped_data->notify = notify;
+  pool->wrapped_data->user_data = user_data;
+
+  pool->is_wrapped = TRUE;
+  return bpool;
+}
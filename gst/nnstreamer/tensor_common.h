@@ -236,6 +236,11 @@ gst_tensor_pad_get_format (GstPad *pad);
  */
 #define gst_tensor_pad_caps_is_sparse(p) (gst_tensor_pad_get_format (p) == _NNS_TENSOR_FORMAT_SPARSE)
 
+/**
+ * @brief Macro to check current pad caps is compressed tensor.
+ */
+#define gst_tensor_pad_caps_is_compressed(p) (gst_tensor_pad_get_format (p) == _NNS_TENSOR_FORMAT_COMPRESSED)
+
 /**
  * @brief Gets new hash table for tensor aggregation.
  * @return Newly allocated hash table, caller should release this using g_hash_table_destroy().
@@ -119,6 +119,23 @@ G_DEFINE_TYPE (GstTensorFilter, gst_tensor_filter, GST_TYPE_BASE_TRANSFORM);
  */
 #define LATENCY_REPORT_THRESHOLD 0.25
 
+/**
+ * @brief Default and max number of frames in a batch.
+ */
+#define DEFAULT_BATCH_SIZE 1
+#define MAX_BATCH_SIZE 256
+
+/**
+ * @brief Default max time (ms) to wait for a partial batch.
+ */
+#define DEFAULT_BATCH_TIMEOUT 0
+
+/**
+ * @brief Default and max number of framework instances for parallel invoke.
+ */
+#define DEFAULT_NUM_INSTANCES 1
+#define MAX_NUM_INSTANCES 64
+
 /* GObject vmethod implementations */
 static void gst_tensor_filter_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -126,6 +143,10 @@ static void gst_tensor_filter_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static void gst_tensor_filter_finalize (GObject * object);
 
+/* GstElement vmethod implementations */
+static GstStateChangeReturn gst_tensor_filter_change_state (GstElement *
+    element, GstStateChange transition);
+
 /* GstBaseTransform vmethod implementations */
 static GstFlowReturn gst_tensor_filter_transform (GstBaseTransform * trans,
     GstBuffer * inbuf, GstBuffer * outbuf);
@@ -140,12 +161,31 @@ static gboolean gst_tensor_filter_query (GstBaseTransform * trans,
 static gboolean gst_tensor_filter_transform_size (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, gsize size,
     GstCaps * othercaps, gsize * othersize);
+static gboolean gst_tensor_filter_decide_allocation (GstBaseTransform * trans,
+    GstQuery * query);
+static gboolean gst_tensor_filter_propose_allocation (GstBaseTransform *
+    trans, GstQuery * decide_query, GstQuery * query);
 static gboolean gst_tensor_filter_start (GstBaseTransform * trans);
 static gboolean gst_tensor_filter_stop (GstBaseTransform * trans);
 static gboolean gst_tensor_filter_sink_event (GstBaseTransform * trans,
     GstEvent * event);
 static gboolean gst_tensor_filter_src_event (GstBaseTransform * trans,
     GstEvent * event);
+static GstFlowReturn gst_tensor_filter_submit_input_buffer (GstBaseTransform *
+    trans, gboolean is_discont, GstBuffer * input);
+
+static void gst_tensor_filter_batch_configure (GstTensorFilter * self);
+static GstFlowReturn gst_tensor_filter_batch_flush (GstTensorFilter * self);
+static void gst_tensor_filter_batch_clear (GstTensorFilter * self);
+static void gst_tensor_filter_batch_close_fw (GstTensorFilter * self);
+static void gst_tensor_filter_batch_stop_task (GstTensorFilter * self);
+static void gst_tensor_filter_pool_configure (GstTensorFilter * self);
+static void gst_tensor_filter_pool_stop (GstTensorFilter * self);
+static void gst_tensor_filter_out_pool_release (GstTensorFilter * self,
+    gboolean deactivate);
+static void gst_tensor_filter_in_pool_release (GstTensorFilter * self,
+    gboolean deactivate);
+static void gst_tensor_filter_in_pool_close_fw (GstTensorFilter * self);
 
 /**
  * @brief initialize the tensor_filter's class
@@ -170,6 +210,33 @@ gst_tensor_filter_class_init (GstTensorFilterClass * klass)
 
   gst_tensor_filter_install_properties (gobject_class);
 
+  g_object_class_install_property (gobject_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch size",
+          "The max number of incoming frames to be stacked along the outermost "
+          "dimension and invoked at once. The framework should accept the "
+          "batched input dimension. 1 means no batching. This property is "
+          "applied when the pad caps are negotiated.",
+          1, MAX_BATCH_SIZE, DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_BATCH_TIMEOUT,
+      g_param_spec_uint ("batch-timeout", "Batch timeout",
+          "The max time (ms) to wait for a partial batch when batch-size is "
+          "larger than 1. The remaining slots are filled with zero. "
+          "0 means to wait until the batch is full.",
+          0, G_MAXUINT, DEFAULT_BATCH_TIMEOUT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_NUM_INSTANCES,
+      g_param_spec_uint ("num-instances", "Number of instances",
+          "The number of framework instances of the same model to invoke the "
+          "incoming frames in parallel. The output frames are pushed in the "
+          "input order. 1 means to invoke the model in the streaming thread. "
+          "This property is applied when the pad caps are negotiated.",
+          1, MAX_NUM_INSTANCES, DEFAULT_NUM_INSTANCES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gstelement_class->change_state =
+      GST_DEBUG_FUNCPTR (gst_tensor_filter_change_state);
+
   gst_element_class_set_details_simple (gstelement_class,
       "TensorFilter",
       "Filter/Tensor",
@@ -186,6 +253,8 @@ gst_tensor_filter_class_init (GstTensorFilterClass * klass)
 
   /* Processing units */
   trans_class->transform = GST_DEBUG_FUNCPTR (gst_tensor_filter_transform);
+  trans_class->submit_input_buffer =
+      GST_DEBUG_FUNCPTR (gst_tensor_filter_submit_input_buffer);
 
   /* Negotiation units */
   trans_class->transform_caps =
@@ -196,6 +265,10 @@ gst_tensor_filter_class_init (GstTensorFilterClass * klass)
   /* Allocation units */
   trans_class->transform_size =
       GST_DEBUG_FUNCPTR (gst_tensor_filter_transform_size);
+  trans_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_tensor_filter_decide_allocation);
+  trans_class->propose_allocation =
+      GST_DEBUG_FUNCPTR (gst_tensor_filter_propose_allocation);
 
   /* setup events */
   trans_class->sink_event = GST_DEBUG_FUNCPTR (gst_tensor_filter_sink_event);
@@ -225,6 +298,34 @@ gst_tensor_filter_init (GstTensorFilter * self)
   self->prev_ts = GST_CLOCK_TIME_NONE;
   self->throttling_delay = 0;
   self->throttling_accum = 0;
+
+  /* init batch properties */
+  memset (&self->batch, 0, sizeof (GstTensorFilterBatch));
+  self->batch.size = DEFAULT_BATCH_SIZE;
+  self->batch.timeout = DEFAULT_BATCH_TIMEOUT;
+  gst_tensors_info_init (&self->batch.in_info);
+  gst_tensors_info_init (&self->batch.out_info);
+  self->batch.pending = g_queue_new ();
+  self->batch.outputs = g_queue_new ();
+  self->batch.last_ret = GST_FLOW_OK;
+  g_mutex_init (&self->batch.lock);
+  g_cond_init (&self->batch.cond);
+
+  /* init parallel invoke properties */
+  memset (&self->pool, 0, sizeof (GstTensorFilterPool));
+  self->pool.size = DEFAULT_NUM_INSTANCES;
+  self->pool.jobs = g_async_queue_new ();
+  self->pool.results = g_queue_new ();
+  self->pool.last_ret = GST_FLOW_OK;
+  g_mutex_init (&self->pool.lock);
+  g_cond_init (&self->pool.cond);
+
+  self->out_pool = NULL;
+  self->in_pool = NULL;
+  g_mutex_init (&self->in_lock);
+  self->in_wrapped = 0;
+  self->close_pending = FALSE;
+  self->metrics = gst_tensor_metrics_new (GST_ELEMENT (self), "tensor_filter");
 }
 
 /**
@@ -239,8 +340,29 @@ gst_tensor_filter_finalize (GObject * object)
   self = GST_TENSOR_FILTER (object);
   priv = &self->priv;
 
+  gst_tensor_filter_pool_stop (self);
+  g_mutex_lock (&self->batch.lock);
+  gst_tensor_filter_batch_close_fw (self);
+  g_mutex_unlock (&self->batch.lock);
+  gst_tensor_filter_out_pool_release (self, TRUE);
+  gst_tensor_filter_in_pool_release (self, TRUE);
   gst_tensor_filter_common_close_fw (priv);
   gst_tensor_filter_common_free_property (priv);
+  gst_tensor_metrics_free (self->metrics);
+
+  g_async_queue_unref (self->pool.jobs);
+  g_queue_free (self->pool.results);
+  g_mutex_clear (&self->pool.lock);
+  g_cond_clear (&self->pool.cond);
+
+  gst_tensor_filter_batch_clear (self);
+  g_queue_free (self->batch.pending);
+  g_queue_free (self->batch.outputs);
+  gst_tensors_info_free (&self->batch.in_info);
+  gst_tensors_info_free (&self->batch.out_info);
+  g_mutex_clear (&self->batch.lock);
+  g_cond_clear (&self->batch.cond);
+  g_mutex_clear (&self->in_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -297,6 +419,24 @@ gst_tensor_filter_set_property (GObject * object, guint prop_id,
     return;
   }
 
+  if (prop_id == PROP_BATCH_SIZE) {
+    self->batch.size = g_value_get_uint (value);
+    return;
+  }
+
+  if (prop_id == PROP_BATCH_TIMEOUT) {
+    g_mutex_lock (&self->batch.lock);
+    self->batch.timeout = g_value_get_uint (value);
+    g_cond_broadcast (&self->batch.cond);
+    g_mutex_unlock (&self->batch.lock);
+    return;
+  }
+
+  if (prop_id == PROP_NUM_INSTANCES) {
+    self->pool.size = g_value_get_uint (value);
+    return;
+  }
+
   if (!gst_tensor_filter_common_set_property (priv, prop_id, value, pspec))
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 }
@@ -321,6 +461,21 @@ gst_tensor_filter_get_property (GObject * object, guint prop_id,
     return;
   }
 
+  if (prop_id == PROP_BATCH_SIZE) {
+    g_value_set_uint (value, self->batch.size);
+    return;
+  }
+
+  if (prop_id == PROP_BATCH_TIMEOUT) {
+    g_value_set_uint (value, self->batch.timeout);
+    return;
+  }
+
+  if (prop_id == PROP_NUM_INSTANCES) {
+    g_value_set_uint (value, self->pool.size);
+    return;
+  }
+
   if (!gst_tensor_filter_common_get_property (priv, prop_id, value, pspec))
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 }
@@ -361,11 +516,12 @@ gst_tensor_filter_get_wrapped_mem (GstTensorFilter * self, gpointer data,
 
 /**
  * @brief Prepare statistics for performance profiling (e.g, latency, throughput)
+ * @return The invoke start time (usec)
  */
-static void
-prepare_statistics (GstTensorFilterPrivate * priv)
+static gint64
+prepare_statistics (void)
 {
-  priv->stat.latest_invoke_time = g_get_real_time ();
+  return g_get_real_time ();
 }
 
 /**
@@ -385,14 +541,17 @@ accumulate_latency (void *data, void *user_data)
 
 /**
  * @brief Record statistics for performance profiling (e.g, latency, throughput)
+ * @note Caller should hold the object lock, the invokes may run in parallel.
  */
 static void
-record_statistics (GstTensorFilterPrivate * priv)
+record_statistics (GstTensorFilterPrivate * priv, gint64 start_time)
 {
   gint64 end_time = g_get_real_time ();
   gint64 *latency;
   GQueue *recent_latencies = priv->stat.recent_latencies;
 
+  priv->stat.latest_invoke_time = start_time;
+
   /* ignore first measurements that may be off */
   if (priv->stat.latency_ignore_count) {
     priv->stat.latency_ignore_count--;
@@ -616,17 +775,14 @@ _gst_tensor_filter_transform_validate (GstBaseTransform * trans,
   silent_debug (self, "Invoking %s with %s model\n", priv->fw->name,
       GST_STR_NULL (prop->model_files[0]));
 
-  /* skip input data when throttling delay is set */
-  if (gst_tensor_filter_check_throttling_delay (trans, inbuf))
-    return GST_BASE_TRANSFORM_FLOW_DROPPED;
-
   if (!outbuf) {
     GST_ELEMENT_ERROR_BTRACE (self, STREAM, FAILED,
         ("The output buffer for the instance of tensor-filter subplugin (%s / %s) is null. Cannot proceed.",
             prop->fwname, TF_MODELNAME (prop)));
     return GST_FLOW_ERROR;
   }
-  if (gst_buffer_get_size (outbuf) != 0) {
+  if (gst_buffer_get_size (outbuf) != 0 &&
+      (self->out_pool == NULL || outbuf->pool != self->out_pool)) {
     GST_ELEMENT_ERROR_BTRACE (self, STREAM, FAILED,
         ("The output buffer for the isntance of tensor-filter subplugin (%s / %s) already has a content (buffer size = %zu). It should be 0.",
             prop->fwname, TF_MODELNAME (prop), gst_buffer_get_size (outbuf)));
@@ -637,13 +793,18 @@ _gst_tensor_filter_transform_validate (GstBaseTransform * trans,
 }
 
 /**
- * @brief non-ip transform. required vmethod of GstBaseTransform.
+ * @brief Invoke the model with given framework instance and fill the output buffer.
+ * @param self "this" pointer
+ * @param inbuf input buffer
+ * @param outbuf output buffer to be filled
+ * @param private_data private data of the framework instance
+ * @param queued_time monotonic time (usec) when the input buffer was queued (-1 if it is not queued)
  */
 static GstFlowReturn
-gst_tensor_filter_transform (GstBaseTransform * trans,
-    GstBuffer * inbuf, GstBuffer * outbuf)
+gst_tensor_filter_invoke_buffer (GstTensorFilter * self, GstBuffer * inbuf,
+    GstBuffer * outbuf, void **private_data, gint64 queued_time)
 {
-  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (trans);
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (self);
   GstTensorFilterPrivate *priv = &self->priv;
   GstTensorFilterProperties *prop = &priv->prop;
 
@@ -660,23 +821,22 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
   GList *list;
   guint i, num_tensors;
   gint ret;
-  gboolean allocate_in_invoke, in_flexible, out_flexible;
+  gboolean allocate_in_invoke, in_flexible, out_flexible, pooled;
   gboolean need_profiling;
-  gsize expected, hsize;
+  gint64 start_time = 0, invoke_start, invoke_end;
+  gsize expected, hsize, out_size;
 
   GstTensorMetaInfo in_meta[NNS_TENSOR_SIZE_LIMIT];
   GstTensorMetaInfo out_meta[NNS_TENSOR_SIZE_LIMIT];
 
   GstMemory *mem;
 
-  /* 0. Check all properties. */
-  GstFlowReturn retval = _gst_tensor_filter_transform_validate (trans, inbuf,
-      outbuf);
-  if (retval != GST_FLOW_OK)
-    return retval;
-
   allocate_in_invoke = gst_tensor_filter_allocate_in_invoke (priv);
 
+  /* the output memories are pre-allocated if outbuf is from the buffer pool */
+  pooled = (self->out_pool != NULL && outbuf->pool == self->out_pool &&
+      gst_buffer_n_memory (outbuf) == prop->output_meta.num_tensors);
+
   in_flexible =
       gst_tensor_pad_caps_is_flexible (GST_BASE_TRANSFORM_SINK_PAD (trans));
   out_flexible =
@@ -778,8 +938,11 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
 
     /* allocate memory if allocate_in_invoke is FALSE */
     if (!allocate_in_invoke) {
-      out_mem[i] =
-          gst_allocator_alloc (NULL, out_tensors[i].size + hsize, NULL);
+      if (pooled)
+        out_mem[i] = gst_buffer_peek_memory (outbuf, i);
+      else
+        out_mem[i] =
+            gst_allocator_alloc (NULL, out_tensors[i].size + hsize, NULL);
       if (!out_mem[i]) {
         ml_loge_stacktrace
             ("gst_tensor_filter_transform: cannot allocate memory for the output buffer (%u'th memory chunk for %u'th tensor), which requires %zd bytes. gst_allocate_alloc has returned Null. Out of memory?",
@@ -795,8 +958,8 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
 
       out_tensors[i].data = out_info[i].data + hsize;
 
-      /* append header */
-      if (out_flexible) {
+      /* append header (the pooled memory already has the header) */
+      if (out_flexible && !pooled) {
         if (FALSE == gst_tensor_meta_info_update_header
             (&out_meta[i], out_info[i].data)) {
           ml_loge_stacktrace
@@ -811,12 +974,28 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
   need_profiling = (priv->latency_mode > 0 || priv->throughput_mode > 0 ||
       priv->latency_reporting);
   if (need_profiling)
-    prepare_statistics (priv);
+    start_time = prepare_statistics ();
 
   /* 3. Call the filter-subplugin callback, "invoke" */
-  GST_TF_FW_INVOKE_COMPAT (priv, ret, invoke_tensors, out_tensors);
+  invoke_start = g_get_monotonic_time ();
+  GST_TF_FW_INVOKE_COMPAT_DATA (priv, private_data, ret, invoke_tensors,
+      out_tensors);
+  invoke_end = g_get_monotonic_time ();
+
+  if (ret == 0 && self->metrics) {
+    out_size = 0;
+    for (i = 0; i < prop->output_meta.num_tensors; i++)
+      out_size += out_tensors[i].size;
+
+    gst_tensor_metrics_record (self->metrics,
+        (queued_time >= 0) ? invoke_start - queued_time : -1,
+        invoke_end - invoke_start, gst_buffer_get_size (inbuf), out_size);
+  }
+
   if (need_profiling) {
-    record_statistics (priv);
+    GST_OBJECT_LOCK (self);
+    record_statistics (priv, start_time);
+    GST_OBJECT_UNLOCK (self);
     track_latency (self);
   }
 
@@ -829,7 +1008,7 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
   if (!allocate_in_invoke) {
     for (i = 0; i < prop->output_meta.num_tensors; i++) {
       gst_memory_unmap (out_mem[i], &out_info[i]);
-      if (ret != 0)
+      if (ret != 0 && !pooled)
         gst_allocator_free (out_mem[i]->allocator, out_mem[i]);
     }
   }
@@ -846,6 +1025,10 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
   }
 
   /* 5. Update result */
+  /* The pooled outbuf is already filled (the pool is not used with combination) */
+  if (pooled)
+    return GST_FLOW_OK;
+
   /* If output combination is defined, append input tensors first */
   if (priv->combi.out_combi_i_defined) {
     for (list = priv->combi.out_combi_i; list != NULL; list = list->next) {
@@ -936,7 +1119,8 @@ mem_map_error:
     for (i = 0; i < prop->output_meta.num_tensors; i++) {
       if (out_mem[i]) {
         gst_memory_unmap (out_mem[i], &out_info[i]);
-        gst_allocator_free (out_mem[i]->allocator, out_mem[i]);
+        if (!pooled)
+          gst_allocator_free (out_mem[i]->allocator, out_mem[i]);
       }
     }
   }
@@ -944,192 +1128,1068 @@ mem_map_error:
 }
 
 /**
- * @brief Configure input and output tensor info from incaps.
- * @param self "this" pointer
- * @param incaps received caps for sink pad
- * @return TRUE if fully configured
+ * @brief non-ip transform. required vmethod of GstBaseTransform.
  */
-static gboolean
-gst_tensor_filter_configure_tensor (GstTensorFilter * self,
-    const GstCaps * incaps)
+static GstFlowReturn
+gst_tensor_filter_transform (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer * outbuf)
 {
-  GstTensorFilterPrivate *priv;
-  GstTensorFilterProperties *prop;
-  GstStructure *structure;
-  GstTensorsConfig in_config, out_config;
-  GstTensorsInfo in_info, out_info;
-  gboolean flexible;
+  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (trans);
+  GstFlowReturn retval;
 
-  g_return_val_if_fail (incaps != NULL, FALSE);
-  priv = &self->priv;
-  prop = &priv->prop;
-  gst_tensors_config_init (&in_config);
-  gst_tensors_config_init (&out_config);
-  gst_tensors_info_init (&in_info);
-  gst_tensors_info_init (&out_info);
+  /* 0. Check all properties. */
+  retval = _gst_tensor_filter_transform_validate (trans, inbuf, outbuf);
+  if (retval != GST_FLOW_OK)
+    return retval;
 
-  /**
-   * GstTensorFilter has to parse the tensor dimension and type from NN model.
-   * 1. Call functions getInputDimension and getOutputDimension to get the dimension and type.
-   * 2. If these functions are not defined, call setInputDimension with parsed info from caps.
-   * 3. If set-prop configured dimension, verify the dimension with fw callbacks.
-   */
-  gst_tensor_filter_load_tensor_info (&self->priv);
+  /* skip input data when throttling delay is set */
+  if (gst_tensor_filter_check_throttling_delay (trans, inbuf))
+    return GST_BASE_TRANSFORM_FLOW_DROPPED;
 
-  structure = gst_caps_get_structure (incaps, 0);
-  if (G_UNLIKELY (!structure)) {
-    gchar *capstr = gst_caps_to_string (incaps);
-    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-        ("%s:%u The input stream padcap is not appropriate. Cannot get structured information from the given padcap: '%s' (gst_caps_get_structure() has returned NULL.). Please check if the caps you've given is correct especially if you have applied caps-filter in front of tensor-filter (%s:%s).",
-            __func__, __LINE__, capstr, GST_STR_NULL (prop->fwname),
-            TF_MODELNAME (prop)));
-    g_free (capstr);
-    goto done;
-  }
-  if (G_UNLIKELY (!gst_tensors_config_from_structure (&in_config, structure))) {
-    gchar *capstr = gst_caps_to_string (incaps);
-    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-        ("%s:%u The input stream padcap is not appropriate. It is not a valid tensor stream (other/tensors) or a tensor stream with a few required entries missing. For example, dimesion and type are missing for a static tensor (format=static or other/tensor (single tensor)). The given padcap is '%s' for tensor-filter (%s:%s).",
-            __func__, __LINE__, capstr, GST_STR_NULL (prop->fwname),
-            TF_MODELNAME (prop)));
-    g_free (capstr);
+  /* invoked right away, no wait time to record */
+  return gst_tensor_filter_invoke_buffer (self, inbuf, outbuf,
+      &self->priv.privateData, -1);
+}
+
+/**
+ * @brief Get the dimension of batched tensor, stacking the frames along the outermost dimension.
+ */
+static void
+gst_tensor_filter_batch_get_dimension (tensor_dim dim, const guint batch)
+{
+  guint rank = gst_tensor_dimension_get_rank (dim);
+
+  if (rank > 0 && dim[rank - 1] == 1)
+    dim[rank - 1] = batch;
+  else if (rank < NNS_TENSOR_RANK_LIMIT)
+    dim[rank] = batch;
+  else
+    dim[rank - 1] *= batch;
+}
+
+/**
+ * @brief Close the framework instance for batched invoke.
+ * @note Caller should hold the batch lock.
+ */
+static void
+gst_tensor_filter_batch_close_fw (GstTensorFilter * self)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterBatch *batch = &self->batch;
+
+  if (batch->private_data && priv->fw && priv->fw->close)
+    priv->fw->close (&priv->prop, &batch->private_data);
+  batch->private_data = NULL;
+}
+
+/**
+ * @brief Configure batched tensors info. Batched invoke is enabled if the framework accepts batched input.
+ * @details The batched input is applied to a new framework instance, so that the instance of tensor_filter keeps the non-batched input.
+ */
+static void
+gst_tensor_filter_batch_configure (GstTensorFilter * self)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterProperties *prop = &priv->prop;
+  GstTensorFilterBatch *batch = &self->batch;
+  GstTensorInfo *_info;
+  gsize expected;
+  guint i, size;
+  int ret = -1;
+
+  g_mutex_lock (&batch->lock);
+
+  /* invoke the buffers queued with previous configuration */
+  while (!g_queue_is_empty (batch->pending))
+    gst_tensor_filter_batch_flush (self);
+
+  size = batch->size;
+  batch->active = 0;
+  gst_tensors_info_free (&batch->in_info);
+  gst_tensors_info_free (&batch->out_info);
+  gst_tensor_filter_batch_close_fw (self);
+
+  if (size <= 1)
     goto done;
-  }
 
-  /**
-   * Check configuration from caps.
-   * If true, fully configured tensor info from caps.
-   */
-  if (!gst_tensors_config_validate (&in_config)) {
-    gchar *capstr = gst_caps_to_string (incaps);
-    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-        ("%s:%u The input stream padcaps cannot be validated. It is not a valid tensor stream for tensor_filter element. Input stream type for tensor_filter (%s:%s) is %s. tensor-filter could get config from the input padcap; however, it cannot be validated: framerate or format is not valid. Try a static tensor stream with a valid (0/1 is also valid!) framerate.",
-            __func__, __LINE__, GST_STR_NULL (prop->fwname),
-            TF_MODELNAME (prop), capstr));
-    g_free (capstr);
+  if (prop->invoke_dynamic || priv->combi.in_combi_defined ||
+      priv->combi.out_combi_i_defined || priv->combi.out_combi_o_defined ||
+      gst_tensors_config_is_flexible (&priv->in_config) ||
+      gst_tensors_config_is_flexible (&priv->out_config)) {
+    ml_logw
+        ("[%s] Batched invoke (batch-size=%u) is not available with flexible tensors, dynamic invoke, or in/out combination. tensor_filter will invoke the model for each frame.",
+        TF_MODELNAME (prop), size);
     goto done;
   }
 
-  if (!gst_tensor_filter_common_get_combined_in_info (priv, &in_config.info,
-          &in_info)) {
-    gchar *capstr = gst_caps_to_string (incaps);
-    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-        ("%s:%u Failed to configure combined input info for tensor-filter (%s:%s). The given padcap is '%s'. User has specified input combination (refer to the previous error log), which shuffles the order of tensors, which is not compatible with the given model. Please check the padcap, input combination, and tensor/dimension requirement of your neural network model.",
-            __func__, __LINE__, GST_STR_NULL (prop->fwname),
-            TF_MODELNAME (prop), capstr));
-    g_free (capstr);
+  if (priv->is_updatable || prop->shared_tensor_filter_key ||
+      priv->fw->open == NULL || gst_tensor_filter_allocate_in_invoke (priv)) {
+    ml_logw
+        ("[%s] Batched invoke (batch-size=%u) is not available with updatable or shared model, or the framework (%s) allocating the output in invoke. tensor_filter will invoke the model for each frame.",
+        TF_MODELNAME (prop), size, GST_STR_NULL (prop->fwname));
     goto done;
   }
 
-  /* flexible tensor case, we cannot get the exact info from caps. */
-  flexible = gst_tensors_config_is_flexible (&in_config);
-
-  /** if set-property called and already has info, verify it! */
-  if (prop->input_meta.num_tensors > 0) {
-    if (flexible) {
-      /**
-       * If incoming tensor is flexible, we cannot validate tensor info here.
-       * Need to compare buffer size in transform().
-       */
-      GST_INFO_OBJECT (self, "The input tensor is flexible.");
-    } else if (!gst_tensors_info_is_equal (&in_info, &prop->input_meta)) {
-      gchar *capstr = gst_caps_to_string (incaps);
-      gchar *compare =
-          gst_tensorsinfo_compare_to_string (&in_info, &prop->input_meta);
-      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-          ("%s:%u The input tensor of tensor_filter (%s:%s) is not compatible with the configured input information. Please check tensor-filter properties if you have given input dimensions explicitly; or the model properties if you have not given them. Check the input stream caps and related caps-filters, too. The given gstcap is %s, which is not compatible: %s",
-              __func__, __LINE__, GST_STR_NULL (prop->fwname),
-              TF_MODELNAME (prop), capstr, compare));
-      g_free (compare);
-      g_free (capstr);
-      goto done;
-    }
-  } else {
-    if (flexible) {
-      gchar *capstr = gst_caps_to_string (incaps);
-      /** @todo
-       * We do not support this (flexible tensor for flexible input model).
-       * Cap-negotiation of the current tensor-filter requires either side of
-       * "model / set-property" or "incoming gstcaps" to be static/explicit.
-       * Ideally, this should support flexible tensor for flexible input model,
-       * leaving the negotiation to other elements, but we didn't implement it yet.
-       */
-      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-          ("%s:%u The input tensor of tensor_filter (%s:%s) is flexible (gstcap: '%s'), which requires either explicit type/dimension tensor-filter property values or static input dimension models. The current version of tensor-filter does not support flexible tensors for dynamic-input models without explicit input dimension declaration. Declare type/dimension/tensors with tensor-filter properties, or apply caps-filter in front of tensor-filter, or use static tensor streams.",
-              __func__, __LINE__, GST_STR_NULL (prop->fwname),
-              TF_MODELNAME (prop), capstr));
-      g_free (capstr);
-      goto done;
-    } else {
-      gst_tensors_info_copy (&prop->input_meta, &in_info);
-    }
+  gst_tensors_info_copy (&batch->in_info, &prop->input_meta);
+  for (i = 0; i < batch->in_info.num_tensors; i++) {
+    _info = gst_tensors_info_get_nth_info (&batch->in_info, i);
+    gst_tensor_filter_batch_get_dimension (_info->dimension, size);
   }
 
-  prop->input_configured = TRUE;
-
-  /** call setInputDimension if output tensor is not configured */
-  if (!prop->output_configured) {
-    if (gst_tensor_filter_common_get_out_info (priv, &prop->input_meta,
-            &out_info)) {
-      /** if set-property called and already has info, verify it! */
-      if (prop->output_meta.num_tensors > 0) {
-        if (!gst_tensors_info_is_equal (&out_info, &prop->output_meta)) {
-          gchar *cmpstr = gst_tensorsinfo_compare_to_string (&out_info,
-              &prop->output_meta);
-          GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-              ("%s:%u The output tensor is not compatible with the configured tensor information. The configuration is usually set by tensor-filter properties declared by users or the given neural network itself. The following two tensor metadata are not compatible: %s.\n",
-                  __func__, __LINE__, cmpstr));
-          g_free (cmpstr);
-          gst_tensors_info_free (&out_info);
-          goto done;
-        }
-      } else {
-        gst_tensors_info_copy (&prop->output_meta, &out_info);
-      }
-
-      prop->output_configured = TRUE;
-    }
-
-    if (!prop->output_configured) {
-      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-          ("%s:%u Failed to get output tensor info: not enough related information to configure output.\n",
-              __func__, __LINE__));
-      goto done;
-    }
+  if (priv->fw->open (prop, &batch->private_data) < 0) {
+    ml_logw
+        ("[%s] The framework (%s) cannot open a new instance for the batched input (batch-size=%u). tensor_filter will invoke the model for each frame.",
+        TF_MODELNAME (prop), prop->fwname, size);
+    batch->private_data = NULL;
+    goto done;
   }
 
-  /**
-   * @todo framerate of output tensors
-   * How can we update the framerate?
-   * GstTensorFilter cannot assure the framerate.
-   * Simply set the framerate of out-tensor from incaps.
-   */
-  out_config.rate_n = in_config.rate_n;
-  out_config.rate_d = in_config.rate_d;
+  /* apply the batched input info to new instance */
+  gst_tensors_info_init (&batch->out_info);
+  if (GST_TF_FW_V0 (priv->fw)) {
+    if (priv->fw->setInputDimension)
+      ret = priv->fw->setInputDimension (prop, &batch->private_data,
+          &batch->in_info, &batch->out_info);
+  } else if (priv->fw->getModelInfo) {
+    ret = priv->fw->getModelInfo (priv->fw, prop, batch->private_data,
+        SET_INPUT_INFO, &batch->in_info, &batch->out_info);
+  }
 
-  if (!gst_tensor_filter_common_get_combined_out_info (priv, &in_config.info,
-          &prop->output_meta, &out_config.info)) {
-    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
-        ("%s:%u Failed to configure combined output info: please refer to the error message of gst_tensor_filter_common_get_combined_out_info(). ",
-            __func__, __LINE__));
+  if (ret != 0) {
+    ml_logw
+        ("[%s] The framework (%s) cannot accept the batched input (batch-size=%u). tensor_filter will invoke the model for each frame.",
+        TF_MODELNAME (prop), prop->fwname, size);
     goto done;
   }
 
-  if (priv->configured) {
-    /** already configured, compare to old. */
-    if (!priv->prop.invoke_dynamic) {
-      g_assert (gst_tensors_config_is_equal (&priv->in_config, &in_config));
-      g_assert (gst_tensors_config_is_equal (&priv->out_config, &out_config));
-    }
-  } else {
-    gst_tensors_config_copy (&priv->in_config, &in_config);
-    gst_tensors_config_copy (&priv->out_config, &out_config);
+  if (batch->out_info.num_tensors != prop->output_meta.num_tensors)
+    goto invalid_output;
 
-    priv->configured = TRUE;
+  for (i = 0; i < batch->out_info.num_tensors; i++) {
+    expected = gst_tensors_info_get_size (&prop->output_meta, i) * size;
+    if (gst_tensors_info_get_size (&batch->out_info, i) != expected)
+      goto invalid_output;
   }
 
+  batch->active = size;
+  GST_INFO_OBJECT (self, "Batched invoke is enabled (batch-size=%u).", size);
+  goto done;
+
+invalid_output:
+  ml_logw
+      ("[%s] The output of the framework (%s) with the batched input (batch-size=%u) cannot be split into the frames. tensor_filter will invoke the model for each frame.",
+      TF_MODELNAME (prop), prop->fwname, size);
+
 done:
-  gst_tensors_config_free (&in_config);
+  if (batch->active == 0) {
+    gst_tensors_info_free (&batch->in_info);
+    gst_tensors_info_free (&batch->out_info);
+    gst_tensor_filter_batch_close_fw (self);
+  }
+
+  g_mutex_unlock (&batch->lock);
+}
+
+/**
+ * @brief Invoke the model with the stacked input buffers and queue the output buffers to be pushed.
+ * @note Caller should hold the batch lock.
+ */
+static GstFlowReturn
+gst_tensor_filter_batch_invoke (GstTensorFilter * self, GstBuffer ** inbufs,
+    const guint num)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterProperties *prop = &priv->prop;
+  GstTensorFilterBatch *batch = &self->batch;
+
+  GstMemory *out_mem[NNS_TENSOR_SIZE_LIMIT] = { 0, };
+  GstMapInfo out_info[NNS_TENSOR_SIZE_LIMIT];
+  GstTensorMemory in_tensors[NNS_TENSOR_SIZE_LIMIT];
+  GstTensorMemory out_tensors[NNS_TENSOR_SIZE_LIMIT];
+  GstTensorsInfo in_meta, out_meta;
+
+  GstFlowReturn retval = GST_FLOW_ERROR;
+  gboolean need_profiling, out_mapped = FALSE;
+  gint64 start_time = 0, invoke_start, invoke_end;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstBuffer *outbuf;
+  guint8 *data;
+  gsize fsize;
+  guint i, k, num_in, num_out;
+  gint ret;
+
+  if (G_UNLIKELY (!priv->configured || !priv->fw)) {
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, FAILED,
+        ("The tensor_filter instance is not configured for the batched invoke (framework = '%s').",
+            GST_STR_NULL (prop->fwname)));
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+
+  num_in = batch->in_info.num_tensors;
+  num_out = batch->out_info.num_tensors;
+
+  for (i = 0; i < num_in; i++)
+    in_tensors[i].data = NULL;
+
+  /* 1. Stack input tensors along the outermost dimension. */
+  for (i = 0; i < num_in; i++) {
+    fsize = gst_tensors_info_get_size (&prop->input_meta, i);
+    in_tensors[i].size = gst_tensors_info_get_size (&batch->in_info, i);
+    in_tensors[i].data = data = g_malloc (in_tensors[i].size);
+
+    for (k = 0; k < num; k++) {
+      if (gst_tensor_buffer_get_count (inbufs[k]) != num_in) {
+        ml_loge_stacktrace
+            ("gst_tensor_filter_batch_invoke: Input buffer has invalid number of memory blocks (%u), which is expected to be %u (the number of tensors).\n",
+            gst_tensor_buffer_get_count (inbufs[k]), num_in);
+        goto done;
+      }
+
+      mem = gst_tensor_buffer_get_nth_memory (inbufs[k], i);
+      if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
+        ml_loge_stacktrace
+            ("gst_tensor_filter_batch_invoke: Failed to map the %u'th input tensor of the %u'th frame in the batch.\n",
+            i, k);
+        gst_memory_unref (mem);
+        goto done;
+      }
+
+      if (map.size != fsize) {
+        ml_loge_stacktrace
+            ("gst_tensor_filter_batch_invoke: Input buffer size (%u'th memory chunk: %zd) is invalid, which is expected to be %zd.\n",
+            i, map.size, fsize);
+        gst_memory_unmap (mem, &map);
+        gst_memory_unref (mem);
+        goto done;
+      }
+
+      memcpy (data + fsize * k, map.data, fsize);
+      gst_memory_unmap (mem, &map);
+      gst_memory_unref (mem);
+    }
+
+    /* fill zero if the batch is not full */
+    if (num < batch->active)
+      memset (data + fsize * num, 0, fsize * (batch->active - num));
+  }
+
+  /* 2. Prepare batched output tensors. */
+  out_mapped = TRUE;
+  for (i = 0; i < num_out; i++) {
+    out_tensors[i].size = gst_tensors_info_get_size (&batch->out_info, i);
+    out_mem[i] = gst_allocator_alloc (NULL, out_tensors[i].size, NULL);
+    if (!out_mem[i] ||
+        !gst_memory_map (out_mem[i], &out_info[i], GST_MAP_WRITE)) {
+      ml_loge_stacktrace
+          ("gst_tensor_filter_batch_invoke: cannot allocate memory for the %u'th batched output tensor, which requires %zd bytes.\n",
+          i, out_tensors[i].size);
+      if (out_mem[i])
+        gst_memory_unref (out_mem[i]);
+      out_mem[i] = NULL;
+      goto done;
+    }
+
+    out_tensors[i].data = out_info[i].data;
+  }
+
+  /* 3. Call the filter-subplugin callback of the batched instance with batched tensors info. */
+  in_meta = prop->input_meta;
+  out_meta = prop->output_meta;
+  prop->input_meta = batch->in_info;
+  prop->output_meta = batch->out_info;
+
+  need_profiling = (priv->latency_mode > 0 || priv->throughput_mode > 0 ||
+      priv->latency_reporting);
+  if (need_profiling)
+    start_time = prepare_statistics ();
+
+  invoke_start = g_get_monotonic_time ();
+  GST_TF_FW_INVOKE_COMPAT_DATA (priv, &batch->private_data, ret, in_tensors,
+      out_tensors);
+  invoke_end = g_get_monotonic_time ();
+
+  /* the wait time of a batch is measured from the first queued frame */
+  if (ret == 0 && self->metrics) {
+    gsize in_size = 0, out_size = 0;
+
+    for (i = 0; i < num_in; i++)
+      in_size += in_tensors[i].size;
+    for (i = 0; i < num_out; i++)
+      out_size += out_tensors[i].size;
+
+    gst_tensor_metrics_record (self->metrics, invoke_start - (batch->deadline -
+            (gint64) batch->timeout * G_TIME_SPAN_MILLISECOND),
+        invoke_end - invoke_start, in_size, out_size);
+  }
+
+  if (need_profiling) {
+    GST_OBJECT_LOCK (self);
+    record_statistics (priv, start_time);
+    GST_OBJECT_UNLOCK (self);
+  }
+
+  prop->input_meta = in_meta;
+  prop->output_meta = out_meta;
+
+  if (need_profiling)
+    track_latency (self);
+
+  if (out_mapped) {
+    for (i = 0; i < num_out; i++)
+      gst_memory_unmap (out_mem[i], &out_info[i]);
+    out_mapped = FALSE;
+  }
+
+  if (ret < 0) {
+    ml_loge_stacktrace
+        ("Calling invoke function (inference instance) of the tensor-filter subplugin (%s for %s) has failed with error code (%d) for the batch of %u frames.\n",
+        prop->fwname, TF_MODELNAME (prop), ret, num);
+    goto done;
+  } else if (ret > 0) {
+    /* drop this batch */
+    retval = GST_FLOW_OK;
+    goto done;
+  }
+
+  /* 4. Split the batched output into the frames with their own timestamps. The caller pushes them after releasing the batch lock. */
+  retval = GST_FLOW_OK;
+  for (k = 0; k < num; k++) {
+    outbuf = gst_buffer_new ();
+    gst_buffer_copy_into (outbuf, inbufs[k], GST_BUFFER_COPY_METADATA, 0, -1);
+
+    for (i = 0; i < num_out; i++) {
+      fsize = gst_tensors_info_get_size (&prop->output_meta, i);
+      mem = gst_memory_share (out_mem[i], fsize * k, fsize);
+
+      gst_tensor_buffer_append_memory (outbuf, mem,
+          gst_tensors_info_get_nth_info (&prop->output_meta, i));
+    }
+
+    g_queue_push_tail (batch->outputs, outbuf);
+  }
+
+done:
+  for (i = 0; i < num_in; i++)
+    g_free (in_tensors[i].data);
+
+  for (i = 0; i < num_out; i++) {
+    if (out_mem[i]) {
+      if (out_mapped)
+        gst_memory_unmap (out_mem[i], &out_info[i]);
+      gst_memory_unref (out_mem[i]);
+    }
+  }
+
+  return retval;
+}
+
+/**
+ * @brief Push the output buffers of the batched invoke.
+ * @note Caller should hold the batch lock. The lock is released while pushing the buffers, and only one thread pushes the buffers at a time, so that the output order is kept.
+ */
+static GstFlowReturn
+gst_tensor_filter_batch_push (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+  GstBuffer *outbuf;
+  GstFlowReturn ret;
+
+  /* the other thread pushes the queued buffers */
+  if (batch->pushing)
+    return batch->last_ret;
+
+  batch->pushing = TRUE;
+  batch->last_ret = GST_FLOW_OK;
+  while ((outbuf = (GstBuffer *) g_queue_pop_head (batch->outputs)) != NULL) {
+    /* drop the remaining frames if failed to push */
+    if (batch->last_ret != GST_FLOW_OK) {
+      gst_buffer_unref (outbuf);
+      continue;
+    }
+
+    g_mutex_unlock (&batch->lock);
+    ret = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (self), outbuf);
+    g_mutex_lock (&batch->lock);
+
+    if (ret != GST_FLOW_OK)
+      batch->last_ret = ret;
+  }
+  batch->pushing = FALSE;
+  g_cond_broadcast (&batch->cond);
+
+  return batch->last_ret;
+}
+
+/**
+ * @brief Invoke the pending buffers at once and push the output buffers.
+ * @note Caller should hold the batch lock. The lock is released while pushing the output buffers.
+ */
+static GstFlowReturn
+gst_tensor_filter_batch_flush (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+  GstBuffer *inbufs[MAX_BATCH_SIZE];
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i, num = 0;
+
+  while (num < MAX (batch->active, 1) && !g_queue_is_empty (batch->pending))
+    inbufs[num++] = (GstBuffer *) g_queue_pop_head (batch->pending);
+
+  if (num > 0) {
+    if (batch->active > 0) {
+      ret = gst_tensor_filter_batch_invoke (self, inbufs, num);
+    } else {
+      GST_WARNING_OBJECT (self, "Batched invoke is disabled, drop %u frames.",
+          num);
+    }
+  }
+
+  for (i = 0; i < num; i++)
+    gst_buffer_unref (inbufs[i]);
+
+  /* the remaining buffers wait for next batch */
+  if (!g_queue_is_empty (batch->pending)) {
+    batch->deadline = g_get_monotonic_time () +
+        (gint64) batch->timeout * G_TIME_SPAN_MILLISECOND;
+  }
+
+  if (ret == GST_FLOW_OK)
+    ret = gst_tensor_filter_batch_push (self);
+
+  return ret;
+}
+
+/**
+ * @brief Drop all pending buffers and the output buffers not pushed yet.
+ */
+static void
+gst_tensor_filter_batch_clear (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+  GstBuffer *buffer;
+
+  g_mutex_lock (&batch->lock);
+  while ((buffer = (GstBuffer *) g_queue_pop_head (batch->pending)) != NULL)
+    gst_buffer_unref (buffer);
+  while ((buffer = (GstBuffer *) g_queue_pop_head (batch->outputs)) != NULL)
+    gst_buffer_unref (buffer);
+  g_mutex_unlock (&batch->lock);
+}
+
+/**
+ * @brief Src pad task to invoke a partial batch when batch-timeout is expired.
+ * @details The partial batch is pushed in the task of the src pad, and the serialized events flush the pending frames before they are forwarded, so that the stream order is kept.
+ */
+static void
+gst_tensor_filter_batch_loop (gpointer data)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER (data);
+  GstTensorFilterBatch *batch = &self->batch;
+  GstFlowReturn ret;
+
+  g_mutex_lock (&batch->lock);
+  if (!batch->running) {
+    g_mutex_unlock (&batch->lock);
+    gst_pad_pause_task (GST_BASE_TRANSFORM_SRC_PAD (self));
+    return;
+  }
+
+  if (batch->timeout == 0 || g_queue_is_empty (batch->pending)) {
+    g_cond_wait (&batch->cond, &batch->lock);
+  } else if (g_get_monotonic_time () < batch->deadline) {
+    g_cond_wait_until (&batch->cond, &batch->lock, batch->deadline);
+  } else {
+    ret = gst_tensor_filter_batch_flush (self);
+    if (ret < GST_FLOW_EOS)
+      GST_ELEMENT_FLOW_ERROR (self, ret);
+  }
+  g_mutex_unlock (&batch->lock);
+}
+
+/**
+ * @brief Start the timer task for batched invoke.
+ */
+static void
+gst_tensor_filter_batch_start (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+
+  if (batch->size <= 1)
+    return;
+
+  g_mutex_lock (&batch->lock);
+  batch->running = TRUE;
+  g_mutex_unlock (&batch->lock);
+
+  gst_pad_start_task (GST_BASE_TRANSFORM_SRC_PAD (self),
+      gst_tensor_filter_batch_loop, self, NULL);
+}
+
+/**
+ * @brief Stop the timer task. The task holds the stream lock of the src pad, thus it should be stopped before the pads are deactivated.
+ */
+static void
+gst_tensor_filter_batch_stop_task (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+
+  g_mutex_lock (&batch->lock);
+  batch->running = FALSE;
+  g_cond_broadcast (&batch->cond);
+  g_mutex_unlock (&batch->lock);
+
+  gst_pad_stop_task (GST_BASE_TRANSFORM_SRC_PAD (self));
+}
+
+/**
+ * @brief Stop the timer task, drop the pending buffers and close the framework instance for batched invoke.
+ */
+static void
+gst_tensor_filter_batch_stop (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+
+  gst_tensor_filter_batch_stop_task (self);
+  gst_tensor_filter_batch_clear (self);
+
+  /* batched invoke is configured again with new caps */
+  g_mutex_lock (&batch->lock);
+  batch->active = 0;
+  gst_tensor_filter_batch_close_fw (self);
+  g_mutex_unlock (&batch->lock);
+}
+
+/**
+ * @brief Invoke all pending buffers before a serialized event is forwarded.
+ */
+static GstFlowReturn
+gst_tensor_filter_batch_drain (GstTensorFilter * self)
+{
+  GstTensorFilterBatch *batch = &self->batch;
+  GstFlowReturn ret = GST_FLOW_OK;
+
+  g_mutex_lock (&batch->lock);
+  while (ret == GST_FLOW_OK && !g_queue_is_empty (batch->pending))
+    ret = gst_tensor_filter_batch_flush (self);
+
+  /* wait until the timer task pushes the output buffers */
+  while (batch->pushing)
+    g_cond_wait (&batch->cond, &batch->lock);
+  g_mutex_unlock (&batch->lock);
+
+  /* drop the remaining frames if failed to push */
+  if (ret != GST_FLOW_OK)
+    gst_tensor_filter_batch_clear (self);
+
+  return ret;
+}
+
+/**
+ * @brief Data structure of a frame to be invoked by the workers.
+ */
+typedef struct
+{
+  GstBuffer *inbuf; /**< Input buffer (NULL to stop the worker) */
+  GstBuffer *outbuf; /**< Output buffer filled by the worker */
+  GstFlowReturn ret; /**< The result of invoke */
+  gboolean done; /**< TRUE if the invoke is finished */
+  gint64 queued_time; /**< Monotonic time (usec) when the job is queued */
+} GstTensorFilterPoolJob;
+
+/**
+ * @brief Push the finished results in input order.
+ * @note Caller should hold the pool lock. Only one worker pushes the results at a time, so that the output order is kept.
+ */
+static void
+gst_tensor_filter_pool_push_results (GstTensorFilter * self)
+{
+  GstTensorFilterPool *pool = &self->pool;
+  GstTensorFilterPoolJob *job;
+  GstBuffer *outbuf;
+  GstFlowReturn ret;
+
+  if (pool->pushing)
+    return;
+
+  pool->pushing = TRUE;
+  while ((job = (GstTensorFilterPoolJob *) g_queue_peek_head (pool->results))
+      && job->done) {
+    g_queue_pop_head (pool->results);
+
+    outbuf = job->outbuf;
+    ret = job->ret;
+    gst_buffer_unref (job->inbuf);
+    g_free (job);
+
+    if (pool->flushing) {
+      if (outbuf)
+        gst_buffer_unref (outbuf);
+      continue;
+    }
+
+    g_mutex_unlock (&pool->lock);
+    if (ret == GST_FLOW_OK) {
+      ret = gst_pad_push (GST_BASE_TRANSFORM_SRC_PAD (self), outbuf);
+    } else {
+      if (outbuf)
+        gst_buffer_unref (outbuf);
+      if (ret == GST_BASE_TRANSFORM_FLOW_DROPPED)
+        ret = GST_FLOW_OK;
+    }
+    g_mutex_lock (&pool->lock);
+
+    if (ret != GST_FLOW_OK)
+      pool->last_ret = ret;
+  }
+  pool->pushing = FALSE;
+  g_cond_broadcast (&pool->cond);
+}
+
+/**
+ * @brief Thread to invoke the model with its own framework instance.
+ */
+static gpointer
+gst_tensor_filter_pool_worker (gpointer data)
+{
+  GstTensorFilterPoolWorker *worker = (GstTensorFilterPoolWorker *) data;
+  GstTensorFilter *self = worker->filter;
+  GstTensorFilterPool *pool = &self->pool;
+  GstTensorFilterPoolJob *job;
+  void **private_data;
+
+  /* the first worker uses the framework instance of tensor_filter */
+  if (worker == &pool->workers[0])
+    private_data = &self->priv.privateData;
+  else
+    private_data = &worker->private_data;
+
+  while ((job = (GstTensorFilterPoolJob *) g_async_queue_pop (pool->jobs))) {
+    if (job->inbuf == NULL) {
+      g_free (job);
+      break;
+    }
+
+    /* take the pre-allocated output, allocate it in invoke if the pool is not available */
+    if (self->out_pool == NULL ||
+        gst_buffer_pool_acquire_buffer (self->out_pool, &job->outbuf,
+            NULL) != GST_FLOW_OK)
+      job->outbuf = gst_buffer_new ();
+    gst_buffer_copy_into (job->outbuf, job->inbuf, GST_BUFFER_COPY_METADATA,
+        0, -1);
+
+    job->ret = _gst_tensor_filter_transform_validate (GST_BASE_TRANSFORM_CAST
+        (self), job->inbuf, job->outbuf);
+    if (job->ret == GST_FLOW_OK) {
+      job->ret = gst_tensor_filter_invoke_buffer (self, job->inbuf,
+          job->outbuf, private_data, job->queued_time);
+    }
+
+    g_mutex_lock (&pool->lock);
+    job->done = TRUE;
+    gst_tensor_filter_pool_push_results (self);
+    g_mutex_unlock (&pool->lock);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Wait until all queued frames are invoked and pushed.
+ */
+static void
+gst_tensor_filter_pool_drain (GstTensorFilter * self)
+{
+  GstTensorFilterPool *pool = &self->pool;
+
+  g_mutex_lock (&pool->lock);
+  while (!g_queue_is_empty (pool->results))
+    g_cond_wait (&pool->cond, &pool->lock);
+  g_mutex_unlock (&pool->lock);
+}
+
+/**
+ * @brief Stop the workers and close the additional framework instances.
+ */
+static void
+gst_tensor_filter_pool_stop (GstTensorFilter * self)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterPool *pool = &self->pool;
+  guint i;
+
+  if (pool->active == 0)
+    return;
+
+  /* the workers exit after invoking the queued frames */
+  for (i = 0; i < pool->active; i++)
+    g_async_queue_push (pool->jobs, g_new0 (GstTensorFilterPoolJob, 1));
+
+  for (i = 0; i < pool->active; i++)
+    g_thread_join (pool->workers[i].thread);
+
+  for (i = 1; i < pool->active; i++) {
+    if (priv->fw && priv->fw->close)
+      priv->fw->close (&priv->prop, &pool->workers[i].private_data);
+  }
+
+  g_free (pool->workers);
+  pool->workers = NULL;
+  pool->active = 0;
+  pool->last_ret = GST_FLOW_OK;
+}
+
+/**
+ * @brief Open the additional framework instances and start the workers for parallel invoke.
+ */
+static void
+gst_tensor_filter_pool_configure (GstTensorFilter * self)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterProperties *prop = &priv->prop;
+  GstTensorFilterPool *pool = &self->pool;
+  GstTensorFilterPoolWorker *workers;
+  GstTensorsInfo out_info;
+  guint i, size;
+
+  /* invoke all queued frames with the previous configuration */
+  gst_tensor_filter_pool_stop (self);
+
+  size = pool->size;
+  if (size <= 1)
+    return;
+
+  if (self->batch.active > 0 || prop->invoke_dynamic || priv->is_updatable ||
+      prop->shared_tensor_filter_key || priv->fw->open == NULL ||
+      gst_tensor_filter_allocate_in_invoke (priv)) {
+    ml_logw
+        ("[%s] Parallel invoke (num-instances=%u) is not available with batched invoke, dynamic invoke, updatable or shared model, or the framework (%s) allocating the output in invoke. tensor_filter will invoke the model in the streaming thread.",
+        GST_ELEMENT_NAME (self), size, GST_STR_NULL (prop->fwname));
+    return;
+  }
+
+  workers = g_new0 (GstTensorFilterPoolWorker, size);
+
+  for (i = 1; i < size; i++) {
+    if (priv->fw->open (prop, &workers[i].private_data) < 0)
+      break;
+
+    /* apply the negotiated input info to new instance */
+    gst_tensors_info_init (&out_info);
+    if (GST_TF_FW_V0 (priv->fw)) {
+      if (priv->fw->setInputDimension)
+        priv->fw->setInputDimension (prop, &workers[i].private_data,
+            &prop->input_meta, &out_info);
+    } else if (priv->fw->getModelInfo) {
+      priv->fw->getModelInfo (priv->fw, prop, workers[i].private_data,
+          SET_INPUT_INFO, &prop->input_meta, &out_info);
+    }
+    gst_tensors_info_free (&out_info);
+  }
+
+  if (i < size) {
+    ml_logw ("[%s] Failed to open %u instances of the framework (%s), "
+        "tensor_filter will invoke the model with %u instances.",
+        GST_ELEMENT_NAME (self), size, GST_STR_NULL (prop->fwname), i);
+    size = i;
+  }
+
+  if (size <= 1) {
+    g_free (workers);
+    return;
+  }
+
+  g_mutex_lock (&pool->lock);
+  pool->flushing = FALSE;
+  pool->last_ret = GST_FLOW_OK;
+  g_mutex_unlock (&pool->lock);
+
+  pool->workers = workers;
+  for (i = 0; i < size; i++) {
+    workers[i].filter = self;
+    workers[i].thread = g_thread_new ("tensor_filter_worker",
+        gst_tensor_filter_pool_worker, &workers[i]);
+  }
+
+  pool->active = size;
+  GST_INFO_OBJECT (self, "Parallel invoke is enabled (num-instances=%u).",
+      size);
+}
+
+/**
+ * @brief Queue the input buffer to be invoked by the workers.
+ * @details The streaming thread waits if the number of queued frames exceeds twice the number of workers.
+ */
+static GstFlowReturn
+gst_tensor_filter_pool_submit (GstTensorFilter * self, GstBuffer * input)
+{
+  GstTensorFilterPool *pool = &self->pool;
+  GstTensorFilterPoolJob *job;
+  GstFlowReturn ret;
+
+  g_mutex_lock (&pool->lock);
+  while (!pool->flushing && pool->last_ret == GST_FLOW_OK &&
+      g_queue_get_length (pool->results) >= pool->active * 2)
+    g_cond_wait (&pool->cond, &pool->lock);
+
+  ret = pool->flushing ? GST_FLOW_FLUSHING : pool->last_ret;
+  if (ret != GST_FLOW_OK) {
+    g_mutex_unlock (&pool->lock);
+    gst_buffer_unref (input);
+    return ret;
+  }
+
+  job = g_new0 (GstTensorFilterPoolJob, 1);
+  job->inbuf = input;
+  job->queued_time = g_get_monotonic_time ();
+  g_queue_push_tail (pool->results, job);
+  g_mutex_unlock (&pool->lock);
+
+  g_async_queue_push (pool->jobs, job);
+  return GST_FLOW_OK;
+}
+
+/**
+ * @brief Submit input buffer. optional vmethod of GstBaseTransform.
+ * @details If batched invoke is enabled, tensor_filter queues the input buffer and invokes the model when the batch is full.
+ *          If parallel invoke is enabled, the input buffer is dispatched to the workers.
+ */
+static GstFlowReturn
+gst_tensor_filter_submit_input_buffer (GstBaseTransform * trans,
+    gboolean is_discont, GstBuffer * input)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (trans);
+  GstTensorFilterBatch *batch = &self->batch;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint active;
+
+  g_mutex_lock (&batch->lock);
+  active = batch->active;
+  g_mutex_unlock (&batch->lock);
+
+  if (active == 0 && self->pool.active == 0) {
+    return GST_BASE_TRANSFORM_CLASS (parent_class)->submit_input_buffer (trans,
+        is_discont, input);
+  }
+
+  /* skip input data when throttling delay is set */
+  if (gst_tensor_filter_check_throttling_delay (trans, input)) {
+    gst_buffer_unref (input);
+    return GST_FLOW_OK;
+  }
+
+  if (self->pool.active > 0)
+    return gst_tensor_filter_pool_submit (self, input);
+
+  g_mutex_lock (&batch->lock);
+  if (batch->active == 0) {
+    /* batched invoke is disabled while the input is queued */
+    g_mutex_unlock (&batch->lock);
+    return GST_BASE_TRANSFORM_CLASS (parent_class)->submit_input_buffer (trans,
+        is_discont, input);
+  }
+
+  if (g_queue_is_empty (batch->pending)) {
+    batch->deadline = g_get_monotonic_time () +
+        (gint64) batch->timeout * G_TIME_SPAN_MILLISECOND;
+    g_cond_broadcast (&batch->cond);
+  }
+
+  g_queue_push_tail (batch->pending, input);
+  if (g_queue_get_length (batch->pending) >= batch->active)
+    ret = gst_tensor_filter_batch_flush (self);
+  g_mutex_unlock (&batch->lock);
+
+  return ret;
+}
+
+/**
+ * @brief Configure input and output tensor info from incaps.
+ * @param self "this" pointer
+ * @param incaps received caps for sink pad
+ * @return TRUE if fully configured
+ */
+static gboolean
+gst_tensor_filter_configure_tensor (GstTensorFilter * self,
+    const GstCaps * incaps)
+{
+  GstTensorFilterPrivate *priv;
+  GstTensorFilterProperties *prop;
+  GstStructure *structure;
+  GstTensorsConfig in_config, out_config;
+  GstTensorsInfo in_info, out_info;
+  gboolean flexible;
+
+  g_return_val_if_fail (incaps != NULL, FALSE);
+  priv = &self->priv;
+  prop = &priv->prop;
+  gst_tensors_config_init (&in_config);
+  gst_tensors_config_init (&out_config);
+  gst_tensors_info_init (&in_info);
+  gst_tensors_info_init (&out_info);
+
+  /**
+   * GstTensorFilter has to parse the tensor dimension and type from NN model.
+   * 1. Call functions getInputDimension and getOutputDimension to get the dimension and type.
+   * 2. If these functions are not defined, call setInputDimension with parsed info from caps.
+   * 3. If set-prop configured dimension, verify the dimension with fw callbacks.
+   */
+  gst_tensor_filter_load_tensor_info (&self->priv);
+
+  structure = gst_caps_get_structure (incaps, 0);
+  if (G_UNLIKELY (!structure)) {
+    gchar *capstr = gst_caps_to_string (incaps);
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+        ("%s:%u The input stream padcap is not appropriate. Cannot get structured information from the given padcap: '%s' (gst_caps_get_structure() has returned NULL.). Please check if the caps you've given is correct especially if you have applied caps-filter in front of tensor-filter (%s:%s).",
+            __func__, __LINE__, capstr, GST_STR_NULL (prop->fwname),
+            TF_MODELNAME (prop)));
+    g_free (capstr);
+    goto done;
+  }
+  if (G_UNLIKELY (!gst_tensors_config_from_structure (&in_config, structure))) {
+    gchar *capstr = gst_caps_to_string (incaps);
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+        ("%s:%u The input stream padcap is not appropriate. It is not a valid tensor stream (other/tensors) or a tensor stream with a few required entries missing. For example, dimesion and type are missing for a static tensor (format=static or other/tensor (single tensor)). The given padcap is '%s' for tensor-filter (%s:%s).",
+            __func__, __LINE__, capstr, GST_STR_NULL (prop->fwname),
+            TF_MODELNAME (prop)));
+    g_free (capstr);
+    goto done;
+  }
+
+  /**
+   * Check configuration from caps.
+   * If true, fully configured tensor info from caps.
+   */
+  if (!gst_tensors_config_validate (&in_config)) {
+    gchar *capstr = gst_caps_to_string (incaps);
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+        ("%s:%u The input stream padcaps cannot be validated. It is not a valid tensor stream for tensor_filter element. Input stream type for tensor_filter (%s:%s) is %s. tensor-filter could get config from the input padcap; however, it cannot be validated: framerate or format is not valid. Try a static tensor stream with a valid (0/1 is also valid!) framerate.",
+            __func__, __LINE__, GST_STR_NULL (prop->fwname),
+            TF_MODELNAME (prop), capstr));
+    g_free (capstr);
+    goto done;
+  }
+
+  if (!gst_tensor_filter_common_get_combined_in_info (priv, &in_config.info,
+          &in_info)) {
+    gchar *capstr = gst_caps_to_string (incaps);
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+        ("%s:%u Failed to configure combined input info for tensor-filter (%s:%s). The given padcap is '%s'. User has specified input combination (refer to the previous error log), which shuffles the order of tensors, which is not compatible with the given model. Please check the padcap, input combination, and tensor/dimension requirement of your neural network model.",
+            __func__, __LINE__, GST_STR_NULL (prop->fwname),
+            TF_MODELNAME (prop), capstr));
+    g_free (capstr);
+    goto done;
+  }
+
+  /* flexible tensor case, we cannot get the exact info from caps. */
+  flexible = gst_tensors_config_is_flexible (&in_config);
+
+  /** if set-property called and already has info, verify it! */
+  if (prop->input_meta.num_tensors > 0) {
+    if (flexible) {
+      /**
+       * If incoming tensor is flexible, we cannot validate tensor info here.
+       * Need to compare buffer size in transform().
+       */
+      GST_INFO_OBJECT (self, "The input tensor is flexible.");
+    } else if (!gst_tensors_info_is_equal (&in_info, &prop->input_meta)) {
+      gchar *capstr = gst_caps_to_string (incaps);
+      gchar *compare =
+          gst_tensorsinfo_compare_to_string (&in_info, &prop->input_meta);
+      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+          ("%s:%u The input tensor of tensor_filter (%s:%s) is not compatible with the configured input information. Please check tensor-filter properties if you have given input dimensions explicitly; or the model properties if you have not given them. Check the input stream caps and related caps-filters, too. The given gstcap is %s, which is not compatible: %s",
+              __func__, __LINE__, GST_STR_NULL (prop->fwname),
+              TF_MODELNAME (prop), capstr, compare));
+      g_free (compare);
+      g_free (capstr);
+      goto done;
+    }
+  } else {
+    if (flexible) {
+      gchar *capstr = gst_caps_to_string (incaps);
+      /** @todo
+       * We do not support this (flexible tensor for flexible input model).
+       * Cap-negotiation of the current tensor-filter requires either side of
+       * "model / set-property" or "incoming gstcaps" to be static/explicit.
+       * Ideally, this should support flexible tensor for flexible input model,
+       * leaving the negotiation to other elements, but we didn't implement it yet.
+       */
+      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+          ("%s:%u The input tensor of tensor_filter (%s:%s) is flexible (gstcap: '%s'), which requires either explicit type/dimension tensor-filter property values or static input dimension models. The current version of tensor-filter does not support flexible tensors for dynamic-input models without explicit input dimension declaration. Declare type/dimension/tensors with tensor-filter properties, or apply caps-filter in front of tensor-filter, or use static tensor streams.",
+              __func__, __LINE__, GST_STR_NULL (prop->fwname),
+              TF_MODELNAME (prop), capstr));
+      g_free (capstr);
+      goto done;
+    } else {
+      gst_tensors_info_copy (&prop->input_meta, &in_info);
+    }
+  }
+
+  prop->input_configured = TRUE;
+
+  /** call setInputDimension if output tensor is not configured */
+  if (!prop->output_configured) {
+    if (gst_tensor_filter_common_get_out_info (priv, &prop->input_meta,
+            &out_info)) {
+      /** if set-property called and already has info, verify it! */
+      if (prop->output_meta.num_tensors > 0) {
+        if (!gst_tensors_info_is_equal (&out_info, &prop->output_meta)) {
+          gchar *cmpstr = gst_tensorsinfo_compare_to_string (&out_info,
+              &prop->output_meta);
+          GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+              ("%s:%u The output tensor is not compatible with the configured tensor information. The configuration is usually set by tensor-filter properties declared by users or the given neural network itself. The following two tensor metadata are not compatible: %s.\n",
+                  __func__, __LINE__, cmpstr));
+          g_free (cmpstr);
+          gst_tensors_info_free (&out_info);
+          goto done;
+        }
+      } else {
+        gst_tensors_info_copy (&prop->output_meta, &out_info);
+      }
+
+      prop->output_configured = TRUE;
+    }
+
+    if (!prop->output_configured) {
+      GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+          ("%s:%u Failed to get output tensor info: not enough related information to configure output.\n",
+              __func__, __LINE__));
+      goto done;
+    }
+  }
+
+  /**
+   * @todo framerate of output tensors
+   * How can we update the framerate?
+   * GstTensorFilter cannot assure the framerate.
+   * Simply set the framerate of out-tensor from incaps.
+   */
+  out_config.rate_n = in_config.rate_n;
+  out_config.rate_d = in_config.rate_d;
+
+  if (!gst_tensor_filter_common_get_combined_out_info (priv, &in_config.info,
+          &prop->output_meta, &out_config.info)) {
+    GST_ELEMENT_ERROR_BTRACE (self, STREAM, WRONG_TYPE,
+        ("%s:%u Failed to configure combined output info: please refer to the error message of gst_tensor_filter_common_get_combined_out_info(). ",
+            __func__, __LINE__));
+    goto done;
+  }
+
+  if (priv->configured) {
+    /** already configured, compare to old. */
+    if (!priv->prop.invoke_dynamic) {
+      g_assert (gst_tensors_config_is_equal (&priv->in_config, &in_config));
+      g_assert (gst_tensors_config_is_equal (&priv->out_config, &out_config));
+    }
+  } else {
+    gst_tensors_config_copy (&priv->in_config, &in_config);
+    gst_tensors_config_copy (&priv->out_config, &out_config);
+
+    priv->configured = TRUE;
+  }
+
+done:
+  gst_tensors_config_free (&in_config);
   gst_tensors_config_free (&out_config);
   gst_tensors_info_free (&in_info);
   gst_tensors_info_free (&out_info);
@@ -1302,6 +2362,285 @@ gst_tensor_filter_fixate_caps (GstBaseTransform * trans,
   return result;
 }
 
+/**
+ * @brief Release the buffer pool of the output tensors.
+ * @note The pool is deactivated when the element stops, base-transform may still hold the old pool until it decides new allocation.
+ */
+static void
+gst_tensor_filter_out_pool_release (GstTensorFilter * self, gboolean deactivate)
+{
+  if (self->out_pool) {
+    if (deactivate)
+      gst_buffer_pool_set_active (self->out_pool, FALSE);
+    gst_object_unref (self->out_pool);
+    self->out_pool = NULL;
+  }
+}
+
+/**
+ * @brief Create the buffer pool of pre-allocated output tensors with negotiated output info.
+ * @details The pool is not used if the framework allocates the output in invoke, dynamic invoke, or output combination is given.
+ */
+static void
+gst_tensor_filter_out_pool_configure (GstTensorFilter * self, GstCaps * outcaps,
+    gboolean flexible)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterProperties *prop = &priv->prop;
+  GstTensorMetaInfo meta;
+  GstBufferPool *pool;
+  GstStructure *config;
+  gsize size = 0;
+  guint i;
+
+  gst_tensor_filter_out_pool_release (self, FALSE);
+
+  if (gst_tensor_filter_allocate_in_invoke (priv) || prop->invoke_dynamic ||
+      priv->combi.out_combi_i_defined || priv->combi.out_combi_o_defined)
+    return;
+
+  pool = gst_tensor_buffer_pool_new (&prop->output_meta, flexible);
+  if (!pool)
+    return;
+
+  for (i = 0; i < prop->output_meta.num_tensors; i++) {
+    size += gst_tensor_filter_get_tensor_size (self, i, FALSE);
+
+    if (flexible) {
+      gst_tensor_info_convert_to_meta (gst_tensors_info_get_nth_info
+          (&prop->output_meta, i), &meta);
+      size += gst_tensor_meta_info_get_header_size (&meta);
+    }
+  }
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, outcaps, (guint) size, 0, 0);
+
+  if (!gst_buffer_pool_set_config (pool, config) ||
+      !gst_buffer_pool_set_active (pool, TRUE)) {
+    GST_WARNING_OBJECT (self,
+        "Failed to configure the buffer pool of output tensors, tensor_filter will allocate the output for each frame.");
+    gst_object_unref (pool);
+    return;
+  }
+
+  self->out_pool = pool;
+}
+
+/**
+ * @brief Release the buffer pool of the input tensors.
+ * @note The pool is deactivated when the element stops, upstream may still hold the old pool until it decides new allocation. The framework is closed after upstream releases the buffers wrapping its input memories.
+ */
+static void
+gst_tensor_filter_in_pool_release (GstTensorFilter * self, gboolean deactivate)
+{
+  if (self->in_pool) {
+    if (deactivate)
+      gst_buffer_pool_set_active (self->in_pool, FALSE);
+    gst_object_unref (self->in_pool);
+    self->in_pool = NULL;
+  }
+}
+
+/**
+ * @brief Called when the pool and all buffers wrapping the input memories of the framework are released.
+ * @details The memories hold the reference of tensor_filter, close the framework if the element has stopped.
+ */
+static void
+gst_tensor_filter_in_pool_notify (gpointer data)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (data);
+
+  g_mutex_lock (&self->in_lock);
+  self->in_wrapped--;
+  if (self->in_wrapped == 0 && self->close_pending) {
+    GST_INFO_OBJECT (self,
+        "Upstream released the input memories, close the framework.");
+    self->close_pending = FALSE;
+    gst_tensor_filter_common_close_fw (&self->priv);
+  }
+  g_mutex_unlock (&self->in_lock);
+
+  gst_object_unref (self);
+}
+
+/**
+ * @brief Close the framework, or defer it until upstream releases the buffers wrapping the input memories of the framework.
+ */
+static void
+gst_tensor_filter_in_pool_close_fw (GstTensorFilter * self)
+{
+  g_mutex_lock (&self->in_lock);
+  if (self->in_wrapped > 0) {
+    GST_INFO_OBJECT (self,
+        "Upstream holds the input memories of the framework, close it when the memories are released.");
+    self->close_pending = TRUE;
+  } else {
+    gst_tensor_filter_common_close_fw (&self->priv);
+  }
+  g_mutex_unlock (&self->in_lock);
+}
+
+/**
+ * @brief Create the buffer pool of the input tensors, which is proposed to upstream.
+ * @details If the framework provides its input tensors, upstream writes the data into the memories of the framework, and invoke does not copy the input. Otherwise the pool has aligned memory for each tensor.
+ * The pool is not used with flexible tensors, dynamic invoke, in/out combination, batched or parallel invoke, and updatable model, since the framework cannot own the input memory.
+ */
+static void
+gst_tensor_filter_in_pool_configure (GstTensorFilter * self)
+{
+  GstTensorFilterPrivate *priv = &self->priv;
+  GstTensorFilterProperties *prop = &priv->prop;
+  GstTensorFilterFrameworkEventData data;
+  GstTensorMemory in_mem[NNS_TENSOR_MEMORY_MAX];
+  GstBufferPool *pool = NULL;
+  int ret;
+
+  gst_tensor_filter_in_pool_release (self, FALSE);
+
+  if (!GST_TF_FW_V1 (priv->fw) || !priv->info.zero_copy_input)
+    return;
+
+  if (prop->invoke_dynamic || priv->is_updatable ||
+      priv->combi.in_combi_defined || priv->combi.out_combi_i_defined ||
+      self->batch.active > 0 || self->pool.active > 0 ||
+      gst_tensors_config_is_flexible (&priv->in_config)) {
+    GST_INFO_OBJECT (self,
+        "Zero-copy input is not available with flexible tensors, dynamic invoke, in/out combination, batched or parallel invoke, or updatable model.");
+    return;
+  }
+
+  if (prop->input_meta.num_tensors > NNS_TENSOR_MEMORY_MAX)
+    return;
+
+  memset (in_mem, 0, sizeof (in_mem));
+  data.input_memory = in_mem;
+
+  ret = priv->fw->eventHandler (priv->fw, prop, priv->privateData,
+      GET_INPUT_MEMORY, &data);
+  if (ret == 0) {
+    g_mutex_lock (&self->in_lock);
+    pool = gst_tensor_buffer_pool_new_wrapped (&prop->input_meta, in_mem,
+        gst_tensor_filter_in_pool_notify, gst_object_ref (self));
+    if (pool)
+      self->in_wrapped++;
+    else
+      gst_object_unref (self);
+    g_mutex_unlock (&self->in_lock);
+  } else if (ret == -ENOENT) {
+    pool = gst_tensor_buffer_pool_new (&prop->input_meta, FALSE);
+  }
+
+  if (!pool) {
+    GST_WARNING_OBJECT (self,
+        "Failed to get the input tensors of the framework, tensor_filter will not propose the buffer pool to upstream.");
+    return;
+  }
+
+  self->in_pool = pool;
+}
+
+/**
+ * @brief Propose allocation to upstream. optional vmethod of BaseTransform.
+ * @details Add the buffer pool of the input tensors, so that upstream may write the input into the memories of the framework.
+ */
+static gboolean
+gst_tensor_filter_propose_allocation (GstBaseTransform * trans,
+    GstQuery * decide_query, GstQuery * query)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (trans);
+  GstStructure *config;
+  GstCaps *caps;
+  guint i, size = 0, min = 0, max = 0;
+
+  if (!GST_BASE_TRANSFORM_CLASS (parent_class)->propose_allocation (trans,
+          decide_query, query))
+    return FALSE;
+
+  if (self->in_pool == NULL)
+    return TRUE;
+
+  gst_query_parse_allocation (query, &caps, NULL);
+  if (caps == NULL)
+    return TRUE;
+
+  for (i = 0; i < self->priv.prop.input_meta.num_tensors; i++)
+    size += gst_tensor_filter_get_tensor_size (self, i, TRUE);
+
+  /* the pool may be activated by the previous allocation query */
+  if (!gst_buffer_pool_is_active (self->in_pool)) {
+    config = gst_buffer_pool_get_config (self->in_pool);
+    gst_buffer_pool_config_set_params (config, caps, size, 0, 0);
+
+    if (!gst_buffer_pool_set_config (self->in_pool, config)) {
+      GST_WARNING_OBJECT (self,
+          "Failed to configure the buffer pool of input tensors.");
+      return TRUE;
+    }
+  }
+
+  config = gst_buffer_pool_get_config (self->in_pool);
+  gst_buffer_pool_config_get_params (config, NULL, NULL, &min, &max);
+  gst_structure_free (config);
+
+  gst_query_add_allocation_pool (query, self->in_pool, size, min, max);
+  return TRUE;
+}
+
+/**
+ * @brief Decide allocation with downstream. optional vmethod of BaseTransform.
+ * @details Set the buffer pool of the output tensors, which is shared with downstream.
+ */
+static gboolean
+gst_tensor_filter_decide_allocation (GstBaseTransform * trans, GstQuery * query)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER_CAST (trans);
+  GstStructure *config;
+  GstCaps *caps;
+  guint size, min = 0, max = 0;
+
+  if (self->out_pool == NULL) {
+    return GST_BASE_TRANSFORM_CLASS (parent_class)->decide_allocation (trans,
+        query);
+  }
+
+  config = gst_buffer_pool_get_config (self->out_pool);
+  gst_buffer_pool_config_get_params (config, &caps, &size, NULL, NULL);
+
+  /* ignore the pool of downstream, but keep its requirement of buffers */
+  if (gst_query_get_n_allocation_pools (query) > 0)
+    gst_query_parse_nth_allocation_pool (query, 0, NULL, NULL, &min, &max);
+
+  if (min > 0 || max > 0) {
+    caps = gst_caps_ref (caps);
+    gst_buffer_pool_config_set_params (config, caps, size, min, max);
+    gst_caps_unref (caps);
+
+    /* the pool is activated at set_caps, no buffer is acquired yet */
+    gst_buffer_pool_set_active (self->out_pool, FALSE);
+    if (!gst_buffer_pool_set_config (self->out_pool, config) ||
+        !gst_buffer_pool_set_active (self->out_pool, TRUE)) {
+      GST_WARNING_OBJECT (self,
+          "Failed to apply the requirement of downstream (min %u, max %u buffers) to the buffer pool of output tensors.",
+          min, max);
+      gst_tensor_filter_out_pool_release (self, TRUE);
+      return GST_BASE_TRANSFORM_CLASS (parent_class)->decide_allocation (trans,
+          query);
+    }
+  } else {
+    gst_structure_free (config);
+  }
+
+  if (gst_query_get_n_allocation_pools (query) > 0) {
+    gst_query_set_nth_allocation_pool (query, 0, self->out_pool, size, min,
+        max);
+  } else {
+    gst_query_add_allocation_pool (query, self->out_pool, size, min, max);
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief set caps. required vmethod of GstBaseTransform.
  */
@@ -1357,8 +2696,16 @@ gst_tensor_filter_set_caps (GstBaseTransform * trans,
     return FALSE;
   }
 
+  /* invoke all queued frames with the previous configuration */
+  gst_tensor_filter_pool_stop (self);
+  gst_tensor_filter_out_pool_configure (self, outcaps,
+      gst_tensors_config_is_flexible (&config));
   gst_tensors_config_free (&config);
 
+  gst_tensor_filter_batch_configure (self);
+  gst_tensor_filter_pool_configure (self);
+  gst_tensor_filter_in_pool_configure (self);
+
   return TRUE;
 }
 
@@ -1472,7 +2819,35 @@ gst_tensor_filter_sink_event (GstBaseTransform * trans, GstEvent * event)
   GstTensorFilterPrivate *priv;
   self = GST_TENSOR_FILTER_CAST (trans);
   priv = &self->priv;
+
+  /**
+   * Serialized events should not overtake the frames queued for batched or parallel invoke.
+   * Invoke and push the pending frames before forwarding the event (e.g., EOS, segment, caps).
+   * This also guarantees that no worker is invoking the model when the model is updated.
+   */
+  if (GST_EVENT_IS_SERIALIZED (event) &&
+      GST_EVENT_TYPE (event) != GST_EVENT_FLUSH_STOP) {
+    gst_tensor_filter_batch_drain (self);
+    gst_tensor_filter_pool_drain (self);
+  }
+
   switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_FLUSH_START:
+      g_mutex_lock (&self->pool.lock);
+      self->pool.flushing = TRUE;
+      g_cond_broadcast (&self->pool.cond);
+      g_mutex_unlock (&self->pool.lock);
+      break;
+    case GST_EVENT_FLUSH_STOP:
+      gst_tensor_filter_batch_clear (self);
+
+      /* drop the results of the frames queued before flushing */
+      gst_tensor_filter_pool_drain (self);
+      g_mutex_lock (&self->pool.lock);
+      self->pool.flushing = FALSE;
+      self->pool.last_ret = GST_FLOW_OK;
+      g_mutex_unlock (&self->pool.lock);
+      break;
     case GST_EVENT_CUSTOM_DOWNSTREAM:
     {
       const GstStructure *structure = gst_event_get_structure (event);
@@ -1554,8 +2929,17 @@ gst_tensor_filter_start (GstBaseTransform * trans)
   /* If it is not configured properly, don't allow to start! */
   if (priv->fw == NULL)
     return FALSE;
+
+  /* upstream still holds the input memories of the last stream, keep the framework opened */
+  g_mutex_lock (&self->in_lock);
+  self->close_pending = FALSE;
+  g_mutex_unlock (&self->in_lock);
+
   gst_tensor_filter_common_open_fw (priv);
 
+  if (priv->prop.fw_opened)
+    gst_tensor_filter_batch_start (self);
+
   return priv->prop.fw_opened;
 }
 
@@ -1568,9 +2952,32 @@ static gboolean
 gst_tensor_filter_stop (GstBaseTransform * trans)
 {
   GstTensorFilter *self;
-  GstTensorFilterPrivate *priv;
   self = GST_TENSOR_FILTER_CAST (trans);
-  priv = &self->priv;
-  gst_tensor_filter_common_close_fw (priv);
+  gst_tensor_filter_batch_stop (self);
+  gst_tensor_filter_pool_stop (self);
+  gst_tensor_filter_out_pool_release (self, TRUE);
+  gst_tensor_filter_in_pool_release (self, TRUE);
+  gst_tensor_filter_in_pool_close_fw (self);
+  gst_tensor_metrics_dump (TRUE);
   return TRUE;
 }
+
+/**
+ * @brief Called to perform state change.
+ */
+static GstStateChangeReturn
+gst_tensor_filter_change_state (GstElement * element, GstStateChange transition)
+{
+  GstTensorFilter *self = GST_TENSOR_FILTER (element);
+
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      /* stop the timer task before the src pad is deactivated */
+      gst_tensor_filter_batch_stop_task (self);
+      break;
+    default:
+      break;
+  }
+
+  return GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+}
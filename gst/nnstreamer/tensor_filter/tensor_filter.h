@@ -37,6 +37,7 @@
 #include "nnstreamer_subplugin.h"
 #include "nnstreamer_plugin_api_filter.h"
 #include "tensor_filter_common.h"
+#include "tensor_metrics.h"
 
 G_BEGIN_DECLS
 
@@ -55,6 +56,56 @@ G_BEGIN_DECLS
 typedef struct _GstTensorFilter GstTensorFilter;
 typedef struct _GstTensorFilterClass GstTensorFilterClass;
 
+/**
+ * @brief Internal data structure to collect incoming frames and invoke them at once (micro-batching).
+ */
+typedef struct
+{
+  guint size; /**< The max number of frames in a batch (property, 1 to disable) */
+  guint timeout; /**< The max time (ms) to wait for a partial batch (property, 0 to wait until the batch is full) */
+  guint active; /**< The number of frames in a batch configured at caps negotiation (0 if batching is not available) */
+  GstTensorsInfo in_info; /**< Batched input tensors info */
+  GstTensorsInfo out_info; /**< Batched output tensors info */
+  void *private_data; /**< Private data of the framework instance reshaped with the batched input (the instance of tensor_filter keeps the non-batched input) */
+
+  GQueue *pending; /**< Queued input buffers */
+  GQueue *outputs; /**< Output buffers of the batched invoke, waiting to be pushed */
+  gboolean pushing; /**< TRUE if a thread is pushing the output buffers */
+  GstFlowReturn last_ret; /**< The flow return of pushing the output buffers */
+  gint64 deadline; /**< Monotonic time (usec) to flush the pending buffers */
+  GMutex lock; /**< Lock for pending buffers and batched invoke */
+  GCond cond; /**< Condition to wake up the timer task */
+  gboolean running; /**< TRUE if the timer task (src pad task to flush a partial batch) is running */
+} GstTensorFilterBatch;
+
+/**
+ * @brief Internal data structure for a worker of parallel invoke.
+ */
+typedef struct
+{
+  GstTensorFilter *filter; /**< tensor_filter instance */
+  GThread *thread; /**< Worker thread to invoke the model */
+  void *private_data; /**< Private data of the framework instance (the first worker uses the instance of tensor_filter) */
+} GstTensorFilterPoolWorker;
+
+/**
+ * @brief Internal data structure to invoke the model with multiple framework instances in parallel.
+ */
+typedef struct
+{
+  guint size; /**< The number of framework instances (property, 1 to disable) */
+  guint active; /**< The number of workers configured at caps negotiation (0 if parallel invoke is not available) */
+  GstTensorFilterPoolWorker *workers; /**< Workers, one for each framework instance */
+
+  GAsyncQueue *jobs; /**< Input buffers to be invoked by the workers */
+  GQueue *results; /**< Jobs in input order, waiting to be pushed */
+  GMutex lock; /**< Lock for the results */
+  GCond cond; /**< Condition to signal the results are pushed */
+  gboolean pushing; /**< TRUE if a worker is pushing the results */
+  gboolean flushing; /**< TRUE if the element is flushing, drop the results */
+  GstFlowReturn last_ret; /**< The last flow return of pushing the results */
+} GstTensorFilterPool;
+
 /**
  * @brief Internal data structure for tensor_filter instances.
  */
@@ -67,6 +118,15 @@ struct _GstTensorFilter
   GstClockTime prev_ts;  /**< previous timestamp */
   GstClockTimeDiff throttling_delay;  /**< throttling delay from tensor rate */
   GstClockTimeDiff throttling_accum;  /**< accumulated frame durations for throttling */
+
+  GstTensorFilterBatch batch; /**< Data for batched invoke */
+  GstTensorFilterPool pool; /**< Data for parallel invoke */
+  GstBufferPool *out_pool; /**< Buffer pool of the output tensors (NULL if the output is allocated for each frame) */
+  GstBufferPool *in_pool; /**< Buffer pool of the input tensors proposed to upstream (NULL if zero-copy input is not available) */
+  GMutex in_lock; /**< Lock for the framework close deferred by the wrapped input memories */
+  guint in_wrapped; /**< The number of pools (and their buffers) wrapping the input memories of the framework */
+  gboolean close_pending; /**< TRUE to close the framework when upstream releases the wrapped input memories */
+  GstTensorMetrics *metrics; /**< Latency histograms and bytes of the invoke */
 };
 
 /**
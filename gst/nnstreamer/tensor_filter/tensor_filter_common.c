@@ -536,6 +536,7 @@ gst_tensor_filter_framework_info_init (GstTensorFilterFrameworkInfo * info)
   info->accl_auto = -1;
   info->accl_default = -1;
   info->statistics = NULL;
+  info->zero_copy_input = 0;
 }
 
 /**
@@ -65,12 +65,18 @@ G_BEGIN_DECLS
       } \
     } while (0)
 
-#define GST_TF_FW_INVOKE_COMPAT(priv,ret,in,out) do { \
+#define GST_TF_FW_INVOKE_COMPAT(priv,ret,in,out) \
+    GST_TF_FW_INVOKE_COMPAT_DATA (priv, &(priv)->privateData, ret, in, out)
+
+/**
+ * @brief Invoke callbacks of nn framework with the private data of given framework instance.
+ */
+#define GST_TF_FW_INVOKE_COMPAT_DATA(priv,data,ret,in,out) do { \
       ret = -1; \
       if (GST_TF_FW_V0 ((priv)->fw)) { \
-        ret = (priv)->fw->invoke_NN (&(priv)->prop, &(priv)->privateData, (in), (out)); \
+        ret = (priv)->fw->invoke_NN (&(priv)->prop, (data), (in), (out)); \
       } else if (GST_TF_FW_V1 ((priv)->fw)) { \
-        ret = (priv)->fw->invoke ((priv)->fw, &(priv)->prop, (priv)->privateData, (in), (out)); \
+        ret = (priv)->fw->invoke ((priv)->fw, &(priv)->prop, *(data), (in), (out)); \
       } \
     } while (0)
 
@@ -106,7 +112,10 @@ enum
   PROP_SHARED_TENSOR_FILTER_KEY,
   PROP_LATENCY_REPORT,
   PROP_INVOKE_DYNAMIC,
-  PROP_CONFIG
+  PROP_CONFIG,
+  PROP_BATCH_SIZE,
+  PROP_BATCH_TIMEOUT,
+  PROP_NUM_INSTANCES
 };
 
 /**
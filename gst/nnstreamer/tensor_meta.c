@@ -14,6 +14,7 @@
 #include "config.h"
 #endif
 
+#include <string.h>
 #include <nnstreamer_util.h>
 #include "tensor_meta.h"
 
@@ -51,6 +52,10 @@ gst_meta_query_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
   UNUSED (params);
   UNUSED (buffer);
   emeta->client_id = 0;
+  emeta->request_id = 0;
+  emeta->batch_size = 0;
+  emeta->num_items = 0;
+  emeta->items = NULL;
   return TRUE;
 }
 
@@ -60,8 +65,11 @@ gst_meta_query_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
 static void
 gst_meta_query_free (GstMeta * meta, GstBuffer * buffer)
 {
-  UNUSED (meta);
+  GstMetaQuery *emeta = (GstMetaQuery *) meta;
   UNUSED (buffer);
+
+  g_free (emeta->items);
+  emeta->items = NULL;
 }
 
 /**
@@ -77,6 +85,32 @@ gst_meta_query_transform (GstBuffer * transbuf, GstMeta * meta,
   UNUSED (type);
   UNUSED (data);
   dest_meta->client_id = src_meta->client_id;
+  dest_meta->request_id = src_meta->request_id;
+
+  if (src_meta->num_items > 0 &&
+      gst_meta_query_set_batch (dest_meta, src_meta->batch_size,
+          src_meta->num_items)) {
+    memcpy (dest_meta->items, src_meta->items,
+        sizeof (GstMetaQueryItem) * src_meta->num_items);
+  }
+  return TRUE;
+}
+
+/**
+ * @brief Set the batch info of meta_query.
+ */
+gboolean
+gst_meta_query_set_batch (GstMetaQuery * meta, guint batch_size,
+    guint num_items)
+{
+  g_return_val_if_fail (meta != NULL, FALSE);
+  g_return_val_if_fail (num_items > 0 && num_items <= batch_size, FALSE);
+
+  g_free (meta->items);
+  meta->items = g_new0 (GstMetaQueryItem, num_items);
+  meta->batch_size = batch_size;
+  meta->num_items = num_items;
+
   return TRUE;
 }
 
@@ -90,7 +124,7 @@ gst_meta_query_get_info (void)
 
   if (g_once_init_enter (&meta_query_info)) {
     const GstMetaInfo *meta = gst_meta_register (GST_META_QUERY_API_TYPE,
-        "GstMetaQuery", sizeof *meta,
+        "GstMetaQuery", sizeof (GstMetaQuery),
         gst_meta_query_init,
         gst_meta_query_free,
         gst_meta_query_transform);
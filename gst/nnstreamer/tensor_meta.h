@@ -19,6 +19,16 @@
 G_BEGIN_DECLS
 
 typedef int64_t query_client_id_t;
+typedef uint64_t query_request_id_t;
+
+/**
+ * @brief Request info of the batched buffer in query server.
+ */
+typedef struct
+{
+  query_client_id_t client_id; /**< id of the query client */
+  query_request_id_t request_id; /**< id of the request from query client */
+} GstMetaQueryItem;
 
 /**
  * @brief GstMetaQuery meta structure
@@ -28,6 +38,11 @@ typedef struct
   GstMeta meta;
 
   query_client_id_t client_id;
+  query_request_id_t request_id; /**< id of the request from query client, 0 if not given */
+
+  guint batch_size; /**< the number of slots in the outermost dimension of batched tensors, 0 if the buffer is not batched */
+  guint num_items; /**< the number of requests in the batched buffer */
+  GstMetaQueryItem *items; /**< request info of each slot */
 } GstMetaQuery;
 
 /**
@@ -46,6 +61,12 @@ const GstMetaInfo * gst_meta_query_get_info (void);
 #define gst_buffer_add_meta_query(b) \
     ((GstMetaQuery *) gst_buffer_add_meta ((b), GST_META_QUERY_INFO, NULL))
 
+/**
+ * @brief Set the batch info of meta_query. The requests are stored in the first num_items slots.
+ * @return TRUE if the request info array is allocated
+ */
+gboolean gst_meta_query_set_batch (GstMetaQuery * meta, guint batch_size, guint num_items);
+
 G_END_DECLS
 
 #endif /* __GST_TENSOR_META_H__ */
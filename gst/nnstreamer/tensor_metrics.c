@@ -0,0 +1,464 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file	tensor_metrics.c
+ * @date	16 Oct 2026
+ * @brief	Internal latency histograms and counters of nnstreamer elements.
+ * @see	http://github.com/nnstreamer/nnstreamer
+ * @bug	No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include "nnstreamer_conf.h"
+#include "nnstreamer_log.h"
+#include "nnstreamer_plugin_api.h"
+#include "tensor_metrics.h"
+
+/**
+ * @brief The number of sub-buckets for each power of 2 (log2).
+ */
+#define METRICS_SUB_BITS (3)
+#define METRICS_SUB_BUCKETS (1U << METRICS_SUB_BITS)
+
+/**
+ * @brief The max power of 2 in the histogram (about 50 days in usec), larger values are recorded in the last bucket.
+ */
+#define METRICS_MAX_BITS (42)
+#define METRICS_NUM_BUCKETS \
+  ((METRICS_MAX_BITS - METRICS_SUB_BITS + 2) * METRICS_SUB_BUCKETS)
+
+/**
+ * @brief Default interval (sec) to write the dump file.
+ */
+#define METRICS_DEFAULT_DUMP_INTERVAL (10)
+
+/**
+ * @brief Log-bucketed histogram of the latency (usec).
+ */
+typedef struct
+{
+  guint64 buckets[METRICS_NUM_BUCKETS]; /**< the number of values in each bucket */
+  guint64 count; /**< the number of values */
+  guint64 sum; /**< the sum of values */
+  guint64 max; /**< the max value */
+} GstTensorHistogram;
+
+/**
+ * @brief The metrics of an element.
+ */
+struct _GstTensorMetrics
+{
+  GstElement *element; /**< the element to be measured (not referenced, the metrics is freed when the element is finalized) */
+  gchar *kind; /**< the kind of the element */
+  GMutex lock; /**< lock for the values, the frames may be processed in parallel */
+
+  GstTensorHistogram hist[NNS_METRICS_STAGE_MAX]; /**< latency histograms for each stage */
+  guint64 bytes_in; /**< the total bytes of input */
+  guint64 bytes_out; /**< the total bytes of output */
+};
+
+/**
+ * @brief Registered metrics and configuration.
+ */
+static GList *metrics_list = NULL;
+static gint64 metrics_last_dump = 0;
+static gint metrics_enabled = 0; /**< 0 if not loaded, 1 if disabled, 2 if enabled */
+G_LOCK_DEFINE_STATIC (metrics_list);
+
+/**
+ * @brief Get the index of bucket for the value.
+ */
+static guint
+_metrics_get_bucket (guint64 value)
+{
+  guint msb;
+
+  if (value < METRICS_SUB_BUCKETS)
+    return (guint) value;
+
+  msb = g_bit_storage (value) - 1;
+  if (msb > METRICS_MAX_BITS)
+    return METRICS_NUM_BUCKETS - 1;
+
+  return (msb - METRICS_SUB_BITS + 1) * METRICS_SUB_BUCKETS +
+      (guint) ((value >> (msb - METRICS_SUB_BITS)) & (METRICS_SUB_BUCKETS - 1));
+}
+
+/**
+ * @brief Get the upper bound of the values in the bucket.
+ */
+static guint64
+_metrics_get_bucket_upper (guint index)
+{
+  guint shift;
+  guint64 lower;
+
+  if (index < METRICS_SUB_BUCKETS)
+    return index;
+
+  shift = index / METRICS_SUB_BUCKETS - 1;
+  lower = ((guint64) METRICS_SUB_BUCKETS + index % METRICS_SUB_BUCKETS) << shift;
+
+  return lower + (G_GUINT64_CONSTANT (1) << shift) - 1;
+}
+
+/**
+ * @brief Add the value to the histogram.
+ */
+static void
+_metrics_hist_add (GstTensorHistogram * hist, guint64 value)
+{
+  hist->buckets[_metrics_get_bucket (value)]++;
+  hist->count++;
+  hist->sum += value;
+  if (value > hist->max)
+    hist->max = value;
+}
+
+/**
+ * @brief Get the percentile from the histogram.
+ */
+static guint64
+_metrics_hist_percentile (const GstTensorHistogram * hist, gdouble percentile)
+{
+  guint64 rank, accum = 0;
+  guint i;
+
+  if (hist->count == 0)
+    return 0;
+
+  if (percentile >= 100.0)
+    return hist->max;
+
+  rank = (guint64) (hist->count * MAX (percentile, 0.0) / 100.0);
+  if (rank == 0)
+    rank = 1;
+
+  for (i = 0; i < METRICS_NUM_BUCKETS; i++) {
+    accum += hist->buckets[i];
+    if (accum >= rank)
+      return MIN (_metrics_get_bucket_upper (i), hist->max);
+  }
+
+  return hist->max;
+}
+
+/**
+ * @brief Check the configuration to enable the metrics.
+ */
+static gboolean
+_metrics_is_enabled (void)
+{
+  gint enabled = g_atomic_int_get (&metrics_enabled);
+
+  if (enabled == 0) {
+    enabled = nnsconf_get_custom_value_bool ("metrics", "enable", FALSE) ?
+        2 : 1;
+    g_atomic_int_set (&metrics_enabled, enabled);
+  }
+
+  return (enabled == 2);
+}
+
+/**
+ * @brief Reload the configuration [metrics] enable when the next metrics is created.
+ */
+void
+gst_tensor_metrics_reload_config (void)
+{
+  g_atomic_int_set (&metrics_enabled, 0);
+}
+
+/**
+ * @brief Create the metrics of the element and register it.
+ */
+GstTensorMetrics *
+gst_tensor_metrics_new (GstElement * element, const gchar * kind)
+{
+  GstTensorMetrics *metrics;
+
+  g_return_val_if_fail (GST_IS_ELEMENT (element), NULL);
+
+  if (!_metrics_is_enabled ())
+    return NULL;
+
+  metrics = g_new0 (GstTensorMetrics, 1);
+  metrics->element = element;
+  metrics->kind = g_strdup (kind);
+  g_mutex_init (&metrics->lock);
+
+  G_LOCK (metrics_list);
+  metrics_list = g_list_append (metrics_list, metrics);
+  G_UNLOCK (metrics_list);
+
+  return metrics;
+}
+
+/**
+ * @brief Unregister and free the metrics.
+ */
+void
+gst_tensor_metrics_free (GstTensorMetrics * metrics)
+{
+  if (!metrics)
+    return;
+
+  G_LOCK (metrics_list);
+  metrics_list = g_list_remove (metrics_list, metrics);
+  G_UNLOCK (metrics_list);
+
+  g_mutex_clear (&metrics->lock);
+  g_free (metrics->kind);
+  g_free (metrics);
+}
+
+/**
+ * @brief Clear the recorded values of the metrics.
+ */
+void
+gst_tensor_metrics_reset (GstTensorMetrics * metrics)
+{
+  if (!metrics)
+    return;
+
+  g_mutex_lock (&metrics->lock);
+  memset (metrics->hist, 0, sizeof (metrics->hist));
+  metrics->bytes_in = metrics->bytes_out = 0;
+  g_mutex_unlock (&metrics->lock);
+}
+
+/**
+ * @brief Record the latency and the bytes of a frame.
+ */
+void
+gst_tensor_metrics_record (GstTensorMetrics * metrics, gint64 wait_us,
+    gint64 process_us, gsize bytes_in, gsize bytes_out)
+{
+  if (!metrics)
+    return;
+
+  g_mutex_lock (&metrics->lock);
+  if (wait_us >= 0)
+    _metrics_hist_add (&metrics->hist[NNS_METRICS_STAGE_WAIT], wait_us);
+  _metrics_hist_add (&metrics->hist[NNS_METRICS_STAGE_PROCESS],
+      MAX (process_us, 0));
+  metrics->bytes_in += bytes_in;
+  metrics->bytes_out += bytes_out;
+  g_mutex_unlock (&metrics->lock);
+
+  gst_tensor_metrics_dump (FALSE);
+}
+
+/**
+ * @brief Get the percentile of the latency.
+ */
+guint64
+gst_tensor_metrics_get_latency (GstTensorMetrics * metrics,
+    nns_metrics_stage stage, gdouble percentile)
+{
+  guint64 value;
+
+  g_return_val_if_fail (metrics != NULL, 0);
+  g_return_val_if_fail (stage < NNS_METRICS_STAGE_MAX, 0);
+
+  g_mutex_lock (&metrics->lock);
+  value = _metrics_hist_percentile (&metrics->hist[stage], percentile);
+  g_mutex_unlock (&metrics->lock);
+
+  return value;
+}
+
+/**
+ * @brief Snapshot of the metrics to print out.
+ */
+typedef struct
+{
+  gchar *labels; /**< labels of the element */
+  GstTensorHistogram hist[NNS_METRICS_STAGE_MAX]; /**< copied histograms */
+  guint64 bytes_in; /**< the total bytes of input */
+  guint64 bytes_out; /**< the total bytes of output */
+} GstTensorMetricsSnapshot;
+
+/**
+ * @brief Names of the stages in the labels.
+ */
+static const gchar *metrics_stage_names[NNS_METRICS_STAGE_MAX] = {
+  [NNS_METRICS_STAGE_WAIT] = "wait",
+  [NNS_METRICS_STAGE_PROCESS] = "process",
+};
+
+/**
+ * @brief Percentiles in the summary.
+ */
+static const gdouble metrics_quantiles[] = { 0.5, 0.95, 0.99 };
+
+/**
+ * @brief Escape the label value (backslash, double-quote and line feed).
+ */
+static gchar *
+_metrics_escape_label (const gchar * value)
+{
+  GString *str = g_string_new (NULL);
+
+  for (; value && *value; value++) {
+    if (*value == '\\' || *value == '"')
+      g_string_append_c (str, '\\');
+    if (*value == '\n')
+      g_string_append (str, "\\n");
+    else
+      g_string_append_c (str, *value);
+  }
+
+  return g_string_free (str, FALSE);
+}
+
+/**
+ * @brief Public function defined in the header.
+ */
+gchar *
+gst_tensor_metrics_to_text (void)
+{
+  GstTensorMetricsSnapshot *snaps;
+  GString *text;
+  GList *l;
+  guint i, j, k, num;
+
+  G_LOCK (metrics_list);
+  num = g_list_length (metrics_list);
+  snaps = g_new0 (GstTensorMetricsSnapshot, MAX (num, 1));
+
+  for (l = metrics_list, i = 0; l; l = l->next, i++) {
+    GstTensorMetrics *metrics = (GstTensorMetrics *) l->data;
+    gchar *name, *element, *kind;
+
+    name = gst_element_get_name (metrics->element);
+    element = _metrics_escape_label (name);
+    kind = _metrics_escape_label (metrics->kind);
+    snaps[i].labels = g_strdup_printf ("element=\"%s\",kind=\"%s\"", element,
+        kind);
+    g_free (name);
+    g_free (element);
+    g_free (kind);
+
+    g_mutex_lock (&metrics->lock);
+    memcpy (snaps[i].hist, metrics->hist, sizeof (metrics->hist));
+    snaps[i].bytes_in = metrics->bytes_in;
+    snaps[i].bytes_out = metrics->bytes_out;
+    g_mutex_unlock (&metrics->lock);
+  }
+  G_UNLOCK (metrics_list);
+
+  text = g_string_new (NULL);
+
+  g_string_append (text,
+      "# HELP nnstreamer_latency_seconds Latency of the element (wait: queued before processing, process: processing a frame).\n"
+      "# TYPE nnstreamer_latency_seconds summary\n");
+  for (i = 0; i < num; i++) {
+    for (j = 0; j < NNS_METRICS_STAGE_MAX; j++) {
+      GstTensorHistogram *hist = &snaps[i].hist[j];
+
+      if (hist->count == 0)
+        continue;
+
+      for (k = 0; k < G_N_ELEMENTS (metrics_quantiles); k++) {
+        g_string_append_printf (text,
+            "nnstreamer_latency_seconds{%s,stage=\"%s\",quantile=\"%g\"} %.6f\n",
+            snaps[i].labels, metrics_stage_names[j], metrics_quantiles[k],
+            _metrics_hist_percentile (hist,
+                metrics_quantiles[k] * 100.0) / 1e6);
+      }
+
+      g_string_append_printf (text,
+          "nnstreamer_latency_seconds_sum{%s,stage=\"%s\"} %.6f\n",
+          snaps[i].labels, metrics_stage_names[j], hist->sum / 1e6);
+      g_string_append_printf (text,
+          "nnstreamer_latency_seconds_count{%s,stage=\"%s\"} %" G_GUINT64_FORMAT
+          "\n", snaps[i].labels, metrics_stage_names[j], hist->count);
+    }
+  }
+
+  g_string_append (text,
+      "# HELP nnstreamer_latency_max_seconds Max latency of the element.\n"
+      "# TYPE nnstreamer_latency_max_seconds gauge\n");
+  for (i = 0; i < num; i++) {
+    for (j = 0; j < NNS_METRICS_STAGE_MAX; j++) {
+      if (snaps[i].hist[j].count == 0)
+        continue;
+
+      g_string_append_printf (text,
+          "nnstreamer_latency_max_seconds{%s,stage=\"%s\"} %.6f\n",
+          snaps[i].labels, metrics_stage_names[j], snaps[i].hist[j].max / 1e6);
+    }
+  }
+
+  g_string_append (text,
+      "# HELP nnstreamer_bytes_total Total bytes of the input and output.\n"
+      "# TYPE nnstreamer_bytes_total counter\n");
+  for (i = 0; i < num; i++) {
+    g_string_append_printf (text,
+        "nnstreamer_bytes_total{%s,direction=\"in\"} %" G_GUINT64_FORMAT "\n",
+        snaps[i].labels, snaps[i].bytes_in);
+    g_string_append_printf (text,
+        "nnstreamer_bytes_total{%s,direction=\"out\"} %" G_GUINT64_FORMAT "\n",
+        snaps[i].labels, snaps[i].bytes_out);
+  }
+
+  for (i = 0; i < num; i++)
+    g_free (snaps[i].labels);
+  g_free (snaps);
+
+  return g_string_free (text, FALSE);
+}
+
+/**
+ * @brief Write the metrics of all elements into the file given by the configuration [metrics] dump_file.
+ */
+void
+gst_tensor_metrics_dump (gboolean force)
+{
+  static gchar *dump_file = NULL;
+  static gint64 dump_interval = 0;
+  static gsize initialized = 0;
+  gchar *text;
+  GError *err = NULL;
+  gint64 now;
+
+  if (g_once_init_enter (&initialized)) {
+    gchar *val;
+
+    dump_file = nnsconf_get_custom_value_string ("metrics", "dump_file");
+    val = nnsconf_get_custom_value_string ("metrics", "dump_interval");
+    dump_interval = val ? g_ascii_strtoll (val, NULL, 10) : 0;
+    if (dump_interval <= 0)
+      dump_interval = METRICS_DEFAULT_DUMP_INTERVAL;
+    dump_interval *= G_USEC_PER_SEC;
+    g_free (val);
+
+    g_once_init_leave (&initialized, 1);
+  }
+
+  if (!dump_file || dump_file[0] == '\0')
+    return;
+
+  now = g_get_monotonic_time ();
+
+  G_LOCK (metrics_list);
+  if (!force && now - metrics_last_dump < dump_interval) {
+    G_UNLOCK (metrics_list);
+    return;
+  }
+  metrics_last_dump = now;
+  G_UNLOCK (metrics_list);
+
+  text = gst_tensor_metrics_to_text ();
+
+  /* the file is replaced atomically, the reader never gets the partial text */
+  if (!g_file_set_contents (dump_file, text, -1, &err)) {
+    nns_logw ("Failed to write the metrics to %s: %s", dump_file,
+        err ? err->message : "unknown error");
+    g_clear_error (&err);
+  }
+
+  g_free (text);
+}
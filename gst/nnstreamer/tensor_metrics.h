@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file	tensor_metrics.h
+ * @date	16 Oct 2026
+ * @brief	Internal latency histograms and counters of nnstreamer elements.
+ * @see	http://github.com/nnstreamer/nnstreamer
+ * @bug	No known bugs except for NYI items
+ *
+ * If the configuration [metrics] enable is TRUE (default FALSE), each element records the time waiting in the element (queue), the processing time and the bytes of the input and output.
+ * The latencies are accumulated in log-bucketed histograms (8 sub-buckets for each power of 2 in usec), thus the percentiles have an error less than 12.5%.
+ * The metrics of all elements are exported in Prometheus text format with gst_tensor_metrics_to_text().
+ * If the configuration [metrics] dump_file is given, the text is written into the file when an element stops and every dump_interval seconds (default 10).
+ */
+
+#ifndef __NNS_TENSOR_METRICS_H__
+#define __NNS_TENSOR_METRICS_H__
+
+#include <glib.h>
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief The stages of the element to measure the latency.
+ */
+typedef enum
+{
+  NNS_METRICS_STAGE_WAIT = 0, /**< Time from the arrival of the input to the start of processing (e.g., queued for batch or workers) */
+  NNS_METRICS_STAGE_PROCESS, /**< Time to process the input (e.g., invoke of the model) */
+
+  NNS_METRICS_STAGE_MAX
+} nns_metrics_stage;
+
+typedef struct _GstTensorMetrics GstTensorMetrics;
+
+/**
+ * @brief Create the metrics of the element and register it.
+ * @param element the element to be measured
+ * @param kind the kind of the element (e.g., "tensor_filter")
+ * @return Newly allocated metrics (NULL if the metrics is disabled with the configuration [metrics] enable). Caller should release it using gst_tensor_metrics_free().
+ */
+extern GstTensorMetrics *
+gst_tensor_metrics_new (GstElement * element, const gchar * kind);
+
+/**
+ * @brief Unregister and free the metrics.
+ * @param metrics the metrics to be released
+ */
+extern void
+gst_tensor_metrics_free (GstTensorMetrics * metrics);
+
+/**
+ * @brief Clear the recorded values of the metrics.
+ * @param metrics the metrics to be cleared
+ */
+extern void
+gst_tensor_metrics_reset (GstTensorMetrics * metrics);
+
+/**
+ * @brief Record the latency and the bytes of a frame.
+ * @param metrics the metrics to be updated (do nothing if NULL)
+ * @param wait_us the time (usec) waiting before processing, negative value if it is not measured
+ * @param process_us the time (usec) to process the frame
+ * @param bytes_in the size of the input
+ * @param bytes_out the size of the output
+ */
+extern void
+gst_tensor_metrics_record (GstTensorMetrics * metrics, gint64 wait_us,
+    gint64 process_us, gsize bytes_in, gsize bytes_out);
+
+/**
+ * @brief Get the percentile of the latency.
+ * @param metrics the metrics
+ * @param stage the stage to get the latency
+ * @param percentile the percentile (0 to 100). Set 100 to get the max value.
+ * @return The latency (usec). 0 if nothing is recorded.
+ */
+extern guint64
+gst_tensor_metrics_get_latency (GstTensorMetrics * metrics,
+    nns_metrics_stage stage, gdouble percentile);
+
+/**
+ * @brief Write the metrics of all elements into the file given by the configuration [metrics] dump_file.
+ * @param force TRUE to write the file regardless of the dump interval
+ */
+extern void
+gst_tensor_metrics_dump (gboolean force);
+
+/**
+ * @brief Reload the configuration [metrics] enable when the next metrics is created.
+ * @note The configuration is read once in the process. This is for the unit tests changing the configuration.
+ */
+extern void
+gst_tensor_metrics_reload_config (void);
+
+G_END_DECLS
+#endif /* __NNS_TENSOR_METRICS_H__ */
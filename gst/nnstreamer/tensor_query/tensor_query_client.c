@@ -47,6 +47,7 @@ enum
   PROP_TIMEOUT,
   PROP_SILENT,
   PROP_MAX_REQUEST,
+  PROP_POLICY,
 };
 
 #define TCP_HIGHEST_PORT        65535
@@ -56,6 +57,20 @@ enum
 #define DEFAULT_CLIENT_TIMEOUT  0
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_MAX_REQUEST 2
+#define DEFAULT_POLICY QUERY_CLIENT_POLICY_DROP
+
+/**
+ * @brief Data structure of the in-flight request.
+ */
+typedef struct
+{
+  guint64 id; /**< id of the request */
+  gint64 sent_time; /**< monotonic time (in us) when the request is sent */
+  GstBuffer *meta_buf; /**< empty buffer holding the metadata of incoming buffer */
+  nns_edge_data_h data_h; /**< response from query server, NULL if not received yet */
+} GstTensorQueryRequest;
+
+#define GST_TYPE_QUERY_CLIENT_POLICY (gst_tensor_query_client_policy_get_type ())
 
 GST_DEBUG_CATEGORY_STATIC (gst_tensor_query_client_debug);
 #define GST_CAT_DEFAULT gst_tensor_query_client_debug
@@ -93,6 +108,33 @@ static GstFlowReturn gst_tensor_query_client_chain (GstPad * pad,
     GstObject * parent, GstBuffer * buf);
 static GstCaps *gst_tensor_query_client_query_caps (GstTensorQueryClient * self,
     GstPad * pad, GstCaps * filter);
+static GstStateChangeReturn gst_tensor_query_client_change_state (GstElement *
+    element, GstStateChange transition);
+static void gst_tensor_query_client_clear_requests (GstTensorQueryClient *
+    self);
+static void gst_tensor_query_client_receive (GstTensorQueryClient * self,
+    nns_edge_data_h data_h);
+
+/**
+ * @brief Register GEnumValue array for query client policy property.
+ */
+static GType
+gst_tensor_query_client_policy_get_type (void)
+{
+  static GType policy = 0;
+  if (policy == 0) {
+    static GEnumValue policies[] = {
+      {QUERY_CLIENT_POLICY_DROP, "drop",
+          "Drop the input buffer if all requests are in-flight."},
+      {QUERY_CLIENT_POLICY_QUEUE, "queue",
+          "Wait for the response of the oldest request if all requests are in-flight."},
+      {0, NULL, NULL},
+    };
+    policy = g_enum_register_static ("tensor_query_client_policy", policies);
+  }
+
+  return policy;
+}
 
 /**
  * @brief initialize the class
@@ -109,6 +151,7 @@ gst_tensor_query_client_class_init (GstTensorQueryClientClass * klass)
   gobject_class->set_property = gst_tensor_query_client_set_property;
   gobject_class->get_property = gst_tensor_query_client_get_property;
   gobject_class->finalize = gst_tensor_query_client_finalize;
+  gstelement_class->change_state = gst_tensor_query_client_change_state;
 
   /** install property goes here */
   g_object_class_install_property (gobject_class, PROP_HOST,
@@ -144,16 +187,23 @@ gst_tensor_query_client_class_init (GstTensorQueryClientClass * klass)
 
   g_object_class_install_property (gobject_class, PROP_TIMEOUT,
       g_param_spec_uint ("timeout", "timeout value",
-          "A timeout value (in ms) to wait message from query server after sending buffer to server. 0 means no wait.",
+          "The lifetime (in ms) of each request. The responses are pushed as soon as they arrive, "
+          "and the request without response from query server is discarded after timeout. "
+          "0 means default timeout (10 sec).",
           0, G_MAXUINT, DEFAULT_CLIENT_TIMEOUT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   g_object_class_install_property (gobject_class, PROP_MAX_REQUEST,
       g_param_spec_uint ("max-request", "Maximum number of request",
-          "Sets the maximum number of buffers to request to the query server. "
-          "If the processing speed of query server is slower than the query client, the input buffer is dropped. "
+          "Sets the maximum number of in-flight requests to the query server. "
+          "If the processing speed of query server is slower than the query client, the input buffer is handled with the policy. "
           "Two buffers are requested by default, and 0 means that all buffers are sent to query server without drop. ",
           0, G_MAXUINT, DEFAULT_MAX_REQUEST,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_POLICY,
+      g_param_spec_enum ("policy", "Policy",
+          "The policy when the number of in-flight requests reaches max-request.",
+          GST_TYPE_QUERY_CLIENT_POLICY, DEFAULT_POLICY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&sinktemplate));
   gst_element_class_add_pad_template (gstelement_class,
@@ -199,9 +249,15 @@ gst_tensor_query_client_init (GstTensorQueryClient * self)
   self->in_caps_str = NULL;
   self->timeout = DEFAULT_CLIENT_TIMEOUT;
   self->edge_h = NULL;
-  self->msg_queue = g_async_queue_new ();
   self->max_request = DEFAULT_MAX_REQUEST;
-  self->requested_num = 0;
+  self->policy = DEFAULT_POLICY;
+  self->request_id = 1;
+  g_queue_init (&self->pending);
+  g_mutex_init (&self->lock);
+  g_cond_init (&self->cond);
+  self->running = FALSE;
+  self->pushing = FALSE;
+  self->last_flow = GST_FLOW_OK;
   self->is_tensor = FALSE;
   gst_tensors_config_init (&self->config);
 }
@@ -213,7 +269,6 @@ static void
 gst_tensor_query_client_finalize (GObject * object)
 {
   GstTensorQueryClient *self = GST_TENSOR_QUERY_CLIENT (object);
-  nns_edge_data_h data_h;
 
   g_free (self->host);
   self->host = NULL;
@@ -224,20 +279,15 @@ gst_tensor_query_client_finalize (GObject * object)
   g_free (self->in_caps_str);
   self->in_caps_str = NULL;
 
-  while ((data_h = g_async_queue_try_pop (self->msg_queue))) {
-    nns_edge_data_destroy (data_h);
-  }
-
-  if (self->msg_queue) {
-    g_async_queue_unref (self->msg_queue);
-    self->msg_queue = NULL;
-  }
-
   if (self->edge_h) {
     nns_edge_release_handle (self->edge_h);
     self->edge_h = NULL;
   }
 
+  gst_tensor_query_client_clear_requests (self);
+  g_mutex_clear (&self->lock);
+  g_cond_clear (&self->cond);
+
   gst_tensors_config_free (&self->config);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -296,6 +346,9 @@ gst_tensor_query_client_set_property (GObject * object, guint prop_id,
     case PROP_MAX_REQUEST:
       self->max_request = g_value_get_uint (value);
       break;
+    case PROP_POLICY:
+      self->policy = g_value_get_enum (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -339,6 +392,9 @@ gst_tensor_query_client_get_property (GObject * object, guint prop_id,
     case PROP_MAX_REQUEST:
       g_value_set_uint (value, self->max_request);
       break;
+    case PROP_POLICY:
+      g_value_set_enum (value, self->policy);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -504,7 +560,11 @@ _nns_edge_event_cb (nns_edge_event_h event_h, void *user_data)
       nns_edge_data_h data;
 
       nns_edge_event_parse_new_data (event_h, &data);
-      g_async_queue_push (self->msg_queue, data);
+
+      g_mutex_lock (&self->lock);
+      gst_tensor_query_client_receive (self, data);
+      g_cond_broadcast (&self->cond);
+      g_mutex_unlock (&self->lock);
       break;
     }
     default:
@@ -580,6 +640,252 @@ done:
   return started;
 }
 
+/**
+ * @brief Free the in-flight request.
+ */
+static void
+gst_tensor_query_request_free (gpointer data)
+{
+  GstTensorQueryRequest *req = (GstTensorQueryRequest *) data;
+
+  if (!req)
+    return;
+
+  if (req->meta_buf)
+    gst_buffer_unref (req->meta_buf);
+  if (req->data_h)
+    nns_edge_data_destroy (req->data_h);
+  g_free (req);
+}
+
+/**
+ * @brief Clear all in-flight requests and received responses.
+ */
+static void
+gst_tensor_query_client_clear_requests (GstTensorQueryClient * self)
+{
+  g_queue_clear_full (&self->pending, gst_tensor_query_request_free);
+}
+
+/**
+ * @brief Get the timeout (in ms) of in-flight request.
+ */
+static gint64
+gst_tensor_query_client_get_request_timeout (GstTensorQueryClient * self)
+{
+  if (self->timeout > 0)
+    return (gint64) self->timeout;
+
+  return (gint64) QUERY_DEFAULT_TIMEOUT_SEC * 1000;
+}
+
+/**
+ * @brief Match the response from query server with the in-flight request. The caller should hold the lock.
+ * @note The response without request id (old server) is matched with the first request that is not responded.
+ */
+static void
+gst_tensor_query_client_receive (GstTensorQueryClient * self,
+    nns_edge_data_h data_h)
+{
+  GstTensorQueryRequest *req = NULL;
+  guint64 id = 0;
+  gchar *val = NULL;
+  GList *l;
+
+  if (nns_edge_data_get_info (data_h, "request_id", &val) ==
+      NNS_EDGE_ERROR_NONE) {
+    id = g_ascii_strtoull (val, NULL, 10);
+    g_free (val);
+  }
+
+  for (l = self->pending.head; l; l = l->next) {
+    GstTensorQueryRequest *r = (GstTensorQueryRequest *) l->data;
+
+    if (r->data_h)
+      continue;
+
+    if (id == 0 || r->id == id) {
+      req = r;
+      break;
+    }
+  }
+
+  if (req) {
+    req->data_h = data_h;
+  } else {
+    GST_DEBUG_OBJECT (self, "Drop the response of unknown request %"
+        G_GUINT64_FORMAT, id);
+    nns_edge_data_destroy (data_h);
+  }
+}
+
+/**
+ * @brief Wait until the oldest request is responded, and discard the requests which are not responded until timeout. The caller should hold the lock.
+ * @return the oldest request with the response, NULL if the task is stopped
+ */
+static GstTensorQueryRequest *
+gst_tensor_query_client_wait_response (GstTensorQueryClient * self)
+{
+  GstTensorQueryRequest *req;
+  gint64 end_time;
+
+  while (self->running) {
+    req = (GstTensorQueryRequest *) g_queue_peek_head (&self->pending);
+    if (!req) {
+      g_cond_wait (&self->cond, &self->lock);
+      continue;
+    }
+
+    if (req->data_h)
+      return req;
+
+    end_time = req->sent_time + gst_tensor_query_client_get_request_timeout
+        (self) * G_TIME_SPAN_MILLISECOND;
+    if (g_get_monotonic_time () >= end_time) {
+      nns_logw ("No response of the request %" G_GUINT64_FORMAT
+          " from the query server, drop it.", req->id);
+      gst_tensor_query_request_free (g_queue_pop_head (&self->pending));
+
+      /* release the credit */
+      g_cond_broadcast (&self->cond);
+      continue;
+    }
+
+    g_cond_wait_until (&self->cond, &self->lock, end_time);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Src pad task to push the responses in the order of sending.
+ * @details The responses are pushed as soon as they arrive, and the serialized events wait until all in-flight requests are pushed or expired before they are forwarded, so that the stream order is kept.
+ */
+static void
+gst_tensor_query_client_loop (gpointer data)
+{
+  GstTensorQueryClient *self = GST_TENSOR_QUERY_CLIENT (data);
+  GstTensorQueryRequest *req;
+  GstFlowReturn res;
+  GstBuffer *out_buf;
+  nns_edge_data_h data_h;
+
+  g_mutex_lock (&self->lock);
+  req = gst_tensor_query_client_wait_response (self);
+  if (!req) {
+    g_mutex_unlock (&self->lock);
+    gst_pad_pause_task (self->srcpad);
+    return;
+  }
+
+  g_queue_pop_head (&self->pending);
+  self->pushing = TRUE;
+  g_mutex_unlock (&self->lock);
+
+  /* wrap the response without copy, edge data is released with the buffer */
+  data_h = req->data_h;
+  req->data_h = NULL;
+
+  out_buf = gst_buffer_new ();
+  if (gst_tensor_query_data_append_to_buffer (data_h, out_buf,
+          self->is_tensor ? &self->config.info : NULL)) {
+    /* metadata from incoming buffer */
+    gst_buffer_copy_into (out_buf, req->meta_buf, GST_BUFFER_COPY_METADATA,
+        0, -1);
+
+    res = gst_pad_push (self->srcpad, out_buf);
+  } else {
+    gst_buffer_unref (out_buf);
+    res = GST_FLOW_ERROR;
+  }
+
+  gst_tensor_query_request_free (req);
+
+  g_mutex_lock (&self->lock);
+  self->pushing = FALSE;
+  self->last_flow = res;
+  g_cond_broadcast (&self->cond);
+  g_mutex_unlock (&self->lock);
+
+  if (res != GST_FLOW_OK) {
+    if (res == GST_FLOW_NOT_LINKED || res < GST_FLOW_EOS)
+      GST_ELEMENT_FLOW_ERROR (self, res);
+
+    /* the flow result is returned to upstream in the next chain call */
+    gst_pad_pause_task (self->srcpad);
+  }
+}
+
+/**
+ * @brief Start the src pad task to push the responses.
+ */
+static void
+gst_tensor_query_client_start_task (GstTensorQueryClient * self)
+{
+  g_mutex_lock (&self->lock);
+  self->running = TRUE;
+  self->last_flow = GST_FLOW_OK;
+  g_mutex_unlock (&self->lock);
+
+  gst_pad_start_task (self->srcpad, gst_tensor_query_client_loop, self, NULL);
+}
+
+/**
+ * @brief Stop the src pad task. The task holds the stream lock of the src pad, thus it should be stopped before the pads are deactivated.
+ * @param pause TRUE to pause the task (flushing), FALSE to stop the task.
+ */
+static void
+gst_tensor_query_client_stop_task (GstTensorQueryClient * self,
+    gboolean pause)
+{
+  g_mutex_lock (&self->lock);
+  self->running = FALSE;
+  g_cond_broadcast (&self->cond);
+  g_mutex_unlock (&self->lock);
+
+  if (pause)
+    gst_pad_pause_task (self->srcpad);
+  else
+    gst_pad_stop_task (self->srcpad);
+
+  g_mutex_lock (&self->lock);
+  gst_tensor_query_client_clear_requests (self);
+  g_mutex_unlock (&self->lock);
+}
+
+/**
+ * @brief Wait until all in-flight requests are pushed or expired before a serialized event is forwarded.
+ */
+static void
+gst_tensor_query_client_drain (GstTensorQueryClient * self)
+{
+  g_mutex_lock (&self->lock);
+  while (self->running && self->last_flow == GST_FLOW_OK &&
+      (!g_queue_is_empty (&self->pending) || self->pushing))
+    g_cond_wait (&self->cond, &self->lock);
+  g_mutex_unlock (&self->lock);
+}
+
+/**
+ * @brief Change state of query client.
+ */
+static GstStateChangeReturn
+gst_tensor_query_client_change_state (GstElement * element,
+    GstStateChange transition)
+{
+  GstTensorQueryClient *self = GST_TENSOR_QUERY_CLIENT (element);
+
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_tensor_query_client_stop_task (self, FALSE);
+      break;
+    default:
+      break;
+  }
+
+  return GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+}
+
 /**
  * @brief This function handles sink event.
  */
@@ -588,6 +894,7 @@ gst_tensor_query_client_sink_event (GstPad * pad,
     GstObject * parent, GstEvent * event)
 {
   GstTensorQueryClient *self = GST_TENSOR_QUERY_CLIENT (parent);
+  gboolean ret;
 
   GST_DEBUG_OBJECT (self, "Received %s event: %" GST_PTR_FORMAT,
       GST_EVENT_TYPE_NAME (event), event);
@@ -596,20 +903,34 @@ gst_tensor_query_client_sink_event (GstPad * pad,
     case GST_EVENT_CAPS:
     {
       GstCaps *caps;
-      gboolean ret;
+
+      gst_tensor_query_client_drain (self);
 
       gst_event_parse_caps (event, &caps);
       g_free (self->in_caps_str);
       self->in_caps_str = gst_caps_to_string (caps);
 
       ret = gst_tensor_query_client_create_edge_handle (self);
-      if (!ret)
+      if (ret)
+        gst_tensor_query_client_start_task (self);
+      else
         nns_loge ("Failed to create edge handle, cannot start query client.");
 
       gst_event_unref (event);
       return ret;
     }
+    case GST_EVENT_FLUSH_START:
+      ret = gst_pad_event_default (pad, parent, event);
+      gst_tensor_query_client_stop_task (self, TRUE);
+      return ret;
+    case GST_EVENT_FLUSH_STOP:
+      ret = gst_pad_event_default (pad, parent, event);
+      if (self->edge_h)
+        gst_tensor_query_client_start_task (self);
+      return ret;
     default:
+      if (GST_EVENT_IS_SERIALIZED (event))
+        gst_tensor_query_client_drain (self);
       break;
   }
 
@@ -669,32 +990,54 @@ gst_tensor_query_client_sink_query (GstPad * pad,
 
 /**
  * @brief Chain function, this function does the actual processing.
+ * @note The requests are pipelined up to max-request, the responses are pushed in the order of sending by the src pad task.
  */
 static GstFlowReturn
 gst_tensor_query_client_chain (GstPad * pad,
     GstObject * parent, GstBuffer * buf)
 {
   GstTensorQueryClient *self = GST_TENSOR_QUERY_CLIENT (parent);
-  GstBuffer *out_buf = NULL;
+  GstTensorQueryRequest *req = NULL;
   GstFlowReturn res = GST_FLOW_OK;
   nns_edge_data_h data_h = NULL;
-  guint i, num_tensors = 0, num_data = 0;
+  guint i, num_tensors = 0;
   int ret = NNS_EDGE_ERROR_NONE;
   GstMemory *mem[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo map[NNS_TENSOR_SIZE_LIMIT];
+  gboolean drop = FALSE;
+  guint64 id;
   gchar *val;
   UNUSED (pad);
 
-  if (self->max_request > 0 && self->requested_num > self->max_request) {
+  /* wait for the credit, the src pad task releases it when the response is pushed or expired */
+  g_mutex_lock (&self->lock);
+  while (self->running && self->last_flow == GST_FLOW_OK &&
+      self->max_request > 0 &&
+      g_queue_get_length (&self->pending) >= self->max_request) {
+    if (self->policy == QUERY_CLIENT_POLICY_DROP) {
+      drop = TRUE;
+      break;
+    }
+
+    g_cond_wait (&self->cond, &self->lock);
+  }
+
+  res = self->running ? self->last_flow : GST_FLOW_FLUSHING;
+  g_mutex_unlock (&self->lock);
+
+  if (res != GST_FLOW_OK)
+    goto done;
+
+  if (drop) {
     nns_logi
         ("The processing speed of the query server is too slow. Drop the input buffer.");
-    goto try_pop;
+    goto done;
   }
 
   ret = nns_edge_data_create (&data_h);
   if (ret != NNS_EDGE_ERROR_NONE) {
     nns_loge ("Failed to create data handle in client chain.");
-    goto try_pop;
+    goto done;
   }
 
   num_tensors = gst_tensor_buffer_get_count (buf);
@@ -704,7 +1047,7 @@ gst_tensor_query_client_chain (GstPad * pad,
       ml_loge ("Cannot map the %uth memory in gst-buffer.", i);
       gst_memory_unref (mem[i]);
       num_tensors = i;
-      goto try_pop;
+      goto done;
     }
     nns_edge_data_add (data_h, map[i].data, map[i].size, NULL);
   }
@@ -713,60 +1056,38 @@ gst_tensor_query_client_chain (GstPad * pad,
   nns_edge_data_set_info (data_h, "client_id", val);
   g_free (val);
 
-  ret = nns_edge_send (self->edge_h, data_h);
-  if (ret == NNS_EDGE_ERROR_NONE) {
-    self->requested_num++;
-  } else {
-    nns_loge ("Failed to publish to server node.");
-  }
-
-try_pop:
-  if (data_h)
-    nns_edge_data_destroy (data_h);
-
-  data_h = g_async_queue_timeout_pop (self->msg_queue,
-      self->timeout * G_TIME_SPAN_MILLISECOND);
-  if (data_h) {
-    if (self->requested_num > 0)
-      self->requested_num--;
-    ret = nns_edge_data_get_count (data_h, &num_data);
-
-    if (ret == NNS_EDGE_ERROR_NONE && num_data > 0) {
-      GstMemory *new_mem;
-      GstTensorInfo *_info;
+  req = g_new0 (GstTensorQueryRequest, 1);
+  req->meta_buf = gst_buffer_new ();
+  gst_buffer_copy_into (req->meta_buf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
 
-      out_buf = gst_buffer_new ();
+  /* the request should be in-flight before sending, the response may arrive before nns_edge_send() returns. */
+  g_mutex_lock (&self->lock);
+  id = req->id = self->request_id++;
+  req->sent_time = g_get_monotonic_time ();
+  g_queue_push_tail (&self->pending, req);
+  g_cond_broadcast (&self->cond);
+  g_mutex_unlock (&self->lock);
 
-      for (i = 0; i < num_data; i++) {
-        void *data = NULL;
-        nns_size_t data_len;
-        gpointer new_data;
-
-        nns_edge_data_get (data_h, i, &data, &data_len);
-        new_data = _g_memdup (data, data_len);
-
-        new_mem = gst_memory_new_wrapped (0, new_data, data_len, 0, data_len,
-            new_data, g_free);
-
-        if (self->is_tensor) {
-          _info = gst_tensors_info_get_nth_info (&self->config.info, i);
-          gst_tensor_buffer_append_memory (out_buf, new_mem, _info);
-        } else {
-          gst_buffer_append_memory (out_buf, new_mem);
-        }
-      }
+  val = g_strdup_printf ("%" G_GUINT64_FORMAT, id);
+  nns_edge_data_set_info (data_h, "request_id", val);
+  g_free (val);
 
-      /* metadata from incoming buffer */
-      gst_buffer_copy_into (out_buf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  ret = nns_edge_send (self->edge_h, data_h);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_loge ("Failed to publish to server node.");
 
-      res = gst_pad_push (self->srcpad, out_buf);
-    } else {
-      nns_loge ("Failed to get the number of memories of the edge data.");
-      res = GST_FLOW_ERROR;
+    /* the request may be already expired and released by the src pad task */
+    g_mutex_lock (&self->lock);
+    if (g_queue_remove (&self->pending, req)) {
+      gst_tensor_query_request_free (req);
+      g_cond_broadcast (&self->cond);
     }
+    g_mutex_unlock (&self->lock);
+  }
 
+done:
+  if (data_h)
     nns_edge_data_destroy (data_h);
-  }
 
   for (i = 0; i < num_tensors; i++) {
     gst_memory_unmap (mem[i], &map[i]);
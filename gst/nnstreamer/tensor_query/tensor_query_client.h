@@ -35,6 +35,15 @@ G_BEGIN_DECLS
 typedef struct _GstTensorQueryClient GstTensorQueryClient;
 typedef struct _GstTensorQueryClientClass GstTensorQueryClientClass;
 
+/**
+ * @brief Policy of query client when the number of in-flight requests reaches max-request.
+ */
+typedef enum
+{
+  QUERY_CLIENT_POLICY_DROP = 0, /**< drop the input buffer */
+  QUERY_CLIENT_POLICY_QUEUE, /**< wait for the response of the oldest request */
+} tensor_query_client_policy;
+
 /**
  * @brief GstTensorQueryClient data structure.
  */
@@ -48,7 +57,7 @@ struct _GstTensorQueryClient
   gchar *in_caps_str;
   gboolean is_tensor;
   GstTensorsConfig config;
-  guint timeout; /**< timeout value (in ms) to wait message from server */
+  guint timeout; /**< lifetime (in ms) of the request, the request without response is discarded after timeout */
 
   /* Query-hybrid feature */
   gchar *topic; /**< Main operation such as 'object_detection' or 'image_segmentation' */
@@ -59,10 +68,17 @@ struct _GstTensorQueryClient
 
   nns_edge_connect_type_e connect_type;
   nns_edge_h edge_h;
-  GAsyncQueue *msg_queue;
 
-  guint max_request;
-  guint requested_num;
+  guint max_request; /**< the number of in-flight requests (credits), 0 for no limit */
+  tensor_query_client_policy policy; /**< policy when all credits are in use */
+  guint64 request_id; /**< id of the next request */
+  GQueue pending; /**< in-flight requests in the order of sending */
+
+  GMutex lock; /**< lock for the in-flight requests */
+  GCond cond; /**< signaled when a response is received or a request is released */
+  gboolean running; /**< TRUE while the src pad task pushes the responses */
+  gboolean pushing; /**< TRUE while a response is being pushed to the src pad */
+  GstFlowReturn last_flow; /**< the result of the last push in the src pad task */
 };
 
 /**
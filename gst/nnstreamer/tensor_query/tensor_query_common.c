@@ -43,3 +43,81 @@ gst_tensor_query_get_connect_type (void)
 
   return protocol;
 }
+
+/**
+ * @brief Internal data to release the edge data when all wrapped memories are freed.
+ */
+typedef struct
+{
+  nns_edge_data_h data_h; /**< edge data handle */
+  gint refcount; /**< the number of memories referring the edge data */
+} GstTensorQueryDataHolder;
+
+/**
+ * @brief Internal function to release the edge data.
+ */
+static void
+_gst_tensor_query_data_holder_unref (gpointer data)
+{
+  GstTensorQueryDataHolder *holder = (GstTensorQueryDataHolder *) data;
+
+  if (g_atomic_int_dec_and_test (&holder->refcount)) {
+    nns_edge_data_destroy (holder->data_h);
+    g_free (holder);
+  }
+}
+
+/**
+ * @brief Append the memories of edge data to the buffer without copy.
+ */
+gboolean
+gst_tensor_query_data_append_to_buffer (nns_edge_data_h data_h, GstBuffer * buffer,
+    GstTensorsInfo * info)
+{
+  GstTensorQueryDataHolder *holder;
+  GstMemory *mem;
+  GstTensorInfo *_info;
+  guint i, num_data = 0;
+  gboolean appended = TRUE;
+  int ret;
+
+  g_return_val_if_fail (data_h != NULL, FALSE);
+
+  ret = nns_edge_data_get_count (data_h, &num_data);
+  if (ret != NNS_EDGE_ERROR_NONE || num_data == 0) {
+    nns_loge ("Failed to get the number of memories of the edge data.");
+    nns_edge_data_destroy (data_h);
+    return FALSE;
+  }
+
+  /* the holder is referred by this function until all memories are wrapped */
+  holder = g_new0 (GstTensorQueryDataHolder, 1);
+  holder->data_h = data_h;
+  holder->refcount = 1;
+
+  for (i = 0; i < num_data; i++) {
+    void *data = NULL;
+    nns_size_t data_len = 0;
+
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_loge ("Failed to get the %uth memory of the edge data.", i);
+      appended = FALSE;
+      break;
+    }
+
+    g_atomic_int_inc (&holder->refcount);
+    mem = gst_memory_new_wrapped (0, data, data_len, 0, data_len, holder,
+        _gst_tensor_query_data_holder_unref);
+
+    if (info) {
+      _info = gst_tensors_info_get_nth_info (info, i);
+      gst_tensor_buffer_append_memory (buffer, mem, _info);
+    } else {
+      gst_buffer_append_memory (buffer, mem);
+    }
+  }
+
+  _gst_tensor_query_data_holder_unref (holder);
+  return appended;
+}
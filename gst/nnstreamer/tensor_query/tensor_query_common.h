@@ -40,6 +40,17 @@ extern "C" {
 GType
 gst_tensor_query_get_connect_type (void);
 
+/**
+ * @brief Append the memories of edge data to the buffer without copy.
+ * @param data_h the edge data handle, the ownership is transferred and it is destroyed when all memories are released
+ * @param buffer the buffer to append the memories
+ * @param info tensors info to append the memories as tensors, NULL to append raw memories
+ * @return TRUE if all memories are appended
+ */
+gboolean
+gst_tensor_query_data_append_to_buffer (nns_edge_data_h data_h,
+    GstBuffer * buffer, GstTensorsInfo * info);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
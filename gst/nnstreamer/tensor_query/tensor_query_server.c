@@ -172,20 +172,70 @@ done:
   return prepared;
 }
 
+/**
+ * @brief Internal function to send a slot of the buffer to connected edge device.
+ * @param index the index of the slot in the outermost dimension
+ * @param count the number of slots in the buffer, 1 if the buffer is not batched
+ */
+static gboolean
+gst_tensor_query_server_send_data (GstTensorQueryServer * data,
+    GstMapInfo * map, const guint num_tensors, const guint index,
+    const guint count, query_client_id_t client_id,
+    query_request_id_t request_id)
+{
+  nns_edge_data_h data_h;
+  guint i;
+  gint ret;
+  gchar *val;
+
+  ret = nns_edge_data_create (&data_h);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_loge ("Failed to create edge data handle in query server.");
+    return FALSE;
+  }
+
+  for (i = 0; i < num_tensors; i++) {
+    gsize size = map[i].size / count;
+
+    nns_edge_data_add (data_h, map[i].data + size * index, size, NULL);
+  }
+
+  val = g_strdup_printf ("%lld", (long long) client_id);
+  nns_edge_data_set_info (data_h, "client_id", val);
+  g_free (val);
+
+  if (request_id > 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, request_id);
+    nns_edge_data_set_info (data_h, "request_id", val);
+    g_free (val);
+  }
+
+  g_mutex_lock (&data->lock);
+  ret = nns_edge_send (data->edge_h, data_h);
+  g_mutex_unlock (&data->lock);
+
+  nns_edge_data_destroy (data_h);
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_loge ("Failed to send edge data handle in query server.");
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief Send buffer to connected edge device.
+ * @note If the buffer is batched, each slot is sent to the client of the request.
  */
 gboolean
 gst_tensor_query_server_send_buffer (const guint id, GstBuffer * buffer)
 {
   GstTensorQueryServer *data;
   GstMetaQuery *meta_query;
-  nns_edge_data_h data_h;
   guint i, num_tensors = 0;
-  gint ret = NNS_EDGE_ERROR_NONE;
   GstMemory *mem[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo map[NNS_TENSOR_SIZE_LIMIT];
-  gchar *val;
   gboolean sent = FALSE;
 
   data = gst_tensor_query_server_get_handle (id);
@@ -201,12 +251,6 @@ gst_tensor_query_server_send_buffer (const guint id, GstBuffer * buffer)
     return FALSE;
   }
 
-  ret = nns_edge_data_create (&data_h);
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_loge ("Failed to create edge data handle in query server.");
-    return FALSE;
-  }
-
   num_tensors = gst_tensor_buffer_get_count (buffer);
   for (i = 0; i < num_tensors; i++) {
     mem[i] = gst_tensor_buffer_get_nth_memory (buffer, i);
@@ -217,33 +261,41 @@ gst_tensor_query_server_send_buffer (const guint id, GstBuffer * buffer)
       num_tensors = i;
       goto done;
     }
-
-    nns_edge_data_add (data_h, map[i].data, map[i].size, NULL);
   }
 
-  val = g_strdup_printf ("%lld", (long long) meta_query->client_id);
-  nns_edge_data_set_info (data_h, "client_id", val);
-  g_free (val);
+  if (meta_query->num_items > 0 && meta_query->items) {
+    /* batched buffer, split the outermost dimension and send it to each client */
+    if (meta_query->num_items > meta_query->batch_size) {
+      nns_loge ("Failed to send buffer, invalid number of batched requests.");
+      goto done;
+    }
 
-  g_mutex_lock (&data->lock);
-  ret = nns_edge_send (data->edge_h, data_h);
-  g_mutex_unlock (&data->lock);
+    for (i = 0; i < num_tensors; i++) {
+      if (map[i].size % meta_query->batch_size != 0) {
+        nns_loge ("Failed to send buffer, the size of %uth tensor is not a "
+            "multiple of batch size %u.", i, meta_query->batch_size);
+        goto done;
+      }
+    }
 
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_loge ("Failed to send edge data handle in query server.");
-    goto done;
+    sent = TRUE;
+    for (i = 0; i < meta_query->num_items; i++) {
+      if (!gst_tensor_query_server_send_data (data, map, num_tensors, i,
+              meta_query->batch_size, meta_query->items[i].client_id,
+              meta_query->items[i].request_id))
+        sent = FALSE;
+    }
+  } else {
+    sent = gst_tensor_query_server_send_data (data, map, num_tensors, 0, 1,
+        meta_query->client_id, meta_query->request_id);
   }
 
-  sent = TRUE;
-
 done:
   for (i = 0; i < num_tensors; i++) {
     gst_memory_unmap (mem[i], &map[i]);
     gst_memory_unref (mem[i]);
   }
 
-  nns_edge_data_destroy (data_h);
-
   return sent;
 }
 
@@ -361,6 +413,115 @@ gst_tensor_query_server_set_caps (const guint id, const gchar * caps_str)
   g_mutex_unlock (&data->lock);
 }
 
+/**
+ * @brief Set the number of requests batched in a buffer.
+ */
+void
+gst_tensor_query_server_set_batch_size (const guint id, const guint batch_size)
+{
+  GstTensorQueryServer *data;
+
+  data = gst_tensor_query_server_get_handle (id);
+
+  if (NULL == data) {
+    return;
+  }
+
+  g_mutex_lock (&data->lock);
+  data->batch_size = batch_size;
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief Get the number of requests batched in a buffer.
+ */
+guint
+gst_tensor_query_server_get_batch_size (const guint id)
+{
+  GstTensorQueryServer *data;
+  guint batch_size;
+
+  data = gst_tensor_query_server_get_handle (id);
+
+  if (NULL == data) {
+    return 0;
+  }
+
+  g_mutex_lock (&data->lock);
+  batch_size = data->batch_size;
+  g_mutex_unlock (&data->lock);
+
+  return batch_size;
+}
+
+/**
+ * @brief Get the caps string of a single request from the caps of batched buffer.
+ * @return the caps string, NULL if the caps cannot be split into batch_size slots.
+ */
+gchar *
+gst_tensor_query_server_get_unbatched_caps_string (GstCaps * caps,
+    const guint batch_size)
+{
+  GstTensorsConfig config;
+  GstTensorInfo *_info;
+  GstStructure *s;
+  GstCaps *unbatched;
+  gchar *caps_str, *dim_str;
+  guint i, rank;
+
+  if (batch_size <= 1)
+    return gst_caps_to_string (caps);
+
+  if (!gst_caps_is_fixed (caps))
+    return NULL;
+
+  s = gst_caps_get_structure (caps, 0);
+  if (!gst_structure_is_tensor_stream (s)) {
+    nns_loge ("Cannot unbatch the caps, it is not a tensor stream.");
+    return NULL;
+  }
+
+  gst_tensors_config_from_structure (&config, s);
+  if (!gst_tensors_config_is_static (&config)) {
+    nns_loge ("Cannot unbatch the caps, the tensors should be static.");
+    gst_tensors_config_free (&config);
+    return NULL;
+  }
+
+  for (i = 0; i < config.info.num_tensors; i++) {
+    _info = gst_tensors_info_get_nth_info (&config.info, i);
+    rank = gst_tensor_info_get_rank (_info);
+
+    if (rank == 0 || _info->dimension[rank - 1] % batch_size != 0) {
+      nns_loge ("The outermost dimension of %uth tensor is not a multiple of "
+          "batch size %u.", i, batch_size);
+      gst_tensors_config_free (&config);
+      return NULL;
+    }
+
+    _info->dimension[rank - 1] /= batch_size;
+  }
+
+  unbatched = gst_caps_copy (caps);
+  s = gst_caps_get_structure (unbatched, 0);
+
+  if (gst_structure_has_name (s, NNS_MIMETYPE_TENSOR)) {
+    dim_str = gst_tensor_get_dimension_string (config.info.info[0].dimension);
+    gst_structure_set (s, "dimension", G_TYPE_STRING, dim_str, NULL);
+  } else {
+    dim_str = gst_tensors_info_get_dimensions_string (&config.info);
+    gst_structure_set (s, "dimensions", G_TYPE_STRING, dim_str, NULL);
+  }
+
+  caps_str = gst_caps_to_string (unbatched);
+
+  g_free (dim_str);
+  gst_caps_unref (unbatched);
+  gst_tensors_config_free (&config);
+
+  return caps_str;
+}
+
 /**
  * @brief Initialize the query server.
  */
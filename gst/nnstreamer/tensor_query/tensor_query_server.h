@@ -45,6 +45,7 @@ typedef struct
 {
   guint id;
   gboolean configured;
+  guint batch_size; /**< the number of requests batched in a buffer, 0 or 1 if batching is disabled */
   GMutex lock;
   GCond cond;
 
@@ -87,6 +88,23 @@ void gst_tensor_query_server_set_configured (const guint id);
  */
 void gst_tensor_query_server_set_caps (const guint id, const gchar *caps_str);
 
+/**
+ * @brief Set the number of requests batched in a buffer.
+ */
+void gst_tensor_query_server_set_batch_size (const guint id, const guint batch_size);
+
+/**
+ * @brief Get the number of requests batched in a buffer.
+ */
+guint gst_tensor_query_server_get_batch_size (const guint id);
+
+/**
+ * @brief Get the caps string of a single request from the caps of batched buffer.
+ * @note The outermost dimension of each tensor is divided by batch size. Caller should free returned string.
+ * @return the caps string, NULL if the caps cannot be split into batch_size slots.
+ */
+gchar * gst_tensor_query_server_get_unbatched_caps_string (GstCaps *caps, const guint batch_size);
+
 /**
  * @brief Release nnstreamer edge handle of query server.
  */
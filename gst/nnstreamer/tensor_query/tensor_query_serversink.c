@@ -272,7 +272,15 @@ gst_tensor_query_serversink_set_caps (GstBaseSink * bsink, GstCaps * caps)
   GstTensorQueryServerSink *sink = GST_TENSOR_QUERY_SERVERSINK (bsink);
   gchar *caps_str, *new_caps_str;
 
-  caps_str = gst_caps_to_string (caps);
+  /* the client receives a slot of the batched buffer */
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps,
+      gst_tensor_query_server_get_batch_size (sink->sink_id));
+  if (!caps_str) {
+    nns_loge ("The output of query server cannot be split into the batched "
+        "requests. The outermost dimension of static tensors should be a "
+        "multiple of batch size.");
+    return FALSE;
+  }
 
   new_caps_str = g_strdup_printf ("@query_server_sink_caps@%s", caps_str);
   gst_tensor_query_server_set_caps (sink->sink_id, new_caps_str);
@@ -14,6 +14,7 @@
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <tensor_typedef.h>
 #include <tensor_common.h>
 #include "tensor_query_serversrc.h"
@@ -28,6 +29,9 @@ GST_DEBUG_CATEGORY_STATIC (gst_tensor_query_serversrc_debug);
 #define DEFAULT_MQTT_HOST "127.0.0.1"
 #define DEFAULT_MQTT_PORT 1883
 #define DEFAULT_DATA_POP_TIMEOUT 100000U
+#define DEFAULT_BATCH_SIZE 1
+#define DEFAULT_BATCH_TIMEOUT 5
+#define MAX_BATCH_SIZE 1024
 
 /**
  * @brief the capabilities of the outputs
@@ -51,7 +55,9 @@ enum
   PROP_TIMEOUT,
   PROP_TOPIC,
   PROP_ID,
-  PROP_IS_LIVE
+  PROP_IS_LIVE,
+  PROP_BATCH_SIZE,
+  PROP_BATCH_TIMEOUT
 };
 
 #define gst_tensor_query_serversrc_parent_class parent_class
@@ -67,6 +73,8 @@ static void gst_tensor_query_serversrc_get_property (GObject * object,
 static void gst_tensor_query_serversrc_finalize (GObject * object);
 static GstFlowReturn gst_tensor_query_serversrc_create (GstPushSrc * psrc,
     GstBuffer ** buf);
+static gboolean gst_tensor_query_serversrc_set_caps (GstBaseSrc * bsrc,
+    GstCaps * caps);
 
 /**
  * @brief initialize the query_serversrc class
@@ -89,6 +97,7 @@ gst_tensor_query_serversrc_class_init (GstTensorQueryServerSrcClass * klass)
   gobject_class->finalize = gst_tensor_query_serversrc_finalize;
   gstelement_class->change_state = gst_tensor_query_serversrc_change_state;
   gstpushsrc_class->create = gst_tensor_query_serversrc_create;
+  gstbasesrc_class->set_caps = gst_tensor_query_serversrc_set_caps;
 
   g_object_class_install_property (gobject_class, PROP_HOST,
       g_param_spec_string ("host", "Host", "The hostname to listen as",
@@ -128,6 +137,19 @@ gst_tensor_query_serversrc_class_init (GstTensorQueryServerSrcClass * klass)
       g_param_spec_boolean ("is-live", "Is Live",
           "Synchronize the incoming buffers' timestamp with the current running time",
           DEFAULT_IS_LIVE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch size",
+          "The max number of requests from the clients to be batched in a buffer. "
+          "The outermost dimension of the negotiated tensors should be a multiple of batch size, "
+          "and the empty slots are filled with zero. 1 means batching is disabled.",
+          1, MAX_BATCH_SIZE, DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_BATCH_TIMEOUT,
+      g_param_spec_uint ("batch-timeout", "Batch timeout",
+          "Time (in ms) to wait for the requests to fill a batch after the first request is received. "
+          "0 means the requests already received are batched without wait.",
+          0, G_MAXUINT, DEFAULT_BATCH_TIMEOUT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&srctemplate));
@@ -158,6 +180,10 @@ gst_tensor_query_serversrc_init (GstTensorQueryServerSrc * src)
   src->configured = FALSE;
   src->msg_queue = g_async_queue_new ();
   src->playing = FALSE;
+  src->batch_size = DEFAULT_BATCH_SIZE;
+  src->batch_timeout = DEFAULT_BATCH_TIMEOUT;
+  src->batched = FALSE;
+  src->batch_num_tensors = 0;
 
   gst_base_src_set_format (GST_BASE_SRC (src), GST_FORMAT_TIME);
   /** set the timestamps on each buffer */
@@ -368,6 +394,12 @@ gst_tensor_query_serversrc_set_property (GObject * object, guint prop_id,
       gst_base_src_set_live (GST_BASE_SRC (serversrc),
           g_value_get_boolean (value));
       break;
+    case PROP_BATCH_SIZE:
+      serversrc->batch_size = g_value_get_uint (value);
+      break;
+    case PROP_BATCH_TIMEOUT:
+      serversrc->batch_timeout = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -412,6 +444,12 @@ gst_tensor_query_serversrc_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value,
           gst_base_src_is_live (GST_BASE_SRC (serversrc)));
       break;
+    case PROP_BATCH_SIZE:
+      g_value_set_uint (value, serversrc->batch_size);
+      break;
+    case PROP_BATCH_TIMEOUT:
+      g_value_set_uint (value, serversrc->batch_timeout);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -419,66 +457,285 @@ gst_tensor_query_serversrc_get_property (GObject * object, guint prop_id,
 }
 
 /**
- * @brief Get buffer from message queue.
+ * @brief Parse the client id and request id of the edge data.
  */
-static GstBuffer *
-_gst_tensor_query_serversrc_get_buffer (GstTensorQueryServerSrc * src)
+static gboolean
+_gst_tensor_query_serversrc_parse_ids (nns_edge_data_h data_h,
+    GstMetaQueryItem * item)
+{
+  char *val;
+
+  if (nns_edge_data_get_info (data_h, "client_id", &val) !=
+      NNS_EDGE_ERROR_NONE)
+    return FALSE;
+
+  item->client_id = g_ascii_strtoll (val, NULL, 10);
+  g_free (val);
+
+  /* request id is optional, query client matches the response with it */
+  item->request_id = 0;
+  if (nns_edge_data_get_info (data_h, "request_id", &val) ==
+      NNS_EDGE_ERROR_NONE) {
+    item->request_id = g_ascii_strtoull (val, NULL, 10);
+    g_free (val);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Pop the edge data from message queue, wait until the element is playing.
+ */
+static nns_edge_data_h
+_gst_tensor_query_serversrc_pop_data (GstTensorQueryServerSrc * src)
 {
   nns_edge_data_h data_h = NULL;
-  GstBuffer *buffer = NULL;
-  guint i, num_data;
-  GstMetaQuery *meta_query;
-  int ret;
 
   while (src->playing && !data_h) {
     data_h = g_async_queue_timeout_pop (src->msg_queue,
         DEFAULT_DATA_POP_TIMEOUT);
   }
 
+  return data_h;
+}
+
+/**
+ * @brief Get buffer from message queue.
+ */
+static GstBuffer *
+_gst_tensor_query_serversrc_get_buffer (GstTensorQueryServerSrc * src)
+{
+  nns_edge_data_h data_h = NULL;
+  GstBuffer *buffer = NULL;
+  GstMetaQuery *meta_query;
+  GstMetaQueryItem item;
+
+  data_h = _gst_tensor_query_serversrc_pop_data (src);
   if (!data_h) {
     nns_loge ("Failed to get message from the server message queue.");
     return NULL;
   }
 
-  ret = nns_edge_data_get_count (data_h, &num_data);
-  if (ret != NNS_EDGE_ERROR_NONE || num_data == 0) {
-    nns_loge ("Failed to get the number of memories of the edge data.");
-    goto done;
+  if (!_gst_tensor_query_serversrc_parse_ids (data_h, &item)) {
+    nns_loge ("Failed to get the client id of the edge data.");
+    nns_edge_data_destroy (data_h);
+    return NULL;
   }
 
+  /* wrap received data without copy, edge data is released with the buffer */
   buffer = gst_buffer_new ();
-  for (i = 0; i < num_data; i++) {
-    void *data = NULL;
-    nns_size_t data_len = 0;
-    gpointer new_data;
-
-    nns_edge_data_get (data_h, i, &data, &data_len);
-    new_data = _g_memdup (data, data_len);
-
-    gst_buffer_append_memory (buffer,
-        gst_memory_new_wrapped (0, new_data, data_len, 0, data_len, new_data,
-            g_free));
+  if (!gst_tensor_query_data_append_to_buffer (data_h, buffer, NULL)) {
+    gst_buffer_unref (buffer);
+    return NULL;
   }
 
   meta_query = gst_buffer_add_meta_query (buffer);
   if (meta_query) {
-    char *val;
+    meta_query->client_id = item.client_id;
+    meta_query->request_id = item.request_id;
+  }
+
+  return buffer;
+}
 
-    ret = nns_edge_data_get_info (data_h, "client_id", &val);
-    if (NNS_EDGE_ERROR_NONE != ret) {
+/**
+ * @brief Check the negotiated caps and prepare the batching.
+ * @return TRUE if the outermost dimension of each tensor is a multiple of batch size.
+ */
+static gboolean
+_gst_tensor_query_serversrc_configure_batch (GstTensorQueryServerSrc * src,
+    GstCaps * caps)
+{
+  GstTensorsConfig config;
+  GstTensorInfo *_info;
+  GstStructure *s;
+  gboolean configured = FALSE;
+  guint i, rank;
+
+  src->batched = FALSE;
+  src->batch_num_tensors = 0;
+
+  if (src->batch_size <= 1)
+    return FALSE;
+
+  if (!gst_caps_is_fixed (caps))
+    goto done;
+
+  s = gst_caps_get_structure (caps, 0);
+  if (!gst_structure_is_tensor_stream (s))
+    goto done;
+
+  gst_tensors_config_from_structure (&config, s);
+  if (gst_tensors_config_is_static (&config) &&
+      gst_tensors_config_validate (&config)) {
+    configured = TRUE;
+
+    for (i = 0; i < config.info.num_tensors; i++) {
+      _info = gst_tensors_info_get_nth_info (&config.info, i);
+      rank = gst_tensor_info_get_rank (_info);
+
+      if (rank == 0 || _info->dimension[rank - 1] % src->batch_size != 0) {
+        configured = FALSE;
+        break;
+      }
+
+      src->batch_item_size[i] =
+          gst_tensor_info_get_size (_info) / src->batch_size;
+    }
+
+    if (configured)
+      src->batch_num_tensors = config.info.num_tensors;
+  }
+  gst_tensors_config_free (&config);
+
+done:
+  if (!configured) {
+    nns_logw ("Cannot batch the requests, the outermost dimension of static "
+        "tensors should be a multiple of batch size %u. Batching is disabled.",
+        src->batch_size);
+  }
+
+  src->batched = configured;
+  return configured;
+}
+
+/**
+ * @brief Check the edge data can be batched.
+ */
+static gboolean
+_gst_tensor_query_serversrc_check_batch_item (GstTensorQueryServerSrc * src,
+    nns_edge_data_h data_h)
+{
+  GstMetaQueryItem item;
+  guint i, num_data = 0;
+  void *data;
+  nns_size_t data_len;
+
+  if (nns_edge_data_get_count (data_h, &num_data) != NNS_EDGE_ERROR_NONE ||
+      num_data != src->batch_num_tensors)
+    return FALSE;
+
+  for (i = 0; i < num_data; i++) {
+    if (nns_edge_data_get (data_h, i, &data, &data_len) != NNS_EDGE_ERROR_NONE
+        || data_len != src->batch_item_size[i])
+      return FALSE;
+  }
+
+  return _gst_tensor_query_serversrc_parse_ids (data_h, &item);
+}
+
+/**
+ * @brief Get batched buffer from message queue.
+ * @note Waits for the first request, then collects the requests until the batch is full or batch-timeout is expired.
+ */
+static GstBuffer *
+_gst_tensor_query_serversrc_get_batch (GstTensorQueryServerSrc * src)
+{
+  nns_edge_data_h data_h;
+  GPtrArray *requests;
+  GstBuffer *buffer = NULL;
+  GstMetaQuery *meta_query;
+  GstMemory *mem;
+  GstMapInfo map;
+  gint64 end_time, remaining;
+  guint i, k;
+
+  requests = g_ptr_array_new_with_free_func (
+      (GDestroyNotify) nns_edge_data_destroy);
+
+  while (requests->len == 0) {
+    data_h = _gst_tensor_query_serversrc_pop_data (src);
+    if (!data_h) {
+      nns_loge ("Failed to get message from the server message queue.");
+      goto done;
+    }
+
+    end_time = g_get_monotonic_time () +
+        (gint64) src->batch_timeout * G_TIME_SPAN_MILLISECOND;
+
+    while (data_h) {
+      if (_gst_tensor_query_serversrc_check_batch_item (src, data_h)) {
+        g_ptr_array_add (requests, data_h);
+      } else {
+        nns_logw ("Invalid request for the batched tensors, drop it.");
+        nns_edge_data_destroy (data_h);
+      }
+
+      if (requests->len >= src->batch_size)
+        break;
+
+      remaining = end_time - g_get_monotonic_time ();
+      if (remaining > 0)
+        data_h = g_async_queue_timeout_pop (src->msg_queue, remaining);
+      else
+        data_h = g_async_queue_try_pop (src->msg_queue);
+    }
+  }
+
+  buffer = gst_buffer_new ();
+  for (i = 0; i < src->batch_num_tensors; i++) {
+    gsize item_size = src->batch_item_size[i];
+
+    mem = gst_allocator_alloc (NULL, item_size * src->batch_size, NULL);
+    if (!mem || !gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+      nns_loge ("Failed to allocate memory for the batched tensors.");
+      if (mem)
+        gst_memory_unref (mem);
       gst_buffer_unref (buffer);
       buffer = NULL;
-    } else {
-      meta_query->client_id = g_ascii_strtoll (val, NULL, 10);
-      g_free (val);
+      goto done;
     }
+
+    for (k = 0; k < requests->len; k++) {
+      void *data = NULL;
+      nns_size_t data_len = 0;
+
+      nns_edge_data_get (g_ptr_array_index (requests, k), i, &data, &data_len);
+      memcpy (map.data + item_size * k, data, item_size);
+    }
+
+    /* fill empty slots with zero */
+    if (requests->len < src->batch_size)
+      memset (map.data + item_size * requests->len, 0,
+          item_size * (src->batch_size - requests->len));
+
+    gst_memory_unmap (mem, &map);
+    gst_buffer_append_memory (buffer, mem);
+  }
+
+  meta_query = gst_buffer_add_meta_query (buffer);
+  if (meta_query &&
+      gst_meta_query_set_batch (meta_query, src->batch_size, requests->len)) {
+    for (k = 0; k < requests->len; k++) {
+      _gst_tensor_query_serversrc_parse_ids (g_ptr_array_index (requests, k),
+          &meta_query->items[k]);
+    }
+
+    meta_query->client_id = meta_query->items[0].client_id;
+    meta_query->request_id = meta_query->items[0].request_id;
   }
 
 done:
-  nns_edge_data_destroy (data_h);
+  g_ptr_array_free (requests, TRUE);
   return buffer;
 }
 
+/**
+ * @brief An implementation of the set_caps vmethod in GstBaseSrcClass
+ * @note The batch size is shared before the caps event is pushed, so that query serversink gets it when it is negotiated.
+ */
+static gboolean
+gst_tensor_query_serversrc_set_caps (GstBaseSrc * bsrc, GstCaps * caps)
+{
+  GstTensorQueryServerSrc *src = GST_TENSOR_QUERY_SERVERSRC (bsrc);
+
+  _gst_tensor_query_serversrc_configure_batch (src, caps);
+  gst_tensor_query_server_set_batch_size (src->src_id,
+      src->batched ? src->batch_size : 1);
+
+  return TRUE;
+}
+
 /**
  * @brief create query_serversrc, wait on socket and receive data
  */
@@ -498,7 +755,9 @@ gst_tensor_query_serversrc_create (GstPushSrc * psrc, GstBuffer ** outbuf)
       gst_base_src_set_caps (bsrc, caps);
     }
 
-    caps_str = gst_caps_to_string (caps);
+    /* the client sends a slot of the batched buffer, batch is configured in set_caps */
+    caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps,
+        src->batched ? src->batch_size : 1);
 
     new_caps_str = g_strdup_printf ("@query_server_src_caps@%s", caps_str);
     gst_tensor_query_server_set_caps (src->src_id, new_caps_str);
@@ -509,7 +768,10 @@ gst_tensor_query_serversrc_create (GstPushSrc * psrc, GstBuffer ** outbuf)
     src->configured = TRUE;
   }
 
-  *outbuf = _gst_tensor_query_serversrc_get_buffer (src);
+  if (src->batched)
+    *outbuf = _gst_tensor_query_serversrc_get_batch (src);
+  else
+    *outbuf = _gst_tensor_query_serversrc_get_buffer (src);
   if (*outbuf == NULL) {
     sret = gst_element_get_state (GST_ELEMENT (psrc), &state, NULL, 0);
     if (sret != GST_STATE_CHANGE_SUCCESS || state != GST_STATE_PLAYING) {
@@ -54,6 +54,13 @@ struct _GstTensorQueryServerSrc
   nns_edge_connect_type_e connect_type;
   GAsyncQueue *msg_queue;
   gboolean playing;
+
+  /* Batching requests from clients */
+  guint batch_size; /**< the max number of requests in a buffer, 1 to disable batching */
+  guint batch_timeout; /**< time (in ms) to wait for the requests to fill a batch */
+  gboolean batched; /**< TRUE if the pipeline accepts batched buffer */
+  guint batch_num_tensors; /**< the number of tensors in a request */
+  gsize batch_item_size[NNS_TENSOR_SIZE_LIMIT]; /**< size of each tensor in a request */
 };
 
 /**
@@ -0,0 +1,1561 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file	tensor_simd.c
+ * @date	16 Oct 2026
+ * @brief	Internal SIMD kernels for element-wise tensor operations.
+ * @see	http://github.com/nnstreamer/nnstreamer
+ * @bug	No known bugs except for NYI items
+ */
+
+#include <math.h>
+#include <string.h>
+#include "tensor_simd.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define NNS_SIMD_X86 1
+#include <immintrin.h>
+#define NNS_SIMD_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#define NNS_SIMD_TARGET_F16C __attribute__ ((target ("avx,f16c")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define NNS_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief SIMD instruction set selected at runtime.
+ */
+typedef enum
+{
+  NNS_SIMD_LEVEL_NONE = 0,
+  NNS_SIMD_LEVEL_SSE2,
+  NNS_SIMD_LEVEL_AVX2,
+  NNS_SIMD_LEVEL_NEON
+} nns_simd_level;
+
+static nns_simd_level simd_level = NNS_SIMD_LEVEL_NONE;
+static gboolean simd_f16 = FALSE;
+
+/**
+ * @brief Max number of float32 lanes in the kernels.
+ */
+#define NNS_SIMD_MAX_LANES (8)
+
+/**
+ * @brief Detect the instruction set once.
+ */
+static void
+gst_tensor_simd_init (void)
+{
+  static gsize initialized = 0;
+
+  if (g_once_init_enter (&initialized)) {
+#if defined(NNS_SIMD_X86)
+    __builtin_cpu_init ();
+    simd_level = __builtin_cpu_supports ("avx2") ?
+        NNS_SIMD_LEVEL_AVX2 : NNS_SIMD_LEVEL_SSE2;
+    simd_f16 = __builtin_cpu_supports ("avx") && __builtin_cpu_supports ("f16c");
+#elif defined(NNS_SIMD_NEON)
+    simd_level = NNS_SIMD_LEVEL_NEON;
+    simd_f16 = TRUE;
+#endif
+
+    if (g_getenv ("NNSTREAMER_DISABLE_SIMD") != NULL) {
+      simd_level = NNS_SIMD_LEVEL_NONE;
+      simd_f16 = FALSE;
+    }
+
+    g_once_init_leave (&initialized, 1);
+  }
+}
+
+/**
+ * @brief Macro to typecast the remaining elements.
+ */
+#define typecast_f32_tail(intype,i,o,from,to) do { \
+    const intype *_ip = (const intype *) (i); \
+    gsize _idx; \
+    for (_idx = (from); _idx < (to); _idx++) \
+      (o)[_idx] = (gfloat) _ip[_idx]; \
+  } while (0)
+
+/**
+ * @brief Macro to apply the operator to the remaining elements.
+ */
+#define operator_f32_tail(d,from,to,op,v) do { \
+    gsize _idx; \
+    switch (op) { \
+      case NNS_SIMD_OP_ADD: \
+        for (_idx = (from); _idx < (to); _idx++) (d)[_idx] = (d)[_idx] + (v); \
+        break; \
+      case NNS_SIMD_OP_MUL: \
+        for (_idx = (from); _idx < (to); _idx++) (d)[_idx] = (d)[_idx] * (v); \
+        break; \
+      case NNS_SIMD_OP_DIV: \
+        for (_idx = (from); _idx < (to); _idx++) (d)[_idx] = (d)[_idx] / (v); \
+        break; \
+      default: \
+        break; \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to set the bits of non-zero elements in the remaining elements.
+ */
+#define nonzero_mask_tail(intype,i,m,from,to) do { \
+    const intype *_ip = (const intype *) (i); \
+    gsize _idx; \
+    for (_idx = (from); _idx < (to); _idx++) \
+      (m)[_idx >> 6] |= (guint64) (_ip[_idx] != 0) << (_idx & 63); \
+  } while (0)
+
+/**
+ * @brief Macro to run the vector loop for each operator.
+ */
+#define operator_loop(step,load,store,add,mul,div,d,n,i,vval) do { \
+    switch (op) { \
+      case NNS_SIMD_OP_ADD: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          store ((d) + (i), add (load ((d) + (i)), (vval))); \
+        break; \
+      case NNS_SIMD_OP_MUL: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          store ((d) + (i), mul (load ((d) + (i)), (vval))); \
+        break; \
+      case NNS_SIMD_OP_DIV: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          store ((d) + (i), div (load ((d) + (i)), (vval))); \
+        break; \
+      default: \
+        break; \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to run the vector loop with repeated operands.
+ */
+#define operator_pattern_loop(step,load,store,opfunc,d,n,i,p,period,j) do { \
+    gsize _jstep = (step) % (period); \
+    for (; (i) + (step) <= (n); (i) += (step)) { \
+      store ((d) + (i), opfunc (load ((d) + (i)), load ((p) + (j)))); \
+      (j) += _jstep; \
+      if ((j) >= (period)) \
+        (j) -= (period); \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro to run the vector loop of max, min or count reduction.
+ */
+#define reduce_f32_loop(step,vtype,load,store,set1,vmax,vmin,gtbits,in,n,i,op,th,value,count) do { \
+    vtype _acc = set1 (((op) == NNS_SIMD_REDUCE_MAX) ? -INFINITY : INFINITY); \
+    const vtype _vth = set1 (th); \
+    gfloat _lanes[step]; \
+    guint _j; \
+    switch (op) { \
+      case NNS_SIMD_REDUCE_MAX: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          _acc = vmax (load ((in) + (i)), _acc); \
+        break; \
+      case NNS_SIMD_REDUCE_MIN: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          _acc = vmin (load ((in) + (i)), _acc); \
+        break; \
+      case NNS_SIMD_REDUCE_COUNT_GT: \
+        for (; (i) + (step) <= (n); (i) += (step)) \
+          (count) += __builtin_popcount (gtbits (load ((in) + (i)), _vth)); \
+        break; \
+      default: \
+        break; \
+    } \
+    if ((op) == NNS_SIMD_REDUCE_MAX || (op) == NNS_SIMD_REDUCE_MIN) { \
+      store (_lanes, _acc); \
+      for (_j = 0; _j < (step); _j++) { \
+        if (((op) == NNS_SIMD_REDUCE_MAX) ? \
+            (_lanes[_j] > (value)) : (_lanes[_j] < (value))) \
+          (value) = _lanes[_j]; \
+      } \
+    } \
+  } while (0)
+
+#if defined(NNS_SIMD_X86)
+/**
+ * @brief Typecast to float32 (SSE2).
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_typecast_f32 (gconstpointer input, tensor_type in_type, gfloat * output,
+    gsize num)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i v, lo, hi;
+  gsize i = 0;
+
+  switch (in_type) {
+    case _NNS_UINT8:
+      for (; i + 16 <= num; i += 16) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const guint8 *) input + i));
+        lo = _mm_unpacklo_epi8 (v, zero);
+        hi = _mm_unpackhi_epi8 (v, zero);
+        _mm_storeu_ps (output + i,
+            _mm_cvtepi32_ps (_mm_unpacklo_epi16 (lo, zero)));
+        _mm_storeu_ps (output + i + 4,
+            _mm_cvtepi32_ps (_mm_unpackhi_epi16 (lo, zero)));
+        _mm_storeu_ps (output + i + 8,
+            _mm_cvtepi32_ps (_mm_unpacklo_epi16 (hi, zero)));
+        _mm_storeu_ps (output + i + 12,
+            _mm_cvtepi32_ps (_mm_unpackhi_epi16 (hi, zero)));
+      }
+      break;
+    case _NNS_INT8:
+      for (; i + 16 <= num; i += 16) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const gint8 *) input + i));
+        lo = _mm_srai_epi16 (_mm_unpacklo_epi8 (v, v), 8);
+        hi = _mm_srai_epi16 (_mm_unpackhi_epi8 (v, v), 8);
+        _mm_storeu_ps (output + i,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpacklo_epi16 (lo, lo), 16)));
+        _mm_storeu_ps (output + i + 4,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpackhi_epi16 (lo, lo), 16)));
+        _mm_storeu_ps (output + i + 8,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpacklo_epi16 (hi, hi), 16)));
+        _mm_storeu_ps (output + i + 12,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpackhi_epi16 (hi, hi), 16)));
+      }
+      break;
+    case _NNS_UINT16:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const guint16 *) input + i));
+        _mm_storeu_ps (output + i,
+            _mm_cvtepi32_ps (_mm_unpacklo_epi16 (v, zero)));
+        _mm_storeu_ps (output + i + 4,
+            _mm_cvtepi32_ps (_mm_unpackhi_epi16 (v, zero)));
+      }
+      break;
+    case _NNS_INT16:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const gint16 *) input + i));
+        _mm_storeu_ps (output + i,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpacklo_epi16 (v, v), 16)));
+        _mm_storeu_ps (output + i + 4,
+            _mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpackhi_epi16 (v, v), 16)));
+      }
+      break;
+    case _NNS_INT32:
+      for (; i + 4 <= num; i += 4) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const gint32 *) input + i));
+        _mm_storeu_ps (output + i, _mm_cvtepi32_ps (v));
+      }
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Typecast to float32 (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_typecast_f32 (gconstpointer input, tensor_type in_type, gfloat * output,
+    gsize num)
+{
+  __m128i v;
+  gsize i = 0;
+
+  switch (in_type) {
+    case _NNS_UINT8:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadl_epi64 ((const __m128i *) ((const guint8 *) input + i));
+        _mm256_storeu_ps (output + i,
+            _mm256_cvtepi32_ps (_mm256_cvtepu8_epi32 (v)));
+      }
+      break;
+    case _NNS_INT8:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadl_epi64 ((const __m128i *) ((const gint8 *) input + i));
+        _mm256_storeu_ps (output + i,
+            _mm256_cvtepi32_ps (_mm256_cvtepi8_epi32 (v)));
+      }
+      break;
+    case _NNS_UINT16:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const guint16 *) input + i));
+        _mm256_storeu_ps (output + i,
+            _mm256_cvtepi32_ps (_mm256_cvtepu16_epi32 (v)));
+      }
+      break;
+    case _NNS_INT16:
+      for (; i + 8 <= num; i += 8) {
+        v = _mm_loadu_si128 ((const __m128i *) ((const gint16 *) input + i));
+        _mm256_storeu_ps (output + i,
+            _mm256_cvtepi32_ps (_mm256_cvtepi16_epi32 (v)));
+      }
+      break;
+    case _NNS_INT32:
+      for (; i + 8 <= num; i += 8) {
+        _mm256_storeu_ps (output + i, _mm256_cvtepi32_ps (_mm256_loadu_si256
+                ((const __m256i *) ((const gint32 *) input + i))));
+      }
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Apply the operator (SSE2).
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_operator_f32 (gfloat * data, gsize num, nns_simd_op op, gfloat value)
+{
+  const __m128 v = _mm_set1_ps (value);
+  gsize i = 0;
+
+  operator_loop (4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, _mm_mul_ps,
+      _mm_div_ps, data, num, i, v);
+  return i;
+}
+
+/**
+ * @brief Apply the operator (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_operator_f32 (gfloat * data, gsize num, nns_simd_op op, gfloat value)
+{
+  const __m256 v = _mm256_set1_ps (value);
+  gsize i = 0;
+
+  operator_loop (8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps,
+      _mm256_mul_ps, _mm256_div_ps, data, num, i, v);
+  return i;
+}
+
+/**
+ * @brief Apply the operator with repeated operands (SSE2).
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_operator_pattern_f32 (gfloat * data, gsize num, nns_simd_op op,
+    const gfloat * pattern, gsize period)
+{
+  gsize i = 0, j = 0;
+
+  switch (op) {
+    case NNS_SIMD_OP_ADD:
+      operator_pattern_loop (4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps,
+          data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_MUL:
+      operator_pattern_loop (4, _mm_loadu_ps, _mm_storeu_ps, _mm_mul_ps,
+          data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_DIV:
+      operator_pattern_loop (4, _mm_loadu_ps, _mm_storeu_ps, _mm_div_ps,
+          data, num, i, pattern, period, j);
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Apply the operator with repeated operands (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_operator_pattern_f32 (gfloat * data, gsize num, nns_simd_op op,
+    const gfloat * pattern, gsize period)
+{
+  gsize i = 0, j = 0;
+
+  switch (op) {
+    case NNS_SIMD_OP_ADD:
+      operator_pattern_loop (8, _mm256_loadu_ps, _mm256_storeu_ps,
+          _mm256_add_ps, data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_MUL:
+      operator_pattern_loop (8, _mm256_loadu_ps, _mm256_storeu_ps,
+          _mm256_mul_ps, data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_DIV:
+      operator_pattern_loop (8, _mm256_loadu_ps, _mm256_storeu_ps,
+          _mm256_div_ps, data, num, i, pattern, period, j);
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Clamp float32 data (SSE2). The NaN is kept as it is.
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_clamp_f32 (const gfloat * input, gfloat * output, gsize num,
+    gfloat min, gfloat max)
+{
+  const __m128 vmin = _mm_set1_ps (min);
+  const __m128 vmax = _mm_set1_ps (max);
+  gsize i = 0;
+
+  /* maxps and minps return the second operand if either is NaN */
+  for (; i + 4 <= num; i += 4) {
+    _mm_storeu_ps (output + i, _mm_min_ps (vmax, _mm_max_ps (vmin,
+                _mm_loadu_ps (input + i))));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Linear interpolation of float32 data, a + (b - a) * w (SSE2).
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_lerp_f32 (const gfloat * a, const gfloat * b, gfloat * output,
+    gsize num, gfloat w)
+{
+  const __m128 vw = _mm_set1_ps (w);
+  __m128 va;
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4) {
+    va = _mm_loadu_ps (a + i);
+    _mm_storeu_ps (output + i, _mm_add_ps (va,
+            _mm_mul_ps (_mm_sub_ps (_mm_loadu_ps (b + i), va), vw)));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Clamp float32 data (AVX2). The NaN is kept as it is.
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_clamp_f32 (const gfloat * input, gfloat * output, gsize num,
+    gfloat min, gfloat max)
+{
+  const __m256 vmin = _mm256_set1_ps (min);
+  const __m256 vmax = _mm256_set1_ps (max);
+  gsize i = 0;
+
+  for (; i + 8 <= num; i += 8) {
+    _mm256_storeu_ps (output + i, _mm256_min_ps (vmax, _mm256_max_ps (vmin,
+                _mm256_loadu_ps (input + i))));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Linear interpolation of float32 data, a + (b - a) * w (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_lerp_f32 (const gfloat * a, const gfloat * b, gfloat * output,
+    gsize num, gfloat w)
+{
+  const __m256 vw = _mm256_set1_ps (w);
+  __m256 va;
+  gsize i = 0;
+
+  /* multiply and add separately, same result with the scalar loop */
+  for (; i + 8 <= num; i += 8) {
+    va = _mm256_loadu_ps (a + i);
+    _mm256_storeu_ps (output + i, _mm256_add_ps (va,
+            _mm256_mul_ps (_mm256_sub_ps (_mm256_loadu_ps (b + i), va), vw)));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Load 4 elements and typecast to float64 (AVX2).
+ */
+NNS_SIMD_TARGET_AVX2 static inline __m256d
+_avx2_load_pd (gconstpointer input, tensor_type in_type, gsize i)
+{
+  gint32 u8x4;
+
+  if (in_type == _NNS_UINT8) {
+    memcpy (&u8x4, (const guint8 *) input + i, sizeof (gint32));
+    return _mm256_cvtepi32_pd (_mm_cvtepu8_epi32 (_mm_cvtsi32_si128 (u8x4)));
+  }
+
+  return _mm256_cvtps_pd (_mm_loadu_ps ((const gfloat *) input + i));
+}
+
+/**
+ * @brief Calculate the sum of the elements, or the sum of squared difference from the average if given (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_sum (gconstpointer input, tensor_type in_type, gsize num,
+    const gdouble * average, gdouble * sum)
+{
+  const __m256d vavg = _mm256_set1_pd (average ? *average : 0.0);
+  __m256d acc0 = _mm256_setzero_pd ();
+  __m256d acc1 = _mm256_setzero_pd ();
+  __m256d v0, v1;
+  gdouble lanes[4];
+  gsize i = 0;
+
+  /* 2 accumulators to hide the latency of addition */
+  for (; i + 8 <= num; i += 8) {
+    v0 = _avx2_load_pd (input, in_type, i);
+    v1 = _avx2_load_pd (input, in_type, i + 4);
+
+    if (average) {
+      v0 = _mm256_sub_pd (v0, vavg);
+      v1 = _mm256_sub_pd (v1, vavg);
+      v0 = _mm256_mul_pd (v0, v0);
+      v1 = _mm256_mul_pd (v1, v1);
+    }
+
+    acc0 = _mm256_add_pd (acc0, v0);
+    acc1 = _mm256_add_pd (acc1, v1);
+  }
+
+  _mm256_storeu_pd (lanes, _mm256_add_pd (acc0, acc1));
+  *sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  return i;
+}
+
+/**
+ * @brief Standardize the data to float32 output (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_stand_f32 (gconstpointer input, tensor_type in_type, gfloat * output,
+    gsize num, gdouble average, const gdouble * std)
+{
+  const __m256d vavg = _mm256_set1_pd (average);
+  const __m256d vstd = _mm256_set1_pd (std ? *std : 1.0);
+  const __m256d sign = _mm256_set1_pd (-0.0);
+  __m256d v;
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4) {
+    v = _mm256_sub_pd (_avx2_load_pd (input, in_type, i), vavg);
+    if (std)
+      v = _mm256_andnot_pd (sign, _mm256_div_pd (v, vstd));
+    _mm_storeu_ps (output + i, _mm256_cvtpd_ps (v));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Convert float16 to float32 (F16C).
+ */
+NNS_SIMD_TARGET_F16C static void
+_f16c_f16_to_f32 (gconstpointer input, gfloat * output, gsize num)
+{
+  const guint16 *ip = (const guint16 *) input;
+  guint16 tmp_in[8] = { 0, };
+  gfloat tmp_out[8];
+  gsize i = 0;
+
+  for (; i + 8 <= num; i += 8) {
+    _mm256_storeu_ps (output + i, _mm256_cvtph_ps (_mm_loadu_si128
+            ((const __m128i *) (ip + i))));
+  }
+
+  /* convert the remaining elements with the same instruction */
+  if (i < num) {
+    memcpy (tmp_in, ip + i, (num - i) * sizeof (guint16));
+    _mm256_storeu_ps (tmp_out, _mm256_cvtph_ps (_mm_loadu_si128
+            ((const __m128i *) tmp_in)));
+    memcpy (output + i, tmp_out, (num - i) * sizeof (gfloat));
+  }
+}
+
+/**
+ * @brief Convert float32 to float16 (F16C).
+ */
+NNS_SIMD_TARGET_F16C static void
+_f16c_f32_to_f16 (const gfloat * input, gpointer output, gsize num)
+{
+  guint16 *op = (guint16 *) output;
+  gfloat tmp_in[8] = { 0, };
+  guint16 tmp_out[8];
+  gsize i = 0;
+
+  for (; i + 8 <= num; i += 8) {
+    _mm_storeu_si128 ((__m128i *) (op + i),
+        _mm256_cvtps_ph (_mm256_loadu_ps (input + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  if (i < num) {
+    memcpy (tmp_in, input + i, (num - i) * sizeof (gfloat));
+    _mm_storeu_si128 ((__m128i *) tmp_out,
+        _mm256_cvtps_ph (_mm256_loadu_ps (tmp_in), _MM_FROUND_TO_NEAREST_INT));
+    memcpy (op + i, tmp_out, (num - i) * sizeof (guint16));
+  }
+}
+
+/**
+ * @brief Build the bitmap of non-zero elements (SSE2).
+ * @return The number of processed elements (multiple of 64)
+ */
+static gsize
+_sse2_nonzero_mask (const guint8 * input, gsize esize, guint64 * mask,
+    gsize num)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i a, b, c, d;
+  const guint8 *p;
+  guint64 bits;
+  gsize w, nwords = num / 64;
+  guint j, m;
+
+  for (w = 0; w < nwords; w++) {
+    p = input + w * 64 * esize;
+    bits = 0;
+
+    switch (esize) {
+      case 1:
+        for (j = 0; j < 4; j++, p += 16) {
+          a = _mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i *) p), zero);
+          m = (guint) _mm_movemask_epi8 (a);
+          bits |= (guint64) (~m & 0xFFFF) << (j * 16);
+        }
+        break;
+      case 2:
+        for (j = 0; j < 4; j++, p += 32) {
+          a = _mm_cmpeq_epi16 (_mm_loadu_si128 ((const __m128i *) p), zero);
+          b = _mm_cmpeq_epi16 (_mm_loadu_si128 ((const __m128i *) (p + 16)),
+              zero);
+          m = (guint) _mm_movemask_epi8 (_mm_packs_epi16 (a, b));
+          bits |= (guint64) (~m & 0xFFFF) << (j * 16);
+        }
+        break;
+      case 4:
+        for (j = 0; j < 4; j++, p += 64) {
+          a = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i *) p), zero);
+          b = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i *) (p + 16)),
+              zero);
+          c = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i *) (p + 32)),
+              zero);
+          d = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i *) (p + 48)),
+              zero);
+          m = (guint) _mm_movemask_epi8 (_mm_packs_epi16 (_mm_packs_epi32 (a,
+                      b), _mm_packs_epi32 (c, d)));
+          bits |= (guint64) (~m & 0xFFFF) << (j * 16);
+        }
+        break;
+      case 8:
+        for (j = 0; j < 32; j++, p += 16) {
+          /* 64-bit element is zero if both 32-bit halves are zero */
+          a = _mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i *) p), zero);
+          a = _mm_and_si128 (a, _mm_shuffle_epi32 (a, _MM_SHUFFLE (2, 3, 0, 1)));
+          m = (guint) _mm_movemask_pd (_mm_castsi128_pd (a));
+          bits |= (guint64) (~m & 0x3) << (j * 2);
+        }
+        break;
+      default:
+        return 0;
+    }
+
+    mask[w] = bits;
+  }
+
+  return nwords * 64;
+}
+/**
+ * @brief Macro to get the mask of elements greater than the threshold (SSE2).
+ */
+#define _sse2_gt_bits(a,b) _mm_movemask_ps (_mm_cmpgt_ps ((a), (b)))
+
+/**
+ * @brief Macro to get the mask of elements greater than the threshold (AVX2).
+ */
+#define _avx2_gt_bits(a,b) _mm256_movemask_ps (_mm256_cmp_ps ((a), (b), _CMP_GT_OQ))
+
+/**
+ * @brief Reduce float32 data with max, min or count (SSE2).
+ * @return The number of processed elements
+ */
+static gsize
+_sse2_reduce_f32 (const gfloat * input, gsize num, nns_simd_reduce op,
+    gfloat threshold, gfloat * value, gsize * count)
+{
+  gsize i = 0;
+
+  reduce_f32_loop (4, __m128, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+      _mm_max_ps, _mm_min_ps, _sse2_gt_bits, input, num, i, op, threshold,
+      *value, *count);
+  return i;
+}
+
+/**
+ * @brief Reduce float32 data with max, min or count (AVX2).
+ * @return The number of processed elements
+ */
+NNS_SIMD_TARGET_AVX2 static gsize
+_avx2_reduce_f32 (const gfloat * input, gsize num, nns_simd_reduce op,
+    gfloat threshold, gfloat * value, gsize * count)
+{
+  gsize i = 0;
+
+  reduce_f32_loop (8, __m256, _mm256_loadu_ps, _mm256_storeu_ps,
+      _mm256_set1_ps, _mm256_max_ps, _mm256_min_ps, _avx2_gt_bits, input, num,
+      i, op, threshold, *value, *count);
+  return i;
+}
+#endif /* NNS_SIMD_X86 */
+
+#if defined(NNS_SIMD_NEON)
+/**
+ * @brief Typecast to float32 (NEON).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_typecast_f32 (gconstpointer input, tensor_type in_type, gfloat * output,
+    gsize num)
+{
+  gsize i = 0;
+
+  switch (in_type) {
+    case _NNS_UINT8:
+      for (; i + 8 <= num; i += 8) {
+        uint16x8_t v = vmovl_u8 (vld1_u8 ((const guint8 *) input + i));
+        vst1q_f32 (output + i, vcvtq_f32_u32 (vmovl_u16 (vget_low_u16 (v))));
+        vst1q_f32 (output + i + 4, vcvtq_f32_u32 (vmovl_high_u16 (v)));
+      }
+      break;
+    case _NNS_INT8:
+      for (; i + 8 <= num; i += 8) {
+        int16x8_t v = vmovl_s8 (vld1_s8 ((const gint8 *) input + i));
+        vst1q_f32 (output + i, vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (v))));
+        vst1q_f32 (output + i + 4, vcvtq_f32_s32 (vmovl_high_s16 (v)));
+      }
+      break;
+    case _NNS_UINT16:
+      for (; i + 4 <= num; i += 4) {
+        vst1q_f32 (output + i,
+            vcvtq_f32_u32 (vmovl_u16 (vld1_u16 ((const guint16 *) input + i))));
+      }
+      break;
+    case _NNS_INT16:
+      for (; i + 4 <= num; i += 4) {
+        vst1q_f32 (output + i,
+            vcvtq_f32_s32 (vmovl_s16 (vld1_s16 ((const gint16 *) input + i))));
+      }
+      break;
+    case _NNS_INT32:
+      for (; i + 4 <= num; i += 4) {
+        vst1q_f32 (output + i,
+            vcvtq_f32_s32 (vld1q_s32 ((const gint32 *) input + i)));
+      }
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Apply the operator (NEON).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_operator_f32 (gfloat * data, gsize num, nns_simd_op op, gfloat value)
+{
+  const float32x4_t v = vdupq_n_f32 (value);
+  gsize i = 0;
+
+  operator_loop (4, vld1q_f32, vst1q_f32, vaddq_f32, vmulq_f32, vdivq_f32,
+      data, num, i, v);
+  return i;
+}
+
+/**
+ * @brief Apply the operator with repeated operands (NEON).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_operator_pattern_f32 (gfloat * data, gsize num, nns_simd_op op,
+    const gfloat * pattern, gsize period)
+{
+  gsize i = 0, j = 0;
+
+  switch (op) {
+    case NNS_SIMD_OP_ADD:
+      operator_pattern_loop (4, vld1q_f32, vst1q_f32, vaddq_f32,
+          data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_MUL:
+      operator_pattern_loop (4, vld1q_f32, vst1q_f32, vmulq_f32,
+          data, num, i, pattern, period, j);
+      break;
+    case NNS_SIMD_OP_DIV:
+      operator_pattern_loop (4, vld1q_f32, vst1q_f32, vdivq_f32,
+          data, num, i, pattern, period, j);
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Clamp float32 data (NEON). The NaN is kept as it is.
+ * @return The number of processed elements
+ */
+static gsize
+_neon_clamp_f32 (const gfloat * input, gfloat * output, gsize num,
+    gfloat min, gfloat max)
+{
+  const float32x4_t vmin = vdupq_n_f32 (min);
+  const float32x4_t vmax = vdupq_n_f32 (max);
+  float32x4_t v;
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4) {
+    v = vld1q_f32 (input + i);
+    v = vbslq_f32 (vcltq_f32 (v, vmin), vmin, v);
+    v = vbslq_f32 (vcgtq_f32 (v, vmax), vmax, v);
+    vst1q_f32 (output + i, v);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Linear interpolation of float32 data, a + (b - a) * w (NEON).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_lerp_f32 (const gfloat * a, const gfloat * b, gfloat * output,
+    gsize num, gfloat w)
+{
+  const float32x4_t vw = vdupq_n_f32 (w);
+  float32x4_t va;
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4) {
+    va = vld1q_f32 (a + i);
+    vst1q_f32 (output + i, vaddq_f32 (va,
+            vmulq_f32 (vsubq_f32 (vld1q_f32 (b + i), va), vw)));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Load 2 float32 elements and typecast to float64 (NEON).
+ */
+static inline float64x2_t
+_neon_load_f64 (gconstpointer input, gsize i)
+{
+  return vcvt_f64_f32 (vld1_f32 ((const gfloat *) input + i));
+}
+
+/**
+ * @brief Calculate the sum of the elements, or the sum of squared difference from the average if given (NEON, float32 only).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_sum (gconstpointer input, gsize num, const gdouble * average,
+    gdouble * sum)
+{
+  const float64x2_t vavg = vdupq_n_f64 (average ? *average : 0.0);
+  float64x2_t acc0 = vdupq_n_f64 (0.0);
+  float64x2_t acc1 = vdupq_n_f64 (0.0);
+  float64x2_t v0, v1;
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4) {
+    v0 = _neon_load_f64 (input, i);
+    v1 = _neon_load_f64 (input, i + 2);
+
+    if (average) {
+      v0 = vsubq_f64 (v0, vavg);
+      v1 = vsubq_f64 (v1, vavg);
+      v0 = vmulq_f64 (v0, v0);
+      v1 = vmulq_f64 (v1, v1);
+    }
+
+    acc0 = vaddq_f64 (acc0, v0);
+    acc1 = vaddq_f64 (acc1, v1);
+  }
+
+  acc0 = vaddq_f64 (acc0, acc1);
+  *sum = vgetq_lane_f64 (acc0, 0) + vgetq_lane_f64 (acc0, 1);
+  return i;
+}
+
+/**
+ * @brief Standardize the data to float32 output (NEON, float32 only).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_stand_f32 (gconstpointer input, tensor_type in_type, gfloat * output,
+    gsize num, gdouble average, const gdouble * std)
+{
+  const float64x2_t vavg = vdupq_n_f64 (average);
+  const float64x2_t vstd = vdupq_n_f64 (std ? *std : 1.0);
+  float64x2_t v;
+  gsize i = 0;
+
+  if (in_type != _NNS_FLOAT32)
+    return 0;
+
+  for (; i + 2 <= num; i += 2) {
+    v = vsubq_f64 (_neon_load_f64 (input, i), vavg);
+    if (std)
+      v = vabsq_f64 (vdivq_f64 (v, vstd));
+    vst1_f32 (output + i, vcvt_f32_f64 (v));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Convert float16 to float32 (NEON).
+ */
+static void
+_neon_f16_to_f32 (gconstpointer input, gfloat * output, gsize num)
+{
+  const guint16 *ip = (const guint16 *) input;
+  guint16 tmp_in[4] = { 0, };
+  gfloat tmp_out[4];
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4)
+    vst1q_f32 (output + i, vcvt_f32_f16 (vreinterpret_f16_u16 (vld1_u16 (ip + i))));
+
+  /* convert the remaining elements with the same instruction */
+  if (i < num) {
+    memcpy (tmp_in, ip + i, (num - i) * sizeof (guint16));
+    vst1q_f32 (tmp_out, vcvt_f32_f16 (vreinterpret_f16_u16 (vld1_u16 (tmp_in))));
+    memcpy (output + i, tmp_out, (num - i) * sizeof (gfloat));
+  }
+}
+
+/**
+ * @brief Convert float32 to float16 (NEON).
+ */
+static void
+_neon_f32_to_f16 (const gfloat * input, gpointer output, gsize num)
+{
+  guint16 *op = (guint16 *) output;
+  gfloat tmp_in[4] = { 0, };
+  guint16 tmp_out[4];
+  gsize i = 0;
+
+  for (; i + 4 <= num; i += 4)
+    vst1_u16 (op + i, vreinterpret_u16_f16 (vcvt_f16_f32 (vld1q_f32 (input + i))));
+
+  if (i < num) {
+    memcpy (tmp_in, input + i, (num - i) * sizeof (gfloat));
+    vst1_u16 (tmp_out, vreinterpret_u16_f16 (vcvt_f16_f32 (vld1q_f32 (tmp_in))));
+    memcpy (op + i, tmp_out, (num - i) * sizeof (guint16));
+  }
+}
+
+/**
+ * @brief Bit weights to gather the lanes of 8-bit mask (NEON).
+ */
+static const guint8 _neon_bit_weights[16] = {
+  1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+};
+
+/**
+ * @brief Get the lanes (0xFF if the element is not zero) of 16 elements (NEON).
+ */
+static inline uint8x16_t
+_neon_nonzero_lanes (const guint8 * p, gsize esize)
+{
+  switch (esize) {
+    case 1:
+    {
+      uint8x16_t v = vld1q_u8 (p);
+      return vtstq_u8 (v, v);
+    }
+    case 2:
+    {
+      uint16x8_t v0 = vld1q_u16 ((const guint16 *) p);
+      uint16x8_t v1 = vld1q_u16 ((const guint16 *) (p + 16));
+      return vcombine_u8 (vmovn_u16 (vtstq_u16 (v0, v0)),
+          vmovn_u16 (vtstq_u16 (v1, v1)));
+    }
+    case 4:
+    {
+      uint32x4_t v0 = vld1q_u32 ((const guint32 *) p);
+      uint32x4_t v1 = vld1q_u32 ((const guint32 *) (p + 16));
+      uint32x4_t v2 = vld1q_u32 ((const guint32 *) (p + 32));
+      uint32x4_t v3 = vld1q_u32 ((const guint32 *) (p + 48));
+      uint16x8_t h0 = vcombine_u16 (vmovn_u32 (vtstq_u32 (v0, v0)),
+          vmovn_u32 (vtstq_u32 (v1, v1)));
+      uint16x8_t h1 = vcombine_u16 (vmovn_u32 (vtstq_u32 (v2, v2)),
+          vmovn_u32 (vtstq_u32 (v3, v3)));
+      return vcombine_u8 (vmovn_u16 (h0), vmovn_u16 (h1));
+    }
+    default:
+    {
+      uint32x4_t q[4];
+      guint k;
+
+      for (k = 0; k < 4; k++) {
+        uint64x2_t v0 = vld1q_u64 ((const guint64 *) (p + k * 32));
+        uint64x2_t v1 = vld1q_u64 ((const guint64 *) (p + k * 32 + 16));
+        q[k] = vcombine_u32 (vmovn_u64 (vtstq_u64 (v0, v0)),
+            vmovn_u64 (vtstq_u64 (v1, v1)));
+      }
+
+      return vcombine_u8 (vmovn_u16 (vcombine_u16 (vmovn_u32 (q[0]),
+                  vmovn_u32 (q[1]))), vmovn_u16 (vcombine_u16 (vmovn_u32 (q[2]),
+                  vmovn_u32 (q[3]))));
+    }
+  }
+}
+
+/**
+ * @brief Build the bitmap of non-zero elements (NEON).
+ * @return The number of processed elements (multiple of 64)
+ */
+static gsize
+_neon_nonzero_mask (const guint8 * input, gsize esize, guint64 * mask,
+    gsize num)
+{
+  const uint8x16_t weights = vld1q_u8 (_neon_bit_weights);
+  uint8x16_t lanes;
+  const guint8 *p;
+  guint64 bits, m;
+  gsize w, nwords = num / 64;
+  guint j;
+
+  if (esize != 1 && esize != 2 && esize != 4 && esize != 8)
+    return 0;
+
+  for (w = 0; w < nwords; w++) {
+    p = input + w * 64 * esize;
+    bits = 0;
+
+    for (j = 0; j < 4; j++, p += 16 * esize) {
+      lanes = vandq_u8 (_neon_nonzero_lanes (p, esize), weights);
+      m = vaddv_u8 (vget_low_u8 (lanes)) |
+          ((guint64) vaddv_u8 (vget_high_u8 (lanes)) << 8);
+      bits |= m << (j * 16);
+    }
+
+    mask[w] = bits;
+  }
+
+  return nwords * 64;
+}
+/**
+ * @brief Reduce float32 data with max, min or count (NEON).
+ * @return The number of processed elements
+ */
+static gsize
+_neon_reduce_f32 (const gfloat * input, gsize num, nns_simd_reduce op,
+    gfloat threshold, gfloat * value, gsize * count)
+{
+  const float32x4_t vth = vdupq_n_f32 (threshold);
+  float32x4_t acc;
+  uint32x4_t cnt = vdupq_n_u32 (0);
+  gfloat v;
+  gsize i = 0;
+
+  /* vmaxnm and vminnm return the other operand if an element is NaN */
+  switch (op) {
+    case NNS_SIMD_REDUCE_MAX:
+      acc = vdupq_n_f32 (-INFINITY);
+      for (; i + 4 <= num; i += 4)
+        acc = vmaxnmq_f32 (acc, vld1q_f32 (input + i));
+      v = vmaxnmvq_f32 (acc);
+      if (v > *value)
+        *value = v;
+      break;
+    case NNS_SIMD_REDUCE_MIN:
+      acc = vdupq_n_f32 (INFINITY);
+      for (; i + 4 <= num; i += 4)
+        acc = vminnmq_f32 (acc, vld1q_f32 (input + i));
+      v = vminnmvq_f32 (acc);
+      if (v < *value)
+        *value = v;
+      break;
+    case NNS_SIMD_REDUCE_COUNT_GT:
+      /* the mask of a lane is all 1 (-1) if greater than the threshold */
+      for (; i + 4 <= num; i += 4)
+        cnt = vsubq_u32 (cnt, vcgtq_f32 (vld1q_f32 (input + i), vth));
+      *count += vaddvq_u32 (cnt);
+      break;
+    default:
+      break;
+  }
+
+  return i;
+}
+#endif /* NNS_SIMD_NEON */
+
+/**
+ * @brief Check whether the SIMD kernels are available on this machine.
+ */
+gboolean
+gst_tensor_simd_is_available (void)
+{
+  gst_tensor_simd_init ();
+  return (simd_level != NNS_SIMD_LEVEL_NONE);
+}
+
+/**
+ * @brief Typecast the tensor data to float32.
+ */
+gboolean
+gst_tensor_simd_typecast_f32 (gconstpointer input, tensor_type in_type,
+    gfloat * output, gsize num)
+{
+  gsize i = 0;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+  switch (in_type) {
+    case _NNS_INT8:
+    case _NNS_UINT8:
+    case _NNS_INT16:
+    case _NNS_UINT16:
+    case _NNS_INT32:
+      break;
+    case _NNS_FLOAT32:
+      if ((gconstpointer) output != input)
+        memcpy (output, input, num * sizeof (gfloat));
+      return TRUE;
+    default:
+      return FALSE;
+  }
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_typecast_f32 (input, in_type, output, num);
+  else
+    i = _sse2_typecast_f32 (input, in_type, output, num);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_typecast_f32 (input, in_type, output, num);
+#endif
+
+  switch (in_type) {
+    case _NNS_INT8:
+      typecast_f32_tail (gint8, input, output, i, num);
+      break;
+    case _NNS_UINT8:
+      typecast_f32_tail (guint8, input, output, i, num);
+      break;
+    case _NNS_INT16:
+      typecast_f32_tail (gint16, input, output, i, num);
+      break;
+    case _NNS_UINT16:
+      typecast_f32_tail (guint16, input, output, i, num);
+      break;
+    case _NNS_INT32:
+      typecast_f32_tail (gint32, input, output, i, num);
+      break;
+    default:
+      break;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Apply the operator with a constant value to float32 data (in-place).
+ */
+gboolean
+gst_tensor_simd_operator_f32 (gfloat * data, gsize num, nns_simd_op op,
+    gfloat value)
+{
+  gsize i = 0;
+
+  g_return_val_if_fail (data != NULL, FALSE);
+  g_return_val_if_fail (op < NNS_SIMD_OP_UNKNOWN, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_operator_f32 (data, num, op, value);
+  else
+    i = _sse2_operator_f32 (data, num, op, value);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_operator_f32 (data, num, op, value);
+#endif
+
+  operator_f32_tail (data, i, num, op, value);
+  return TRUE;
+}
+
+/**
+ * @brief Apply the operator to float32 data with repeated operands (in-place).
+ */
+gboolean
+gst_tensor_simd_operator_pattern_f32 (gfloat * data, gsize num,
+    nns_simd_op op, const gfloat * pattern, gsize period)
+{
+  gsize i = 0, j;
+
+  g_return_val_if_fail (data != NULL, FALSE);
+  g_return_val_if_fail (pattern != NULL, FALSE);
+  g_return_val_if_fail (period > 0, FALSE);
+  g_return_val_if_fail (op < NNS_SIMD_OP_UNKNOWN, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_operator_pattern_f32 (data, num, op, pattern, period);
+  else
+    i = _sse2_operator_pattern_f32 (data, num, op, pattern, period);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_operator_pattern_f32 (data, num, op, pattern, period);
+#endif
+
+  for (j = i % period; i < num; i++) {
+    operator_f32_tail (data, i, i + 1, op, pattern[j]);
+    if (++j == period)
+      j = 0;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Clamp float32 data.
+ */
+gboolean
+gst_tensor_simd_clamp_f32 (const gfloat * input, gfloat * output, gsize num,
+    gfloat min, gfloat max)
+{
+  gsize i = 0;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_clamp_f32 (input, output, num, min, max);
+  else
+    i = _sse2_clamp_f32 (input, output, num, min, max);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_clamp_f32 (input, output, num, min, max);
+#endif
+
+  for (; i < num; i++)
+    output[i] = CLAMP (input[i], min, max);
+
+  return TRUE;
+}
+
+/**
+ * @brief Linear interpolation of float32 data.
+ */
+gboolean
+gst_tensor_simd_lerp_f32 (const gfloat * a, const gfloat * b,
+    gfloat * output, gsize num, gfloat w)
+{
+  gsize i = 0;
+
+  g_return_val_if_fail (a != NULL, FALSE);
+  g_return_val_if_fail (b != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_lerp_f32 (a, b, output, num, w);
+  else
+    i = _sse2_lerp_f32 (a, b, output, num, w);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_lerp_f32 (a, b, output, num, w);
+#endif
+
+  for (; i < num; i++)
+    output[i] = a[i] + (b[i] - a[i]) * w;
+
+  return TRUE;
+}
+
+/**
+ * @brief Get the element as float64.
+ */
+static inline gdouble
+_get_f64 (gconstpointer input, tensor_type in_type, gsize i)
+{
+  if (in_type == _NNS_UINT8)
+    return (gdouble) ((const guint8 *) input)[i];
+
+  return (gdouble) ((const gfloat *) input)[i];
+}
+
+/**
+ * @brief Calculate the sum of the elements, or the sum of squared difference from the average if given.
+ * @return TRUE if done
+ */
+static gboolean
+_simd_sum (gconstpointer input, tensor_type in_type, gsize num,
+    const gdouble * average, gdouble * sum)
+{
+  gdouble v;
+  gsize i = 0;
+
+  *sum = 0.0;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level != NNS_SIMD_LEVEL_AVX2)
+    return FALSE;
+  i = _avx2_sum (input, in_type, num, average, sum);
+#elif defined(NNS_SIMD_NEON)
+  if (in_type != _NNS_FLOAT32)
+    return FALSE;
+  i = _neon_sum (input, num, average, sum);
+#else
+  return FALSE;
+#endif
+
+  for (; i < num; i++) {
+    v = _get_f64 (input, in_type, i);
+    if (average)
+      v = (v - *average) * (v - *average);
+    *sum += v;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Calculate the average and standard deviation of the tensor data.
+ */
+gboolean
+gst_tensor_simd_average_std (gconstpointer input, tensor_type in_type,
+    gsize num, gdouble * average, gdouble * std)
+{
+  gdouble sum;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (num > 0, FALSE);
+  g_return_val_if_fail (average != NULL, FALSE);
+  g_return_val_if_fail (std != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+  if (in_type != _NNS_UINT8 && in_type != _NNS_FLOAT32)
+    return FALSE;
+
+  if (!_simd_sum (input, in_type, num, NULL, &sum))
+    return FALSE;
+  *average = sum / num;
+
+  _simd_sum (input, in_type, num, average, &sum);
+  sum /= num;
+  *std = (sum != 0.0) ? sqrt (sum) : (1e-10);
+
+  return TRUE;
+}
+
+/**
+ * @brief Standardize the tensor data to float32 output.
+ */
+gboolean
+gst_tensor_simd_stand_f32 (gconstpointer input, tensor_type in_type,
+    gfloat * output, gsize num, gdouble average, const gdouble * std)
+{
+  gdouble v;
+  gsize i = 0;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+  if (in_type != _NNS_UINT8 && in_type != _NNS_FLOAT32)
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level != NNS_SIMD_LEVEL_AVX2)
+    return FALSE;
+  i = _avx2_stand_f32 (input, in_type, output, num, average, std);
+#elif defined(NNS_SIMD_NEON)
+  if (in_type != _NNS_FLOAT32)
+    return FALSE;
+  i = _neon_stand_f32 (input, in_type, output, num, average, std);
+#endif
+
+  for (; i < num; i++) {
+    v = _get_f64 (input, in_type, i) - average;
+    if (std)
+      v = fabs (v / *std);
+    output[i] = (gfloat) v;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Convert float16 (IEEE 754 half precision) data to float32.
+ */
+gboolean
+gst_tensor_simd_f16_to_f32 (gconstpointer input, gfloat * output, gsize num)
+{
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  gst_tensor_simd_init ();
+  if (!simd_f16)
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  _f16c_f16_to_f32 (input, output, num);
+  return TRUE;
+#elif defined(NNS_SIMD_NEON)
+  _neon_f16_to_f32 (input, output, num);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+/**
+ * @brief Convert float32 data to float16 (IEEE 754 half precision, round to nearest even).
+ */
+gboolean
+gst_tensor_simd_f32_to_f16 (const gfloat * input, gpointer output, gsize num)
+{
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (output != NULL, FALSE);
+
+  gst_tensor_simd_init ();
+  if (!simd_f16)
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  _f16c_f32_to_f16 (input, output, num);
+  return TRUE;
+#elif defined(NNS_SIMD_NEON)
+  _neon_f32_to_f16 (input, output, num);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+/**
+ * @brief Build the bitmap of non-zero elements.
+ */
+gboolean
+gst_tensor_simd_nonzero_mask (gconstpointer input, gsize esize,
+    guint64 * mask, gsize num)
+{
+  gsize i = 0;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (mask != NULL, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+  if (esize != 1 && esize != 2 && esize != 4 && esize != 8)
+    return FALSE;
+
+#if defined(NNS_SIMD_X86)
+  i = _sse2_nonzero_mask (input, esize, mask, num);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_nonzero_mask (input, esize, mask, num);
+#endif
+
+  if (i < num) {
+    mask[i >> 6] = 0;
+
+    switch (esize) {
+      case 1:
+        nonzero_mask_tail (guint8, input, mask, i, num);
+        break;
+      case 2:
+        nonzero_mask_tail (guint16, input, mask, i, num);
+        break;
+      case 4:
+        nonzero_mask_tail (guint32, input, mask, i, num);
+        break;
+      default:
+        nonzero_mask_tail (guint64, input, mask, i, num);
+        break;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Reduce float32 data into a value.
+ */
+gboolean
+gst_tensor_simd_reduce_f32 (const gfloat * input, gsize num,
+    nns_simd_reduce op, gfloat threshold, gdouble * result)
+{
+  gfloat value;
+  gsize i = 0, count = 0;
+
+  g_return_val_if_fail (input != NULL, FALSE);
+  g_return_val_if_fail (result != NULL, FALSE);
+  g_return_val_if_fail (op < NNS_SIMD_REDUCE_UNKNOWN, FALSE);
+
+  if (!gst_tensor_simd_is_available ())
+    return FALSE;
+
+  if (op == NNS_SIMD_REDUCE_SUM)
+    return _simd_sum (input, _NNS_FLOAT32, num, NULL, result);
+
+  value = (op == NNS_SIMD_REDUCE_MIN) ? INFINITY : -INFINITY;
+
+#if defined(NNS_SIMD_X86)
+  if (simd_level == NNS_SIMD_LEVEL_AVX2)
+    i = _avx2_reduce_f32 (input, num, op, threshold, &value, &count);
+  else
+    i = _sse2_reduce_f32 (input, num, op, threshold, &value, &count);
+#elif defined(NNS_SIMD_NEON)
+  i = _neon_reduce_f32 (input, num, op, threshold, &value, &count);
+#endif
+
+  for (; i < num; i++) {
+    if (op == NNS_SIMD_REDUCE_MAX) {
+      if (input[i] > value)
+        value = input[i];
+    } else if (op == NNS_SIMD_REDUCE_MIN) {
+      if (input[i] < value)
+        value = input[i];
+    } else if (input[i] > threshold) {
+      count++;
+    }
+  }
+
+  *result = (op == NNS_SIMD_REDUCE_COUNT_GT) ? (gdouble) count : value;
+  return TRUE;
+}
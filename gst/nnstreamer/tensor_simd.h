@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file	tensor_simd.h
+ * @date	16 Oct 2026
+ * @brief	Internal SIMD kernels for element-wise tensor operations.
+ * @see	http://github.com/nnstreamer/nnstreamer
+ * @bug	No known bugs except for NYI items
+ *
+ * The kernels are selected at runtime (AVX2 or SSE2 on x86_64, NEON on aarch64).
+ * Each function returns FALSE if the given type is not supported or SIMD is not available,
+ * then the caller should run its scalar code. The results are the same as the scalar code
+ * except the reduction (sum of the elements) which is accumulated in several lanes.
+ */
+
+#ifndef __NNS_TENSOR_SIMD_H__
+#define __NNS_TENSOR_SIMD_H__
+
+#include <glib.h>
+#include <tensor_typedef.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Element-wise operators supported by SIMD kernels.
+ */
+typedef enum
+{
+  NNS_SIMD_OP_ADD = 0,
+  NNS_SIMD_OP_MUL,
+  NNS_SIMD_OP_DIV,
+
+  NNS_SIMD_OP_UNKNOWN
+} nns_simd_op;
+
+/**
+ * @brief Check whether the SIMD kernels are available on this machine.
+ * @return TRUE if available
+ */
+extern gboolean
+gst_tensor_simd_is_available (void);
+
+/**
+ * @brief Typecast the tensor data to float32.
+ * @param input pointer of input tensor data
+ * @param in_type input tensor type (int8, uint8, int16, uint16, int32 or float32)
+ * @param output pointer of float32 output
+ * @param num the number of elements
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_typecast_f32 (gconstpointer input, tensor_type in_type,
+    gfloat * output, gsize num);
+
+/**
+ * @brief Apply the operator with a constant value to float32 data (in-place).
+ * @param data pointer of float32 data
+ * @param num the number of elements
+ * @param op operator
+ * @param value operand
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_operator_f32 (gfloat * data, gsize num, nns_simd_op op,
+    gfloat value);
+
+/**
+ * @brief Apply the operator to float32 data with repeated operands (in-place).
+ * @details The operand of i'th element is pattern[i % period]. The pattern should have (period + 8) elements, repeating the first 8 elements at the end.
+ * @param data pointer of float32 data
+ * @param num the number of elements
+ * @param op operator
+ * @param pattern operands
+ * @param period the period of the operands
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_operator_pattern_f32 (gfloat * data, gsize num,
+    nns_simd_op op, const gfloat * pattern, gsize period);
+
+/**
+ * @brief Clamp float32 data.
+ * @param input pointer of float32 input
+ * @param output pointer of float32 output
+ * @param num the number of elements
+ * @param min the min value
+ * @param max the max value
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_clamp_f32 (const gfloat * input, gfloat * output, gsize num,
+    gfloat min, gfloat max);
+
+/**
+ * @brief Linear interpolation of float32 data, output = a + (b - a) * w.
+ * @param a pointer of float32 input
+ * @param b pointer of float32 input
+ * @param output pointer of float32 output
+ * @param num the number of elements
+ * @param w the weight of b
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_lerp_f32 (const gfloat * a, const gfloat * b,
+    gfloat * output, gsize num, gfloat w);
+
+/**
+ * @brief Calculate the average and standard deviation of the tensor data.
+ * @param input pointer of input tensor data
+ * @param in_type input tensor type (uint8 or float32)
+ * @param num the number of elements
+ * @param[out] average the average value
+ * @param[out] std the standard deviation (1e-10 if it is 0)
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_average_std (gconstpointer input, tensor_type in_type,
+    gsize num, gdouble * average, gdouble * std);
+
+/**
+ * @brief Standardize the tensor data to float32 output.
+ * @details output = |(input - average) / std| if std is given, otherwise output = input - average. The result is calculated in float64.
+ * @param input pointer of input tensor data
+ * @param in_type input tensor type (uint8 or float32)
+ * @param output pointer of float32 output
+ * @param num the number of elements
+ * @param average the average value
+ * @param std pointer of the standard deviation (NULL to subtract the average only)
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_stand_f32 (gconstpointer input, tensor_type in_type,
+    gfloat * output, gsize num, gdouble average, const gdouble * std);
+
+/**
+ * @brief Convert float16 (IEEE 754 half precision) data to float32.
+ * @param input pointer of float16 input
+ * @param output pointer of float32 output
+ * @param num the number of elements
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_f16_to_f32 (gconstpointer input, gfloat * output, gsize num);
+
+/**
+ * @brief Convert float32 data to float16 (IEEE 754 half precision, round to nearest even).
+ * @param input pointer of float32 input
+ * @param output pointer of float16 output
+ * @param num the number of elements
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_f32_to_f16 (const gfloat * input, gpointer output, gsize num);
+
+/**
+ * @brief Build the bitmap of non-zero elements.
+ * @details Bit (i % 64) of mask[i / 64] is set if i'th element is not zero, comparing all bits of the element. (e.g., float -0.0 is not zero)
+ * @param input pointer of input tensor data
+ * @param esize the size of an element in bytes (1, 2, 4 or 8)
+ * @param mask bitmap to be filled, (num + 63) / 64 words
+ * @param num the number of elements
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_nonzero_mask (gconstpointer input, gsize esize,
+    guint64 * mask, gsize num);
+
+/**
+ * @brief Reductions supported by SIMD kernels.
+ */
+typedef enum
+{
+  NNS_SIMD_REDUCE_SUM = 0,
+  NNS_SIMD_REDUCE_MAX,
+  NNS_SIMD_REDUCE_MIN,
+  NNS_SIMD_REDUCE_COUNT_GT,
+
+  NNS_SIMD_REDUCE_UNKNOWN
+} nns_simd_reduce;
+
+/**
+ * @brief Reduce float32 data into a value.
+ * @details SUM is accumulated in float64. MAX and MIN ignore NaN elements (the result is -inf or inf if there is no other element). COUNT_GT counts the elements greater than the threshold.
+ * @param input pointer of float32 input
+ * @param num the number of elements
+ * @param op reduction
+ * @param threshold the threshold of COUNT_GT
+ * @param[out] result the reduced value
+ * @return TRUE if done
+ */
+extern gboolean
+gst_tensor_simd_reduce_f32 (const gfloat * input, gsize num,
+    nns_simd_reduce op, gfloat threshold, gdouble * result);
+
+G_END_DECLS
+#endif /* __NNS_TENSOR_SIMD_H__ */
@@ -46,16 +46,23 @@ NNSTREAMER_COMMON_SRCS := \
 # nnstreamer plugins. Not used for SINGLE-only build.
 NNSTREAMER_PLUGINS_SRCS := \
     $(NNSTREAMER_GST_HOME)/tensor_data.c \
+    $(NNSTREAMER_GST_HOME)/tensor_simd.c \
+    $(NNSTREAMER_GST_HOME)/tensor_metrics.c \
     $(NNSTREAMER_GST_HOME)/tensor_meta.c \
     $(NNSTREAMER_GST_HOME)/nnstreamer_plugin_api_impl.c \
     $(NNSTREAMER_GST_HOME)/registerer/nnstreamer.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_aggregator.c \
+    $(NNSTREAMER_GST_HOME)/elements/gsttensor_codecdec.c \
+    $(NNSTREAMER_GST_HOME)/elements/gsttensor_codecenc.c \
+    $(NNSTREAMER_GST_HOME)/elements/gsttensor_codecutil.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_converter.c \
+    $(NNSTREAMER_GST_HOME)/elements/gsttensor_converter_preprocess.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_crop.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_debug.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_decoder.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_demux.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_if.c \
+    $(NNSTREAMER_GST_HOME)/elements/gsttensor_ifexpr.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_merge.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_mux.c \
     $(NNSTREAMER_GST_HOME)/elements/gsttensor_rate.c \
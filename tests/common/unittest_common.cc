@@ -19,6 +19,7 @@
 #include <nnstreamer_conf.h>
 #include <nnstreamer_plugin_api.h>
 #include <tensor_common.h>
+#include <tensor_metrics.h>
 #include <unistd.h>
 #include <unittest_util.h>
 
@@ -1505,6 +1506,100 @@ TEST (commonMetaInfo, parseHeaderInvalidParam_n)
   g_free (header);
 }
 
+/**
+ * @brief Test for tensor meta info (the size of the structure is kept).
+ */
+TEST (commonMetaInfo, structSize)
+{
+  /* 22 words, the parameters of tensor format are kept in the reserved words of the header */
+  EXPECT_EQ (sizeof (GstTensorMetaInfo), 88U);
+}
+
+/**
+ * @brief Test for tensor meta info (update and parse the header of compressed tensor).
+ */
+TEST (commonMetaInfo, compressedHeader)
+{
+  GstTensorMetaInfo meta, parsed;
+  GstCompressedTensorInfo compressed, result;
+  gpointer header;
+  guint major, minor;
+
+  gst_tensor_meta_info_init (&meta);
+  meta.type = _NNS_FLOAT32;
+  meta.dimension[0] = 100;
+
+  memset (&compressed, 0, sizeof (GstCompressedTensorInfo));
+  compressed.codec = _NNS_CODEC_LZ;
+  compressed.filter = _NNS_CODEC_FILTER_DELTA;
+  compressed.quant = _NNS_CODEC_QUANT_INT8;
+  compressed.size = 50;
+  compressed.scale = 0.5f;
+  compressed.zero_point = -1.0f;
+
+  EXPECT_TRUE (gst_tensor_meta_info_set_compressed (&meta, &compressed));
+  EXPECT_EQ (meta.format, _NNS_TENSOR_FORMAT_COMPRESSED);
+  EXPECT_EQ (gst_tensor_meta_info_get_data_size (&meta), 50U);
+
+  gst_tensor_meta_info_get_version (&meta, &major, &minor);
+  EXPECT_EQ (major, 2U);
+
+  header = g_malloc0 (gst_tensor_meta_info_get_header_size (&meta));
+  EXPECT_TRUE (gst_tensor_meta_info_update_compressed_header (&meta, &compressed, header));
+  EXPECT_TRUE (gst_tensor_meta_info_parse_compressed_header (&parsed, &result, header));
+
+  EXPECT_EQ (parsed.version, meta.version);
+  EXPECT_EQ (parsed.format, _NNS_TENSOR_FORMAT_COMPRESSED);
+  EXPECT_EQ (parsed.data_size, 50U);
+  EXPECT_EQ (result.codec, (uint32_t) _NNS_CODEC_LZ);
+  EXPECT_EQ (result.filter, (uint32_t) _NNS_CODEC_FILTER_DELTA);
+  EXPECT_EQ (result.quant, (uint32_t) _NNS_CODEC_QUANT_INT8);
+  EXPECT_EQ (result.size, 50U);
+  EXPECT_FLOAT_EQ (result.scale, 0.5f);
+  EXPECT_FLOAT_EQ (result.zero_point, -1.0f);
+
+  g_free (header);
+}
+
+/**
+ * @brief Test for tensor meta info (compressed tensor with invalid param).
+ */
+TEST (commonMetaInfo, compressedHeaderInvalidParam_n)
+{
+  GstTensorMetaInfo meta;
+  GstCompressedTensorInfo compressed;
+  gpointer header;
+
+  gst_tensor_meta_info_init (&meta);
+  meta.type = _NNS_UINT8;
+  meta.dimension[0] = 100;
+  memset (&compressed, 0, sizeof (GstCompressedTensorInfo));
+
+  EXPECT_FALSE (gst_tensor_meta_info_set_compressed (NULL, &compressed));
+  EXPECT_FALSE (gst_tensor_meta_info_set_compressed (&meta, NULL));
+
+  /* invalid codec */
+  compressed.codec = _NNS_CODEC_END;
+  EXPECT_FALSE (gst_tensor_meta_info_set_compressed (&meta, &compressed));
+
+  /* quantization of integer tensor */
+  compressed.codec = _NNS_CODEC_LZ;
+  compressed.quant = _NNS_CODEC_QUANT_INT8;
+  EXPECT_FALSE (gst_tensor_meta_info_set_compressed (&meta, &compressed));
+
+  /* compressed tensor with meta version 1 */
+  header = g_malloc0 (gst_tensor_meta_info_get_header_size (&meta));
+  meta.format = _NNS_TENSOR_FORMAT_COMPRESSED;
+  EXPECT_FALSE (gst_tensor_meta_info_validate (&meta));
+  EXPECT_FALSE (gst_tensor_meta_info_update_compressed_header (&meta, &compressed, header));
+
+  compressed.quant = _NNS_CODEC_QUANT_NONE;
+  EXPECT_FALSE (gst_tensor_meta_info_update_compressed_header (&meta, NULL, header));
+  EXPECT_FALSE (gst_tensor_meta_info_parse_compressed_header (&meta, NULL, header));
+
+  g_free (header);
+}
+
 /**
  * @brief Test for tensor meta info (parse memory with invalid param).
  */
@@ -2147,6 +2242,70 @@ TEST (commonUtil, createTensorBufferInvalidSize_n)
   gst_buffer_unref (out);
 }
 
+/**
+ * @brief Test tensor buffer util (append extra tensors and get nth memory)
+ */
+TEST (commonUtil, appendExtraTensors_p)
+{
+  GstTensorInfo info;
+  GstBuffer *buffer;
+  GstMemory *mem, *shared;
+  GstMapInfo map;
+  guint i;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_UINT32;
+  gst_tensor_parse_dimension ("4", info.dimension);
+
+  buffer = gst_buffer_new ();
+
+  for (i = 0; i < 200U; i++) {
+    guint32 *data;
+
+    mem = gst_allocator_alloc (NULL, gst_tensor_info_get_size (&info), NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_WRITE));
+    data = (guint32 *) map.data;
+    data[0] = data[1] = data[2] = data[3] = i;
+    gst_memory_unmap (mem, &map);
+
+    EXPECT_TRUE (gst_tensor_buffer_append_memory (buffer, mem, &info));
+  }
+
+  EXPECT_EQ (gst_buffer_n_memory (buffer), (guint) NNS_TENSOR_MEMORY_MAX);
+  EXPECT_EQ (gst_tensor_buffer_get_count (buffer), 200U);
+
+  /* The sub-memory is shared, appending a tensor should not change it. */
+  shared = gst_tensor_buffer_get_nth_memory (buffer, 100U);
+  ASSERT_TRUE (shared != NULL);
+
+  mem = gst_allocator_alloc (NULL, gst_tensor_info_get_size (&info), NULL);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_WRITE));
+  memset (map.data, 0xff, map.size);
+  gst_memory_unmap (mem, &map);
+  EXPECT_TRUE (gst_tensor_buffer_append_memory (buffer, mem, &info));
+  EXPECT_EQ (gst_tensor_buffer_get_count (buffer), 201U);
+
+  ASSERT_TRUE (gst_memory_map (shared, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, gst_tensor_info_get_size (&info));
+  EXPECT_EQ (((guint32 *) map.data)[3], 100U);
+  gst_memory_unmap (shared, &map);
+  gst_memory_unref (shared);
+
+  for (i = 0; i < 201U; i++) {
+    mem = gst_tensor_buffer_get_nth_memory (buffer, i);
+    ASSERT_TRUE (mem != NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+    EXPECT_EQ (map.size, gst_tensor_info_get_size (&info));
+    EXPECT_EQ (((guint32 *) map.data)[0], (i < 200U) ? i : 0xffffffffU);
+    EXPECT_EQ (((guint32 *) map.data)[3], (i < 200U) ? i : 0xffffffffU);
+    gst_memory_unmap (mem, &map);
+    gst_memory_unref (mem);
+  }
+
+  gst_buffer_unref (buffer);
+  gst_tensor_info_free (&info);
+}
+
 /**
  * @brief Test tensor dimension validation check util
  */
@@ -2251,6 +2410,313 @@ TEST (commonUtil, tensorDimensionIsEqualInvalid_n)
   EXPECT_FALSE (gst_tensor_dimension_is_equal (dim1, dim2));
 }
 
+/**
+ * @brief Test for buffer pool of tensor memories.
+ */
+TEST (commonTensorBufferPool, allocStatic_p)
+{
+  GstTensorsInfo info;
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstBuffer *buffer = NULL;
+  GstMemory *mem;
+  GstMapInfo map;
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 2;
+  info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("3:4:2:1", info.info[0].dimension);
+  info.info[1].type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("10:1:1:1", info.info[1].dimension);
+
+  pool = gst_tensor_buffer_pool_new (&info, FALSE);
+  ASSERT_TRUE (pool != NULL);
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, NULL, 64, 1, 0);
+  EXPECT_TRUE (gst_buffer_pool_set_config (pool, config));
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, TRUE));
+
+  EXPECT_EQ (gst_buffer_pool_acquire_buffer (pool, &buffer, NULL), GST_FLOW_OK);
+  ASSERT_TRUE (buffer != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (buffer), 2U);
+  EXPECT_EQ (gst_buffer_get_size (buffer), 64U);
+
+  mem = gst_buffer_peek_memory (buffer, 0);
+  EXPECT_EQ (gst_memory_get_sizes (mem, NULL, NULL), 24U);
+  mem = gst_buffer_peek_memory (buffer, 1);
+  EXPECT_EQ (gst_memory_get_sizes (mem, NULL, NULL), 40U);
+
+  /* the memory is aligned */
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_WRITE));
+  EXPECT_EQ (((guintptr) map.data) % 64, 0U);
+  gst_memory_unmap (mem, &map);
+
+  gst_buffer_unref (buffer);
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  gst_tensors_info_free (&info);
+}
+
+/**
+ * @brief Test for buffer pool of flexible tensor memories (with header).
+ */
+TEST (commonTensorBufferPool, allocFlexible_p)
+{
+  GstTensorsInfo info;
+  GstTensorMetaInfo meta;
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstBuffer *buffer = NULL;
+  gsize hsize;
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 1;
+  info.info[0].type = _NNS_INT16;
+  gst_tensor_parse_dimension ("5:2:1:1", info.info[0].dimension);
+
+  pool = gst_tensor_buffer_pool_new (&info, TRUE);
+  ASSERT_TRUE (pool != NULL);
+
+  gst_tensor_info_convert_to_meta (&info.info[0], &meta);
+  hsize = gst_tensor_meta_info_get_header_size (&meta);
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, NULL, (guint) (20 + hsize), 0, 0);
+  EXPECT_TRUE (gst_buffer_pool_set_config (pool, config));
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, TRUE));
+
+  EXPECT_EQ (gst_buffer_pool_acquire_buffer (pool, &buffer, NULL), GST_FLOW_OK);
+  ASSERT_TRUE (buffer != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (buffer), 1U);
+
+  gst_tensor_meta_info_init (&meta);
+  EXPECT_TRUE (gst_tensor_meta_info_parse_memory (&meta, gst_buffer_peek_memory (buffer, 0)));
+  EXPECT_EQ (meta.type, _NNS_INT16);
+  EXPECT_EQ (meta.dimension[0], 5U);
+  EXPECT_EQ (meta.dimension[1], 2U);
+  EXPECT_EQ (gst_tensor_meta_info_get_data_size (&meta), 20U);
+
+  gst_buffer_unref (buffer);
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  gst_tensors_info_free (&info);
+}
+
+/**
+ * @brief Test for buffer pool of tensor memories with invalid param.
+ */
+TEST (commonTensorBufferPool, newInvalidParam_n)
+{
+  GstTensorsInfo info;
+
+  EXPECT_TRUE (gst_tensor_buffer_pool_new (NULL, FALSE) == NULL);
+
+  gst_tensors_info_init (&info);
+  EXPECT_TRUE (gst_tensor_buffer_pool_new (&info, FALSE) == NULL);
+
+  info.num_tensors = NNS_TENSOR_MEMORY_MAX + 1;
+  EXPECT_TRUE (gst_tensor_buffer_pool_new (&info, FALSE) == NULL);
+}
+
+/**
+ * @brief Callback to count the release of wrapped memories.
+ */
+static void
+_wrapped_pool_notify (gpointer user_data)
+{
+  guint *notified = (guint *) user_data;
+
+  (*notified)++;
+}
+
+/**
+ * @brief Test for buffer pool wrapping external tensor memories.
+ */
+TEST (commonTensorBufferPool, allocWrapped_p)
+{
+  GstTensorsInfo info;
+  GstTensorMemory mem[2];
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstBuffer *buffer = NULL;
+  GstBuffer *other = NULL;
+  GstMemory *held;
+  GstMapInfo map;
+  guint8 data0[24];
+  gfloat data1[10];
+  guint min, max;
+  guint notified = 0;
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 2;
+  info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("3:4:2:1", info.info[0].dimension);
+  info.info[1].type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("10:1:1:1", info.info[1].dimension);
+
+  mem[0].data = data0;
+  mem[0].size = sizeof (data0);
+  mem[1].data = data1;
+  mem[1].size = sizeof (data1);
+
+  pool = gst_tensor_buffer_pool_new_wrapped (&info, mem, _wrapped_pool_notify, &notified);
+  ASSERT_TRUE (pool != NULL);
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, NULL, 64, 2, 0);
+  EXPECT_TRUE (gst_buffer_pool_set_config (pool, config));
+
+  config = gst_buffer_pool_get_config (pool);
+  EXPECT_TRUE (gst_buffer_pool_config_get_params (config, NULL, NULL, &min, &max));
+  EXPECT_EQ (min, 2U);
+  EXPECT_EQ (max, 0U);
+  gst_structure_free (config);
+
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, TRUE));
+  EXPECT_EQ (gst_buffer_pool_acquire_buffer (pool, &buffer, NULL), GST_FLOW_OK);
+  ASSERT_TRUE (buffer != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (buffer), 2U);
+
+  /* the buffer writes the data into the external memories */
+  ASSERT_TRUE (gst_memory_map (gst_buffer_peek_memory (buffer, 1), &map, GST_MAP_WRITE));
+  EXPECT_TRUE (map.data == (guint8 *) data1);
+  EXPECT_EQ (map.size, 40U);
+  ((gfloat *) map.data)[3] = 1.5f;
+  gst_memory_unmap (gst_buffer_peek_memory (buffer, 1), &map);
+  EXPECT_FLOAT_EQ (data1[3], 1.5f);
+
+  /* the external memories are in use, the next buffer does not share them */
+  EXPECT_EQ (gst_buffer_pool_acquire_buffer (pool, &other, NULL), GST_FLOW_OK);
+  ASSERT_TRUE (other != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (other), 2U);
+  ASSERT_TRUE (gst_memory_map (gst_buffer_peek_memory (other, 0), &map, GST_MAP_READ));
+  EXPECT_TRUE (map.data != data0);
+  EXPECT_EQ (map.size, 24U);
+  gst_memory_unmap (gst_buffer_peek_memory (other, 0), &map);
+  gst_buffer_unref (other);
+
+  /* the notify is called after the last wrapped memory is released */
+  held = gst_buffer_get_memory (buffer, 0);
+  gst_buffer_unref (buffer);
+  EXPECT_TRUE (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  EXPECT_EQ (notified, 0U);
+
+  gst_memory_unref (held);
+  EXPECT_EQ (notified, 1U);
+
+  gst_tensors_info_free (&info);
+}
+
+/**
+ * @brief Test for buffer pool wrapping external tensor memories with invalid param.
+ */
+TEST (commonTensorBufferPool, newWrappedInvalidParam_n)
+{
+  GstTensorsInfo info;
+  GstTensorMemory mem[1];
+  guint8 data[10];
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 1;
+  info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("24:1:1:1", info.info[0].dimension);
+
+  EXPECT_TRUE (gst_tensor_buffer_pool_new_wrapped (&info, NULL, NULL, NULL) == NULL);
+
+  /* the memory is smaller than the tensor */
+  mem[0].data = data;
+  mem[0].size = sizeof (data);
+  EXPECT_TRUE (gst_tensor_buffer_pool_new_wrapped (&info, mem, NULL, NULL) == NULL);
+
+  gst_tensors_info_free (&info);
+}
+
+/**
+ * @brief Test for latency histograms of the element.
+ */
+TEST (commonTensorMetrics, recordLatency_p)
+{
+  GstElement *element;
+  GstTensorMetrics *metrics;
+  gchar *text;
+  guint64 value;
+  gint64 i;
+  gchar *fullpath = g_build_path ("/", g_get_tmp_dir (), "nns-tizen-XXXXXX", NULL);
+  gchar *dir = g_mkdtemp (fullpath);
+  gchar *filename = g_build_path ("/", dir, "nnstreamer.ini", NULL);
+  gchar *confenv = g_strdup (g_getenv ("NNSTREAMER_CONF"));
+
+  /* the metrics is disabled by default */
+  FILE *fp = g_fopen (filename, "w");
+  ASSERT_TRUE (fp != NULL);
+  g_fprintf (fp, "[metrics]\n");
+  g_fprintf (fp, "enable=True\n");
+  fclose (fp);
+
+  EXPECT_TRUE (g_setenv ("NNSTREAMER_CONF", filename, TRUE));
+  EXPECT_TRUE (nnsconf_loadconf (TRUE));
+
+  /* the configuration may be read by the other tests */
+  gst_tensor_metrics_reload_config ();
+
+  element = gst_bin_new ("metrics_test");
+  metrics = gst_tensor_metrics_new (element, "tensor_filter");
+
+  removeTempFile (&filename);
+  g_rmdir (dir);
+  g_free (fullpath);
+  if (confenv) {
+    EXPECT_TRUE (g_setenv ("NNSTREAMER_CONF", confenv, TRUE));
+    g_free (confenv);
+  } else {
+    g_unsetenv ("NNSTREAMER_CONF");
+  }
+
+  /* restore the configuration for the other tests */
+  EXPECT_TRUE (nnsconf_loadconf (TRUE));
+  gst_tensor_metrics_reload_config ();
+
+  ASSERT_TRUE (metrics != NULL);
+
+  /* 1 to 1000 usec */
+  for (i = 1; i <= 1000; i++)
+    gst_tensor_metrics_record (metrics, 10, i, 100, 20);
+
+  /* the percentile has an error less than 12.5% */
+  value = gst_tensor_metrics_get_latency (metrics, NNS_METRICS_STAGE_PROCESS, 50.0);
+  EXPECT_GE (value, 500U);
+  EXPECT_LE (value, 563U);
+  value = gst_tensor_metrics_get_latency (metrics, NNS_METRICS_STAGE_PROCESS, 99.0);
+  EXPECT_GE (value, 990U);
+  EXPECT_LE (value, 1000U);
+  value = gst_tensor_metrics_get_latency (metrics, NNS_METRICS_STAGE_PROCESS, 100.0);
+  EXPECT_EQ (value, 1000U);
+  value = gst_tensor_metrics_get_latency (metrics, NNS_METRICS_STAGE_WAIT, 95.0);
+  EXPECT_EQ (value, 10U);
+
+  text = gst_tensor_metrics_to_text ();
+  EXPECT_TRUE (g_strstr_len (text, -1,
+                   "nnstreamer_latency_max_seconds{element=\"metrics_test\",kind=\"tensor_filter\",stage=\"process\"} 0.001000")
+      != NULL);
+  EXPECT_TRUE (g_strstr_len (text, -1,
+                   "nnstreamer_bytes_total{element=\"metrics_test\",kind=\"tensor_filter\",direction=\"in\"} 100000")
+      != NULL);
+  g_free (text);
+
+  gst_tensor_metrics_reset (metrics);
+  EXPECT_EQ (gst_tensor_metrics_get_latency (metrics, NNS_METRICS_STAGE_PROCESS, 100.0), 0U);
+
+  /* unregistered metrics is not exported */
+  gst_tensor_metrics_free (metrics);
+  text = gst_tensor_metrics_to_text ();
+  EXPECT_TRUE (g_strstr_len (text, -1, "metrics_test") == NULL);
+  g_free (text);
+
+  gst_object_unref (element);
+}
+
 /**
  * @brief Main function for unit test.
  */
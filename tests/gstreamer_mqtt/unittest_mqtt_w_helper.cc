@@ -284,6 +284,10 @@ TEST (testMqttSink, sinkGetSetProperties)
   EXPECT_STREQ (sprop, "time.google.com:123");
   g_free (sprop);
 
+  g_object_set (h->element, "coalesce", true, NULL);
+  g_object_get (h->element, "coalesce", &bprop, NULL);
+  EXPECT_TRUE (bprop);
+
   gst_harness_teardown (h);
 }
 
@@ -453,6 +457,67 @@ TEST (testMqttSinkWithHelper, sinkPush1)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for mqttsink with GstMqttTestHelper (Push a GstBufferList as a coalesced message)
+ */
+TEST (testMqttSinkWithHelper, sinkPushListCoalesce)
+{
+  GstHarness *h = gst_harness_new ("mqttsink");
+  GstBufferList *list;
+  GstFlowReturn ret;
+  const guint num_buffers = 8;
+  guint i;
+
+  g_object_set (h->element, "coalesce", true, NULL);
+  g_object_set (h->element, "max-buffer-size", 1024UL, NULL);
+  gst_harness_set_src_caps_str (h,
+      "other/tensors,num_tensors=1,dimensions=4:1:1:1,types=float32,format=static,framerate=0/1");
+  GstMqttTestHelper::getInstance ().initFailFlags ();
+
+  list = gst_buffer_list_new ();
+  for (i = 0; i < num_buffers; ++i) {
+    GstBuffer *buf = gst_harness_create_buffer (h, 16);
+
+    GST_BUFFER_PTS (buf) = i * GST_MSECOND;
+    gst_buffer_list_add (list, buf);
+  }
+
+  ret = gst_pad_push_list (h->srcpad, list);
+  EXPECT_EQ (ret, GST_FLOW_OK);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for mqttsink with GstMqttTestHelper (Push a coalesced message with too many memories)
+ */
+TEST (testMqttSinkWithHelper, sinkPushListCoalesceMems_n)
+{
+  GstHarness *h = gst_harness_new ("mqttsink");
+  GstBufferList *list;
+  GstBuffer *buf;
+  GstFlowReturn ret;
+  guint i;
+
+  g_object_set (h->element, "coalesce", true, NULL);
+  g_object_set (h->element, "max-buffer-size", 1024UL, NULL);
+  gst_harness_set_src_caps_str (h, "application/octet-stream");
+  GstMqttTestHelper::getInstance ().initFailFlags ();
+
+  list = gst_buffer_list_new ();
+  gst_buffer_list_add (list, gst_harness_create_buffer (h, 16));
+
+  buf = gst_buffer_new ();
+  for (i = 0; i < GST_MQTT_MAX_NUM_MEMS + 1; ++i)
+    gst_buffer_append_memory (buf, gst_allocator_alloc (NULL, 4, NULL));
+  gst_buffer_list_add (list, buf);
+
+  ret = gst_pad_push_list (h->srcpad, list);
+  EXPECT_EQ (ret, GST_FLOW_ERROR);
+
+  gst_harness_teardown (h);
+}
+
 /**
  * @brief Test for mqttsink with GstMqttTestHelper (MQTTAsync_send failure case)
  */
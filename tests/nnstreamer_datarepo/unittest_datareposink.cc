@@ -11,6 +11,7 @@
 #include <glib.h>
 #include <glib/gstdio.h>
 #include <gst/gst.h>
+#include <string.h>
 #include <unittest_util.h>
 
 static const gchar filename[] = "mnist.data";
@@ -313,6 +314,79 @@ TEST (datareposink, writeTensors)
   g_remove ("mnist.json");
 }
 
+/**
+ * @brief Test for writing a Tensors file in the background writer
+ */
+TEST (datareposink, writeTensorsAsync)
+{
+  gchar *contents = NULL, *expected = NULL;
+  gsize len = 0, expected_len = 0;
+  GstBus *bus;
+  GMainLoop *loop;
+  gchar *file_path = NULL;
+  gchar *json_path = NULL;
+  GstElement *datareposink = NULL;
+  gboolean get_bool;
+  guint get_value;
+
+  loop = g_main_loop_new (NULL, FALSE);
+
+  file_path = get_file_path (filename);
+  json_path = get_file_path (json);
+
+  /* small buffer and budget to make the render thread wait for the writer */
+  gchar *str_pipeline = g_strdup_printf (
+      "datareposrc location=%s json=%s start-sample-index=0 stop-sample-index=9 is-shuffle=false ! "
+      "datareposink name=datareposink location=mnist_async.data json=mnist_async.json "
+      "async-write=true buffer-size=5000 max-buffered-size=16384 direct-io=true",
+      file_path, json_path);
+
+  GstElement *pipeline = gst_parse_launch (str_pipeline, NULL);
+  g_free (str_pipeline);
+  ASSERT_NE (pipeline, nullptr);
+
+  datareposink = gst_bin_get_by_name (GST_BIN (pipeline), "datareposink");
+  EXPECT_NE (datareposink, nullptr);
+
+  g_object_get (datareposink, "async-write", &get_bool, NULL);
+  EXPECT_TRUE (get_bool);
+  g_object_get (datareposink, "buffer-size", &get_value, NULL);
+  EXPECT_EQ (get_value, 5000U);
+  g_object_get (datareposink, "max-buffered-size", &get_value, NULL);
+  EXPECT_EQ (get_value, 16384U);
+  g_object_get (datareposink, "direct-io", &get_bool, NULL);
+  EXPECT_TRUE (get_bool);
+  gst_object_unref (datareposink);
+
+  bus = gst_pipeline_get_bus (GST_PIPELINE (pipeline));
+  ASSERT_NE (bus, nullptr);
+  gst_bus_add_watch (bus, bus_callback, loop);
+  gst_object_unref (bus);
+
+  setPipelineStateSync (pipeline, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT);
+  g_main_loop_run (loop);
+
+  setPipelineStateSync (pipeline, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT);
+  g_main_loop_unref (loop);
+  gst_object_unref (pipeline);
+
+  /* 10 samples (3176 bytes) from the start of the file */
+  EXPECT_TRUE (g_file_get_contents ("mnist_async.data", &contents, &len, NULL));
+  EXPECT_TRUE (g_file_get_contents (file_path, &expected, &expected_len, NULL));
+  EXPECT_EQ (len, 3176U * 10U);
+  if (contents && expected && len <= expected_len)
+    EXPECT_EQ (memcmp (contents, expected, len), 0);
+  g_free (contents);
+  g_free (expected);
+
+  EXPECT_TRUE (g_file_test ("mnist_async.json", G_FILE_TEST_EXISTS));
+
+  g_free (file_path);
+  g_free (json_path);
+  g_remove ("mnist_async.data");
+  g_remove ("mnist_async.json");
+}
+
 /**
  * @brief Test for writing flexible tensors
  */
@@ -11,6 +11,7 @@
 #include <glib.h>
 #include <glib/gstdio.h>
 #include <gst/gst.h>
+#include <string.h>
 #include <unittest_util.h>
 
 static const gchar filename[] = "mnist.data";
@@ -820,6 +821,112 @@ TEST (datareposrc, readTensorsNoJSONWithCapsParam)
   g_main_loop_unref (loop);
 }
 
+/**
+ * @brief Callback for tensor sink signal, appends the data of received buffer.
+ */
+static void
+append_data_cb (GstElement *element, GstBuffer *buffer, GByteArray *array)
+{
+  GstMapInfo map;
+  guint i;
+
+  for (i = 0; i < gst_buffer_n_memory (buffer); i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buffer, i);
+
+    if (gst_memory_map (mem, &map, GST_MAP_READ)) {
+      g_byte_array_append (array, map.data, map.size);
+      gst_memory_unmap (mem, &map);
+    }
+  }
+}
+
+/**
+ * @brief Internal function to read a tensors file with given I/O option.
+ */
+static GByteArray *
+read_tensors_with_io_option (gboolean use_mmap, guint prefetch_depth)
+{
+  GstBus *bus;
+  GMainLoop *loop;
+  GstElement *pipeline, *datareposrc, *tensor_sink;
+  gboolean get_bool;
+  guint get_value;
+  GByteArray *array = g_byte_array_new ();
+  g_autofree gchar *file_path = get_file_path (filename);
+  g_autofree gchar *json_path = get_file_path (json);
+  g_autofree gchar *str_pipeline = g_strdup_printf (
+      "datareposrc name=datareposrc location=%s json=%s "
+      "start-sample-index=2 stop-sample-index=9 epochs=3 is-shuffle=false "
+      "tensors-sequence=1,0 use-mmap=%s prefetch-depth=%u ! "
+      "tensor_sink name=tensor_sink",
+      file_path, json_path, use_mmap ? "true" : "false", prefetch_depth);
+
+  pipeline = gst_parse_launch (str_pipeline, NULL);
+  EXPECT_NE (pipeline, nullptr);
+  if (pipeline == NULL)
+    return array;
+
+  datareposrc = gst_bin_get_by_name (GST_BIN (pipeline), "datareposrc");
+  EXPECT_NE (datareposrc, nullptr);
+
+  g_object_get (datareposrc, "use-mmap", &get_bool, NULL);
+  EXPECT_EQ (get_bool, use_mmap);
+
+  g_object_get (datareposrc, "prefetch-depth", &get_value, NULL);
+  EXPECT_EQ (get_value, prefetch_depth);
+
+  tensor_sink = gst_bin_get_by_name (GST_BIN (pipeline), "tensor_sink");
+  EXPECT_NE (tensor_sink, nullptr);
+  g_signal_connect (tensor_sink, "new-data", (GCallback) append_data_cb, array);
+
+  loop = g_main_loop_new (NULL, FALSE);
+  bus = gst_pipeline_get_bus (GST_PIPELINE (pipeline));
+  EXPECT_NE (bus, nullptr);
+  gst_bus_add_watch (bus, bus_callback, loop);
+  gst_object_unref (bus);
+
+  EXPECT_EQ (setPipelineStateSync (pipeline, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT), 0);
+  g_main_loop_run (loop);
+  EXPECT_EQ (setPipelineStateSync (pipeline, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT), 0);
+
+  gst_object_unref (tensor_sink);
+  gst_object_unref (datareposrc);
+  gst_object_unref (pipeline);
+  g_main_loop_unref (loop);
+
+  return array;
+}
+
+/**
+ * @brief Test for reading a tensors file with mmap and prefetch.
+ * The data should be same as the data read with read().
+ */
+TEST (datareposrc, readTensorsMmapPrefetch)
+{
+  GByteArray *expected, *result;
+
+  expected = read_tensors_with_io_option (FALSE, 0);
+  /* 8 samples (1:1:784:1 and 1:1:10:1 float32) and 3 epochs */
+  EXPECT_EQ (expected->len, (3136U + 40U) * 8U * 3U);
+
+  result = read_tensors_with_io_option (TRUE, 0);
+  EXPECT_EQ (result->len, expected->len);
+  EXPECT_EQ (memcmp (result->data, expected->data, MIN (result->len, expected->len)), 0);
+  g_byte_array_unref (result);
+
+  result = read_tensors_with_io_option (TRUE, 4);
+  EXPECT_EQ (result->len, expected->len);
+  EXPECT_EQ (memcmp (result->data, expected->data, MIN (result->len, expected->len)), 0);
+  g_byte_array_unref (result);
+
+  result = read_tensors_with_io_option (FALSE, 16);
+  EXPECT_EQ (result->len, expected->len);
+  EXPECT_EQ (memcmp (result->data, expected->data, MIN (result->len, expected->len)), 0);
+  g_byte_array_unref (result);
+
+  g_byte_array_unref (expected);
+}
+
 /**
  * @brief Test for reading a file with invalid param (start-sample-index)
  * the number of total sample(mnist.data) is 1000 (0~999)
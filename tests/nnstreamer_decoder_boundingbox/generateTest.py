@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+##
+# SPDX-License-Identifier: LGPL-2.1-only
+#
+# Copyright (C) 2026 Samsung Electronics
+#
+# @file generateTest.py
+# @brief Generate the input of yolov5 decoder to test NMS
+#
+
+from struct import pack
+
+NUM_BOXES = 6300
+NUM_INFO = 85
+
+
+def save_yolov5_input(filename, boxes):
+    """Save the yolov5 output tensor (85:6300:1) with the given boxes (cx, cy, w, h, class, score)."""
+    data = [0.0] * (NUM_BOXES * NUM_INFO)
+
+    for i, (cx, cy, w, h, cls, score) in enumerate(boxes):
+        base = i * NUM_INFO
+        data[base:base + 5] = [cx, cy, w, h, 1.0]
+        data[base + 5 + cls] = score
+
+    with open(filename, 'wb') as file:
+        file.write(pack('%df' % len(data), *data))
+
+
+# Two overlapping boxes (IoU > 0.45), the second one has lower probability.
+save_yolov5_input('yolov5_nms_single.raw', [(0.5, 0.5, 0.3, 0.3, 0, 0.9)])
+save_yolov5_input('yolov5_nms_same.raw',
+                  [(0.5, 0.5, 0.3, 0.3, 0, 0.9), (0.52, 0.52, 0.3, 0.3, 0, 0.8)])
+save_yolov5_input('yolov5_nms_diff.raw',
+                  [(0.5, 0.5, 0.3, 0.3, 0, 0.9), (0.52, 0.52, 0.3, 0.3, 1, 0.8)])
@@ -118,6 +118,29 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov8_decode
 
 callCompareTest yolov8_result_golden.raw yolov8_result_0.log "8 diff" "yolov8 golden" 0
 
-rm yolov*.log
+# NMS test, two overlapping boxes of the same or different classes
+python3 generateTest.py || (echo "Failed to run test preparation script (generateTest.py). Test not available." && report && exit)
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov5_nms_single.raw start-index=0 stop-index=0 caps=application/octet-stream ! tensor_converter input-dim=85:6300:1 input-type=float32 ! tensor_decoder mode=bounding_boxes option1=yolov5 option2=coco-80.txt option3=0:0.25:0.45 option4=320:320 option5=320:320 ! videoconvert ! video/x-raw,format=RGBA ! multifilesink location=yolov5_nms_single_%1d.log" "9-1 yolov5 NMS single box" 0 0
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov5_nms_diff.raw start-index=0 stop-index=0 caps=application/octet-stream ! tensor_converter input-dim=85:6300:1 input-type=float32 ! tensor_decoder mode=bounding_boxes option1=yolov5 option2=coco-80.txt option3=0:0.25:1.0 option4=320:320 option5=320:320 ! videoconvert ! video/x-raw,format=RGBA ! multifilesink location=yolov5_nms_none_%1d.log" "9-2 yolov5 NMS disabled" 0 0
+
+## the box of different class is suppressed by default
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov5_nms_diff.raw start-index=0 stop-index=0 caps=application/octet-stream ! tensor_converter input-dim=85:6300:1 input-type=float32 ! tensor_decoder mode=bounding_boxes option1=yolov5 option2=coco-80.txt option3=0:0.25:0.45 option4=320:320 option5=320:320 ! videoconvert ! video/x-raw,format=RGBA ! multifilesink location=yolov5_nms_diff_%1d.log" "9-3 yolov5 NMS class-agnostic" 0 0
+callCompareTest yolov5_nms_single_0.log yolov5_nms_diff_0.log "9-3 diff" "yolov5 NMS class-agnostic" 0
+
+## per_class_nms keeps the box of different class
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov5_nms_diff.raw start-index=0 stop-index=0 caps=application/octet-stream ! tensor_converter input-dim=85:6300:1 input-type=float32 ! tensor_decoder mode=bounding_boxes option1=yolov5 option2=coco-80.txt option3=0:0.25:0.45:1 option4=320:320 option5=320:320 ! videoconvert ! video/x-raw,format=RGBA ! multifilesink location=yolov5_nms_per_class_diff_%1d.log" "9-4 yolov5 NMS per class with different classes" 0 0
+callCompareTest yolov5_nms_none_0.log yolov5_nms_per_class_diff_0.log "9-4 diff" "yolov5 NMS per class with different classes" 0
+if cmp -s yolov5_nms_single_0.log yolov5_nms_per_class_diff_0.log; then
+    testResult 0 9-4-1 "yolov5 NMS per class keeps both boxes"
+else
+    testResult 1 9-4-1 "yolov5 NMS per class keeps both boxes"
+fi
+
+## per_class_nms suppresses the box of same class
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=yolov5_nms_same.raw start-index=0 stop-index=0 caps=application/octet-stream ! tensor_converter input-dim=85:6300:1 input-type=float32 ! tensor_decoder mode=bounding_boxes option1=yolov5 option2=coco-80.txt option3=0:0.25:0.45:1 option4=320:320 option5=320:320 ! videoconvert ! video/x-raw,format=RGBA ! multifilesink location=yolov5_nms_per_class_same_%1d.log" "9-5 yolov5 NMS per class with same class" 0 0
+callCompareTest yolov5_nms_single_0.log yolov5_nms_per_class_same_0.log "9-5 diff" "yolov5 NMS per class with same class" 0
+
+rm yolov*.log yolov5_nms_*.raw
 
 report
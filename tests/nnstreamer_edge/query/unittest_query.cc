@@ -10,10 +10,12 @@
 #include <gtest/gtest.h>
 #include <glib.h>
 #include <glib/gstdio.h>
+#include <gst/check/gstharness.h>
 #include <gst/gst.h>
 #include <tensor_common.h>
 #include <unittest_util.h>
 #include "../gst/nnstreamer/tensor_query/tensor_query_common.h"
+#include "../gst/nnstreamer/tensor_query/tensor_query_server.h"
 
 /**
  * @brief Test for tensor_query_server get and set properties
@@ -88,6 +90,18 @@ TEST (tensorQuery, serverProperties0)
   EXPECT_STREQ ("TEMP_TEST_TOPIC", str_val);
   g_free (str_val);
 
+  g_object_get (srv_handle, "batch-size", &uint_val, NULL);
+  EXPECT_EQ (1U, uint_val);
+  g_object_set (srv_handle, "batch-size", 4U, NULL);
+  g_object_get (srv_handle, "batch-size", &uint_val, NULL);
+  EXPECT_EQ (4U, uint_val);
+
+  g_object_get (srv_handle, "batch-timeout", &uint_val, NULL);
+  EXPECT_EQ (5U, uint_val);
+  g_object_set (srv_handle, "batch-timeout", 20U, NULL);
+  g_object_get (srv_handle, "batch-timeout", &uint_val, NULL);
+  EXPECT_EQ (20U, uint_val);
+
   g_object_set (srv_handle, "id", 12345U, NULL);
   g_object_get (srv_handle, "id", &uint_val, NULL);
   EXPECT_EQ (12345U, uint_val);
@@ -160,6 +174,7 @@ TEST (tensorQuery, clientProperties0)
   GstElement *client_handle;
   nns_edge_connect_type_e connect_type;
   guint uint_val;
+  gint int_val;
   gchar *str_val;
   gboolean bool_val;
 
@@ -205,6 +220,18 @@ TEST (tensorQuery, clientProperties0)
   g_object_get (client_handle, "silent", &bool_val, NULL);
   EXPECT_EQ (FALSE, bool_val);
 
+  g_object_get (client_handle, "max-request", &uint_val, NULL);
+  EXPECT_EQ (2U, uint_val);
+  g_object_set (client_handle, "max-request", 8U, NULL);
+  g_object_get (client_handle, "max-request", &uint_val, NULL);
+  EXPECT_EQ (8U, uint_val);
+
+  g_object_get (client_handle, "policy", &int_val, NULL);
+  EXPECT_EQ (0, int_val);
+  gst_util_set_object_arg (G_OBJECT (client_handle), "policy", "queue");
+  g_object_get (client_handle, "policy", &int_val, NULL);
+  EXPECT_EQ (1, int_val);
+
   gst_object_unref (client_handle);
   gst_object_unref (gstpipe);
   g_free (pipeline);
@@ -266,6 +293,564 @@ TEST (tensorQuery, clientAlone_n)
   g_free (pipeline);
 }
 
+/**
+ * @brief The number of the released data in edge data handle.
+ */
+static guint _test_data_released = 0;
+
+/**
+ * @brief Callback to release the data of edge data handle.
+ */
+static void
+_test_data_destroy (void *data)
+{
+  g_free (data);
+  _test_data_released++;
+}
+
+/**
+ * @brief Test for appending the edge data to the buffer, edge data is released after the last wrapped memory is freed.
+ */
+TEST (tensorQuery, dataAppendToBuffer)
+{
+  nns_edge_data_h data_h;
+  GstTensorsInfo info;
+  GstBuffer *buffer;
+  GstMemory *mem;
+  GstMapInfo map;
+  gpointer data[2];
+  guint i;
+
+  _test_data_released = 0;
+  gst_tensors_info_init (&info);
+  info.num_tensors = 2;
+  for (i = 0; i < info.num_tensors; i++) {
+    info.info[i].type = _NNS_UINT8;
+    gst_tensor_parse_dimension ("4:1:1:1", info.info[i].dimension);
+  }
+
+  ASSERT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 2; i++) {
+    data[i] = g_malloc0 (4);
+    EXPECT_EQ (nns_edge_data_add (data_h, data[i], 4, _test_data_destroy),
+        NNS_EDGE_ERROR_NONE);
+  }
+
+  buffer = gst_buffer_new ();
+  EXPECT_TRUE (gst_tensor_query_data_append_to_buffer (data_h, buffer, &info));
+  EXPECT_EQ (gst_tensor_buffer_get_count (buffer), 2U);
+
+  /* the memories are wrapped without copy */
+  mem = gst_tensor_buffer_get_nth_memory (buffer, 1);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+  EXPECT_EQ (map.data, (guint8 *) data[1]);
+  EXPECT_EQ (map.size, 4U);
+  gst_memory_unmap (mem, &map);
+
+  /* edge data is kept while a memory is referred */
+  gst_buffer_unref (buffer);
+  EXPECT_EQ (_test_data_released, 0U);
+
+  gst_memory_unref (mem);
+  EXPECT_EQ (_test_data_released, 2U);
+
+  gst_tensors_info_free (&info);
+}
+
+/**
+ * @brief Test for appending the edge data to the buffer with invalid param.
+ */
+TEST (tensorQuery, dataAppendToBufferEmpty_n)
+{
+  nns_edge_data_h data_h;
+  GstBuffer *buffer;
+
+  ASSERT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+
+  /* edge data without memory is released */
+  buffer = gst_buffer_new ();
+  EXPECT_FALSE (gst_tensor_query_data_append_to_buffer (data_h, buffer, NULL));
+  EXPECT_EQ (gst_buffer_n_memory (buffer), 0U);
+  gst_buffer_unref (buffer);
+}
+
+#define QUERY_TEST_CAPS \
+  "other/tensors,format=static,num_tensors=1,dimensions=4:1:1:1,types=uint8,framerate=0/1"
+
+/**
+ * @brief Data structure of the query server to reply the requests of query client.
+ */
+typedef struct {
+  nns_edge_h edge_h; /**< edge handle of query server */
+  GMutex lock; /**< lock for received requests */
+  GPtrArray *received; /**< received requests (nns_edge_data_h) */
+} query_test_server_s;
+
+/**
+ * @brief Event callback of the test server, keeps the received requests.
+ */
+static int
+_test_server_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  query_test_server_s *server = (query_test_server_s *) user_data;
+  nns_edge_event_e event_type;
+  nns_edge_data_h data_h;
+
+  if (nns_edge_event_get_type (event_h, &event_type) != NNS_EDGE_ERROR_NONE)
+    return NNS_EDGE_ERROR_UNKNOWN;
+
+  if (event_type == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    if (nns_edge_event_parse_new_data (event_h, &data_h) != NNS_EDGE_ERROR_NONE)
+      return NNS_EDGE_ERROR_UNKNOWN;
+
+    g_mutex_lock (&server->lock);
+    g_ptr_array_add (server->received, data_h);
+    g_mutex_unlock (&server->lock);
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Start the test server which replies the requests in the order of the test.
+ */
+static query_test_server_s *
+_test_server_start (guint port)
+{
+  query_test_server_s *server;
+  gchar *val;
+  int ret;
+
+  server = g_new0 (query_test_server_s, 1);
+  g_mutex_init (&server->lock);
+  server->received = g_ptr_array_new_with_free_func ((GDestroyNotify) nns_edge_data_destroy);
+
+  ret = nns_edge_create_handle ("TEMP_SERVER", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server->edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_set_event_callback (server->edge_h, _test_server_event_cb, server);
+  nns_edge_set_info (server->edge_h, "HOST", "127.0.0.1");
+  val = g_strdup_printf ("%u", port);
+  nns_edge_set_info (server->edge_h, "PORT", val);
+  g_free (val);
+  nns_edge_set_info (server->edge_h, "CAPS",
+      "@query_server_src_caps@" QUERY_TEST_CAPS "@query_server_sink_caps@" QUERY_TEST_CAPS);
+
+  ret = nns_edge_start (server->edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return server;
+}
+
+/**
+ * @brief Stop the test server.
+ */
+static void
+_test_server_stop (query_test_server_s *server)
+{
+  nns_edge_release_handle (server->edge_h);
+  g_ptr_array_free (server->received, TRUE);
+  g_mutex_clear (&server->lock);
+  g_free (server);
+}
+
+/**
+ * @brief Get the number of the requests received by the test server.
+ */
+static guint
+_test_server_get_received (query_test_server_s *server)
+{
+  guint received;
+
+  g_mutex_lock (&server->lock);
+  received = server->received->len;
+  g_mutex_unlock (&server->lock);
+
+  return received;
+}
+
+/**
+ * @brief Wait until the test server receives the requests.
+ */
+static gboolean
+_test_server_wait_received (query_test_server_s *server, guint num)
+{
+  guint i;
+
+  for (i = 0; i < 500; i++) {
+    if (_test_server_get_received (server) >= num)
+      return TRUE;
+    g_usleep (10000);
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Reply the index-th received request. The response echoes the request data.
+ * @param request_id request id of the response, NULL to keep the id of the request.
+ */
+static void
+_test_server_reply (query_test_server_s *server, guint index, const gchar *request_id)
+{
+  nns_edge_data_h data_h;
+
+  g_mutex_lock (&server->lock);
+  data_h = g_ptr_array_index (server->received, index);
+  g_mutex_unlock (&server->lock);
+
+  if (request_id)
+    nns_edge_data_set_info (data_h, "request_id", request_id);
+
+  EXPECT_EQ (nns_edge_send (server->edge_h, data_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create the harness of query client connected to the test server.
+ */
+static GstHarness *
+_test_client_new (guint port, guint max_request, const gchar *policy, guint timeout)
+{
+  GstHarness *h;
+
+  h = gst_harness_new ("tensor_query_client");
+  g_object_set (h->element, "host", "127.0.0.1", "port", 0U, "dest-host", "127.0.0.1",
+      "dest-port", port, "max-request", max_request, "timeout", timeout, NULL);
+  gst_util_set_object_arg (G_OBJECT (h->element), "policy", policy);
+  gst_harness_set_src_caps_str (h, QUERY_TEST_CAPS);
+
+  return h;
+}
+
+/**
+ * @brief Push the buffer filled with given value to query client.
+ */
+static GstFlowReturn
+_test_client_push (GstHarness *h, guint8 value)
+{
+  GstBuffer *buf;
+
+  buf = gst_harness_create_buffer (h, 4);
+  gst_buffer_memset (buf, 0, value, 4);
+
+  return gst_harness_push (h, buf);
+}
+
+/**
+ * @brief Pull the response from query client and check the value.
+ */
+static void
+_test_client_pull (GstHarness *h, guint8 value)
+{
+  GstBuffer *buf;
+  guint8 data = 0;
+
+  buf = gst_harness_pull (h);
+  ASSERT_TRUE (buf != NULL);
+  EXPECT_EQ (gst_buffer_get_size (buf), 4U);
+  gst_buffer_extract (buf, 0, &data, 1);
+  EXPECT_EQ (data, value);
+  gst_buffer_unref (buf);
+}
+
+/**
+ * @brief Thread to push the buffer which waits for the credit.
+ */
+static gpointer
+_test_client_push_thread (gpointer data)
+{
+  _test_client_push ((GstHarness *) data, 2);
+  return NULL;
+}
+
+/**
+ * @brief Test for tensor_query_client, responses are matched with the request id and pushed in the order of sending.
+ */
+TEST (tensorQuery, clientResponseInOrder)
+{
+  query_test_server_s *server;
+  GstHarness *h;
+  guint port;
+
+  port = get_available_port ();
+  server = _test_server_start (port);
+  h = _test_client_new (port, 3U, "drop", 10000U);
+
+  EXPECT_EQ (_test_client_push (h, 1), GST_FLOW_OK);
+  EXPECT_EQ (_test_client_push (h, 2), GST_FLOW_OK);
+  EXPECT_EQ (_test_client_push (h, 3), GST_FLOW_OK);
+  EXPECT_TRUE (_test_server_wait_received (server, 3U));
+
+  /* the response of the last request is not pushed before the older ones */
+  _test_server_reply (server, 2, NULL);
+  g_usleep (100000);
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+
+  /* responses are pushed without the next input */
+  _test_server_reply (server, 0, NULL);
+  _test_client_pull (h, 1);
+
+  _test_server_reply (server, 1, NULL);
+  _test_client_pull (h, 2);
+  _test_client_pull (h, 3);
+
+  gst_harness_teardown (h);
+  _test_server_stop (server);
+}
+
+/**
+ * @brief Test for tensor_query_client, the request without response is discarded after timeout.
+ */
+TEST (tensorQuery, clientRequestExpired)
+{
+  query_test_server_s *server;
+  GstHarness *h;
+  guint port;
+
+  port = get_available_port ();
+  server = _test_server_start (port);
+  h = _test_client_new (port, 2U, "drop", 300U);
+
+  EXPECT_EQ (_test_client_push (h, 1), GST_FLOW_OK);
+  EXPECT_EQ (_test_client_push (h, 2), GST_FLOW_OK);
+  EXPECT_TRUE (_test_server_wait_received (server, 2U));
+
+  /* the response of unknown request is dropped, the first request is expired */
+  _test_server_reply (server, 0, "100");
+  _test_server_reply (server, 1, NULL);
+  _test_client_pull (h, 2);
+
+  g_usleep (100000);
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  gst_harness_teardown (h);
+  _test_server_stop (server);
+}
+
+/**
+ * @brief Test for tensor_query_client, the input buffer is dropped when all credits are in use.
+ */
+TEST (tensorQuery, clientPolicyDrop)
+{
+  query_test_server_s *server;
+  GstHarness *h;
+  guint port;
+
+  port = get_available_port ();
+  server = _test_server_start (port);
+  h = _test_client_new (port, 1U, "drop", 10000U);
+
+  EXPECT_EQ (_test_client_push (h, 1), GST_FLOW_OK);
+  EXPECT_EQ (_test_client_push (h, 2), GST_FLOW_OK);
+  EXPECT_TRUE (_test_server_wait_received (server, 1U));
+  g_usleep (100000);
+  EXPECT_EQ (_test_server_get_received (server), 1U);
+
+  /* the credit is released when the response is pushed */
+  _test_server_reply (server, 0, NULL);
+  _test_client_pull (h, 1);
+
+  EXPECT_EQ (_test_client_push (h, 3), GST_FLOW_OK);
+  EXPECT_TRUE (_test_server_wait_received (server, 2U));
+  _test_server_reply (server, 1, NULL);
+  _test_client_pull (h, 3);
+
+  gst_harness_teardown (h);
+  _test_server_stop (server);
+}
+
+/**
+ * @brief Test for tensor_query_client, the input buffer waits for the credit.
+ */
+TEST (tensorQuery, clientPolicyQueue)
+{
+  query_test_server_s *server;
+  GstHarness *h;
+  GThread *thread;
+  guint port;
+
+  port = get_available_port ();
+  server = _test_server_start (port);
+  h = _test_client_new (port, 1U, "queue", 10000U);
+
+  EXPECT_EQ (_test_client_push (h, 1), GST_FLOW_OK);
+  thread = g_thread_new ("query_push", _test_client_push_thread, h);
+
+  EXPECT_TRUE (_test_server_wait_received (server, 1U));
+  g_usleep (100000);
+  EXPECT_EQ (_test_server_get_received (server), 1U);
+
+  /* the second buffer is sent after the response of the first one */
+  _test_server_reply (server, 0, NULL);
+  EXPECT_TRUE (_test_server_wait_received (server, 2U));
+  _test_server_reply (server, 1, NULL);
+  g_thread_join (thread);
+
+  _test_client_pull (h, 1);
+  _test_client_pull (h, 2);
+
+  gst_harness_teardown (h);
+  _test_server_stop (server);
+}
+
+/**
+ * @brief Test for the caps of a single request from the caps of batched buffer.
+ */
+TEST (tensorQuery, serverUnbatchedCaps)
+{
+  GstCaps *caps;
+  gchar *caps_str;
+
+  caps = gst_caps_from_string ("other/tensors,format=static,num_tensors=2,"
+                               "dimensions=4:1:1:4.2:4,types=uint8.float32,framerate=0/1");
+
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 1U);
+  EXPECT_TRUE (caps_str != NULL);
+  EXPECT_TRUE (g_strrstr (caps_str, "4:1:1:4,2:4") != NULL);
+  g_free (caps_str);
+
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 2U);
+  EXPECT_TRUE (caps_str != NULL);
+  EXPECT_TRUE (g_strrstr (caps_str, "4:1:1:2,2:2") != NULL);
+  g_free (caps_str);
+
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 4U);
+  EXPECT_TRUE (caps_str != NULL);
+  EXPECT_TRUE (g_strrstr (caps_str, "4:1:1:1,2:1") != NULL);
+  g_free (caps_str);
+
+  gst_caps_unref (caps);
+}
+
+/**
+ * @brief Test for the caps of a single request with invalid batch size.
+ */
+TEST (tensorQuery, serverUnbatchedCaps_n)
+{
+  GstCaps *caps;
+  gchar *caps_str;
+
+  /* the outermost dimension is not a multiple of batch size */
+  caps = gst_caps_from_string (
+      "other/tensors,format=static,num_tensors=1,dimensions=4:1:1:3,types=uint8,framerate=0/1");
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 2U);
+  EXPECT_TRUE (caps_str == NULL);
+  gst_caps_unref (caps);
+
+  /* flexible tensors cannot be unbatched */
+  caps = gst_caps_from_string ("other/tensors,format=flexible,framerate=0/1");
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 2U);
+  EXPECT_TRUE (caps_str == NULL);
+  gst_caps_unref (caps);
+
+  /* not a tensor stream */
+  caps = gst_caps_from_string ("video/x-raw,format=RGB,width=4,height=4,framerate=0/1");
+  caps_str = gst_tensor_query_server_get_unbatched_caps_string (caps, 2U);
+  EXPECT_TRUE (caps_str == NULL);
+  gst_caps_unref (caps);
+}
+
+/**
+ * @brief Test for tensor_query_serversink, negotiation fails if the output cannot be split into the batched requests.
+ */
+TEST (tensorQuery, serverSinkUnbatchedCaps_n)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  const guint id = 30U;
+
+  h = gst_harness_new_empty ();
+  gst_harness_add_parse (h, "tensor_query_serversink id=30 sync=false async=false");
+  gst_harness_play (h);
+
+  /* batch size is shared by query serversrc */
+  gst_tensor_query_server_set_batch_size (id, 2U);
+  EXPECT_EQ (gst_tensor_query_server_get_batch_size (id), 2U);
+
+  gst_harness_set_src_caps_str (h,
+      "other/tensors,format=static,num_tensors=1,dimensions=4:1:1:3,types=uint8,framerate=0/1");
+
+  buf = gst_harness_create_buffer (h, 12);
+  EXPECT_EQ (gst_harness_push (h, buf), GST_FLOW_NOT_NEGOTIATED);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Data structure to check the batched buffer in query server.
+ */
+typedef struct {
+  guint num_buffers; /**< the number of batched buffers */
+  gsize size; /**< size of the last batched buffer */
+  guint8 slots[2]; /**< the first byte of each slot */
+} query_test_batch_s;
+
+/**
+ * @brief Callback for handoff signal to check the batched buffer.
+ */
+static void
+_test_batch_handoff (GstElement *element, GstBuffer *buffer, gpointer user_data)
+{
+  query_test_batch_s *batch = (query_test_batch_s *) user_data;
+
+  batch->num_buffers++;
+  batch->size = gst_buffer_get_size (buffer);
+  gst_buffer_extract (buffer, 0, &batch->slots[0], 1);
+  gst_buffer_extract (buffer, 4, &batch->slots[1], 1);
+}
+
+/**
+ * @brief Test for tensor_query_server, the requests from the clients are packed in a buffer and each slot is sent to the client of the request.
+ */
+TEST (tensorQuery, serverBatchSplit)
+{
+  query_test_batch_s batch = { 0 };
+  gchar *pipeline;
+  GstElement *gstpipe, *identity;
+  GstHarness *h1, *h2;
+  guint port;
+
+  port = get_available_port ();
+
+  pipeline = g_strdup_printf ("tensor_query_serversrc id=31 host=127.0.0.1 port=%u batch-size=2 batch-timeout=5000 ! "
+                              "other/tensors,format=static,num_tensors=1,dimensions=4:1:1:2,types=uint8,framerate=0/1 ! "
+                              "identity name=batch ! tensor_query_serversink id=31 sync=false async=false",
+      port);
+  gstpipe = gst_parse_launch (pipeline, NULL);
+  ASSERT_TRUE (gstpipe != nullptr);
+
+  identity = gst_bin_get_by_name (GST_BIN (gstpipe), "batch");
+  g_signal_connect (identity, "handoff", G_CALLBACK (_test_batch_handoff), &batch);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT), 0);
+  g_usleep (200000);
+
+  /* the client negotiates the caps of a single request */
+  h1 = _test_client_new (port, 2U, "drop", 10000U);
+  h2 = _test_client_new (port, 2U, "drop", 10000U);
+
+  EXPECT_EQ (_test_client_push (h1, 1), GST_FLOW_OK);
+  EXPECT_EQ (_test_client_push (h2, 2), GST_FLOW_OK);
+
+  /* each client receives its own slot */
+  _test_client_pull (h1, 1);
+  _test_client_pull (h2, 2);
+
+  EXPECT_EQ (batch.num_buffers, 1U);
+  EXPECT_EQ (batch.size, 8U);
+  EXPECT_EQ (batch.slots[0] + batch.slots[1], 3);
+  EXPECT_NE (batch.slots[0], batch.slots[1]);
+
+  gst_harness_teardown (h1);
+  gst_harness_teardown (h2);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT), 0);
+  gst_object_unref (identity);
+  gst_object_unref (gstpipe);
+  g_free (pipeline);
+}
+
 /**
  * @brief Main GTest
  */
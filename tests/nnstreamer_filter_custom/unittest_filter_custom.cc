@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <glib/gstdio.h>
+#include <gst/app/gstappsrc.h>
 #include <gst/gst.h>
 #include <nnstreamer_plugin_api.h>
 #include <nnstreamer_plugin_api_util.h>
@@ -22,6 +23,7 @@ typedef struct _cb_data {
   GMutex lock;
   guint filter_received;
   guint sink_received;
+  guint invoked;
 } cb_data;
 
 /**
@@ -439,6 +441,391 @@ TEST (tensorFilterCustom, dynamicRegisterInvalidParam_n)
   g_mutex_clear (&data.lock);
 }
 
+/**
+ * @brief Callback for tensor sink signal to check the output of batched invoke.
+ */
+static void
+new_data_batch_cb (GstElement *element, GstBuffer *buffer, gpointer user_data)
+{
+  GstMemory *mem;
+  GstMapInfo map;
+  cb_data *cbdata = (cb_data *) user_data;
+  UNUSED (element);
+
+  g_mutex_lock (&cbdata->lock);
+
+  EXPECT_EQ (1U, gst_buffer_n_memory (buffer));
+  EXPECT_TRUE (GST_BUFFER_PTS_IS_VALID (buffer));
+
+  mem = gst_buffer_peek_memory (buffer, 0);
+
+  /**
+   * The frames in a batch share the output memory of an invoke.
+   * Count the invokes with the first frame of each batch (offset 0 in the batched output).
+   */
+  if (mem->parent == NULL || mem->offset == mem->parent->offset)
+    cbdata->invoked++;
+
+  if (gst_memory_map (mem, &map, GST_MAP_READ)) {
+    /* passthrough: first element is the index of the frame */
+    EXPECT_EQ (4U, map.size);
+    EXPECT_EQ (cbdata->sink_received, (guint) map.data[0]);
+    gst_memory_unmap (mem, &map);
+  }
+
+  cbdata->sink_received++;
+  g_mutex_unlock (&cbdata->lock);
+}
+
+/**
+ * @brief Internal function to push the frames and check the output of batched invoke.
+ * @param num_invokes the expected number of invokes, 0 not to check it
+ */
+static void
+_test_batch_invoke (const gchar *filter_desc, guint num_frames, gboolean eos, guint num_invokes)
+{
+  gchar *pipeline;
+  GstElement *gstpipe, *src_handle, *sink_handle;
+  GstBuffer *buffer;
+  guint i;
+  cb_data data;
+
+  g_mutex_init (&data.lock);
+  data.filter_received = 0;
+  data.sink_received = 0;
+  data.invoked = 0;
+
+  pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=test_filter %s ! tensor_sink name=sinkx async=false",
+      filter_desc);
+
+  gstpipe = gst_parse_launch (pipeline, NULL);
+  ASSERT_TRUE (gstpipe != nullptr);
+
+  src_handle = gst_bin_get_by_name (GST_BIN (gstpipe), "srcx");
+  EXPECT_NE (src_handle, nullptr);
+  sink_handle = gst_bin_get_by_name (GST_BIN (gstpipe), "sinkx");
+  EXPECT_NE (sink_handle, nullptr);
+
+  g_signal_connect (sink_handle, "new-data", (GCallback) new_data_batch_cb, &data);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT), 0);
+
+  for (i = 0; i < num_frames; i++) {
+    buffer = gst_buffer_new_allocate (NULL, 4, NULL);
+    gst_buffer_memset (buffer, 0, (guint8) i, 4);
+    GST_BUFFER_PTS (buffer) = i * GST_MSECOND;
+    EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (src_handle), buffer), GST_FLOW_OK);
+  }
+
+  if (eos)
+    EXPECT_EQ (gst_app_src_end_of_stream (GST_APP_SRC (src_handle)), GST_FLOW_OK);
+
+  EXPECT_TRUE (wait_pipeline_process_buffers (&data.sink_received, num_frames, TEST_TIMEOUT_LIMIT_MS));
+  g_usleep (100000);
+  EXPECT_EQ (data.sink_received, num_frames);
+  if (num_invokes > 0)
+    EXPECT_EQ (data.invoked, num_invokes);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT), 0);
+
+  gst_object_unref (src_handle);
+  gst_object_unref (sink_handle);
+  gst_object_unref (gstpipe);
+  g_free (pipeline);
+  g_mutex_clear (&data.lock);
+}
+
+/**
+ * @brief Test batched invoke with the custom filter which accepts batched input dimension.
+ */
+TEST (tensorFilterCustom, batchInvoke_p)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  gchar *filter_desc = g_strdup_printf ("framework=custom model=%s batch-size=4", model_file);
+
+  /* 10 frames with batch-size 4, the last partial batch is invoked with EOS. */
+  _test_batch_invoke (filter_desc, 10U, TRUE, 3U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief Test batched invoke with timeout (partial batch without EOS).
+ */
+TEST (tensorFilterCustom, batchInvokeTimeout_p)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  gchar *filter_desc = g_strdup_printf (
+      "framework=custom model=%s batch-size=8 batch-timeout=20", model_file);
+
+  /* 3 frames with batch-size 8, the partial batch is invoked once when the timeout is expired. */
+  _test_batch_invoke (filter_desc, 3U, FALSE, 1U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief In-Code Test Function for custom-easy filter (passthrough).
+ */
+static int
+_custom_easy_filter_passthrough (void *data, const GstTensorFilterProperties *prop,
+    const GstTensorMemory *in, GstTensorMemory *out)
+{
+  UNUSED (data);
+  UNUSED (prop);
+
+  memcpy (out[0].data, in[0].data, in[0].size);
+  return 0;
+}
+
+/**
+ * @brief Test batched invoke with the custom-easy filter which cannot change input dimension.
+ * @details tensor_filter should invoke the model for each frame.
+ */
+TEST (tensorFilterCustom, batchInvokeNotSupported_n)
+{
+  GstTensorsInfo info;
+  int ret;
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 1U;
+  info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4:1:1:1", info.info[0].dimension);
+
+  ret = NNS_custom_easy_register ("batch_passthrough",
+      _custom_easy_filter_passthrough, NULL, &info, &info);
+  ASSERT_EQ (ret, 0);
+
+  _test_batch_invoke ("framework=custom-easy model=batch_passthrough batch-size=4", 5U, FALSE, 5U);
+
+  ret = NNS_custom_easy_unregister ("batch_passthrough");
+  EXPECT_EQ (ret, 0);
+}
+
+/**
+ * @brief Test parallel invoke with multiple instances of the custom filter.
+ */
+TEST (tensorFilterCustom, parallelInvoke_p)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  gchar *filter_desc = g_strdup_printf ("framework=custom model=%s num-instances=4", model_file);
+
+  /* the output frames should be pushed in the input order. */
+  _test_batch_invoke (filter_desc, 30U, TRUE, 30U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief Test parallel invoke is disabled with batched invoke (invoke in streaming thread).
+ */
+TEST (tensorFilterCustom, parallelInvokeWithBatch_n)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  gchar *filter_desc = g_strdup_printf (
+      "framework=custom model=%s batch-size=4 num-instances=4", model_file);
+
+  _test_batch_invoke (filter_desc, 10U, TRUE, 3U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief Data to check the order of the buffers and the serialized event.
+ */
+typedef struct {
+  guint buffers; /**< The number of buffers received */
+  gint buffers_before_event; /**< The number of buffers received before the custom event (-1 if not received) */
+} batch_order_data;
+
+/**
+ * @brief Pad probe to check the order of the buffers and the serialized event.
+ */
+static GstPadProbeReturn
+_batch_order_probe (GstPad *pad, GstPadProbeInfo *info, gpointer user_data)
+{
+  batch_order_data *order = (batch_order_data *) user_data;
+  UNUSED (pad);
+
+  if (info->type & GST_PAD_PROBE_TYPE_BUFFER) {
+    order->buffers++;
+  } else if (info->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM) {
+    GstEvent *event = GST_PAD_PROBE_INFO_EVENT (info);
+
+    if (GST_EVENT_TYPE (event) == GST_EVENT_CUSTOM_DOWNSTREAM
+        && gst_event_has_name (event, "test-batch-marker"))
+      order->buffers_before_event = (gint) order->buffers;
+  }
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Internal function to check the serialized event does not overtake the queued frames.
+ */
+static void
+_test_event_order (const gchar *filter_desc, guint num_frames)
+{
+  GstElement *gstpipe, *src_handle, *sink_handle;
+  GstBuffer *buffer;
+  GstPad *pad;
+  gchar *pipeline;
+  batch_order_data order = { 0U, -1 };
+  guint i;
+
+  pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter %s ! tensor_sink name=sinkx async=false",
+      filter_desc);
+
+  gstpipe = gst_parse_launch (pipeline, NULL);
+  ASSERT_TRUE (gstpipe != nullptr);
+
+  src_handle = gst_bin_get_by_name (GST_BIN (gstpipe), "srcx");
+  EXPECT_NE (src_handle, nullptr);
+  sink_handle = gst_bin_get_by_name (GST_BIN (gstpipe), "sinkx");
+  EXPECT_NE (sink_handle, nullptr);
+
+  pad = gst_element_get_static_pad (sink_handle, "sink");
+  ASSERT_TRUE (pad != nullptr);
+  gst_pad_add_probe (pad, (GstPadProbeType) (GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+      _batch_order_probe, &order, NULL);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT), 0);
+
+  for (i = 0; i < num_frames; i++) {
+    buffer = gst_buffer_new_allocate (NULL, 4, NULL);
+    gst_buffer_memset (buffer, 0, (guint8) i, 4);
+    GST_BUFFER_PTS (buffer) = i * GST_MSECOND;
+    EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (src_handle), buffer), GST_FLOW_OK);
+  }
+
+  /* the custom event should be forwarded after the queued frames */
+  EXPECT_TRUE (gst_element_send_event (src_handle,
+      gst_event_new_custom (GST_EVENT_CUSTOM_DOWNSTREAM,
+          gst_structure_new_empty ("test-batch-marker"))));
+  EXPECT_EQ (gst_app_src_end_of_stream (GST_APP_SRC (src_handle)), GST_FLOW_OK);
+
+  g_usleep (500000);
+  EXPECT_EQ (order.buffers, num_frames);
+  EXPECT_EQ (order.buffers_before_event, (gint) num_frames);
+
+  EXPECT_EQ (setPipelineStateSync (gstpipe, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT), 0);
+
+  gst_object_unref (pad);
+  gst_object_unref (src_handle);
+  gst_object_unref (sink_handle);
+  gst_object_unref (gstpipe);
+  g_free (pipeline);
+}
+
+/**
+ * @brief Test the serialized event does not overtake the frames queued for batched invoke.
+ */
+TEST (tensorFilterCustom, batchInvokeEventOrder_p)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  /* batch-timeout 0: the partial batch waits until the batch is full */
+  gchar *filter_desc = g_strdup_printf ("framework=custom model=%s batch-size=4", model_file);
+
+  _test_event_order (filter_desc, 2U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief Test the serialized event does not overtake the frames invoked by the workers.
+ */
+TEST (tensorFilterCustom, parallelInvokeEventOrder_p)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *model_file = g_build_filename (root_path, "build", "tests", "nnstreamer_example",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (model_file, G_FILE_TEST_EXISTS));
+
+  gchar *filter_desc = g_strdup_printf ("framework=custom model=%s num-instances=4", model_file);
+
+  _test_event_order (filter_desc, 20U);
+
+  g_free (filter_desc);
+  g_free (model_file);
+}
+
+/**
+ * @brief Test batch properties of tensor_filter.
+ */
+TEST (tensorFilterCustom, batchProperties_p)
+{
+  GstElement *filter;
+  guint size, timeout;
+
+  filter = gst_element_factory_make ("tensor_filter", NULL);
+  ASSERT_NE (filter, nullptr);
+
+  g_object_get (filter, "batch-size", &size, "batch-timeout", &timeout, NULL);
+  EXPECT_EQ (size, 1U);
+  EXPECT_EQ (timeout, 0U);
+
+  g_object_set (filter, "batch-size", 16U, "batch-timeout", 30U, NULL);
+  g_object_get (filter, "batch-size", &size, "batch-timeout", &timeout, NULL);
+  EXPECT_EQ (size, 16U);
+  EXPECT_EQ (timeout, 30U);
+
+  g_object_get (filter, "num-instances", &size, NULL);
+  EXPECT_EQ (size, 1U);
+
+  g_object_set (filter, "num-instances", 4U, NULL);
+  g_object_get (filter, "num-instances", &size, NULL);
+  EXPECT_EQ (size, 4U);
+
+  gst_object_unref (filter);
+}
+
 /**
  * @brief Main gtest
  */
@@ -15,6 +15,7 @@
 #include <tensor_common.h>
 #include <unittest_util.h>
 #include "../gst/nnstreamer/elements/gsttensor_if.h"
+#include "../gst/nnstreamer/elements/gsttensor_ifexpr.h"
 
 #define TEST_TIMEOUT_MS (20000U)
 
@@ -908,6 +909,342 @@ TEST (tensorIfCustom, invalidParam3_n)
   EXPECT_NE (0, nnstreamer_if_custom_unregister ("tifx"));
 }
 
+/**
+ * @brief Test reductions of the whole tensor
+ */
+TEST (tensorIfReduce, tensor0)
+{
+  GstTensorInfo info;
+  gdouble val;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", info.dimension);
+
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_MEAN, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 1162.5);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 1224);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_ARGMIN, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 0);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_COUNT, 1200, &val));
+  EXPECT_DOUBLE_EQ (val, 24);
+}
+
+/**
+ * @brief Test reductions of a region in the tensor
+ */
+TEST (tensorIfReduce, region0)
+{
+  GstTensorInfo info;
+  tensor_if_region region;
+  gdouble val;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", info.dimension);
+
+  /* [0:2, 1:3, 0, 1] : 1204, 1205, 1207, 1208 */
+  gst_tensor_if_region_init (&region);
+  region.start[0] = 0;
+  region.end[0] = 2;
+  region.start[1] = 1;
+  region.end[1] = 3;
+  region.start[2] = 0;
+  region.end[2] = 1;
+  region.start[3] = 1;
+  region.end[3] = 2;
+
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_SUM, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 4824);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_MEAN, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 1206);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 1208);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_ARGMAX, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 3);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_COUNT, 1205, &val));
+  EXPECT_DOUBLE_EQ (val, 2);
+}
+
+/**
+ * @brief Test reductions of float tensor
+ */
+TEST (tensorIfReduce, float0)
+{
+  GstTensorInfo info;
+  tensor_if_region region;
+  gfloat data[100];
+  gdouble val;
+  guint i;
+
+  for (i = 0; i < 100; i++)
+    data[i] = (gfloat) ((i * 37) % 100) / 100.0f;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("100:1:1:1", info.dimension);
+
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), NULL, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_FLOAT_EQ (val, 0.99f);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), NULL, TIF_REDUCE_ARGMAX, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 27);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), NULL, TIF_REDUCE_MEAN, 0, &val));
+  EXPECT_NEAR (val, 0.495, 1e-6);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), NULL, TIF_REDUCE_COUNT, 0.895f, &val));
+  EXPECT_DOUBLE_EQ (val, 10);
+
+  gst_tensor_if_region_init (&region);
+  region.start[0] = 30;
+  region.end[0] = 40;
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), &region, TIF_REDUCE_MIN, 0, &val));
+  EXPECT_FLOAT_EQ (val, 0.06f);
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), &region, TIF_REDUCE_ARGMIN, 0, &val));
+  EXPECT_DOUBLE_EQ (val, 8);
+
+  /* the threshold is compared in float32 with or without SIMD kernels */
+  for (i = 0; i < 100; i++)
+    data[i] = 0.1f;
+
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), NULL, TIF_REDUCE_COUNT, 0.1, &val));
+  EXPECT_DOUBLE_EQ (val, 0);
+
+  region.start[0] = 0;
+  region.end[0] = 3;
+  EXPECT_TRUE (gst_tensor_if_reduce (&info, data, sizeof (data), &region, TIF_REDUCE_COUNT, 0.1, &val));
+  EXPECT_DOUBLE_EQ (val, 0);
+}
+
+/**
+ * @brief Test reductions with invalid region
+ */
+TEST (tensorIfReduce, invalidRegion_n)
+{
+  GstTensorInfo info;
+  tensor_if_region region;
+  gdouble val;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", info.dimension);
+
+  gst_tensor_if_region_init (&region);
+  region.end[0] = 4;
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_MAX, 0, &val));
+
+  gst_tensor_if_region_init (&region);
+  region.start[1] = 2;
+  region.end[1] = 2;
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, test_frames[0], 192, &region, TIF_REDUCE_MAX, 0, &val));
+}
+
+/**
+ * @brief Test reductions with invalid param
+ */
+TEST (tensorIfReduce, invalidParam_n)
+{
+  GstTensorInfo info;
+  gdouble val;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", info.dimension);
+
+  EXPECT_FALSE (gst_tensor_if_reduce (NULL, test_frames[0], 192, NULL, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, NULL, 192, NULL, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, test_frames[0], 100, NULL, TIF_REDUCE_MAX, 0, &val));
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_END, 0, &val));
+  EXPECT_FALSE (gst_tensor_if_reduce (&info, test_frames[0], 192, NULL, TIF_REDUCE_MAX, 0, NULL));
+}
+
+/**
+ * @brief Test evaluation of the compiled expression
+ */
+TEST (tensorIfExpr, eval0)
+{
+  GstTensorsInfo info;
+  GstBuffer *buf;
+  GstMemory *mem;
+  tensor_if_expr *expr;
+  gdouble val;
+  guint i;
+  const gchar *exprs[] = {
+    "(max(t0) > 1200) && (mean(t0[:, :, :, 0]) < 1120)",
+    "argmax(t1[:, 2]) == 11 && t1[1, 1, 0, 1] == 2205",
+    "count(t0, 1210) - count(t1[0:2], 2200) + 1",
+    "!(min(t1) < 2000) || t9[0]",
+    "sum(t0[0, 0]) / -2 + 3 * 2",
+  };
+  const gdouble expected[] = { 1, 1, -1, 1, (1101 + 1113 + 1201 + 1213) / -2.0 + 6 };
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 2;
+  for (i = 0; i < 2; i++) {
+    info.info[i].type = _NNS_INT32;
+    gst_tensor_parse_dimension ("3:4:2:2", info.info[i].dimension);
+  }
+
+  buf = gst_buffer_new ();
+  for (i = 0; i < 2; i++) {
+    mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, (gpointer) test_frames[i], 192, 0, 192, NULL, NULL);
+    gst_buffer_append_memory (buf, mem);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (exprs); i++) {
+    expr = gst_tensor_if_expr_compile (exprs[i]);
+    ASSERT_TRUE (expr != NULL);
+    EXPECT_TRUE (gst_tensor_if_expr_eval (expr, &info, buf, &val));
+    EXPECT_DOUBLE_EQ (val, expected[i]);
+    gst_tensor_if_expr_free (expr);
+  }
+
+  gst_buffer_unref (buf);
+}
+
+/**
+ * @brief Test evaluation of the expression with invalid tensor
+ */
+TEST (tensorIfExpr, eval1_n)
+{
+  GstTensorsInfo info;
+  GstBuffer *buf;
+  GstMemory *mem;
+  tensor_if_expr *expr;
+  gdouble val;
+  guint i;
+  const gchar *exprs[] = {
+    "max(t2) > 0",
+    "max(t0[0:4]) > 0",
+    "t0[0, 5] > 0",
+    "max(t0[0, 0, 0, 0, 1]) > 0",
+  };
+
+  gst_tensors_info_init (&info);
+  info.num_tensors = 1;
+  info.info[0].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", info.info[0].dimension);
+
+  buf = gst_buffer_new ();
+  mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, (gpointer) test_frames[0], 192, 0, 192, NULL, NULL);
+  gst_buffer_append_memory (buf, mem);
+
+  for (i = 0; i < G_N_ELEMENTS (exprs); i++) {
+    expr = gst_tensor_if_expr_compile (exprs[i]);
+    ASSERT_TRUE (expr != NULL);
+    EXPECT_FALSE (gst_tensor_if_expr_eval (expr, &info, buf, &val));
+    gst_tensor_if_expr_free (expr);
+  }
+
+  gst_buffer_unref (buf);
+}
+
+/**
+ * @brief Test compiling invalid expressions
+ */
+TEST (tensorIfExpr, compile_n)
+{
+  guint i;
+  const gchar *exprs[] = {
+    "",
+    "max(t0",
+    "1 < 2 < 3",
+    "foo(t0)",
+    "count(t0)",
+    "max(t0[2:1])",
+    "t0[0:2]",
+    "1 +",
+    "(max(t0) > 0.8) & (min(t0) < 0.2)",
+  };
+
+  EXPECT_TRUE (gst_tensor_if_expr_compile (NULL) == NULL);
+  for (i = 0; i < G_N_ELEMENTS (exprs); i++)
+    EXPECT_TRUE (gst_tensor_if_expr_compile (exprs[i]) == NULL);
+}
+
+/**
+ * @brief Test behavior: compared value with expression using appsrc
+ */
+TEST (tensorIfAppsrc, expression0)
+{
+  GstBuffer *buf_0, *buf_1, *buf_2;
+  GstMemory *mem;
+  GstMapInfo info;
+  GstElement *appsrc_handle, *sink_handle, *tif_handle;
+  gint idx;
+  gchar *option;
+  gboolean ret;
+  gchar *str_pipeline = g_strdup (
+      "appsrc name=appsrc ! other/tensor,dimension=(string)3:4:2:2,type=(string)int32,framerate=(fraction)0/1 ! "
+      "tensor_if name=tif compared-value=EXPRESSION "
+      "compared-value-option=\"(max(t0) > 1200) && (mean(t0[:, :, :, 0]) < 1120)\" "
+      "then=PASSTHROUGH else=SKIP ! "
+      "other/tensors,num_tensors=1,dimensions=(string)3:4:2:2, types=(string)int32, framerate=(fraction)0/1 ! "
+      "tensor_sink name=sinkx async=false");
+
+  GstElement *pipeline = gst_parse_launch (str_pipeline, NULL);
+  EXPECT_NE (pipeline, nullptr);
+
+  appsrc_handle = gst_bin_get_by_name (GST_BIN (pipeline), "appsrc");
+  EXPECT_NE (appsrc_handle, nullptr);
+
+  tif_handle = gst_bin_get_by_name (GST_BIN (pipeline), "tif");
+  EXPECT_NE (tif_handle, nullptr);
+
+  g_object_get (tif_handle, "compared-value-option", &option, NULL);
+  EXPECT_STREQ (option, "(max(t0) > 1200) && (mean(t0[:, :, :, 0]) < 1120)");
+  g_free (option);
+
+  sink_handle = gst_bin_get_by_name (GST_BIN (pipeline), "sinkx");
+  EXPECT_NE (sink_handle, nullptr);
+
+  g_signal_connect (sink_handle, "new-data", (GCallback) new_data_cb, (gpointer) &idx);
+
+  buf_0 = gst_buffer_new ();
+  mem = gst_allocator_alloc (NULL, 192, NULL);
+  ret = gst_memory_map (mem, &info, GST_MAP_WRITE);
+  ASSERT_TRUE (ret);
+  memcpy (info.data, test_frames[0], 192);
+  gst_memory_unmap (mem, &info);
+  gst_buffer_append_memory (buf_0, mem);
+  buf_1 = gst_buffer_copy (buf_0);
+  buf_2 = gst_buffer_copy (buf_0);
+
+  data_received = 0;
+
+  EXPECT_EQ (setPipelineStateSync (pipeline, GST_STATE_PLAYING, UNITTEST_STATECHANGE_TIMEOUT), 0);
+  g_usleep (100000);
+
+  idx = 0;
+  EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (appsrc_handle), buf_0), GST_FLOW_OK);
+  g_usleep (100000);
+
+  /* compare the result of the expression with supplied value */
+  g_object_set (tif_handle, "compared-value-option", "argmax(t0)", "operator", TIFOP_EQ,
+      "supplied-value", "47", NULL);
+
+  idx = 0;
+  EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (appsrc_handle), buf_1), GST_FLOW_OK);
+  g_usleep (100000);
+
+  g_object_set (tif_handle, "supplied-value", "46", NULL);
+
+  idx = 100;
+  EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (appsrc_handle), buf_2), GST_FLOW_OK);
+  g_usleep (100000);
+
+  gst_object_unref (sink_handle);
+
+  EXPECT_EQ (setPipelineStateSync (pipeline, GST_STATE_NULL, UNITTEST_STATECHANGE_TIMEOUT), 0);
+  g_usleep (100000);
+
+  EXPECT_EQ (2, data_received);
+
+  gst_object_unref (appsrc_handle);
+  gst_object_unref (tif_handle);
+  gst_object_unref (pipeline);
+  g_free (str_pipeline);
+}
+
 /**
  * @brief Main GTest
  */
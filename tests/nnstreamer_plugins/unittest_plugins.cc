@@ -21,7 +21,9 @@
 #include <tensor_common.h>
 #include <tensor_meta.h>
 #include <unistd.h>
+#include <cmath>
 
+#include "../gst/nnstreamer/elements/gsttensor_codecutil.h"
 #include "../gst/nnstreamer/elements/gsttensor_sparseutil.h"
 #include "../gst/nnstreamer/elements/gsttensor_transform.h"
 #include "../unittest_util.h"
@@ -640,7 +642,7 @@ TEST (testTensorTransform, transposeProperties0_n)
   h = gst_harness_new ("tensor_transform");
   ASSERT_TRUE (NULL != h);
 
-  /* It should be in the form of NEW_IDX_DIM0:NEW_IDX_DIM1:NEW_IDX_DIM2:3 */
+  /* It should be the permutation of the dimension indices */
   g_object_set (h->element, "mode", GTT_TRANSPOSE, "option", "5:2:4:3", NULL);
 
   g_object_get (h->element, "option", &str, NULL);
@@ -660,8 +662,8 @@ TEST (testTensorTransform, transposeProperties1_n)
   h = gst_harness_new ("tensor_transform");
   ASSERT_TRUE (NULL != h);
 
-  /* It should be in the form of NEW_IDX_DIM0:NEW_IDX_DIM1:NEW_IDX_DIM2:3 */
-  g_object_set (h->element, "mode", GTT_TRANSPOSE, "option", "2:3:1:0", NULL);
+  /* Each index should be given once */
+  g_object_set (h->element, "mode", GTT_TRANSPOSE, "option", "2:3:1:1", NULL);
 
   g_object_get (h->element, "option", &str, NULL);
   EXPECT_TRUE (str == NULL);
@@ -680,7 +682,7 @@ TEST (testTensorTransform, transposeProperties2_n)
   h = gst_harness_new ("tensor_transform");
   ASSERT_TRUE (NULL != h);
 
-  /* It should be in the form of NEW_IDX_DIM0:NEW_IDX_DIM1:NEW_IDX_DIM2:3 */
+  /* It should be the permutation of the dimension indices */
   g_object_set (h->element, "mode", GTT_TRANSPOSE, "option", "0:3", NULL);
 
   g_object_get (h->element, "option", &str, NULL);
@@ -1864,6 +1866,77 @@ TEST (testTensorTransform, arithmetic5Accel)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for tensor_transform arithmetic, normalization chain over several chunks
+ */
+TEST (testTensorTransform, arithmeticChain)
+{
+  const guint array_size = 3 * 400;
+
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i;
+  gsize data_in_size, data_out_size;
+
+  h = gst_harness_new ("tensor_transform");
+
+  g_object_set (h->element, "mode", GTT_ARITHMETIC, "option",
+      "typecast:float64,add:-127.5,div:127.5,mul:2", NULL);
+
+  /* input tensor info */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1U;
+  config.info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("3:400", config.info.info[0].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+  data_in_size = gst_tensors_info_get_size (&config.info, 0);
+
+  config.info.info[0].type = _NNS_FLOAT64;
+  data_out_size = gst_tensors_info_get_size (&config.info, 0);
+
+  /* set input buffer */
+  in_buf = gst_harness_create_buffer (h, data_in_size);
+
+  mem = gst_buffer_peek_memory (in_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+  for (i = 0; i < array_size; i++) {
+    ((uint8_t *) info.data)[i] = (uint8_t) i;
+  }
+
+  gst_memory_unmap (mem, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), data_out_size);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+  for (i = 0; i < array_size; i++) {
+    double expected = (((double) ((uint8_t) i) - 127.5) / 127.5) * 2;
+
+    EXPECT_DOUBLE_EQ (((double *) info.data)[i], expected);
+  }
+
+  gst_memory_unmap (mem, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
 /**
  * @brief Test for tensor_transform arithmetic, per-channel
  */
@@ -1947,6 +2020,163 @@ TEST (testTensorTransform, arithmeticPerChannel)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for tensor_transform arithmetic, per-channel with float32 (small channel in innermost dimension)
+ */
+TEST (testTensorTransform, arithmeticPerChannelFloat)
+{
+  const guint num_buffers = 3;
+  const guint array_size = 3 * 37; /* channel 3 (RGB), 37 pixels */
+
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, b;
+  gsize data_in_size, data_out_size;
+
+  h = gst_harness_new ("tensor_transform");
+
+  g_object_set (h->element, "mode", GTT_ARITHMETIC, "option",
+      "typecast:float32,per-channel:true@0,add:-0.5,mul:2@0,add:1.5@1,div:4@2",
+      NULL);
+  g_object_set (h->element, "acceleration", (gboolean) FALSE, NULL);
+
+  /* input tensor info */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1U;
+  config.info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("3:37", config.info.info[0].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+  data_in_size = gst_tensors_info_get_size (&config.info, 0);
+
+  config.info.info[0].type = _NNS_FLOAT32;
+  data_out_size = gst_tensors_info_get_size (&config.info, 0);
+
+  /* push buffers */
+  for (b = 0; b < num_buffers; b++) {
+    /* set input buffer */
+    in_buf = gst_harness_create_buffer (h, data_in_size);
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    for (i = 0; i < array_size; i++) {
+      ((uint8_t *) info.data)[i] = (uint8_t) (i * (b + 1));
+    }
+
+    gst_memory_unmap (mem, &info);
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+    /* get output buffer */
+    out_buf = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+    ASSERT_EQ (gst_buffer_get_size (out_buf), data_out_size);
+
+    mem = gst_buffer_peek_memory (out_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+    for (i = 0; i < array_size; i++) {
+      float expected = (float) ((uint8_t) (i * (b + 1))) - 0.5f;
+
+      if (i % 3 == 0)
+        expected = expected * 2.0f;
+      else if (i % 3 == 1)
+        expected = expected + 1.5f;
+      else
+        expected = expected / 4.0f;
+
+      EXPECT_FLOAT_EQ (((float *) info.data)[i], expected);
+    }
+
+    gst_memory_unmap (mem, &info);
+    gst_buffer_unref (out_buf);
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), num_buffers);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_transform clamp with float32 (including NaN)
+ */
+TEST (testTensorTransform, clampFloat)
+{
+  const guint array_size = 37;
+
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i;
+  gsize data_size;
+
+  h = gst_harness_new ("tensor_transform");
+
+  g_object_set (h->element, "mode", GTT_CLAMP, "option", "-10.5:20", NULL);
+
+  /* input tensor info */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1U;
+  config.info.info[0].type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("37", config.info.info[0].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+  data_size = gst_tensors_info_get_size (&config.info, 0);
+
+  /* set input buffer */
+  in_buf = gst_harness_create_buffer (h, data_size);
+
+  mem = gst_buffer_peek_memory (in_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+  for (i = 0; i < array_size; i++) {
+    ((float *) info.data)[i] = (i == 5) ? NAN : ((float) i - 18.0f) * 1.7f;
+  }
+
+  gst_memory_unmap (mem, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), data_size);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+  for (i = 0; i < array_size; i++) {
+    float value = ((float *) info.data)[i];
+
+    if (i == 5) {
+      EXPECT_TRUE (std::isnan (value));
+    } else {
+      float expected = ((float) i - 18.0f) * 1.7f;
+
+      expected = CLAMP (expected, -10.5f, 20.0f);
+      EXPECT_FLOAT_EQ (value, expected);
+    }
+  }
+
+  gst_memory_unmap (mem, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
 /**
  * @brief Test for tensor_transform arithmetic (changing option string dynamically)
  */
@@ -2759,6 +2989,135 @@ TEST (testTensorAggregator, flushData)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for tensor_aggregator (sliding window with overlapped frames)
+ */
+TEST (testTensorAggregator, slidingWindow)
+{
+  const guint frames_out = 4;
+  const guint total = 40;
+  GstHarness *h;
+  GstTensorsConfig config;
+  GstBuffer *buf, *held[20];
+  GstMapInfo map;
+  guint i, j, received;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-in", 1, "frames-out", frames_out,
+      "frames-flush", 1, "frames-dim", 0, NULL);
+
+  /* input tensor info */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1;
+  config.info.info[0].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("1", config.info.info[0].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+
+  /* push buffers */
+  for (i = 0; i < total; i++) {
+    buf = gst_harness_create_buffer (h, sizeof (gint));
+    ASSERT_TRUE (gst_buffer_map (buf, &map, GST_MAP_WRITE));
+    ((gint *) map.data)[0] = (gint) i;
+    gst_buffer_unmap (buf, &map);
+
+    GST_BUFFER_PTS (buf) = i * GST_SECOND;
+    GST_BUFFER_DURATION (buf) = GST_SECOND;
+    EXPECT_EQ (gst_harness_push (h, buf), GST_FLOW_OK);
+  }
+
+  received = gst_harness_buffers_received (h);
+  EXPECT_EQ (received, total - frames_out + 1);
+
+  /* The outputs are still used (queued in harness), the window should not overwrite the data. */
+  for (i = 0; i < received; i++) {
+    buf = gst_harness_pull (h);
+    ASSERT_TRUE (buf != NULL);
+
+    EXPECT_EQ (GST_BUFFER_PTS (buf), i * GST_SECOND);
+    EXPECT_EQ (GST_BUFFER_DURATION (buf), frames_out * GST_SECOND);
+
+    ASSERT_TRUE (gst_buffer_map (buf, &map, GST_MAP_READ));
+    ASSERT_EQ (map.size, sizeof (gint) * frames_out);
+    for (j = 0; j < frames_out; j++)
+      EXPECT_EQ (((gint *) map.data)[j], (gint) (i + j));
+    gst_buffer_unmap (buf, &map);
+
+    if (i < 20)
+      held[i] = buf;
+    else
+      gst_buffer_unref (buf);
+  }
+
+  for (i = 0; i < 20; i++) {
+    ASSERT_TRUE (gst_buffer_map (held[i], &map, GST_MAP_READ));
+    EXPECT_EQ (((gint *) map.data)[0], (gint) i);
+    EXPECT_EQ (((gint *) map.data)[frames_out - 1], (gint) (i + frames_out - 1));
+    gst_buffer_unmap (held[i], &map);
+    gst_buffer_unref (held[i]);
+  }
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_aggregator (sliding window, the flags of the first frame in the window)
+ */
+TEST (testTensorAggregator, slidingWindowFlags)
+{
+  const guint frames_out = 3;
+  const guint total = 10;
+  GstHarness *h;
+  GstTensorsConfig config;
+  GstBuffer *buf;
+  guint i, received;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-in", 1, "frames-out", frames_out,
+      "frames-flush", 1, "frames-dim", 0, NULL);
+
+  /* input tensor info */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1;
+  config.info.info[0].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("1", config.info.info[0].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+
+  /* the first frame is discont, and odd frames are delta units */
+  for (i = 0; i < total; i++) {
+    buf = gst_harness_create_buffer (h, sizeof (gint));
+    GST_BUFFER_PTS (buf) = i * GST_SECOND;
+    GST_BUFFER_DURATION (buf) = GST_SECOND;
+    if (i == 0)
+      GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DISCONT);
+    if (i % 2 == 1)
+      GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT);
+    EXPECT_EQ (gst_harness_push (h, buf), GST_FLOW_OK);
+  }
+
+  received = gst_harness_buffers_received (h);
+  EXPECT_EQ (received, total - frames_out + 1);
+
+  for (i = 0; i < received; i++) {
+    buf = gst_harness_pull (h);
+    ASSERT_TRUE (buf != NULL);
+
+    EXPECT_EQ (GST_BUFFER_PTS (buf), i * GST_SECOND);
+    EXPECT_EQ (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_DISCONT), i == 0);
+    EXPECT_EQ (GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT), i % 2 == 1);
+    gst_buffer_unref (buf);
+  }
+
+  gst_harness_teardown (h);
+}
+
 /**
  * @brief Test for tensor_aggregator (supposed multi clients using tensor-meta)
  */
@@ -3672,9 +4031,349 @@ TEST (testTensorConverter, flexToStaticInvalidBuffer2_n)
   gst_harness_teardown (h);
 }
 
-#ifdef HAVE_ORC
-#include "nnstreamer-orc.h"
-
+/**
+ * @brief Test for tensor_converter preprocess mode (RGB with stride padding, nearest, BGR)
+ */
+TEST (testTensorConverter, preprocessRGBStride)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  guint x, y, c;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:3,height:1,resize:nearest,color:BGR", NULL);
+
+  /* RGB 6x2, row stride is 20 bytes (18 bytes of pixels and 2 bytes of padding) */
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=6,height=2,framerate=(fraction)0/1");
+
+  in_buf = gst_harness_create_buffer (h, 40U);
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+  memset (map.data, 0xff, map.size);
+  for (y = 0; y < 2; y++) {
+    for (x = 0; x < 6; x++) {
+      for (c = 0; c < 3; c++)
+        map.data[y * 20 + x * 3 + c] = (guint8) (x * 10 + y + c);
+    }
+  }
+  gst_buffer_unmap (in_buf, &map);
+
+  EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  /* pixels (1,1), (3,1) and (5,1) in BGR order */
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 9U);
+  for (x = 0; x < 3; x++) {
+    for (c = 0; c < 3; c++)
+      EXPECT_EQ (map.data[x * 3 + c], (guint8) ((x * 2 + 1) * 10 + 1 + 2 - c));
+  }
+  gst_buffer_unmap (out_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (NV12 to normalized float32 NCHW)
+ */
+TEST (testTensorConverter, preprocessNV12)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstCaps *caps;
+  GstTensorsConfig config;
+  GstMapInfo map;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:2,height:2,layout:NCHW,type:float32,add:-127.5,div:127.5",
+      NULL);
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=NV12,width=4,height=2,framerate=(fraction)0/1");
+
+  /* white (Y 235, U and V 128 in limited range) */
+  in_buf = gst_harness_create_buffer (h, 12U);
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+  memset (map.data, 235, 8);
+  memset (map.data + 8, 128, 4);
+  gst_buffer_unmap (in_buf, &map);
+
+  EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  caps = gst_pad_get_current_caps (h->sinkpad);
+  ASSERT_TRUE (gst_tensors_config_from_structure (&config,
+      gst_caps_get_structure (caps, 0)));
+  EXPECT_EQ (config.info.info[0].type, _NNS_FLOAT32);
+  EXPECT_EQ (config.info.info[0].dimension[0], 2U);
+  EXPECT_EQ (config.info.info[0].dimension[1], 2U);
+  EXPECT_EQ (config.info.info[0].dimension[2], 3U);
+  gst_tensors_config_free (&config);
+  gst_caps_unref (caps);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 2U * 2U * 3U * sizeof (float));
+  for (i = 0; i < 12; i++)
+    EXPECT_NEAR (((float *) map.data)[i], 1.0f, 1e-4);
+  gst_buffer_unmap (out_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (bilinear and area resize)
+ */
+TEST (testTensorConverter, preprocessResize)
+{
+  const gchar *resize[] = { "bilinear", "area" };
+  /* bilinear samples the source pixels 1 and 4, area averages 3 pixels */
+  const guint8 expected[2][2] = { { 0U, 0U }, { 30U, 0U } };
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  gchar *mode;
+  guint i, x, c;
+
+  for (i = 0; i < 2; i++) {
+    h = gst_harness_new ("tensor_converter");
+    mode = g_strdup_printf ("preprocess:width:2,height:1,resize:%s", resize[i]);
+    g_object_set (h->element, "mode", mode, NULL);
+    g_free (mode);
+
+    /* RGB 6x1, only the pixel 2 is not black */
+    gst_harness_set_src_caps_str (h,
+        "video/x-raw,format=RGB,width=6,height=1,framerate=(fraction)0/1");
+
+    in_buf = gst_harness_create_buffer (h, 20U);
+    ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+    memset (map.data, 0, map.size);
+    memset (map.data + 6, 90, 3);
+    gst_buffer_unmap (in_buf, &map);
+
+    EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+    EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+    out_buf = gst_harness_pull (h);
+    ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+    EXPECT_EQ (map.size, 6U);
+    for (x = 0; x < 2; x++) {
+      for (c = 0; c < 3; c++)
+        EXPECT_NEAR (map.data[x * 3 + c], expected[i][x], 1);
+    }
+    gst_buffer_unmap (out_buf, &map);
+
+    gst_buffer_unref (out_buf);
+    gst_harness_teardown (h);
+  }
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (output rows split over the threads)
+ */
+TEST (testTensorConverter, preprocessThreads)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  guint x, y, c;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:2,height:64,resize:nearest,threads:4", NULL);
+
+  /* RGB 2x64, row stride is 8 bytes */
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=2,height=64,framerate=(fraction)0/1");
+
+  in_buf = gst_harness_create_buffer (h, 8U * 64U);
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+  for (y = 0; y < 64; y++)
+    memset (map.data + y * 8, (gint) (y * 2), 8);
+  gst_buffer_unmap (in_buf, &map);
+
+  EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 2U * 64U * 3U);
+  for (y = 0; y < 64; y++) {
+    for (x = 0; x < 2; x++) {
+      for (c = 0; c < 3; c++)
+        EXPECT_EQ (map.data[(y * 2 + x) * 3 + c], (guint8) (y * 2));
+    }
+  }
+  gst_buffer_unmap (out_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (I420 planes)
+ */
+TEST (testTensorConverter, preprocessI420)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:8,height:2,resize:nearest", NULL);
+
+  /* I420 8x2, Y plane 16 bytes, U and V planes 4 bytes each */
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=I420,width=8,height=2,framerate=(fraction)0/1");
+
+  /* Y 126, U 128 and V 240 in limited range is (255, 37, 128) */
+  in_buf = gst_harness_create_buffer (h, 24U);
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+  memset (map.data, 126, 16);
+  memset (map.data + 16, 128, 4);
+  memset (map.data + 20, 240, 4);
+  gst_buffer_unmap (in_buf, &map);
+
+  EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 8U * 2U * 3U);
+  for (i = 0; i < 16; i++) {
+    EXPECT_EQ (map.data[i * 3], 255U);
+    EXPECT_NEAR (map.data[i * 3 + 1], 37, 2);
+    EXPECT_NEAR (map.data[i * 3 + 2], 128, 2);
+  }
+  gst_buffer_unmap (out_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (YUY2 with odd width)
+ */
+TEST (testTensorConverter, preprocessYUY2OddWidth)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:3,height:2,resize:nearest", NULL);
+
+  /* YUY2 3x2, row stride is 8 bytes and the last macro-pixel holds the chroma of pixel 2 */
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=YUY2,width=3,height=2,framerate=(fraction)0/1");
+
+  in_buf = gst_harness_create_buffer (h, 16U);
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_WRITE));
+  for (i = 0; i < 4; i++) {
+    map.data[i * 4] = 126;
+    map.data[i * 4 + 1] = 128;
+    map.data[i * 4 + 2] = 126;
+    map.data[i * 4 + 3] = 240;
+  }
+  gst_buffer_unmap (in_buf, &map);
+
+  EXPECT_EQ (GST_FLOW_OK, gst_harness_push (h, in_buf));
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 3U * 2U * 3U);
+  for (i = 0; i < 6; i++) {
+    EXPECT_EQ (map.data[i * 3], 255U);
+    EXPECT_NEAR (map.data[i * 3 + 1], 37, 2);
+    EXPECT_NEAR (map.data[i * 3 + 2], 128, 2);
+  }
+  gst_buffer_unmap (out_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (YUY2 frame without the last chroma)
+ */
+TEST (testTensorConverter, preprocessYUY2OddWidthShort_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+
+  h = gst_harness_new ("tensor_converter");
+  g_object_set (h->element, "mode",
+      "preprocess:width:3,height:2,resize:nearest", NULL);
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=YUY2,width=3,height=2,framerate=(fraction)0/1");
+
+  /* the last row ends at 6 bytes, the chroma of pixel 2 is out of the frame */
+  in_buf = gst_harness_create_buffer (h, 14U);
+  EXPECT_NE (GST_FLOW_OK, gst_harness_push (h, in_buf));
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (YUV is not supported without preprocess mode)
+ */
+TEST (testTensorConverter, preprocessYUVWithoutMode_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+
+  h = gst_harness_new ("tensor_converter");
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=NV12,width=4,height=2,framerate=(fraction)0/1");
+
+  in_buf = gst_harness_create_buffer (h, 12U);
+  EXPECT_NE (GST_FLOW_OK, gst_harness_push (h, in_buf));
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter preprocess mode (invalid option)
+ */
+TEST (testTensorConverter, preprocessInvalidOption_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+
+  h = gst_harness_new ("tensor_converter");
+
+  /* output size is required */
+  g_object_set (h->element, "mode", "preprocess:type:float32", NULL);
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=4,height=2,framerate=(fraction)0/1");
+
+  in_buf = gst_harness_create_buffer (h, 24U);
+  EXPECT_NE (GST_FLOW_OK, gst_harness_push (h, in_buf));
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+  gst_harness_teardown (h);
+}
+
+#ifdef HAVE_ORC
+#include "nnstreamer-orc.h"
+
 /**
  * @brief Test for tensor_transform orc functions (add constant value)
  */
@@ -7161,76 +7860,347 @@ TEST (testConverterSubplugins, flexbufInvalidParam1_n)
 #endif /** ENABLE_FLATBUF && ENABLE_PROTOBUF */
 
 /**
- * @brief Data structure for tensor-crop test.
+ * @brief Data structure for tensor-merge test.
  */
 typedef struct {
-  GstHarness *crop;
-  GstHarness *raw;
-  GstHarness *info;
-  GstHarness *raw_q;
-  GstHarness *info_q;
-
-  GstTensorInfo raw_info;
-  tensor_format raw_format;
-  guint received;
-  gpointer raw_data;
-  gsize raw_size;
-  GstClockTime ts_raw;
-  tensor_type info_type;
-  gpointer info_data;
-  guint info_num;
-  gsize info_size;
-  GstClockTime ts_info;
-} crop_test_data_s;
+  GstHarness *merge;
+  GstHarness *sink[2];
+  GstHarness *queue[2];
+} merge_test_data_s;
 
 /**
- * @brief Initialize tensor-crop test data.
- * After calling this function, you should set raw-pad caps.
+ * @brief Initialize tensor-merge test data with two uint8 inputs.
  */
 static void
-_crop_test_init (crop_test_data_s *crop_test)
+_merge_test_init (merge_test_data_s *merge_test, const gchar *option,
+    const gchar *dim0, const gchar *dim1)
 {
-  GstPad *raw_sink, *info_sink, *raw_src, *info_src;
-  GstCaps *caps;
-
-  crop_test->crop = gst_harness_new_with_padnames ("tensor_crop", NULL, "src");
-  crop_test->raw = gst_harness_new_with_element (crop_test->crop->element, "raw", NULL);
-  crop_test->info = gst_harness_new_with_element (crop_test->crop->element, "info", NULL);
-  crop_test->raw_q = gst_harness_new ("queue");
-  crop_test->info_q = gst_harness_new ("queue");
+  const gchar *dims[2] = { dim0, dim1 };
+  GstTensorsConfig config;
+  GstPad *sinkpad, *srcpad;
+  gchar *name;
+  guint i;
 
-  raw_sink = GST_PAD_PEER (crop_test->raw->srcpad);
-  info_sink = GST_PAD_PEER (crop_test->info->srcpad);
-  raw_src = GST_PAD_PEER (crop_test->raw_q->sinkpad);
-  info_src = GST_PAD_PEER (crop_test->info_q->sinkpad);
+  merge_test->merge = gst_harness_new_with_padnames ("tensor_merge", NULL, "src");
+  g_object_set (merge_test->merge->element, "mode", "linear", "option", option, NULL);
 
-  gst_pad_unlink (crop_test->raw->srcpad, raw_sink);
-  gst_pad_unlink (crop_test->info->srcpad, info_sink);
-  gst_pad_unlink (raw_src, crop_test->raw_q->sinkpad);
-  gst_pad_unlink (info_src, crop_test->info_q->sinkpad);
-  gst_pad_link (raw_src, raw_sink);
-  gst_pad_link (info_src, info_sink);
+  for (i = 0; i < 2; i++) {
+    name = g_strdup_printf ("sink_%u", i);
+    merge_test->sink[i] = gst_harness_new_with_element (merge_test->merge->element, name, NULL);
+    merge_test->queue[i] = gst_harness_new ("queue");
+    g_free (name);
+
+    /* push the buffers via queue, tensor_merge waits for all sink pads */
+    sinkpad = GST_PAD_PEER (merge_test->sink[i]->srcpad);
+    srcpad = GST_PAD_PEER (merge_test->queue[i]->sinkpad);
+    gst_pad_unlink (merge_test->sink[i]->srcpad, sinkpad);
+    gst_pad_unlink (srcpad, merge_test->queue[i]->sinkpad);
+    gst_pad_link (srcpad, sinkpad);
 
-  /* caps for crop info (flex tensor) */
-  caps = gst_caps_from_string (GST_TENSORS_FLEX_CAP_DEFAULT);
-  gst_caps_set_simple (caps, "framerate", GST_TYPE_FRACTION, 0, 1, NULL);
-  gst_harness_set_src_caps (crop_test->info_q, caps);
+    gst_tensors_config_init (&config);
+    config.info.num_tensors = 1;
+    config.info.info[0].type = _NNS_UINT8;
+    gst_tensor_parse_dimension (dims[i], config.info.info[0].dimension);
+    config.rate_n = 0;
+    config.rate_d = 1;
 
-  gst_tensor_info_init (&crop_test->raw_info);
-  crop_test->raw_format = _NNS_TENSOR_FORMAT_STATIC;
-  crop_test->received = 0;
-  crop_test->raw_data = NULL;
-  crop_test->raw_size = 0;
-  crop_test->ts_raw = GST_CLOCK_TIME_NONE;
-  crop_test->info_type = _NNS_END;
-  crop_test->info_data = NULL;
-  crop_test->info_num = 0;
-  crop_test->info_size = 0;
-  crop_test->ts_info = GST_CLOCK_TIME_NONE;
+    gst_harness_set_src_caps (merge_test->queue[i], gst_tensors_caps_from_config (&config));
+    gst_tensors_config_free (&config);
+  }
 }
 
 /**
- * @brief Free tensor-crop test data.
+ * @brief Free tensor-merge test data.
+ */
+static void
+_merge_test_free (merge_test_data_s *merge_test)
+{
+  guint i;
+
+  for (i = 0; i < 2; i++) {
+    gst_harness_teardown (merge_test->sink[i]);
+    gst_harness_teardown (merge_test->queue[i]);
+  }
+
+  gst_harness_teardown (merge_test->merge);
+}
+
+/**
+ * @brief Push the input memories to tensor_merge and pull the merged buffer.
+ */
+static GstBuffer *
+_merge_test_push (merge_test_data_s *merge_test, GstMemory *mem0, GstMemory *mem1)
+{
+  GstMemory *mems[2] = { mem0, mem1 };
+  GstBuffer *buf;
+  guint i;
+
+  for (i = 0; i < 2; i++) {
+    buf = gst_buffer_new ();
+    gst_buffer_append_memory (buf, mems[i]);
+    GST_BUFFER_TIMESTAMP (buf) = 0;
+    EXPECT_EQ (gst_harness_push (merge_test->queue[i], buf), GST_FLOW_OK);
+  }
+
+  return gst_harness_pull (merge_test->merge);
+}
+
+/**
+ * @brief Allocate the memory filled with the byte pattern for tensor-merge test.
+ */
+static GstMemory *
+_merge_test_alloc (gsize size, guint seed)
+{
+  GstMemory *mem;
+  GstMapInfo map;
+  gsize i;
+
+  mem = gst_allocator_alloc (NULL, size, NULL);
+  if (gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+    for (i = 0; i < size; i++)
+      map.data[i] = (guint8) ((i * seed + seed) % 251);
+    gst_memory_unmap (mem, &map);
+  }
+
+  return mem;
+}
+
+/**
+ * @brief Test for tensor_merge, the inputs in the same parent memory are merged without copy (gather).
+ */
+TEST (testTensorMerge, gatherSpan)
+{
+  merge_test_data_s merge_test;
+  GstMemory *parent, *out_mem;
+  GstBuffer *out_buf;
+  GstMapInfo pmap, map;
+
+  _merge_test_init (&merge_test, "1", "4:2", "4:3");
+
+  /* the tensors split from a buffer */
+  parent = _merge_test_alloc (20U, 1U);
+  out_buf = _merge_test_push (&merge_test, gst_memory_share (parent, 0, 8),
+      gst_memory_share (parent, 8, 12));
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+
+  out_mem = gst_buffer_peek_memory (out_buf, 0);
+  EXPECT_TRUE (out_mem->parent == parent);
+
+  ASSERT_TRUE (gst_memory_map (parent, &pmap, GST_MAP_READ));
+  ASSERT_TRUE (gst_memory_map (out_mem, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 20U);
+  EXPECT_TRUE (map.data == pmap.data);
+  gst_memory_unmap (out_mem, &map);
+  gst_memory_unmap (parent, &pmap);
+
+  gst_buffer_unref (out_buf);
+  gst_memory_unref (parent);
+  _merge_test_free (&merge_test);
+}
+
+/**
+ * @brief Test for tensor_merge, the inputs in the different memories are copied in turn (gather).
+ */
+TEST (testTensorMerge, gatherCopy)
+{
+  merge_test_data_s merge_test;
+  GstMemory *mem0, *mem1;
+  GstBuffer *out_buf;
+  GstMapInfo map0, map1, map;
+
+  _merge_test_init (&merge_test, "1", "4:2", "4:3");
+
+  mem0 = _merge_test_alloc (8U, 3U);
+  mem1 = _merge_test_alloc (12U, 5U);
+  out_buf = _merge_test_push (&merge_test, gst_memory_ref (mem0), gst_memory_ref (mem1));
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+
+  ASSERT_TRUE (gst_memory_map (mem0, &map0, GST_MAP_READ));
+  ASSERT_TRUE (gst_memory_map (mem1, &map1, GST_MAP_READ));
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 20U);
+  EXPECT_EQ (memcmp (map.data, map0.data, 8), 0);
+  EXPECT_EQ (memcmp (map.data + 8, map1.data, 12), 0);
+  gst_buffer_unmap (out_buf, &map);
+  gst_memory_unmap (mem1, &map1);
+  gst_memory_unmap (mem0, &map0);
+
+  gst_buffer_unref (out_buf);
+  gst_memory_unref (mem0);
+  gst_memory_unref (mem1);
+  _merge_test_free (&merge_test);
+}
+
+/**
+ * @brief Test for tensor_merge, the large slices are copied in turn (slice).
+ */
+TEST (testTensorMerge, slice)
+{
+  merge_test_data_s merge_test;
+  GstMemory *mem0, *mem1;
+  GstBuffer *out_buf;
+  GstMapInfo map0, map1, map;
+  guint o;
+
+  _merge_test_init (&merge_test, "0", "256:3", "300:3");
+
+  mem0 = _merge_test_alloc (256U * 3U, 3U);
+  mem1 = _merge_test_alloc (300U * 3U, 5U);
+  out_buf = _merge_test_push (&merge_test, gst_memory_ref (mem0), gst_memory_ref (mem1));
+  ASSERT_TRUE (out_buf != NULL);
+
+  ASSERT_TRUE (gst_memory_map (mem0, &map0, GST_MAP_READ));
+  ASSERT_TRUE (gst_memory_map (mem1, &map1, GST_MAP_READ));
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 556U * 3U);
+  for (o = 0; o < 3; o++) {
+    EXPECT_EQ (memcmp (map.data + o * 556, map0.data + o * 256, 256), 0);
+    EXPECT_EQ (memcmp (map.data + o * 556 + 256, map1.data + o * 300, 300), 0);
+  }
+  gst_buffer_unmap (out_buf, &map);
+  gst_memory_unmap (mem1, &map1);
+  gst_memory_unmap (mem0, &map0);
+
+  gst_buffer_unref (out_buf);
+  gst_memory_unref (mem0);
+  gst_memory_unref (mem1);
+  _merge_test_free (&merge_test);
+}
+
+/**
+ * @brief Test for tensor_merge, the small slices are interleaved block by block (interleave).
+ */
+TEST (testTensorMerge, interleave)
+{
+  merge_test_data_s merge_test;
+  GstMemory *mem0, *mem1;
+  GstBuffer *out_buf;
+  GstMapInfo map0, map1, map;
+  guint o;
+
+  /* 8000 slices of 8 bytes are over the interleave block (16KB), fixed-size (3) and default (5) copy */
+  _merge_test_init (&merge_test, "0", "3:8000", "5:8000");
+
+  mem0 = _merge_test_alloc (3U * 8000U, 3U);
+  mem1 = _merge_test_alloc (5U * 8000U, 5U);
+  out_buf = _merge_test_push (&merge_test, gst_memory_ref (mem0), gst_memory_ref (mem1));
+  ASSERT_TRUE (out_buf != NULL);
+
+  ASSERT_TRUE (gst_memory_map (mem0, &map0, GST_MAP_READ));
+  ASSERT_TRUE (gst_memory_map (mem1, &map1, GST_MAP_READ));
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 8U * 8000U);
+  for (o = 0; o < 8000; o++) {
+    EXPECT_EQ (memcmp (map.data + o * 8, map0.data + o * 3, 3), 0);
+    EXPECT_EQ (memcmp (map.data + o * 8 + 3, map1.data + o * 5, 5), 0);
+  }
+  gst_buffer_unmap (out_buf, &map);
+  gst_memory_unmap (mem1, &map1);
+  gst_memory_unmap (mem0, &map0);
+
+  gst_buffer_unref (out_buf);
+  gst_memory_unref (mem0);
+  gst_memory_unref (mem1);
+  _merge_test_free (&merge_test);
+}
+
+/**
+ * @brief Test for tensor_merge, the input with invalid size is dropped.
+ */
+TEST (testTensorMerge, invalidSize_n)
+{
+  merge_test_data_s merge_test;
+  GstBuffer *buf;
+  guint i;
+
+  _merge_test_init (&merge_test, "0", "3:10", "5:10");
+
+  for (i = 0; i < 2; i++) {
+    buf = gst_buffer_new ();
+    gst_buffer_append_memory (buf, _merge_test_alloc (10U, 1U));
+    GST_BUFFER_TIMESTAMP (buf) = 0;
+    EXPECT_EQ (gst_harness_push (merge_test.queue[i], buf), GST_FLOW_OK);
+  }
+
+  g_usleep (100000);
+  EXPECT_EQ (gst_harness_buffers_received (merge_test.merge), 0U);
+
+  _merge_test_free (&merge_test);
+}
+
+/**
+ * @brief Data structure for tensor-crop test.
+ */
+typedef struct {
+  GstHarness *crop;
+  GstHarness *raw;
+  GstHarness *info;
+  GstHarness *raw_q;
+  GstHarness *info_q;
+
+  GstTensorInfo raw_info;
+  tensor_format raw_format;
+  guint received;
+  gpointer raw_data;
+  gsize raw_size;
+  GstClockTime ts_raw;
+  tensor_type info_type;
+  gpointer info_data;
+  guint info_num;
+  gsize info_size;
+  GstClockTime ts_info;
+} crop_test_data_s;
+
+/**
+ * @brief Initialize tensor-crop test data.
+ * After calling this function, you should set raw-pad caps.
+ */
+static void
+_crop_test_init (crop_test_data_s *crop_test)
+{
+  GstPad *raw_sink, *info_sink, *raw_src, *info_src;
+  GstCaps *caps;
+
+  crop_test->crop = gst_harness_new_with_padnames ("tensor_crop", NULL, "src");
+  crop_test->raw = gst_harness_new_with_element (crop_test->crop->element, "raw", NULL);
+  crop_test->info = gst_harness_new_with_element (crop_test->crop->element, "info", NULL);
+  crop_test->raw_q = gst_harness_new ("queue");
+  crop_test->info_q = gst_harness_new ("queue");
+
+  raw_sink = GST_PAD_PEER (crop_test->raw->srcpad);
+  info_sink = GST_PAD_PEER (crop_test->info->srcpad);
+  raw_src = GST_PAD_PEER (crop_test->raw_q->sinkpad);
+  info_src = GST_PAD_PEER (crop_test->info_q->sinkpad);
+
+  gst_pad_unlink (crop_test->raw->srcpad, raw_sink);
+  gst_pad_unlink (crop_test->info->srcpad, info_sink);
+  gst_pad_unlink (raw_src, crop_test->raw_q->sinkpad);
+  gst_pad_unlink (info_src, crop_test->info_q->sinkpad);
+  gst_pad_link (raw_src, raw_sink);
+  gst_pad_link (info_src, info_sink);
+
+  /* caps for crop info (flex tensor) */
+  caps = gst_caps_from_string (GST_TENSORS_FLEX_CAP_DEFAULT);
+  gst_caps_set_simple (caps, "framerate", GST_TYPE_FRACTION, 0, 1, NULL);
+  gst_harness_set_src_caps (crop_test->info_q, caps);
+
+  gst_tensor_info_init (&crop_test->raw_info);
+  crop_test->raw_format = _NNS_TENSOR_FORMAT_STATIC;
+  crop_test->received = 0;
+  crop_test->raw_data = NULL;
+  crop_test->raw_size = 0;
+  crop_test->ts_raw = GST_CLOCK_TIME_NONE;
+  crop_test->info_type = _NNS_END;
+  crop_test->info_data = NULL;
+  crop_test->info_num = 0;
+  crop_test->info_size = 0;
+  crop_test->ts_info = GST_CLOCK_TIME_NONE;
+}
+
+/**
+ * @brief Free tensor-crop test data.
  */
 static void
 _crop_test_free (crop_test_data_s *crop_test)
@@ -7520,87 +8490,342 @@ TEST (testTensorCrop, cropTensor)
 }
 
 /**
- * @brief Test for tensor_crop, invalid property name.
+ * @brief Test for tensor_crop, resize the regions and push batched tensor.
  */
-TEST (testTensorCrop, invalidProperty_n)
+TEST (testTensorCrop, cropResizeBatch)
 {
   crop_test_data_s crop_test;
-  gboolean value_bool, res_bool;
-  gchar *value_str = NULL;
+  GstBuffer *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorMetaInfo meta;
+  gsize hsize;
+  guint i;
+  gfloat *_data, *resized;
+  guint *_info;
 
   _crop_test_init (&crop_test);
+  g_object_set (crop_test.crop->element, "resize", "2:1", "batch-size", 3U, NULL);
 
-  g_object_get (crop_test.crop->element, "silent", &value_bool, NULL);
-  g_object_set (crop_test.crop->element, "silent", !value_bool, NULL);
-  g_object_get (crop_test.crop->element, "silent", &res_bool, NULL);
-  EXPECT_EQ (res_bool, !value_bool);
-
-  g_object_set (crop_test.crop->element, "invalid-prop", &value_str, NULL);
-  EXPECT_FALSE (value_str != NULL);
-
-  _crop_test_free (&crop_test);
-}
+  /* prepare test data */
+  crop_test.raw_info.type = _NNS_FLOAT32;
 
-/**
- * @brief Test for tensor_crop, seek event is not available.
- */
-TEST (testTensorCrop, eventSeek_n)
-{
-  crop_test_data_s crop_test;
-  GstEvent *event;
+  crop_test.raw_size = sizeof (gfloat) * 40U;
+  crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+  _data = (gfloat *) crop_test.raw_data;
 
-  _crop_test_init (&crop_test);
+  for (i = 0; i < 40; i++)
+    _data[i] = (gfloat) (i + 1);
 
-  event = gst_event_new_seek (1, GST_FORMAT_TIME, GST_SEEK_FLAG_FLUSH,
-      GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_SET, 2 * GST_SECOND);
-  EXPECT_FALSE (gst_harness_push_upstream_event (crop_test.crop, event));
+  crop_test.info_type = _NNS_UINT32;
+  crop_test.info_size = sizeof (guint) * 8U;
+  crop_test.info_num = 2U;
+  crop_test.info_data = g_malloc0 (crop_test.info_size);
+  _info = (guint *) crop_test.info_data;
 
-  _crop_test_free (&crop_test);
-}
+  /* crop info (1 ch / [0, 0, 4, 2] [4, 2, 4, 2]) */
+  _info[0] = 0U;
+  _info[1] = 0U;
+  _info[2] = 4U;
+  _info[3] = 2U;
+  _info[4] = 4U;
+  _info[5] = 2U;
+  _info[6] = 4U;
+  _info[7] = 2U;
 
-/**
- * @brief Test for tensor_crop, push invalid raw buffer.
- */
-TEST (testTensorCrop, rawInvalidSize_n)
-{
-  crop_test_data_s crop_test;
+  gst_tensor_parse_dimension ("1:10:4:1", crop_test.raw_info.dimension);
+  _crop_test_push_buffer (&crop_test);
+  EXPECT_EQ (crop_test.received, 1U);
 
-  _crop_test_init (&crop_test);
+  out_buf = gst_harness_pull (crop_test.crop);
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
 
-  crop_test.raw_info.type = _NNS_UINT32;
-  gst_tensor_parse_dimension ("20:1:1:1", crop_test.raw_info.dimension);
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
 
-  crop_test.raw_size = sizeof (guint) * 10U;
-  crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+  gst_tensor_meta_info_parse_header (&meta, map.data);
+  EXPECT_EQ (meta.type, _NNS_FLOAT32);
+  EXPECT_EQ (meta.dimension[0], 1U);
+  EXPECT_EQ (meta.dimension[1], 2U);
+  EXPECT_EQ (meta.dimension[2], 1U);
+  EXPECT_EQ (meta.dimension[3], 3U);
 
-  crop_test.info_type = _NNS_UINT16;
-  crop_test.info_size = gst_tensor_get_element_size (crop_test.info_type) * 8U;
-  crop_test.info_num = 2U;
-  crop_test.info_data = g_malloc0 (crop_test.info_size);
+  hsize = gst_tensor_meta_info_get_header_size (&meta);
+  resized = (gfloat *) (map.data + hsize);
+  /* expected average of 2x2 blocks, 3rd batch is empty. */
+  EXPECT_EQ (map.size - hsize, sizeof (gfloat) * 6U);
+  EXPECT_FLOAT_EQ (resized[0], 6.5f);
+  EXPECT_FLOAT_EQ (resized[1], 8.5f);
+  EXPECT_FLOAT_EQ (resized[2], 30.5f);
+  EXPECT_FLOAT_EQ (resized[3], 32.5f);
+  EXPECT_FLOAT_EQ (resized[4], 0.0f);
+  EXPECT_FLOAT_EQ (resized[5], 0.0f);
 
-  /* raw buffer has invalid size */
-  _crop_test_push_buffer (&crop_test);
-  EXPECT_EQ (crop_test.received, 0U);
+  gst_memory_unmap (mem, &map);
+  gst_buffer_unref (out_buf);
 
   _crop_test_free (&crop_test);
 }
 
 /**
- * @brief Test for tensor_crop, push invalid info buffer.
+ * @brief Test for tensor_crop, the regions exceeding batch size are dropped.
  */
-TEST (testTensorCrop, infoInvalidSize_n)
+TEST (testTensorCrop, cropResizeBatchExceed)
 {
   crop_test_data_s crop_test;
+  GstBuffer *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorMetaInfo meta;
+  gsize hsize;
+  guint i;
+  guint8 *_data, *resized;
+  guint *_info;
 
   _crop_test_init (&crop_test);
+  g_object_set (crop_test.crop->element, "resize", "1:1", "batch-size", 1U, NULL);
 
-  crop_test.raw_info.type = _NNS_UINT32;
-  gst_tensor_parse_dimension ("10:1:1:1", crop_test.raw_info.dimension);
+  /* prepare test data */
+  crop_test.raw_info.type = _NNS_UINT8;
 
-  crop_test.raw_size = sizeof (guint) * 10U;
+  crop_test.raw_size = 40U;
   crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+  _data = (guint8 *) crop_test.raw_data;
 
-  crop_test.info_type = _NNS_INT8;
+  for (i = 0; i < 40; i++)
+    _data[i] = (guint8) (i + 1);
+
+  crop_test.info_type = _NNS_UINT32;
+  crop_test.info_size = sizeof (guint) * 8U;
+  crop_test.info_num = 2U;
+  crop_test.info_data = g_malloc0 (crop_test.info_size);
+  _info = (guint *) crop_test.info_data;
+
+  /* crop info (2 ch / [3, 1, 1, 1] [0, 0, 2, 2]) */
+  _info[0] = 3U;
+  _info[1] = 1U;
+  _info[2] = 1U;
+  _info[3] = 1U;
+  _info[4] = 0U;
+  _info[5] = 0U;
+  _info[6] = 2U;
+  _info[7] = 2U;
+
+  gst_tensor_parse_dimension ("2:5:4:1", crop_test.raw_info.dimension);
+  _crop_test_push_buffer (&crop_test);
+  EXPECT_EQ (crop_test.received, 1U);
+
+  out_buf = gst_harness_pull (crop_test.crop);
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+
+  gst_tensor_meta_info_parse_header (&meta, map.data);
+  EXPECT_EQ (meta.type, _NNS_UINT8);
+  EXPECT_EQ (meta.dimension[0], 2U);
+  EXPECT_EQ (meta.dimension[1], 1U);
+  EXPECT_EQ (meta.dimension[2], 1U);
+  EXPECT_EQ (meta.dimension[3], 1U);
+
+  hsize = gst_tensor_meta_info_get_header_size (&meta);
+  resized = (guint8 *) (map.data + hsize);
+  /* expected 1st region only [17, 18] */
+  EXPECT_EQ (map.size - hsize, 2U);
+  EXPECT_EQ (resized[0], 17U);
+  EXPECT_EQ (resized[1], 18U);
+
+  gst_memory_unmap (mem, &map);
+  gst_buffer_unref (out_buf);
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, resize int64 tensor without losing the precision.
+ */
+TEST (testTensorCrop, cropResizeInt64)
+{
+  crop_test_data_s crop_test;
+  GstBuffer *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorMetaInfo meta;
+  gsize hsize;
+  gint64 *_data, *resized;
+  guint *_info;
+
+  _crop_test_init (&crop_test);
+  g_object_set (crop_test.crop->element, "resize", "2:1", "batch-size", 1U, NULL);
+
+  /* prepare test data, float cannot represent these values */
+  crop_test.raw_info.type = _NNS_INT64;
+
+  crop_test.raw_size = sizeof (gint64) * 4U;
+  crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+  _data = (gint64 *) crop_test.raw_data;
+  _data[0] = 1000000000000000LL;
+  _data[1] = 1000000000000003LL;
+  _data[2] = -1000000000000001LL;
+  _data[3] = -1000000000000004LL;
+
+  crop_test.info_type = _NNS_UINT32;
+  crop_test.info_size = sizeof (guint) * 4U;
+  crop_test.info_num = 1U;
+  crop_test.info_data = g_malloc0 (crop_test.info_size);
+  _info = (guint *) crop_test.info_data;
+
+  /* crop info (1 ch / [0, 0, 4, 1]) */
+  _info[0] = 0U;
+  _info[1] = 0U;
+  _info[2] = 4U;
+  _info[3] = 1U;
+
+  gst_tensor_parse_dimension ("1:4:1:1", crop_test.raw_info.dimension);
+  _crop_test_push_buffer (&crop_test);
+  EXPECT_EQ (crop_test.received, 1U);
+
+  out_buf = gst_harness_pull (crop_test.crop);
+  ASSERT_TRUE (out_buf != NULL);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+
+  gst_tensor_meta_info_parse_header (&meta, map.data);
+  EXPECT_EQ (meta.type, _NNS_INT64);
+
+  hsize = gst_tensor_meta_info_get_header_size (&meta);
+  resized = (gint64 *) (map.data + hsize);
+  /* expected average of 2 elements, rounded to nearest */
+  EXPECT_EQ (map.size - hsize, sizeof (gint64) * 2U);
+  EXPECT_EQ (resized[0], 1000000000000002LL);
+  EXPECT_EQ (resized[1], -1000000000000002LL);
+
+  gst_memory_unmap (mem, &map);
+  gst_buffer_unref (out_buf);
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, invalid resize option.
+ */
+TEST (testTensorCrop, invalidResize_n)
+{
+  crop_test_data_s crop_test;
+  gchar *str = NULL;
+
+  _crop_test_init (&crop_test);
+
+  g_object_set (crop_test.crop->element, "resize", "64:32", NULL);
+  g_object_get (crop_test.crop->element, "resize", &str, NULL);
+  EXPECT_STREQ (str, "64:32");
+  g_free (str);
+
+  /* keep the previous size */
+  g_object_set (crop_test.crop->element, "resize", "64:0", NULL);
+  g_object_get (crop_test.crop->element, "resize", &str, NULL);
+  EXPECT_STREQ (str, "64:32");
+  g_free (str);
+
+  g_object_set (crop_test.crop->element, "resize", "invalid", NULL);
+  g_object_get (crop_test.crop->element, "resize", &str, NULL);
+  EXPECT_STREQ (str, "64:32");
+  g_free (str);
+
+  /* empty string to disable resize */
+  g_object_set (crop_test.crop->element, "resize", "", NULL);
+  g_object_get (crop_test.crop->element, "resize", &str, NULL);
+  EXPECT_STREQ (str, "");
+  g_free (str);
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, invalid property name.
+ */
+TEST (testTensorCrop, invalidProperty_n)
+{
+  crop_test_data_s crop_test;
+  gboolean value_bool, res_bool;
+  gchar *value_str = NULL;
+
+  _crop_test_init (&crop_test);
+
+  g_object_get (crop_test.crop->element, "silent", &value_bool, NULL);
+  g_object_set (crop_test.crop->element, "silent", !value_bool, NULL);
+  g_object_get (crop_test.crop->element, "silent", &res_bool, NULL);
+  EXPECT_EQ (res_bool, !value_bool);
+
+  g_object_set (crop_test.crop->element, "invalid-prop", &value_str, NULL);
+  EXPECT_FALSE (value_str != NULL);
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, seek event is not available.
+ */
+TEST (testTensorCrop, eventSeek_n)
+{
+  crop_test_data_s crop_test;
+  GstEvent *event;
+
+  _crop_test_init (&crop_test);
+
+  event = gst_event_new_seek (1, GST_FORMAT_TIME, GST_SEEK_FLAG_FLUSH,
+      GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_SET, 2 * GST_SECOND);
+  EXPECT_FALSE (gst_harness_push_upstream_event (crop_test.crop, event));
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, push invalid raw buffer.
+ */
+TEST (testTensorCrop, rawInvalidSize_n)
+{
+  crop_test_data_s crop_test;
+
+  _crop_test_init (&crop_test);
+
+  crop_test.raw_info.type = _NNS_UINT32;
+  gst_tensor_parse_dimension ("20:1:1:1", crop_test.raw_info.dimension);
+
+  crop_test.raw_size = sizeof (guint) * 10U;
+  crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+
+  crop_test.info_type = _NNS_UINT16;
+  crop_test.info_size = gst_tensor_get_element_size (crop_test.info_type) * 8U;
+  crop_test.info_num = 2U;
+  crop_test.info_data = g_malloc0 (crop_test.info_size);
+
+  /* raw buffer has invalid size */
+  _crop_test_push_buffer (&crop_test);
+  EXPECT_EQ (crop_test.received, 0U);
+
+  _crop_test_free (&crop_test);
+}
+
+/**
+ * @brief Test for tensor_crop, push invalid info buffer.
+ */
+TEST (testTensorCrop, infoInvalidSize_n)
+{
+  crop_test_data_s crop_test;
+
+  _crop_test_init (&crop_test);
+
+  crop_test.raw_info.type = _NNS_UINT32;
+  gst_tensor_parse_dimension ("10:1:1:1", crop_test.raw_info.dimension);
+
+  crop_test.raw_size = sizeof (guint) * 10U;
+  crop_test.raw_data = g_malloc0 (crop_test.raw_size);
+
+  crop_test.info_type = _NNS_INT8;
   crop_test.info_size = gst_tensor_get_element_size (crop_test.info_type) * 7U;
   crop_test.info_num = 2U;
   crop_test.info_data = g_malloc0 (crop_test.info_size);
@@ -7848,6 +9073,271 @@ TEST (testTensorSparse, utilConvert)
   EXPECT_FALSE (failed);
 }
 
+/**
+ * @brief Internal function to convert float tensor with given sparse encoding and check the result.
+ */
+static tensor_sparse_encoding
+_sparse_test_roundtrip (const gfloat *values, guint count, tensor_sparse_encoding encoding)
+{
+  GstMemory *sparse, *dense, *origin;
+  GstMapInfo map;
+  GstTensorInfo info;
+  guint major = 0;
+  GstTensorMetaInfo meta, parsed;
+  GstSparseTensorEncodingInfo sparse_info;
+  gchar *dim_str;
+  gsize data_size;
+  gpointer data;
+  tensor_sparse_encoding result = _NNS_SPARSE_END;
+
+  gst_tensor_info_init (&info);
+  info.type = _NNS_FLOAT32;
+  dim_str = g_strdup_printf ("%u", count);
+  gst_tensor_parse_dimension (dim_str, info.dimension);
+  g_free (dim_str);
+  gst_tensor_info_convert_to_meta (&info, &meta);
+
+  data_size = gst_tensor_info_get_size (&info);
+  data = g_malloc (data_size);
+  memcpy (data, values, data_size);
+  origin = gst_memory_new_wrapped (
+      GST_MEMORY_FLAG_READONLY, data, data_size, 0, data_size, data, g_free);
+
+  sparse = gst_tensor_sparse_from_dense_full (&meta, origin, encoding);
+  EXPECT_TRUE (sparse != NULL);
+  if (sparse == NULL)
+    goto done;
+
+  EXPECT_EQ (meta.format, _NNS_TENSOR_FORMAT_SPARSE);
+  EXPECT_EQ (gst_memory_get_sizes (sparse, NULL, NULL),
+      gst_tensor_meta_info_get_header_size (&meta)
+          + gst_tensor_meta_info_get_data_size (&meta));
+
+  EXPECT_TRUE (gst_memory_map (sparse, &map, GST_MAP_READ));
+  EXPECT_TRUE (gst_tensor_meta_info_parse_sparse_header (&parsed, &sparse_info, map.data));
+  gst_memory_unmap (sparse, &map);
+  result = (tensor_sparse_encoding) sparse_info.encoding;
+
+  /* only coo is readable with tensor meta version 1 */
+  gst_tensor_meta_info_get_version (&parsed, &major, NULL);
+  EXPECT_EQ (major, (result == _NNS_SPARSE_COO) ? 1U : 2U);
+
+  dense = gst_tensor_sparse_to_dense (&meta, sparse);
+  EXPECT_TRUE (dense != NULL);
+  if (dense) {
+    EXPECT_TRUE (gst_memory_map (dense, &map, GST_MAP_READ));
+    EXPECT_EQ (map.size, data_size);
+    EXPECT_EQ (memcmp (map.data, values, data_size), 0);
+    gst_memory_unmap (dense, &map);
+    gst_memory_unref (dense);
+  }
+
+  gst_memory_unref (sparse);
+
+done:
+  gst_memory_unref (origin);
+  gst_tensor_info_free (&info);
+  return result;
+}
+
+/**
+ * @brief Test for tensor_sparse util, conversion with each sparse encoding.
+ */
+TEST (testTensorSparse, utilConvertEncoding)
+{
+  const guint count = 1000U;
+  gfloat *values = g_new0 (gfloat, count);
+  guint i;
+
+  /* non-zero elements (including -0.0 and tail) scattered in the tensor */
+  for (i = 0; i < count; i += 7)
+    values[i] = (gfloat) i + 0.5f;
+  values[10] = -0.0f;
+  values[count - 1] = -1.0f;
+
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_COO), _NNS_SPARSE_COO);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_BITMAP), _NNS_SPARSE_BITMAP);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_BLOCK), _NNS_SPARSE_BLOCK);
+
+  /* all zero */
+  memset (values, 0, sizeof (gfloat) * count);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_COO), _NNS_SPARSE_COO);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_BITMAP), _NNS_SPARSE_BITMAP);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_BLOCK), _NNS_SPARSE_BLOCK);
+
+  g_free (values);
+}
+
+/**
+ * @brief Test for tensor_sparse util, select the smallest encoding.
+ */
+TEST (testTensorSparse, utilConvertAutoEncoding)
+{
+  const guint count = 1024U;
+  gfloat *values = g_new0 (gfloat, count);
+  guint i;
+
+  /* very sparse, coo is the smallest */
+  values[3] = 1.0f;
+  values[500] = 2.0f;
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_END), _NNS_SPARSE_COO);
+
+  /* half of elements, bitmap is the smallest */
+  for (i = 0; i < count; i += 2)
+    values[i] = (gfloat) (i + 1);
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_END), _NNS_SPARSE_BITMAP);
+
+  /* clustered elements, block is the smallest */
+  memset (values, 0, sizeof (gfloat) * count);
+  for (i = 128; i < 256; i++)
+    values[i] = (gfloat) i;
+  EXPECT_EQ (_sparse_test_roundtrip (values, count, _NNS_SPARSE_END), _NNS_SPARSE_BLOCK);
+
+  g_free (values);
+}
+
+/**
+ * @brief Test for tensor_sparse util, the parameters of sparse encoding in the header do not match the data size.
+ */
+TEST (testTensorSparse, utilInvalidEncodingHeader_n)
+{
+  GstTensorMetaInfo meta;
+  GstSparseTensorEncodingInfo sparse;
+  GstMemory *in, *out;
+  GstMapInfo map;
+  guint32 *header;
+  gsize size;
+
+  gst_tensor_meta_info_init (&meta);
+  meta.type = _NNS_FLOAT32;
+  meta.dimension[0] = 64U;
+
+  sparse.encoding = _NNS_SPARSE_BLOCK;
+  sparse.nnz = 16U;
+  sparse.block_size = 16U;
+  sparse.num_blocks = 1U;
+  ASSERT_TRUE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+
+  size = gst_tensor_meta_info_get_header_size (&meta) + gst_tensor_meta_info_get_data_size (&meta);
+  header = (guint32 *) g_malloc0 (size);
+  ASSERT_TRUE (gst_tensor_meta_info_update_sparse_header (&meta, &sparse, header));
+  in = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, header, size, 0, size, header, g_free);
+
+  /* valid header */
+  out = gst_tensor_sparse_to_dense (&meta, in);
+  EXPECT_TRUE (out != NULL);
+  gst_memory_unref (out);
+
+  /* the number of blocks does not match the data size */
+  ASSERT_TRUE (gst_memory_map (in, &map, GST_MAP_READ));
+  header[25] = 2U;
+  EXPECT_FALSE (gst_tensor_meta_info_parse_sparse_header (&meta, &sparse, map.data));
+  gst_memory_unmap (in, &map);
+
+  out = gst_tensor_sparse_to_dense (&meta, in);
+  EXPECT_FALSE (out != NULL);
+
+  gst_memory_unref (in);
+}
+
+/**
+ * @brief Test for tensor_sparse util, the bitmap does not match the number of non-zero elements.
+ */
+TEST (testTensorSparse, utilInvalidBitmap_n)
+{
+  GstTensorMetaInfo meta;
+  GstSparseTensorEncodingInfo sparse;
+  GstMemory *in, *out;
+  guint8 *data;
+  guint64 *bitmap;
+  gsize size, header_size;
+
+  gst_tensor_meta_info_init (&meta);
+  meta.type = _NNS_FLOAT32;
+  meta.dimension[0] = 100U;
+
+  memset (&sparse, 0, sizeof (GstSparseTensorEncodingInfo));
+  sparse.encoding = _NNS_SPARSE_BITMAP;
+  sparse.nnz = 2U;
+  ASSERT_TRUE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+
+  header_size = gst_tensor_meta_info_get_header_size (&meta);
+  size = header_size + gst_tensor_meta_info_get_data_size (&meta);
+  data = (guint8 *) g_malloc0 (size);
+  ASSERT_TRUE (gst_tensor_meta_info_update_sparse_header (&meta, &sparse, data));
+  bitmap = (guint64 *) (data + header_size);
+  in = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, data, size, 0, size, data, g_free);
+
+  /* valid bitmap */
+  bitmap[0] = 0x3ULL;
+  out = gst_tensor_sparse_to_dense (&meta, in);
+  EXPECT_TRUE (out != NULL);
+  gst_memory_unref (out);
+
+  /* more bits than nnz */
+  bitmap[0] = 0x7ULL;
+  out = gst_tensor_sparse_to_dense (&meta, in);
+  EXPECT_FALSE (out != NULL);
+
+  /* the bit out of the elements in the last word */
+  bitmap[0] = 0x1ULL;
+  bitmap[1] = 1ULL << 40;
+  out = gst_tensor_sparse_to_dense (&meta, in);
+  EXPECT_FALSE (out != NULL);
+
+  gst_memory_unref (in);
+}
+
+/**
+ * @brief Test for tensor_sparse util, the parameters of sparse encoding exceed the number of elements or data size.
+ */
+TEST (testTensorSparse, utilInvalidEncodingParams_n)
+{
+  GstTensorMetaInfo meta;
+  GstSparseTensorEncodingInfo sparse, parsed;
+  guint32 *header;
+
+  gst_tensor_meta_info_init (&meta);
+  meta.type = _NNS_FLOAT32;
+  meta.dimension[0] = 64U;
+
+  /* the data size exceeds 32-bit */
+  memset (&sparse, 0, sizeof (GstSparseTensorEncodingInfo));
+  sparse.encoding = _NNS_SPARSE_BLOCK;
+  sparse.block_size = 0x10000000U;
+  sparse.num_blocks = 16U;
+  EXPECT_FALSE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+
+  sparse.encoding = _NNS_SPARSE_BITMAP;
+  sparse.nnz = G_MAXUINT32;
+  EXPECT_FALSE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+
+  header = (guint32 *) g_malloc0 (gst_tensor_meta_info_get_header_size (&meta));
+
+  /* nnz exceeds the number of elements */
+  sparse.encoding = _NNS_SPARSE_BITMAP;
+  sparse.nnz = 65U;
+  ASSERT_TRUE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+  ASSERT_TRUE (gst_tensor_meta_info_update_sparse_header (&meta, &sparse, header));
+  EXPECT_FALSE (gst_tensor_meta_info_parse_sparse_header (&meta, &parsed, header));
+
+  /* the number of blocks exceeds the number of elements */
+  sparse.encoding = _NNS_SPARSE_BLOCK;
+  sparse.nnz = 0U;
+  sparse.block_size = 16U;
+  sparse.num_blocks = 5U;
+  ASSERT_TRUE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+  ASSERT_TRUE (gst_tensor_meta_info_update_sparse_header (&meta, &sparse, header));
+  EXPECT_FALSE (gst_tensor_meta_info_parse_sparse_header (&meta, &parsed, header));
+
+  sparse.num_blocks = 4U;
+  ASSERT_TRUE (gst_tensor_meta_info_set_sparse (&meta, &sparse));
+  ASSERT_TRUE (gst_tensor_meta_info_update_sparse_header (&meta, &sparse, header));
+  EXPECT_TRUE (gst_tensor_meta_info_parse_sparse_header (&meta, &parsed, header));
+
+  g_free (header);
+}
+
 /**
  * @brief Test for tensor_sparse util, invalid tensor-meta.
  */
@@ -7889,6 +9379,22 @@ TEST (testTensorSparse, encInvalidProperty_n)
   g_object_get (h->element, "silent", &res_bool, NULL);
   EXPECT_EQ (res_bool, !value_bool);
 
+  g_object_get (h->element, "encoding", &value_str, NULL);
+  EXPECT_STREQ (value_str, "coo");
+  g_free (value_str);
+
+  g_object_set (h->element, "encoding", "bitmap", NULL);
+  g_object_get (h->element, "encoding", &value_str, NULL);
+  EXPECT_STREQ (value_str, "bitmap");
+  g_free (value_str);
+
+  /* invalid encoding, set default (coo) */
+  g_object_set (h->element, "encoding", "invalid", NULL);
+  g_object_get (h->element, "encoding", &value_str, NULL);
+  EXPECT_STREQ (value_str, "coo");
+  g_free (value_str);
+  value_str = NULL;
+
   g_object_set (h->element, "invalid-prop", &value_str, NULL);
   EXPECT_FALSE (value_str != NULL);
 
@@ -7917,6 +9423,452 @@ TEST (testTensorSparse, decInvalidProperty_n)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Internal function to compress the tensor and check the decompressed data.
+ * @return The size of compressed tensor data, 0 on error.
+ */
+static gsize
+_codec_test_roundtrip (tensor_type type, gconstpointer values, guint count,
+    tensor_codec codec, tensor_codec_filter filter, tensor_codec_quant quant,
+    gdouble max_error, GstCompressedTensorInfo *result)
+{
+  GstMemory *compressed, *dense, *origin;
+  GstMapInfo map;
+  GstTensorInfo info;
+  GstTensorMetaInfo meta, parsed;
+  gchar *dim_str;
+  gsize data_size, size = 0;
+  gpointer data;
+  guint i, major = 0;
+
+  memset (result, 0, sizeof (GstCompressedTensorInfo));
+  gst_tensor_info_init (&info);
+  info.type = type;
+  dim_str = g_strdup_printf ("%u", count);
+  gst_tensor_parse_dimension (dim_str, info.dimension);
+  g_free (dim_str);
+  gst_tensor_info_convert_to_meta (&info, &meta);
+
+  data_size = gst_tensor_info_get_size (&info);
+  data = g_malloc (data_size);
+  memcpy (data, values, data_size);
+  origin = gst_memory_new_wrapped (
+      GST_MEMORY_FLAG_READONLY, data, data_size, 0, data_size, data, g_free);
+
+  compressed = gst_tensor_codec_encode (&meta, origin, codec, filter, quant, max_error);
+  EXPECT_TRUE (compressed != NULL);
+  if (compressed == NULL)
+    goto done;
+
+  EXPECT_EQ (meta.format, _NNS_TENSOR_FORMAT_COMPRESSED);
+  gst_tensor_meta_info_get_version (&meta, &major, NULL);
+  EXPECT_EQ (major, 2U);
+  EXPECT_EQ (gst_memory_get_sizes (compressed, NULL, NULL),
+      gst_tensor_meta_info_get_header_size (&meta)
+          + gst_tensor_meta_info_get_data_size (&meta));
+
+  /* the parameters of compressed data are kept in the header */
+  EXPECT_TRUE (gst_memory_map (compressed, &map, GST_MAP_READ));
+  EXPECT_TRUE (gst_tensor_meta_info_parse_compressed_header (&parsed, result, map.data));
+  EXPECT_EQ (result->size, meta.data_size);
+  gst_memory_unmap (compressed, &map);
+
+  dense = gst_tensor_codec_decode (&meta, compressed);
+  EXPECT_TRUE (dense != NULL);
+  if (dense) {
+    EXPECT_EQ (meta.format, _NNS_TENSOR_FORMAT_STATIC);
+    EXPECT_EQ (meta.type, (uint32_t) type);
+    EXPECT_TRUE (gst_memory_map (dense, &map, GST_MAP_READ));
+    EXPECT_EQ (map.size, data_size);
+
+    if (result->quant == _NNS_CODEC_QUANT_NONE) {
+      EXPECT_EQ (memcmp (map.data, values, data_size), 0);
+    } else {
+      for (i = 0; i < count; i++) {
+        EXPECT_LE (std::fabs (((gfloat *) map.data)[i] - ((const gfloat *) values)[i]),
+            (max_error > 0.0) ? max_error : 0.1);
+      }
+    }
+
+    gst_memory_unmap (dense, &map);
+    gst_memory_unref (dense);
+    size = result->size;
+  }
+
+  gst_memory_unref (compressed);
+
+done:
+  gst_memory_unref (origin);
+  gst_tensor_info_free (&info);
+  return size;
+}
+
+/**
+ * @brief Test for tensor_codec util, lossless compression with each filter.
+ */
+TEST (testTensorCodec, utilLosslessFilter)
+{
+  const guint count = 4096U;
+  gfloat *values = g_new0 (gfloat, count);
+  GstCompressedTensorInfo compressed;
+  gsize raw, shuffle, delta;
+  guint i;
+
+  /* smooth feature map */
+  for (i = 0; i < count; i++)
+    values[i] = std::sin (i * 0.01f) * 4.0f;
+
+  raw = _codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+      _NNS_CODEC_FILTER_NONE, _NNS_CODEC_QUANT_NONE, 0.0, &compressed);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_NONE);
+
+  shuffle = _codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+      _NNS_CODEC_FILTER_SHUFFLE, _NNS_CODEC_QUANT_NONE, 0.0, &compressed);
+  EXPECT_EQ (compressed.codec, (uint32_t) _NNS_CODEC_LZ);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_SHUFFLE);
+
+  delta = _codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+      _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_NONE, 0.0, &compressed);
+  EXPECT_EQ (compressed.codec, (uint32_t) _NNS_CODEC_LZ);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_DELTA);
+
+  EXPECT_GT (raw, 0U);
+  EXPECT_LT (shuffle, raw);
+  EXPECT_LT (delta, shuffle);
+
+  /* no compression, filter only */
+  EXPECT_EQ (_codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_NONE,
+                 _NNS_CODEC_FILTER_DELTA, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      count * sizeof (gfloat));
+  EXPECT_EQ (compressed.codec, (uint32_t) _NNS_CODEC_NONE);
+
+  g_free (values);
+}
+
+/**
+ * @brief Test for tensor_codec util, lossless compression of integer tensors.
+ */
+TEST (testTensorCodec, utilLosslessTypes)
+{
+  const guint count = 1000U;
+  GstCompressedTensorInfo compressed;
+  guint8 *u8 = g_new0 (guint8, count);
+  gint16 *i16 = g_new0 (gint16, count);
+  gint64 *i64 = g_new0 (gint64, count);
+  gdouble *f64 = g_new0 (gdouble, count);
+  guint i;
+
+  for (i = 0; i < count; i++) {
+    u8[i] = (guint8) (i / 10);
+    i16[i] = (gint16) (i * 3 - 1000);
+    i64[i] = (gint64) i * 100000LL;
+    f64[i] = i * 0.5;
+  }
+
+  EXPECT_GT (_codec_test_roundtrip (_NNS_UINT8, u8, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      0U);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_NONE);
+  EXPECT_GT (_codec_test_roundtrip (_NNS_INT16, i16, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      0U);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_SHUFFLE);
+  EXPECT_GT (_codec_test_roundtrip (_NNS_INT64, i64, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_DELTA, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      0U);
+
+  EXPECT_GT (_codec_test_roundtrip (_NNS_FLOAT64, f64, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      0U);
+  EXPECT_EQ (compressed.filter, (uint32_t) _NNS_CODEC_FILTER_DELTA);
+
+  /* quantization is ignored for integer tensors */
+  EXPECT_GT (_codec_test_roundtrip (_NNS_INT16, i16, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_INT8, 0.0, &compressed),
+      0U);
+  EXPECT_EQ (compressed.quant, (uint32_t) _NNS_CODEC_QUANT_NONE);
+
+  g_free (u8);
+  g_free (i16);
+  g_free (i64);
+  g_free (f64);
+}
+
+/**
+ * @brief Test for tensor_codec util, random data is stored without compression.
+ */
+TEST (testTensorCodec, utilIncompressible)
+{
+  const guint count = 4096U;
+  guint32 *values = g_new0 (guint32, count);
+  GstCompressedTensorInfo compressed;
+  guint i;
+
+  for (i = 0; i < count; i++)
+    values[i] = g_random_int ();
+
+  EXPECT_EQ (_codec_test_roundtrip (_NNS_UINT32, values, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_NONE, _NNS_CODEC_QUANT_NONE, 0.0, &compressed),
+      count * sizeof (guint32));
+  EXPECT_EQ (compressed.codec, (uint32_t) _NNS_CODEC_NONE);
+
+  g_free (values);
+}
+
+/**
+ * @brief Test for tensor_codec util, quantization with error bound.
+ */
+TEST (testTensorCodec, utilQuantization)
+{
+  const guint count = 2048U;
+  gfloat *values = g_new0 (gfloat, count);
+  GstCompressedTensorInfo compressed;
+  guint i;
+
+  for (i = 0; i < count; i++)
+    values[i] = std::cos (i * 0.02f) * 2.0f;
+
+  EXPECT_GT (_codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_FLOAT16, 0.001, &compressed),
+      0U);
+  EXPECT_EQ (compressed.quant, (uint32_t) _NNS_CODEC_QUANT_FLOAT16);
+
+  EXPECT_GT (_codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_INT8, 0.01, &compressed),
+      0U);
+  EXPECT_EQ (compressed.quant, (uint32_t) _NNS_CODEC_QUANT_INT8);
+  EXPECT_LT (compressed.size, count);
+
+  /* error exceeds the bound, keep the elements */
+  EXPECT_GT (_codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_INT8, 0.0001, &compressed),
+      0U);
+  EXPECT_EQ (compressed.quant, (uint32_t) _NNS_CODEC_QUANT_NONE);
+
+  /* overflow of float16 */
+  values[10] = 100000.0f;
+  EXPECT_GT (_codec_test_roundtrip (_NNS_FLOAT32, values, count, _NNS_CODEC_LZ,
+                 _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_FLOAT16, 0.0, &compressed),
+      0U);
+  EXPECT_EQ (compressed.quant, (uint32_t) _NNS_CODEC_QUANT_NONE);
+
+  g_free (values);
+}
+
+/**
+ * @brief Test for tensor_codec util, invalid tensor-meta and corrupted data.
+ */
+TEST (testTensorCodec, utilInvalidData_n)
+{
+  GstTensorMetaInfo meta;
+  GstCompressedTensorInfo compressed;
+  GstTensorInfo info;
+  GstMemory *in, *out, *corrupted;
+  GstMapInfo map;
+  guint8 *data;
+  gsize data_size = 4000U, header_size;
+
+  /* temporal data, unspecified tensor info. */
+  gst_tensor_meta_info_init (&meta);
+  data = (guint8 *) g_malloc0 (data_size);
+  in = gst_memory_new_wrapped (
+      GST_MEMORY_FLAG_READONLY, data, data_size, 0, data_size, data, g_free);
+
+  out = gst_tensor_codec_encode (&meta, in, _NNS_CODEC_LZ,
+      _NNS_CODEC_FILTER_END, _NNS_CODEC_QUANT_NONE, 0.0);
+  EXPECT_FALSE (out != NULL);
+
+  /* not a compressed tensor */
+  out = gst_tensor_codec_decode (&meta, in);
+  EXPECT_FALSE (out != NULL);
+
+  /* compressed tensor with broken data */
+  gst_tensor_info_init (&info);
+  info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4000", info.dimension);
+  gst_tensor_info_convert_to_meta (&info, &meta);
+
+  out = gst_tensor_codec_encode (&meta, in, _NNS_CODEC_LZ,
+      _NNS_CODEC_FILTER_NONE, _NNS_CODEC_QUANT_NONE, 0.0);
+  ASSERT_TRUE (out != NULL);
+
+  header_size = gst_tensor_meta_info_get_header_size (&meta);
+  ASSERT_TRUE (gst_memory_map (out, &map, GST_MAP_READ));
+  EXPECT_TRUE (gst_tensor_meta_info_parse_compressed_header (&meta, &compressed, map.data));
+  EXPECT_EQ (compressed.codec, (uint32_t) _NNS_CODEC_LZ);
+  data = (guint8 *) g_malloc (map.size);
+  memcpy (data, map.data, map.size);
+  corrupted = gst_memory_new_wrapped (
+      (GstMemoryFlags) 0, data, map.size, 0, map.size, data, g_free);
+  gst_memory_unmap (out, &map);
+
+  /* invalid offset of the first match */
+  data[header_size + 2] = 0xFF;
+  data[header_size + 3] = 0xFF;
+  EXPECT_FALSE (gst_tensor_codec_decode (&meta, corrupted) != NULL);
+
+  /* truncated data */
+  gst_memory_resize (out, 0, header_size + 2);
+  EXPECT_FALSE (gst_tensor_codec_decode (&meta, out) != NULL);
+
+  gst_memory_unref (corrupted);
+  gst_memory_unref (out);
+  gst_memory_unref (in);
+  gst_tensor_info_free (&info);
+}
+
+/**
+ * @brief Test for tensor_codec_enc and tensor_codec_dec, push tensors through the elements.
+ */
+TEST (testTensorCodec, encDecPushBuffer)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorsConfig config;
+  GstCaps *caps;
+  gfloat *values;
+  const guint count = 1024U;
+  guint i;
+
+  h = gst_harness_new_parse ("tensor_codec_enc ! tensor_codec_dec ! "
+      "other/tensors,format=static,num_tensors=1,dimensions=1024,types=float32,framerate=0/1");
+
+  gst_tensors_config_init (&config);
+  config.rate_n = 0;
+  config.rate_d = 1;
+  config.info.num_tensors = 1;
+  config.info.info[0].type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("1024", config.info.info[0].dimension);
+
+  caps = gst_tensors_caps_from_config (&config);
+  gst_harness_set_src_caps (h, caps);
+
+  in_buf = gst_harness_create_buffer (h, count * sizeof (gfloat));
+  mem = gst_buffer_peek_memory (in_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_WRITE));
+  values = (gfloat *) map.data;
+  for (i = 0; i < count; i++)
+    values[i] = (gfloat) i * 0.25f;
+  gst_memory_unmap (mem, &map);
+
+  EXPECT_EQ (gst_harness_push (h, gst_buffer_ref (in_buf)), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (out_buf != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (out_buf), 1U);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, count * sizeof (gfloat));
+  for (i = 0; i < count; i++)
+    EXPECT_FLOAT_EQ (((gfloat *) map.data)[i], (gfloat) i * 0.25f);
+  gst_memory_unmap (mem, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_buffer_unref (in_buf);
+  gst_tensors_config_free (&config);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_codec_enc, properties and invalid values.
+ */
+TEST (testTensorCodec, encProperties_n)
+{
+  GstHarness *h;
+  gboolean value_bool, res_bool;
+  gdouble value_double;
+  gchar *value_str = NULL;
+
+  h = gst_harness_new ("tensor_codec_enc");
+
+  g_object_get (h->element, "silent", &value_bool, NULL);
+  g_object_set (h->element, "silent", !value_bool, NULL);
+  g_object_get (h->element, "silent", &res_bool, NULL);
+  EXPECT_EQ (res_bool, !value_bool);
+
+  g_object_get (h->element, "codec", &value_str, NULL);
+  EXPECT_STREQ (value_str, "lz");
+  g_free (value_str);
+
+  g_object_set (h->element, "codec", "none", NULL);
+  g_object_get (h->element, "codec", &value_str, NULL);
+  EXPECT_STREQ (value_str, "none");
+  g_free (value_str);
+
+  g_object_get (h->element, "filter", &value_str, NULL);
+  EXPECT_STREQ (value_str, "auto");
+  g_free (value_str);
+
+  g_object_set (h->element, "filter", "shuffle", NULL);
+  g_object_get (h->element, "filter", &value_str, NULL);
+  EXPECT_STREQ (value_str, "shuffle");
+  g_free (value_str);
+
+  g_object_get (h->element, "quantization", &value_str, NULL);
+  EXPECT_STREQ (value_str, "none");
+  g_free (value_str);
+
+  g_object_set (h->element, "quantization", "float16", NULL);
+  g_object_get (h->element, "quantization", &value_str, NULL);
+  EXPECT_STREQ (value_str, "float16");
+  g_free (value_str);
+
+  g_object_get (h->element, "max-error", &value_double, NULL);
+  EXPECT_DOUBLE_EQ (value_double, 0.0);
+
+  g_object_set (h->element, "max-error", 0.01, NULL);
+  g_object_get (h->element, "max-error", &value_double, NULL);
+  EXPECT_DOUBLE_EQ (value_double, 0.01);
+
+  /* invalid values, set default */
+  g_object_set (h->element, "codec", "invalid", NULL);
+  g_object_get (h->element, "codec", &value_str, NULL);
+  EXPECT_STREQ (value_str, "lz");
+  g_free (value_str);
+
+  g_object_set (h->element, "filter", "invalid", NULL);
+  g_object_get (h->element, "filter", &value_str, NULL);
+  EXPECT_STREQ (value_str, "auto");
+  g_free (value_str);
+
+  g_object_set (h->element, "quantization", "invalid", NULL);
+  g_object_get (h->element, "quantization", &value_str, NULL);
+  EXPECT_STREQ (value_str, "none");
+  g_free (value_str);
+  value_str = NULL;
+
+  g_object_set (h->element, "invalid-prop", &value_str, NULL);
+  EXPECT_FALSE (value_str != NULL);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_codec_dec, invalid property name.
+ */
+TEST (testTensorCodec, decInvalidProperty_n)
+{
+  GstHarness *h;
+  gboolean value_bool, res_bool;
+  gchar *value_str = NULL;
+
+  h = gst_harness_new ("tensor_codec_dec");
+
+  g_object_get (h->element, "silent", &value_bool, NULL);
+  g_object_set (h->element, "silent", !value_bool, NULL);
+  g_object_get (h->element, "silent", &res_bool, NULL);
+  EXPECT_EQ (res_bool, !value_bool);
+
+  g_object_set (h->element, "invalid-prop", &value_str, NULL);
+  EXPECT_FALSE (value_str != NULL);
+
+  gst_harness_teardown (h);
+}
+
 /**
  * @brief Main function for unit test.
  */
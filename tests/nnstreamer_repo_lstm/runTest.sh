@@ -65,6 +65,24 @@ tensor_demux name=demux \
 
 callCompareTest lstm.golden out_9.log 1-1 "Compare 1-1" 1 0
 
+rm out_*.log
+
+# Same pipeline, tensor_repo keeps the buffers without copying them
+gstTest "--gst-plugin-path=../../build \
+tensor_mux name=mux sync-mode=nosync ! \
+tensor_filter framework=custom model=${LSTM_DIR}/libdummyLSTM.${SO_EXT} ! \
+tensor_demux name=demux \
+    demux.src_0 ! queue ! tensor_reposink slot-index=0 silent=false zero-copy=true \
+    demux.src_1 ! queue ! tee name=t \
+        t. ! queue ! tensor_reposink slot-index=1 silent=false zero-copy=true \
+        t. ! queue ! multifilesink location=\"out_%1d.log\" \
+    tensor_reposrc slot-index=0 silent=false caps=\"other/tensor,dimension=(string)4:4:4:1,type=(string)float32,framerate=(fraction)0/1\" ! mux.sink_0 \
+    tensor_reposrc slot-index=1 silent=false caps=\"other/tensor,dimension=(string)4:4:4:1,type=(string)float32,framerate=(fraction)0/1\" ! mux.sink_1 \
+    filesrc location=\"video_4x4xBGRx.xraw\" ! application/octet-stream ! tensor_converter input-dim=4:4:4:1 input-type=float32 ! mux.sink_2" \
+2 0 0 $PERFORMANCE
+
+callCompareTest lstm.golden out_9.log 2-1 "Compare 2-1 (zero-copy)" 1 0
+
 rm *.log *.xraw *.golden
 
 report
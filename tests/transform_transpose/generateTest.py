@@ -38,6 +38,27 @@ def save_test_data(filename, channel, height, width, batch, idx_i, idx_j, idx_k,
         file1.write(a)
 
 
+def save_test_data_nd(filename, dims, order):
+    # dims and order are given in the order of nnstreamer (innermost first)
+    rank = len(dims)
+    data = [random.uniform(0.0, 10.0) for _ in range(int(np.prod(dims)))]
+
+    string = pack('%df' % (len(data)), *data)
+    with open(filename, 'wb') as file:
+        file.write(string)
+
+    a = np.array(data, np.float32).reshape(tuple(reversed(dims)))
+    axes = [rank - 1 - order[rank - 1 - i] for i in range(rank)]
+    a = np.transpose(a, axes).copy(order='C')
+
+    with open(filename + '.golden', 'wb') as file1:
+        file1.write(a)
+
+
 save_test_data('test01_00.dat', 3, 50, 100, 1, 0, 2, 3, 1)
 save_test_data('test02_00.dat', 3, 100, 200, 1, 0, 2, 3, 1)
 save_test_data('test03_00.dat', 3, 100, 200, 1, 0, 1, 3, 2)
+save_test_data_nd('test04_00.dat', [10, 50, 3, 1, 10], [2, 0, 4, 3, 1])
+save_test_data_nd('test05_00.dat', [3, 64, 48, 4], [3, 0, 1, 2])
+save_test_data_nd('test06_00.dat', [37, 21], [1, 0])
+save_test_data_nd('test07_00.dat', [3, 40, 20, 2], [1, 0, 2, 3])
@@ -68,8 +68,28 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test01_%02d
 
 callCompareTest test01_00.dat.golden result06_00.log 6 "Compare 6" 1 0
 
-# transform_transpose now only support rank 4
-gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test01_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=10:50:3:1:10 input-type=float32 ! tensor_transform mode=transpose option=2:0:1:3:4 ! multifilesink location=\"./result07_%02d.log\" sync=true" 7_n 0 1 $PERFORMANCE
+# Transpose with rank 5
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test04_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=10:50:3:1:10 input-type=float32 ! tensor_transform mode=transpose option=2:0:4:3:1 ! multifilesink location=\"./result07_%02d.log\" sync=true" 7 0 0 $PERFORMANCE
+
+callCompareTest test04_00.dat.golden result07_00.log 7 "Compare 7" 1 0
+
+# Move the last dimension to the first
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test05_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=3:64:48:4 input-type=float32 ! tensor_transform mode=transpose option=3:0:1:2 ! multifilesink location=\"./result08_%02d.log\" sync=true" 8 0 0 $PERFORMANCE
+
+callCompareTest test05_00.dat.golden result08_00.log 8 "Compare 8" 1 0
+
+# Transpose with rank 2
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test06_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=37:21 input-type=float32 ! tensor_transform mode=transpose option=1:0 ! multifilesink location=\"./result09_%02d.log\" sync=true" 9 0 0 $PERFORMANCE
+
+callCompareTest test06_00.dat.golden result09_00.log 9 "Compare 9" 1 0
+
+# The option rank is lower than the tensor rank, the outer dimensions are not changed
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test07_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=3:40:20:2 input-type=float32 ! tensor_transform mode=transpose option=1:0 ! other/tensor,dimension=40:3:20:2 ! multifilesink location=\"./result11_%02d.log\" sync=true" 11 0 0 $PERFORMANCE
+
+callCompareTest test07_00.dat.golden result11_00.log 11 "Compare 11" 1 0
+
+# Invalid permutation
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"test01_%02d.dat\" caps=\"application/octet-stream\" ! tensor_converter input-dim=100:50:3:1 input-type=float32 ! tensor_transform mode=transpose option=2:0:0:3 ! multifilesink location=\"./result10_%02d.log\" sync=true" 10_n 0 1 $PERFORMANCE
 
 rm *.log *.bmp *.png *.golden *.raw *.dat
 
@@ -0,0 +1,752 @@
+/* SPDX-License-Identifier: LGPL-2.1-only */
+/**
+ * NNStreamer Benchmark Utility
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ */
+/**
+ * @file	bench.c
+ * @date	16 Oct 2026
+ * @brief	Throughput benchmark of the core nnstreamer elements
+ * @see		http://github.com/nnstreamer/nnstreamer
+ * @bug		No known bugs except for NYI items
+ *
+ * This is a utility for nnstreamer developers.
+ * Each case runs a pipeline "appsrc ! <element> ! fakesink" with synthetic tensors
+ * and reports the throughput (fps, ns/frame) and the memory allocations per frame
+ * of the default GstAllocator.
+ *
+ * Internal mechanism:
+ *   The input memories are allocated once and shared by all frames,
+ *   thus the allocations counted are done by the elements under test.
+ *   The default GstAllocator is replaced with a counting allocator,
+ *   which forwards the requests to the original default allocator.
+ *   Only the allocations of the default GstAllocator are counted;
+ *   g_malloc in the elements and subplugins, or a custom allocator, are not.
+ *   The measured time is from the first push of the data to the EOS message.
+ *   Each line of the result is a JSON object (or CSV with --format=csv).
+ */
+#include <string.h>
+#include <glib.h>
+#include <gmodule.h>
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+
+#ifndef BENCH_CUSTOM_FILTER_DIR
+#define BENCH_CUSTOM_FILTER_DIR "."
+#endif
+
+#define BENCH_MAX_SRCS (2)
+#define BENCH_MAX_MEMS (2)
+#define BENCH_FRAME_DURATION (GST_SECOND / 30)
+#define BENCH_TIMEOUT (60 * GST_SECOND)
+
+/**
+ * @brief Element type of the synthetic data.
+ */
+typedef enum
+{
+  BENCH_TYPE_UINT8 = 0,
+  BENCH_TYPE_INT16,
+  BENCH_TYPE_FLOAT32,
+} bench_type;
+
+/**
+ * @brief Data structure for a benchmark case.
+ */
+typedef struct
+{
+  gchar *group; /**< The group of the case (element name) */
+  gchar *name; /**< The name of the case */
+  gchar *caps; /**< The caps of appsrc */
+  gchar *launch; /**< Pipeline description. appsrc is named srcN and the sink to count the frames is named sink. */
+  guint num_srcs; /**< The number of appsrc */
+  guint num_mems; /**< The number of memories in a buffer */
+  gsize mem_size; /**< The size of each memory */
+  bench_type type; /**< Element type to fill the synthetic data */
+} BenchCase;
+
+/**
+ * @brief Data structure for the result of a case.
+ */
+typedef struct
+{
+  guint frames; /**< The number of frames pushed into each appsrc */
+  gint64 elapsed_ns; /**< Time from the first push to EOS */
+  gint allocs; /**< The number of memory allocations */
+  gsize alloc_bytes; /**< The total size of the allocated memories */
+} BenchResult;
+
+/**
+ * @brief Counting allocator. Forwards all requests to the original default allocator.
+ */
+typedef struct
+{
+  GstAllocator parent;
+
+  GstAllocator *base; /**< The original default allocator */
+} BenchAllocator;
+
+/**
+ * @brief Class of the counting allocator.
+ */
+typedef struct
+{
+  GstAllocatorClass parent_class;
+} BenchAllocatorClass;
+
+static gint bench_num_allocs = 0;
+static gssize bench_alloc_bytes = 0;
+
+GType bench_allocator_get_type (void);
+G_DEFINE_TYPE (BenchAllocator, bench_allocator, GST_TYPE_ALLOCATOR);
+
+/**
+ * @brief Count and allocate the memory with the original allocator.
+ */
+static GstMemory *
+bench_allocator_alloc (GstAllocator * allocator, gsize size,
+    GstAllocationParams * params)
+{
+  BenchAllocator *self = (BenchAllocator *) allocator;
+
+  g_atomic_int_inc (&bench_num_allocs);
+  g_atomic_pointer_add (&bench_alloc_bytes, (gssize) size);
+
+  return gst_allocator_alloc (self->base, size, params);
+}
+
+/**
+ * @brief Free the memory. The memory is owned by the original allocator, thus this is not called normally.
+ */
+static void
+bench_allocator_free (GstAllocator * allocator, GstMemory * memory)
+{
+  BenchAllocator *self = (BenchAllocator *) allocator;
+
+  gst_allocator_free (self->base, memory);
+}
+
+/**
+ * @brief Finalize the counting allocator.
+ */
+static void
+bench_allocator_finalize (GObject * object)
+{
+  BenchAllocator *self = (BenchAllocator *) object;
+
+  gst_object_unref (self->base);
+
+  G_OBJECT_CLASS (bench_allocator_parent_class)->finalize (object);
+}
+
+/**
+ * @brief Initialize the class of counting allocator.
+ */
+static void
+bench_allocator_class_init (BenchAllocatorClass * klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+  GstAllocatorClass *allocator_class = GST_ALLOCATOR_CLASS (klass);
+
+  object_class->finalize = bench_allocator_finalize;
+  allocator_class->alloc = bench_allocator_alloc;
+  allocator_class->free = bench_allocator_free;
+}
+
+/**
+ * @brief Initialize the counting allocator.
+ */
+static void
+bench_allocator_init (BenchAllocator * self)
+{
+  self->base = gst_allocator_find (NULL);
+}
+
+/**
+ * @brief Replace the default allocator with the counting allocator.
+ */
+static void
+bench_allocator_install (void)
+{
+  GstAllocator *allocator;
+
+  allocator = g_object_new (bench_allocator_get_type (), NULL);
+  gst_object_ref_sink (allocator);
+
+  gst_allocator_register ("NnsBenchAllocator", gst_object_ref (allocator));
+  gst_allocator_set_default (allocator);
+}
+
+/**
+ * @brief Clear the allocation counters.
+ */
+static void
+bench_allocator_reset (void)
+{
+  g_atomic_int_set (&bench_num_allocs, 0);
+  g_atomic_pointer_set (&bench_alloc_bytes, 0);
+}
+
+/**
+ * @brief Add a case into the list.
+ */
+static void
+bench_add_case (GPtrArray * cases, const gchar * group, gchar * name,
+    gchar * caps, gchar * launch, guint num_srcs, guint num_mems,
+    gsize mem_size, bench_type type)
+{
+  BenchCase *bc = g_new0 (BenchCase, 1);
+
+  bc->group = g_strdup (group);
+  bc->name = name;
+  bc->caps = caps;
+  bc->launch = launch;
+  bc->num_srcs = num_srcs;
+  bc->num_mems = num_mems;
+  bc->mem_size = mem_size;
+  bc->type = type;
+
+  g_ptr_array_add (cases, bc);
+}
+
+/**
+ * @brief Free the case.
+ */
+static void
+bench_free_case (gpointer data)
+{
+  BenchCase *bc = (BenchCase *) data;
+
+  g_free (bc->group);
+  g_free (bc->name);
+  g_free (bc->caps);
+  g_free (bc->launch);
+  g_free (bc);
+}
+
+/**
+ * @brief Get the caps string of static tensors.
+ */
+static gchar *
+bench_tensors_caps (guint num, const gchar * dim, const gchar * type)
+{
+  GString *dims = g_string_new (NULL);
+  GString *types = g_string_new (NULL);
+  gchar *caps;
+  guint i;
+
+  for (i = 0; i < num; i++) {
+    if (i > 0) {
+      g_string_append_c (dims, ',');
+      g_string_append_c (types, ',');
+    }
+
+    g_string_append (dims, dim);
+    g_string_append (types, type);
+  }
+
+  caps = g_strdup_printf ("other/tensors,format=static,num_tensors=%u,"
+      "dimensions=(string)\"%s\",types=(string)\"%s\",framerate=(fraction)30/1",
+      num, dims->str, types->str);
+
+  g_string_free (dims, TRUE);
+  g_string_free (types, TRUE);
+  return caps;
+}
+
+/**
+ * @brief Make the list of benchmark cases.
+ */
+static GPtrArray *
+bench_make_cases (const gchar * custom_dir)
+{
+  static const struct
+  {
+    const gchar *dim;
+    const gchar *sub; /**< dimension except the first one (channel) */
+    gsize count;
+  } sizes[] = {
+    {"3:32:32:1", "32:32:1", 3 * 32 * 32},
+    {"3:224:224:1", "224:224:1", 3 * 224 * 224},
+  };
+  static const struct
+  {
+    const gchar *name;
+    bench_type type;
+    gsize size;
+    const gchar *cast; /**< the type to cast */
+  } types[] = {
+    {"uint8", BENCH_TYPE_UINT8, 1, "float32"},
+    {"float32", BENCH_TYPE_FLOAT32, 4, "uint8"},
+  };
+  static const struct
+  {
+    const gchar *mode;
+    const gchar *option; /**< NULL for typecast */
+  } transforms[] = {
+    {"typecast", NULL},
+    {"arithmetic", "typecast:float32,add:-127.5,div:127.5"},
+    {"dimchg", "0:2"},
+    {"transpose", "1:2:0:3"},
+    {"stand", "default"},
+    {"clamp", "0:100"},
+    {"padding", "left:1,right:1,top:1,bottom:1,layout:NHWC"},
+  };
+  GPtrArray *cases;
+  gchar *model;
+  guint s, t, m;
+
+  cases = g_ptr_array_new_with_free_func (bench_free_case);
+
+  for (s = 0; s < G_N_ELEMENTS (sizes); s++) {
+    for (t = 0; t < G_N_ELEMENTS (types); t++) {
+      const gchar *dim = sizes[s].dim;
+      const gchar *type = types[t].name;
+      gsize size = sizes[s].count * types[t].size;
+
+#define TENSOR_CASE(g,n,l,srcs,mems) \
+      bench_add_case (cases, g, g_strdup_printf ("%s/%s/%s", n, dim, type), \
+          bench_tensors_caps (mems, dim, type), l, srcs, mems, size, types[t].type)
+
+      /* tensor_transform, every mode */
+      for (m = 0; m < G_N_ELEMENTS (transforms); m++) {
+        TENSOR_CASE ("tensor_transform", transforms[m].mode,
+            g_strdup_printf ("appsrc name=src0 ! tensor_transform mode=%s "
+                "option=%s ! fakesink name=sink sync=false",
+                transforms[m].mode, transforms[m].option ?
+                transforms[m].option : types[t].cast), 1, 1);
+      }
+
+      /* tensor_converter, octet stream */
+      bench_add_case (cases, "tensor_converter",
+          g_strdup_printf ("octet/%s/%s", dim, type),
+          g_strdup ("application/octet-stream,framerate=(fraction)30/1"),
+          g_strdup_printf ("appsrc name=src0 ! tensor_converter "
+              "input-dim=%s input-type=%s ! fakesink name=sink sync=false",
+              dim, type), 1, 1, size, types[t].type);
+
+      /* tensor_merge, tensor_mux, tensor_demux, tensor_split */
+      TENSOR_CASE ("tensor_merge", "linear",
+          g_strdup ("tensor_merge name=m mode=linear option=3 sync-mode=nosync "
+              "! fakesink name=sink sync=false "
+              "appsrc name=src0 ! m.sink_0 appsrc name=src1 ! m.sink_1"), 2, 1);
+      TENSOR_CASE ("tensor_merge", "linear-channel",
+          g_strdup ("tensor_merge name=m mode=linear option=0 sync-mode=nosync "
+              "! fakesink name=sink sync=false "
+              "appsrc name=src0 ! m.sink_0 appsrc name=src1 ! m.sink_1"), 2, 1);
+      TENSOR_CASE ("tensor_mux", "mux",
+          g_strdup ("tensor_mux name=m sync-mode=nosync "
+              "! fakesink name=sink sync=false "
+              "appsrc name=src0 ! m.sink_0 appsrc name=src1 ! m.sink_1"), 2, 1);
+      TENSOR_CASE ("tensor_demux", "demux",
+          g_strdup ("appsrc name=src0 ! tensor_demux name=d "
+              "d.src_0 ! queue ! fakesink name=sink sync=false "
+              "d.src_1 ! queue ! fakesink sync=false"), 1, 2);
+      TENSOR_CASE ("tensor_split", "split",
+          g_strdup_printf ("appsrc name=src0 ! tensor_split name=s "
+              "tensorseg=1:%s,2:%s s.src_0 ! queue ! fakesink name=sink "
+              "sync=false s.src_1 ! queue ! fakesink sync=false",
+              sizes[s].sub, sizes[s].sub), 1, 1);
+
+      /* tensor_aggregator */
+      TENSOR_CASE ("tensor_aggregator", "frames-out-4",
+          g_strdup ("appsrc name=src0 ! tensor_aggregator frames-in=1 "
+              "frames-out=4 frames-flush=4 frames-dim=3 "
+              "! fakesink name=sink sync=false"), 1, 1);
+
+      /* tensor_sparse_enc, tensor_sparse_dec (90% of the data is zero) */
+      TENSOR_CASE ("tensor_sparse", "enc",
+          g_strdup ("appsrc name=src0 ! tensor_sparse_enc "
+              "! fakesink name=sink sync=false"), 1, 1);
+      TENSOR_CASE ("tensor_sparse", "enc-dec",
+          g_strdup ("appsrc name=src0 ! tensor_sparse_enc ! tensor_sparse_dec "
+              "! fakesink name=sink sync=false"), 1, 1);
+
+      /* tensor_codec_enc, tensor_codec_dec */
+      TENSOR_CASE ("tensor_codec", "enc",
+          g_strdup ("appsrc name=src0 ! tensor_codec_enc "
+              "! fakesink name=sink sync=false"), 1, 1);
+      TENSOR_CASE ("tensor_codec", "enc-dec",
+          g_strdup ("appsrc name=src0 ! tensor_codec_enc ! tensor_codec_dec "
+              "! fakesink name=sink sync=false"), 1, 1);
+
+      /* tensor_filter, custom passthrough with the dimension of input */
+      model = g_strdup_printf ("%s/libnnstreamer_customfilter_passthrough_variable.%s",
+          custom_dir, G_MODULE_SUFFIX);
+      TENSOR_CASE ("tensor_filter", "custom-passthrough-variable",
+          g_strdup_printf ("appsrc name=src0 ! tensor_filter framework=custom "
+              "model=%s ! fakesink name=sink sync=false", model), 1, 1);
+      g_free (model);
+
+#undef TENSOR_CASE
+    }
+  }
+
+  /* tensor_filter, custom passthrough (fixed dimension 3:280:40:1 uint8) */
+  model = g_strdup_printf ("%s/libnnstreamer_customfilter_passthrough.%s",
+      custom_dir, G_MODULE_SUFFIX);
+  bench_add_case (cases, "tensor_filter",
+      g_strdup ("custom-passthrough/3:280:40:1/uint8"),
+      bench_tensors_caps (1, "3:280:40:1", "uint8"),
+      g_strdup_printf ("appsrc name=src0 ! tensor_filter framework=custom "
+          "model=%s ! fakesink name=sink sync=false", model),
+      1, 1, 3 * 280 * 40, BENCH_TYPE_UINT8);
+  g_free (model);
+
+  /* tensor_converter, video and audio */
+  bench_add_case (cases, "tensor_converter", g_strdup ("video/RGB/224x224"),
+      g_strdup ("video/x-raw,format=RGB,width=224,height=224,"
+          "framerate=(fraction)30/1"),
+      g_strdup ("appsrc name=src0 ! tensor_converter "
+          "! fakesink name=sink sync=false"),
+      1, 1, 3 * 224 * 224, BENCH_TYPE_UINT8);
+  bench_add_case (cases, "tensor_converter", g_strdup ("video/RGB/640x480"),
+      g_strdup ("video/x-raw,format=RGB,width=640,height=480,"
+          "framerate=(fraction)30/1"),
+      g_strdup ("appsrc name=src0 ! tensor_converter "
+          "! fakesink name=sink sync=false"),
+      1, 1, 3 * 640 * 480, BENCH_TYPE_UINT8);
+  bench_add_case (cases, "tensor_converter",
+      g_strdup ("preprocess/NV12/1280x720/224x224/float32"),
+      g_strdup ("video/x-raw,format=NV12,width=1280,height=720,"
+          "framerate=(fraction)30/1"),
+      g_strdup ("appsrc name=src0 ! tensor_converter "
+          "mode=preprocess:width:224,height:224,type:float32,add:-127.5,div:127.5 "
+          "! fakesink name=sink sync=false"),
+      1, 1, 1280 * 720 * 3 / 2, BENCH_TYPE_UINT8);
+  bench_add_case (cases, "tensor_converter", g_strdup ("audio/S16LE/1600"),
+      g_strdup ("audio/x-raw,format=S16LE,rate=16000,channels=1,"
+          "layout=interleaved"),
+      g_strdup ("appsrc name=src0 ! tensor_converter frames-per-tensor=1600 "
+          "! fakesink name=sink sync=false"),
+      1, 1, 2 * 1600, BENCH_TYPE_INT16);
+
+  return cases;
+}
+
+/**
+ * @brief Allocate the memory filled with synthetic data. Every 10th element is 1, the others are 0.
+ */
+static GstMemory *
+bench_make_memory (gsize size, bench_type type)
+{
+  GstMemory *mem;
+  GstMapInfo map;
+  gsize i;
+
+  mem = gst_allocator_alloc (NULL, size, NULL);
+  if (!mem || !gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+    if (mem)
+      gst_memory_unref (mem);
+    return NULL;
+  }
+
+  memset (map.data, 0, map.size);
+
+  switch (type) {
+    case BENCH_TYPE_UINT8:
+      for (i = 0; i < map.size; i += 10)
+        ((guint8 *) map.data)[i] = 1;
+      break;
+    case BENCH_TYPE_INT16:
+      for (i = 0; i < map.size / sizeof (gint16); i += 10)
+        ((gint16 *) map.data)[i] = 1;
+      break;
+    case BENCH_TYPE_FLOAT32:
+      for (i = 0; i < map.size / sizeof (gfloat); i += 10)
+        ((gfloat *) map.data)[i] = 1.0f;
+      break;
+  }
+
+  gst_memory_unmap (mem, &map);
+  return mem;
+}
+
+/**
+ * @brief Run the pipeline of the case and push the frames.
+ * @return TRUE if the pipeline reaches EOS.
+ */
+static gboolean
+bench_run (const BenchCase * bc, guint frames, BenchResult * result,
+    gchar ** error)
+{
+  GstElement *pipeline;
+  GstElement *src[BENCH_MAX_SRCS] = { NULL, };
+  GstMemory *mem[BENCH_MAX_MEMS] = { NULL, };
+  GstCaps *caps = NULL;
+  GstBus *bus = NULL;
+  GstMessage *msg = NULL;
+  GError *err = NULL;
+  gboolean ret = FALSE;
+  gint64 start;
+  guint i, j, f;
+
+  pipeline = gst_parse_launch (bc->launch, &err);
+  if (!pipeline || err) {
+    *error = g_strdup (err ? err->message : "failed to parse the pipeline");
+    g_clear_error (&err);
+    goto done;
+  }
+
+  caps = gst_caps_from_string (bc->caps);
+  for (i = 0; i < bc->num_srcs; i++) {
+    gchar *name = g_strdup_printf ("src%u", i);
+
+    src[i] = gst_bin_get_by_name (GST_BIN (pipeline), name);
+    g_free (name);
+
+    if (!src[i]) {
+      *error = g_strdup ("failed to get appsrc");
+      goto done;
+    }
+
+    g_object_set (src[i], "caps", caps, "format", GST_FORMAT_TIME,
+        "block", TRUE, "max-bytes", (guint64) (bc->mem_size * bc->num_mems * 8),
+        NULL);
+  }
+
+  for (i = 0; i < bc->num_mems; i++) {
+    mem[i] = bench_make_memory (bc->mem_size, bc->type);
+    if (!mem[i]) {
+      *error = g_strdup ("failed to allocate the input memory");
+      goto done;
+    }
+  }
+
+  bus = gst_element_get_bus (pipeline);
+
+  if (gst_element_set_state (pipeline, GST_STATE_PLAYING) ==
+      GST_STATE_CHANGE_FAILURE) {
+    *error = g_strdup ("failed to start the pipeline");
+    goto done;
+  }
+
+  bench_allocator_reset ();
+  start = g_get_monotonic_time ();
+
+  for (f = 0; f < frames; f++) {
+    for (i = 0; i < bc->num_srcs; i++) {
+      GstBuffer *buffer = gst_buffer_new ();
+
+      for (j = 0; j < bc->num_mems; j++)
+        gst_buffer_append_memory (buffer, gst_memory_ref (mem[j]));
+
+      GST_BUFFER_PTS (buffer) = f * BENCH_FRAME_DURATION;
+      GST_BUFFER_DURATION (buffer) = BENCH_FRAME_DURATION;
+
+      if (gst_app_src_push_buffer (GST_APP_SRC (src[i]), buffer) != GST_FLOW_OK) {
+        *error = g_strdup ("failed to push the buffer");
+        goto stop;
+      }
+    }
+  }
+
+  for (i = 0; i < bc->num_srcs; i++)
+    gst_app_src_end_of_stream (GST_APP_SRC (src[i]));
+
+  msg = gst_bus_timed_pop_filtered (bus, BENCH_TIMEOUT,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+
+  result->elapsed_ns = (g_get_monotonic_time () - start) * 1000;
+  result->frames = frames;
+  result->allocs = g_atomic_int_get (&bench_num_allocs);
+  result->alloc_bytes = (gsize) g_atomic_pointer_get (&bench_alloc_bytes);
+
+  if (!msg) {
+    *error = g_strdup ("timeout");
+  } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    gst_message_parse_error (msg, &err, NULL);
+    *error = g_strdup (err ? err->message : "unknown error");
+    g_clear_error (&err);
+  } else {
+    ret = TRUE;
+  }
+
+stop:
+  if (!ret) {
+    /* Check the error message posted while pushing the buffers. */
+    if (!msg)
+      msg = gst_bus_pop_filtered (bus, GST_MESSAGE_ERROR);
+
+    if (msg && GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+      gst_message_parse_error (msg, &err, NULL);
+      g_free (*error);
+      *error = g_strdup (err ? err->message : "unknown error");
+      g_clear_error (&err);
+    }
+  }
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+
+done:
+  if (msg)
+    gst_message_unref (msg);
+  if (bus)
+    gst_object_unref (bus);
+  if (caps)
+    gst_caps_unref (caps);
+
+  for (i = 0; i < BENCH_MAX_MEMS; i++) {
+    if (mem[i])
+      gst_memory_unref (mem[i]);
+  }
+
+  for (i = 0; i < BENCH_MAX_SRCS; i++) {
+    if (src[i])
+      gst_object_unref (src[i]);
+  }
+
+  if (pipeline)
+    gst_object_unref (pipeline);
+
+  return ret;
+}
+
+/**
+ * @brief Print the result of the case.
+ */
+static void
+bench_print (const BenchCase * bc, const BenchResult * result,
+    const gchar * error, gboolean csv)
+{
+  gdouble fps = 0.0, ns_per_frame = 0.0;
+  gdouble allocs_per_frame = 0.0, bytes_per_frame = 0.0;
+
+  if (!error && result->frames > 0 && result->elapsed_ns > 0) {
+    fps = (gdouble) result->frames * G_GINT64_CONSTANT (1000000000) /
+        result->elapsed_ns;
+    ns_per_frame = (gdouble) result->elapsed_ns / result->frames;
+    allocs_per_frame = (gdouble) result->allocs / result->frames;
+    bytes_per_frame = (gdouble) result->alloc_bytes / result->frames;
+  }
+
+  if (csv) {
+    g_print ("%s,%s,%" G_GSIZE_FORMAT ",%u,%.2f,%.1f,%.3f,%.1f,%s\n",
+        bc->group, bc->name, bc->mem_size * bc->num_mems, result->frames,
+        fps, ns_per_frame, allocs_per_frame, bytes_per_frame,
+        error ? error : "");
+  } else {
+    g_print ("{\"group\": \"%s\", \"case\": \"%s\", \"frame_bytes\": %"
+        G_GSIZE_FORMAT ", \"frames\": %u, \"fps\": %.2f, \"ns_per_frame\": %.1f, "
+        "\"default_allocs_per_frame\": %.3f, \"default_alloc_bytes_per_frame\": %.1f",
+        bc->group, bc->name, bc->mem_size * bc->num_mems, result->frames,
+        fps, ns_per_frame, allocs_per_frame, bytes_per_frame);
+
+    if (error) {
+      gchar *escaped = g_strescape (error, NULL);
+
+      g_print (", \"error\": \"%s\"", escaped);
+      g_free (escaped);
+    }
+
+    g_print ("}\n");
+  }
+}
+
+/**
+ * @brief Main routine of the benchmark
+ */
+int
+main (int argc, char *argv[])
+{
+  gint frames = 1000;
+  gint warmup = 50;
+  gchar *filter = NULL;
+  gchar *format = NULL;
+  gchar *custom_dir = NULL;
+  gboolean list = FALSE;
+  gboolean csv = FALSE;
+  GOptionEntry entries[] = {
+    {"frames", 'n', 0, G_OPTION_ARG_INT, &frames,
+        "The number of frames to be measured (default 1000)", "N"},
+    {"warmup", 'w', 0, G_OPTION_ARG_INT, &warmup,
+        "The number of frames of the warm-up run (default 50, 0 to skip)", "N"},
+    {"filter", 'f', 0, G_OPTION_ARG_STRING, &filter,
+        "Run the cases matched with the glob pattern of \"group/case\"", "PATTERN"},
+    {"format", 0, 0, G_OPTION_ARG_STRING, &format,
+        "The format of the result, json (default) or csv", "FORMAT"},
+    {"custom-dir", 0, 0, G_OPTION_ARG_FILENAME, &custom_dir,
+        "The directory of the custom filter examples", "DIR"},
+    {"list", 'l', 0, G_OPTION_ARG_NONE, &list, "List the cases", NULL},
+    {NULL}
+  };
+  GOptionContext *ctx;
+  GError *err = NULL;
+  GPtrArray *cases;
+  guint i;
+
+  ctx = g_option_context_new ("- benchmark of nnstreamer elements");
+  g_option_context_add_main_entries (ctx, entries, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_printerr ("Failed to parse the options: %s\n", err->message);
+    g_clear_error (&err);
+    g_option_context_free (ctx);
+    return 1;
+  }
+  g_option_context_free (ctx);
+
+  if (frames <= 0) {
+    g_printerr ("The number of frames should be a positive number.\n");
+    return 1;
+  }
+
+  if (format) {
+    if (g_ascii_strcasecmp (format, "csv") == 0) {
+      csv = TRUE;
+    } else if (g_ascii_strcasecmp (format, "json") != 0) {
+      g_printerr ("Unknown format %s.\n", format);
+      return 1;
+    }
+  }
+
+  gst_init (&argc, &argv);
+  bench_allocator_install ();
+
+  cases = bench_make_cases (custom_dir ? custom_dir : BENCH_CUSTOM_FILTER_DIR);
+
+  if (csv && !list) {
+    g_print ("group,case,frame_bytes,frames,fps,ns_per_frame,"
+        "default_allocs_per_frame,default_alloc_bytes_per_frame,error\n");
+  }
+
+  for (i = 0; i < cases->len; i++) {
+    BenchCase *bc = g_ptr_array_index (cases, i);
+    BenchResult result = { 0, };
+    gchar *full_name, *error = NULL;
+    gboolean matched;
+
+    full_name = g_strdup_printf ("%s/%s", bc->group, bc->name);
+    matched = (filter == NULL || g_pattern_match_simple (filter, full_name));
+    g_free (full_name);
+
+    if (!matched)
+      continue;
+
+    if (list) {
+      g_print ("%s/%s\n", bc->group, bc->name);
+      continue;
+    }
+
+    if (warmup > 0 && !bench_run (bc, warmup, &result, &error)) {
+      memset (&result, 0, sizeof (result));
+    } else {
+      g_free (error);
+      error = NULL;
+      memset (&result, 0, sizeof (result));
+      bench_run (bc, frames, &result, &error);
+    }
+
+    bench_print (bc, &result, error, csv);
+    g_free (error);
+  }
+
+  g_ptr_array_free (cases, TRUE);
+  g_free (filter);
+  g_free (format);
+  g_free (custom_dir);
+
+  gst_deinit ();
+  return 0;
+}